@@ -170,3 +170,12 @@ address JNI_FastGetField::generate_fast_get_float_field() {
 address JNI_FastGetField::generate_fast_get_double_field() {
   return generate_fast_get_int_field0(T_DOUBLE);
 }
+
+address JNI_FastGetField::generate_fast_get_int_array_region() {
+  // Fast array region copies are not implemented on this platform.
+  return (address)-1;
+}
+
+address JNI_FastGetField::generate_fast_get_long_array_region() {
+  return (address)-1;
+}
@@ -1548,6 +1548,9 @@ private:
 
   // Move Unaligned 256bit Vector
   void vmovdqu(Address dst, XMMRegister src);
+
+  // Move Aligned Double Quadword Non-Temporal (256-bit store)
+  void vmovntdq(Address dst, XMMRegister src);
   void vmovdqu(XMMRegister dst, Address src);
   void vmovdqu(XMMRegister dst, XMMRegister src);
 
@@ -138,6 +138,11 @@ define_pd_global(intx, InitArrayShortSize, 8*BytesPerLong);
   product(bool, UseUnalignedLoadStores, false,                              \
           "Use SSE2 MOVDQU instruction for Arraycopy")                      \
                                                                             \
+  product(uintx, NonTemporalFillThreshold, 1*M,                             \
+          "Fills of at least this many bytes use non-temporal stores "      \
+          "in the fill stubs, bypassing the caches (0 disables)")           \
+          range(0, max_jint)                                                \
+                                                                            \
   product(bool, UseXMMForObjInit, false,                                    \
           "Use XMM/YMM MOVDQU instruction for Object Initialization")       \
                                                                             \
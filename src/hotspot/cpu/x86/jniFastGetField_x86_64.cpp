@@ -28,6 +28,7 @@
 #include "gc/shared/barrierSet.hpp"
 #include "gc/shared/barrierSetAssembler.hpp"
 #include "memory/resourceArea.hpp"
+#include "oops/arrayOop.hpp"
 #include "prims/jniFastGetField.hpp"
 #include "prims/jvm_misc.hpp"
 #include "prims/jvmtiExport.hpp"
@@ -224,3 +225,136 @@ address JNI_FastGetField::generate_fast_get_float_field() {
 address JNI_FastGetField::generate_fast_get_double_field() {
   return generate_fast_get_float_field0(T_DOUBLE);
 }
+
+// Max number of elements copied on the fast path. The JNI transition cost
+// amortizes well enough over larger regions that the slow path is fine for
+// them, and the cap bounds the amount of work done on a speculative copy
+// that a safepoint may invalidate.
+static const int fast_array_region_max_elems = 32;
+
+address JNI_FastGetField::generate_fast_get_array_region0(BasicType type) {
+  const char *name = NULL;
+  address slow_case_addr = NULL;
+  int scale = 0;
+  switch (type) {
+    case T_INT:
+      name = "jni_fast_GetIntArrayRegion";
+      slow_case_addr = jni_GetIntArrayRegion_addr();
+      scale = sizeof(jint);
+      break;
+    case T_LONG:
+      name = "jni_fast_GetLongArrayRegion";
+      slow_case_addr = jni_GetLongArrayRegion_addr();
+      scale = sizeof(jlong);
+      break;
+    default: ShouldNotReachHere();
+  }
+  ResourceMark rm;
+  BufferBlob* blob = BufferBlob::create(name, BUFFER_SIZE);
+  CodeBuffer cbuf(blob);
+  MacroAssembler* masm = new MacroAssembler(&cbuf);
+  address fast_entry = __ pc();
+
+  Label slow;
+
+  // Register usage:
+  // rax (rtmp): scratch, then element index
+  // rbx:        resolved array oop, then element base address. Callee saved,
+  //             so the argument registers stay intact for the slow tail call.
+  // r10:        bounds check scratch, then native buffer address
+  // r11 (rcounter): safepoint counter
+  // c_rarg0:    jni env
+  // c_rarg1:    array jobject
+  // c_rarg2:    start
+  // c_rarg3:    len
+  // buf stays in c_rarg4 (linux) or on the stack (windows).
+  //
+  // All paths below, including the fault recovery through the pclists,
+  // go past the final pop so rbx is always restored.
+  const Register rarr = rbx;
+  const Register rdst = r10;
+
+  __ push  (rbx);
+
+  ExternalAddress counter(SafepointSynchronize::safepoint_counter_addr());
+  __ mov32 (rcounter, counter);
+  __ testb (rcounter, 1);
+  __ jcc (Assembler::notZero, slow);
+
+  __ mov   (rarr, c_rarg1);
+
+  // Both rarr and rtmp are clobbered by try_resolve_jobject_in_native.
+  BarrierSetAssembler* bs = BarrierSet::barrier_set()->barrier_set_assembler();
+  bs->try_resolve_jobject_in_native(masm, /* jni_env */ c_rarg0, rarr, rtmp, slow);
+  DEBUG_ONLY(__ movl(rtmp, 0xDEADC0DE);)
+
+  // Reject negative start or len, regions beyond the array length and
+  // copies too large for the fast path. The length load is speculative
+  // like the element loads, so both pcs are registered in the pclists.
+  assert(count < LIST_CAPACITY - 1, "LIST_CAPACITY too small");
+  speculative_load_pclist[count] = __ pc();
+  __ movl  (rtmp, Address(rarr, arrayOopDesc::length_offset_in_bytes()));
+  __ movl  (rdst, c_rarg2);
+  __ orl   (rdst, c_rarg3);
+  __ jcc (Assembler::negative, slow);        // start < 0 || len < 0
+  __ leal  (rdst, Address(c_rarg2, c_rarg3, Address::times_1));
+  __ cmpl  (rdst, rtmp);
+  __ jcc (Assembler::above, slow);           // start + len > length
+  __ cmpl  (c_rarg3, fast_array_region_max_elems);
+  __ jcc (Assembler::greater, slow);
+
+  __ movslq(rtmp, c_rarg2);
+  __ lea   (rarr, Address(rarr, rtmp, Address::times(scale),
+                          arrayOopDesc::base_offset_in_bytes(type)));
+#ifdef _WIN64
+  // Return address, saved rbx and four words of shadow space.
+  __ movptr(rdst, Address(rsp, 6 * wordSize));
+#else
+  __ mov   (rdst, c_rarg4);
+#endif
+
+  Label loop, done;
+  __ xorl  (rtmp, rtmp);
+  __ bind  (loop);
+  __ cmpl  (rtmp, c_rarg3);
+  __ jcc (Assembler::greaterEqual, done);
+  speculative_load_pclist[count + 1] = __ pc();
+  switch (type) {
+    case T_INT:  __ movdl (xmm0, Address(rarr, rtmp, Address::times_4)); break;
+    case T_LONG: __ movq  (xmm0, Address(rarr, rtmp, Address::times_8)); break;
+    default:     ShouldNotReachHere();
+  }
+  switch (type) {
+    case T_INT:  __ movdl (Address(rdst, rtmp, Address::times_4), xmm0); break;
+    case T_LONG: __ movq  (Address(rdst, rtmp, Address::times_8), xmm0); break;
+    default:     ShouldNotReachHere();
+  }
+  __ incrementl(rtmp);
+  __ jmp   (loop);
+
+  __ bind  (done);
+  __ cmp32 (rcounter, counter);              // may scratch rdst, which is dead
+  __ jcc (Assembler::notEqual, slow);
+
+  __ pop   (rbx);
+  __ ret   (0);
+
+  slowcase_entry_pclist[count++] = __ pc();
+  slowcase_entry_pclist[count++] = __ pc();
+  __ bind (slow);
+  __ pop   (rbx);
+  // tail call
+  __ jump (ExternalAddress(slow_case_addr));
+
+  __ flush ();
+
+  return fast_entry;
+}
+
+address JNI_FastGetField::generate_fast_get_int_array_region() {
+  return generate_fast_get_array_region0(T_INT);
+}
+
+address JNI_FastGetField::generate_fast_get_long_array_region() {
+  return generate_fast_get_array_region0(T_LONG);
+}
@@ -5691,6 +5691,46 @@ void MacroAssembler::generate_fill(BasicType t, bool aligned,
         Label L_fill_64_bytes_loop;
         vpbroadcastd(xtmp, xtmp, Assembler::AVX_256bit);
 
+        if (NonTemporalFillThreshold > 0) {
+          // Stream the bulk of large fills with non-temporal stores, so that
+          // clearing a huge buffer does not evict the working set from the
+          // caches. The destination must be 32-byte aligned for the
+          // non-temporal stores: fill the first 32 bytes with a regular
+          // store and round the destination up, possibly overlapping the
+          // first aligned store. The floor on the threshold keeps those
+          // 32-byte stores within the fill region.
+          const uintx threshold_bytes = MAX2(NonTemporalFillThreshold, (uintx)128);
+          Label L_fill_nt_loop, L_fill_temporal;
+          cmpl(count, (int)(threshold_bytes >> (2 - shift)));
+          jcc(Assembler::below, L_fill_temporal);
+          vmovdqu(Address(to, 0), xtmp);
+          movl(rtmp, to);
+          negl(rtmp);
+          andl(rtmp, 31);          // Bytes until 'to' is 32-byte aligned.
+          addptr(to, rtmp);
+          if (shift < 2) {
+            shrl(rtmp, 2 - shift); // Bytes to elements.
+          }
+          subl(count, rtmp);
+
+          subl(count, 16 << shift);
+          jcc(Assembler::less, L_check_fill_32_bytes);
+          align(16);
+
+          BIND(L_fill_nt_loop);
+          vmovntdq(Address(to, 0), xtmp);
+          vmovntdq(Address(to, 32), xtmp);
+          addptr(to, 64);
+          subl(count, 16 << shift);
+          jcc(Assembler::greaterEqual, L_fill_nt_loop);
+          // Order the non-temporal stores with everything stored after the
+          // fill.
+          sfence();
+          jmp(L_check_fill_32_bytes);
+
+          BIND(L_fill_temporal);
+        }
+
         subl(count, 16 << shift);
         jcc(Assembler::less, L_check_fill_32_bytes);
         align(16);
@@ -6751,6 +6751,140 @@ address generate_avx_ghash_processBlocks() {
     return start;
   }
 
+  /**
+  *  Arguments:
+  *
+  *  Input:
+  *    c_rarg0   - ary      address of the first element to hash
+  *    c_rarg1   - cnt      number of elements
+  *    c_rarg2   - initial  initial hash value
+  *
+  *  Output:
+  *        rax   - initial * 31^cnt + sum(ary[i] * 31^(cnt - 1 - i))
+  */
+  address generate_arrays_hashcode(BasicType eltype, const char* name) {
+    // Lane coefficients {31^7 .. 31^0} for the eight-element step, emitted
+    // ahead of the entry point.
+    __ align(32);
+    address pow31 = __ pc();
+    __ emit_data64(0x34e63b4167e12cdf, relocInfo::none);   // 31^7, 31^6
+    __ emit_data64(0x000e178101b4d89f, relocInfo::none);   // 31^5, 31^4
+    __ emit_data64(0x000003c10000745f, relocInfo::none);   // 31^3, 31^2
+    __ emit_data64(0x000000010000001f, relocInfo::none);   // 31^1, 31^0
+
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", name);
+    address start = __ pc();
+
+    BLOCK_COMMENT("Entry:");
+    __ enter();
+
+    const Register ary = c_rarg0;
+    const Register cnt = c_rarg1;
+    const Register initial = c_rarg2;
+    const Register result = rax;
+    const Register tmp = r10;
+    const Register tmp2 = r11;
+    const XMMRegister vcoef = xmm0;
+    const XMMRegister vacc = xmm1;
+    const XMMRegister vdata = xmm2;
+    const XMMRegister vnext = xmm3;
+    const XMMRegister xtmp = xmm4;
+
+    const int elsize = type2aelembytes(eltype == T_BOOLEAN ? T_BYTE : eltype);
+    const int pow31_8 = 0x94446f01;   // 31^8 mod 2^32
+
+    Label L_scalar, L_scalar_loop, L_exit, L_vector_loop;
+
+    __ movl(result, initial);
+
+    if (UseAVX >= 2) {
+      __ cmpl(cnt, 8);
+      __ jcc(Assembler::less, L_scalar);
+
+      __ lea(tmp, ExternalAddress(pow31));
+      __ vmovdqu(vcoef, Address(tmp, 0));
+      __ movl(tmp2, pow31_8);
+      __ movdl(vnext, tmp2);
+      __ vpbroadcastd(vnext, vnext, Assembler::AVX_256bit);
+      __ vpxor(vacc, vacc, vacc, Assembler::AVX_256bit);
+
+      // Eight elements per step: result tracks initial * 31^(8k), while
+      // lane j of vacc accumulates sum(d[8i+j] * 31^(8*(k-1-i))).
+      __ BIND(L_vector_loop);
+      __ imull(result, result, pow31_8);
+      switch (eltype) {
+      case T_BOOLEAN:
+        __ movq(vdata, Address(ary, 0));
+        __ vpmovzxbd(vdata, vdata, Assembler::AVX_256bit);
+        break;
+      case T_BYTE:
+        __ movq(vdata, Address(ary, 0));
+        __ vpmovsxbd(vdata, vdata, Assembler::AVX_256bit);
+        break;
+      case T_CHAR:
+        __ movdqu(vdata, Address(ary, 0));
+        __ vpmovzxwd(vdata, vdata, Assembler::AVX_256bit);
+        break;
+      case T_SHORT:
+        __ movdqu(vdata, Address(ary, 0));
+        __ vpmovsxwd(vdata, vdata, Assembler::AVX_256bit);
+        break;
+      case T_INT:
+        __ vmovdqu(vdata, Address(ary, 0));
+        break;
+      default:
+        ShouldNotReachHere();
+      }
+      __ vpmulld(vacc, vacc, vnext, Assembler::AVX_256bit);
+      __ vpaddd(vacc, vacc, vdata, Assembler::AVX_256bit);
+      __ addptr(ary, 8 * elsize);
+      __ subl(cnt, 8);
+      __ cmpl(cnt, 8);
+      __ jcc(Assembler::greaterEqual, L_vector_loop);
+
+      // result += sum(vacc[j] * 31^(7 - j))
+      __ vpmulld(vacc, vacc, vcoef, Assembler::AVX_256bit);
+      __ vextracti128_high(xtmp, vacc);
+      __ vpaddd(vacc, vacc, xtmp, Assembler::AVX_128bit);
+      __ pshufd(xtmp, vacc, 0x0E);
+      __ paddd(vacc, xtmp);
+      __ pshufd(xtmp, vacc, 0x01);
+      __ paddd(vacc, xtmp);
+      __ movdl(tmp, vacc);
+      __ addl(result, tmp);
+    }
+
+    __ BIND(L_scalar);
+    __ testl(cnt, cnt);
+    __ jcc(Assembler::zero, L_exit);
+
+    __ BIND(L_scalar_loop);
+    __ imull(result, result, 31);
+    switch (eltype) {
+    case T_BOOLEAN: __ movzbl(tmp, Address(ary, 0)); break;
+    case T_BYTE:    __ movsbl(tmp, Address(ary, 0)); break;
+    case T_CHAR:    __ movzwl(tmp, Address(ary, 0)); break;
+    case T_SHORT:   __ movswl(tmp, Address(ary, 0)); break;
+    case T_INT:     __ movl(tmp, Address(ary, 0));   break;
+    default:
+      ShouldNotReachHere();
+    }
+    __ addl(result, tmp);
+    __ addptr(ary, elsize);
+    __ decrementl(cnt);
+    __ jcc(Assembler::notZero, L_scalar_loop);
+
+    __ BIND(L_exit);
+    if (UseAVX >= 2) {
+      __ vzeroupper();
+    }
+    __ leave();
+    __ ret(0);
+
+    return start;
+  }
+
 /**
    *  Arguments:
    *
@@ -7938,6 +8072,14 @@ address generate_avx_ghash_processBlocks() {
     if (UseVectorizedMismatchIntrinsic) {
       StubRoutines::_vectorizedMismatch = generate_vectorizedMismatch();
     }
+
+    if (UseArraysHashCodeIntrinsic) {
+      StubRoutines::_arrays_hashcode_boolean = generate_arrays_hashcode(T_BOOLEAN, "arrays_hashcode_boolean");
+      StubRoutines::_arrays_hashcode_byte    = generate_arrays_hashcode(T_BYTE,    "arrays_hashcode_byte");
+      StubRoutines::_arrays_hashcode_char    = generate_arrays_hashcode(T_CHAR,    "arrays_hashcode_char");
+      StubRoutines::_arrays_hashcode_short   = generate_arrays_hashcode(T_SHORT,   "arrays_hashcode_short");
+      StubRoutines::_arrays_hashcode_int     = generate_arrays_hashcode(T_INT,     "arrays_hashcode_int");
+    }
   }
 
  public:
@@ -1643,6 +1643,15 @@ void VM_Version::get_processor_features() {
       warning("vectorizedMismatch intrinsics are not available on this CPU");
     FLAG_SET_DEFAULT(UseVectorizedMismatchIntrinsic, false);
   }
+  if (UseAVX >= 2) {
+    if (FLAG_IS_DEFAULT(UseArraysHashCodeIntrinsic)) {
+      UseArraysHashCodeIntrinsic = true;
+    }
+  } else if (UseArraysHashCodeIntrinsic) {
+    if (!FLAG_IS_DEFAULT(UseArraysHashCodeIntrinsic))
+      warning("arrays hashCode intrinsics require AVX2 on this CPU");
+    FLAG_SET_DEFAULT(UseArraysHashCodeIntrinsic, false);
+  }
 #else
   if (UseVectorizedMismatchIntrinsic) {
     if (!FLAG_IS_DEFAULT(UseVectorizedMismatchIntrinsic)) {
@@ -1650,6 +1659,12 @@ void VM_Version::get_processor_features() {
     }
     FLAG_SET_DEFAULT(UseVectorizedMismatchIntrinsic, false);
   }
+  if (UseArraysHashCodeIntrinsic) {
+    if (!FLAG_IS_DEFAULT(UseArraysHashCodeIntrinsic)) {
+      warning("arrays hashCode intrinsics are not available in 32-bit VM");
+    }
+    FLAG_SET_DEFAULT(UseArraysHashCodeIntrinsic, false);
+  }
 #endif // _LP64
 
   // Use count leading zeros count instruction if available.
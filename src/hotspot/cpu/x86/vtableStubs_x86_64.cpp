@@ -26,10 +26,13 @@
 #include "asm/macroAssembler.hpp"
 #include "code/vtableStubs.hpp"
 #include "interp_masm_x86.hpp"
+#include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/compiledICHolder.hpp"
 #include "oops/instanceKlass.hpp"
 #include "oops/klassVtable.hpp"
+#include "prims/jvmtiExport.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "vmreg_x86.inline.hpp"
 #ifdef COMPILER2
@@ -46,6 +49,11 @@ extern "C" void bad_compiled_vtable_index(JavaThread* thread, oop receiver, int
 #endif
 
 VtableStub* VtableStubs::create_vtable_stub(int vtable_index) {
+  if (vtable_index >= VtableStubDedicatedIndexLimit) {
+    // The hot, low indexes keep dedicated stubs; the long tail shares one
+    // parameterized dispatch body, reached through a small trampoline.
+    return create_dispatch_trampoline(true, vtable_index);
+  }
   // Read "A word on VtableStub sizing" in share/code/vtableStubs.hpp for details on stub sizing.
   const int stub_code_length = code_size_limit(true);
   Register tmp_load_klass = rscratch1;
@@ -141,6 +149,9 @@ VtableStub* VtableStubs::create_vtable_stub(int vtable_index) {
 
 
 VtableStub* VtableStubs::create_itable_stub(int itable_index) {
+  if (itable_index >= VtableStubDedicatedIndexLimit) {
+    return create_dispatch_trampoline(false, itable_index);
+  }
   // Read "A word on VtableStub sizing" in share/code/vtableStubs.hpp for details on stub sizing.
   const int stub_code_length = code_size_limit(false);
   VtableStub* s = new(stub_code_length) VtableStub(false, itable_index);
@@ -263,6 +274,221 @@ VtableStub* VtableStubs::create_itable_stub(int itable_index) {
   return s;
 }
 
+// Shared megamorphic dispatch. Most of the code of a vtable/itable stub does
+// not depend on the dispatched index, so indexes beyond the dedicated limit
+// share one parameterized dispatch body each for vtables and itables. The
+// per-index stub degenerates to a trampoline which loads the index into a
+// register and jumps to the body.
+//
+// The index is passed in r11 for vtable dispatch and in rbx for itable
+// dispatch (lookup_interface_method requires a non-constant itable index
+// in the method result register).
+
+address VtableStubs::dispatch_body(bool is_vtable_stub) {
+  assert_lock_strong(VtableStubs_lock);
+  address& body = is_vtable_stub ? _vtable_dispatch_body : _itable_dispatch_body;
+  if (body != NULL) {
+    return body;
+  }
+  // The register-indexed addressing forms are slightly larger than their
+  // constant-indexed counterparts in the dedicated stubs, so add some
+  // headroom to the dedicated stubs' size estimate. The body is generated
+  // only once, so the extra space is irrelevant, but it must not feed back
+  // into that estimate via check_and_set_size_limit().
+  const int stub_code_length = code_size_limit(is_vtable_stub) + 64;
+  VtableStub* s = new(stub_code_length) VtableStub(is_vtable_stub, VtableStub::shared_dispatch_index, stub_code_length);
+  // Can be NULL if there is no free space in the code cache.
+  if (s == NULL) {
+    return NULL;
+  }
+
+  ResourceMark    rm;
+  CodeBuffer      cb(s->entry_point(), stub_code_length);
+  MacroAssembler* masm = new MacroAssembler(&cb);
+  address npe_addr = NULL;
+  address ame_addr = NULL;
+
+#if (!defined(PRODUCT) && defined(COMPILER2))
+  if (CountCompiledCalls) {
+    __ incrementq(ExternalAddress((address) SharedRuntime::nof_megamorphic_calls_addr()));
+  }
+#endif // PRODUCT
+
+  assert(VtableStub::receiver_location() == j_rarg0->as_VMReg(), "receiver expected in j_rarg0");
+
+  if (is_vtable_stub) {
+    // Entry arguments:
+    //  r11: vtable index
+    //  j_rarg0: Receiver
+
+    const Register index          = r11;
+    const Register tmp_load_klass = rscratch1;
+
+    // get receiver klass
+    npe_addr = __ pc();
+    __ load_klass(rax, j_rarg0, tmp_load_klass);
+
+#ifndef PRODUCT
+    if (DebugVtables) {
+      Label L;
+      // check offset vs vtable length
+      __ cmpl(index, Address(rax, Klass::vtable_length_offset()));
+      __ jcc(Assembler::less, L);
+      __ movl(rbx, index);
+      __ call_VM(noreg, CAST_FROM_FN_PTR(address, bad_compiled_vtable_index), j_rarg0, rbx);
+      __ bind(L);
+    }
+#endif // PRODUCT
+
+    const Register method = rbx;
+
+    // load Method* and target address
+    __ lookup_virtual_method(rax, index, method);
+
+#ifndef PRODUCT
+    if (DebugVtables) {
+      Label L;
+      __ cmpptr(method, (int32_t)NULL_WORD);
+      __ jcc(Assembler::equal, L);
+      __ cmpptr(Address(method, Method::from_compiled_offset()), (int32_t)NULL_WORD);
+      __ jcc(Assembler::notZero, L);
+      __ stop("Vtable entry is NULL");
+      __ bind(L);
+    }
+#endif // PRODUCT
+
+    // rax: receiver klass
+    // method (rbx): Method*
+    ame_addr = __ pc();
+    __ jmp(Address(method, Method::from_compiled_offset()));
+  } else {
+    // Entry arguments:
+    //  rax: CompiledICHolder
+    //  rbx: itable index
+    //  j_rarg0: Receiver
+
+    // As in the dedicated itable stubs we use rax, rbx, r10, r11; the index
+    // occupies rbx until the method lookup consumes it, so the resolved
+    // klass cannot be kept in a register across the subtype check and the
+    // CompiledICHolder is preserved on the stack instead.
+    const Register recv_klass_reg = r10;
+    const Register klass_reg      = rax; // resolved (REFC), then declaring (DECC) interface klass
+    const Register temp_reg       = r11;
+    const Register method         = rbx; // itable index on entry
+
+    Label L_no_such_interface, L_no_such_interface_restore;
+
+    // get receiver klass (also an implicit null-check)
+    npe_addr = __ pc();
+    __ load_klass(recv_klass_reg, j_rarg0, temp_reg);
+
+    __ push(rax);  // keep the CompiledICHolder across the subtype check
+    __ movptr(klass_reg, Address(rax, CompiledICHolder::holder_klass_offset()));
+
+    // Receiver subtype check against REFC.
+    // Destroys recv_klass_reg value.
+    __ lookup_interface_method(// inputs: rec. class, interface
+                               recv_klass_reg, klass_reg, noreg,
+                               // outputs:  scan temp. reg1, scan temp. reg2
+                               recv_klass_reg, temp_reg,
+                               L_no_such_interface_restore,
+                               /*return_method=*/false);
+
+    __ pop(rax);   // restore the CompiledICHolder
+    __ movptr(klass_reg, Address(rax, CompiledICHolder::holder_metadata_offset()));
+
+    // Get selected method from declaring class and itable index
+    __ load_klass(recv_klass_reg, j_rarg0, temp_reg);   // restore recv_klass_reg
+    __ lookup_interface_method(// inputs: rec. class, interface, itable index
+                               recv_klass_reg, klass_reg, method,
+                               // outputs: method, scan temp. reg
+                               method, temp_reg,
+                               L_no_such_interface);
+
+#ifdef ASSERT
+    if (DebugVtables) {
+      Label L2;
+      __ cmpptr(method, (int32_t)NULL_WORD);
+      __ jcc(Assembler::equal, L2);
+      __ cmpptr(Address(method, Method::from_compiled_offset()), (int32_t)NULL_WORD);
+      __ jcc(Assembler::notZero, L2);
+      __ stop("compiler entrypoint is null");
+      __ bind(L2);
+    }
+#endif // ASSERT
+
+    // method (rbx): Method*
+    // j_rarg0: receiver
+    ame_addr = __ pc();
+    __ jmp(Address(method, Method::from_compiled_offset()));
+
+    __ bind(L_no_such_interface_restore);
+    __ pop(rax);   // discard the saved CompiledICHolder
+    __ bind(L_no_such_interface);
+    // Handle IncompatibleClassChangeError in itable stubs, see the dedicated
+    // itable stub above.
+    __ jump(RuntimeAddress(SharedRuntime::get_handle_wrong_method_stub()));
+  }
+
+  masm->flush();
+  guarantee(masm->pc() <= s->code_end(), "shared %s dispatch body overflowed buffer, estimated len: %d, actual len: %d",
+            is_vtable_stub ? "vtable" : "itable", stub_code_length, (int)(masm->pc() - s->code_begin()));
+  s->set_exception_points(npe_addr, ame_addr);
+  // Register the body in the stub table so that stub_containing() and the
+  // implicit exception machinery see it; do not run bookkeeping(), its size
+  // estimate must remain that of the dedicated stubs.
+  enter(is_vtable_stub, VtableStub::shared_dispatch_index, s);
+  log_trace(vtablestubs)("shared %s dispatch body at " PTR_FORMAT ": size: %d",
+                         is_vtable_stub ? "vtable" : "itable", p2i(s->code_begin()),
+                         (int)(masm->pc() - s->code_begin()));
+  if (JvmtiExport::should_post_dynamic_code_generated()) {
+    JvmtiExport::post_dynamic_code_generated_while_holding_locks(is_vtable_stub ? "shared vtable dispatch" : "shared itable dispatch",
+                                                                 s->code_begin(), s->code_end());
+  }
+  body = s->entry_point();
+  return body;
+}
+
+
+VtableStub* VtableStubs::create_dispatch_trampoline(bool is_vtable_stub, int index) {
+  address body = dispatch_body(is_vtable_stub);
+  if (body == NULL) {
+    return NULL;
+  }
+  // A 32-bit immediate load plus a (possibly far) jump.
+  const int stub_code_length = 32;
+  VtableStub* s = new(stub_code_length) VtableStub(is_vtable_stub, index, stub_code_length);
+  // Can be NULL if there is no free space in the code cache.
+  if (s == NULL) {
+    return NULL;
+  }
+
+  ResourceMark    rm;
+  CodeBuffer      cb(s->entry_point(), stub_code_length);
+  MacroAssembler* masm = new MacroAssembler(&cb);
+
+  // Nothing in the trampoline can raise an implicit exception; the faulting
+  // instructions are in the shared body, which is covered by a VtableStub of
+  // its own. Two distinct addresses merely keep the recorded exception
+  // points apart.
+  address npe_addr = __ pc();
+  __ movl(is_vtable_stub ? r11 : rbx, index);
+  address ame_addr = __ pc();
+  __ jump(RuntimeAddress(body));
+
+  masm->flush();
+  guarantee(masm->pc() <= s->code_end(), "%s dispatch trampoline #%d overflowed buffer, estimated len: %d, actual len: %d",
+            is_vtable_stub ? "vtable" : "itable", index, stub_code_length, (int)(masm->pc() - s->code_begin()));
+  s->set_exception_points(npe_addr, ame_addr);
+  // As with the shared body, keep the trampoline out of the dedicated stubs'
+  // size estimate maintained by bookkeeping().
+  log_trace(vtablestubs)("%s dispatch trampoline #%d at " PTR_FORMAT ": size: %d",
+                         is_vtable_stub ? "vtable" : "itable", index, p2i(s->code_begin()),
+                         (int)(masm->pc() - s->code_begin()));
+
+  return s;
+}
+
 int VtableStub::pd_code_alignment() {
   // x86 cache line size is 64 bytes, but we want to limit alignment loss.
   const unsigned int icache_line_size = wordSize;
@@ -112,13 +112,18 @@ class LinuxAttachOperation: public AttachOperation {
   // the connection to the client
   int _socket;
 
+  // temporary file holding spilled result data, or -1
+  int _spill_fd;
+  fdStream _spill_stream;
+
  public:
   void complete(jint res, bufferedStream* st);
+  outputStream* open_spill_stream();
 
   void set_socket(int s)                                { _socket = s; }
   int socket() const                                    { return _socket; }
 
-  LinuxAttachOperation(char* name) : AttachOperation(name) {
+  LinuxAttachOperation(char* name) : AttachOperation(name), _spill_fd(-1) {
     set_socket(-1);
   }
 };
@@ -396,6 +401,32 @@ int LinuxAttachListener::write_fully(int s, char* buf, int len) {
   return 0;
 }
 
+// Create a temporary file to hold bulky result data. The file is unlinked
+// immediately so that it cannot be left behind if the VM dies before the
+// operation completes; complete() forwards its contents to the client
+// through the still-open descriptor. Writing the data to a file rather
+// than straight to the socket keeps client I/O off the threads that
+// generate the output - thread dumps and heap histograms are printed by
+// the VM thread at a safepoint, which must not block on an unresponsive
+// client.
+outputStream* LinuxAttachOperation::open_spill_stream() {
+  assert(_spill_fd == -1, "spill stream already open");
+  char path[UNIX_PATH_MAX];
+  int n = snprintf(path, sizeof(path), "%s/.attach_output_%d_XXXXXX",
+                   os::get_temp_directory(), os::current_process_id());
+  if (n >= (int)sizeof(path)) {
+    return NULL;   // fall back to in-memory buffering
+  }
+  int fd = ::mkstemp(path);
+  if (fd == -1) {
+    return NULL;   // fall back to in-memory buffering
+  }
+  ::unlink(path);
+  _spill_fd = fd;
+  _spill_stream.set_fd(fd);
+  return &_spill_stream;
+}
+
 // Complete an operation by sending the operation result and any result
 // output to the client. At this time the socket is in blocking mode so
 // potentially we can block if there is a lot of data and the client is
@@ -415,11 +446,30 @@ void LinuxAttachOperation::complete(jint result, bufferedStream* st) {
 
   // write any result data
   if (rc == 0) {
-    LinuxAttachListener::write_fully(this->socket(), (char*) st->base(), st->size());
+    rc = LinuxAttachListener::write_fully(this->socket(), (char*) st->base(), st->size());
+  }
+
+  // forward spilled result data in bounded chunks
+  if (rc == 0 && _spill_fd != -1) {
+    char buf[8192];
+    ::lseek(_spill_fd, 0, SEEK_SET);
+    for (;;) {
+      ssize_t n;
+      RESTARTABLE(::read(_spill_fd, buf, sizeof(buf)), n);
+      if (n <= 0 || LinuxAttachListener::write_fully(this->socket(), buf, (int)n) != 0) {
+        break;
+      }
+    }
+  }
+
+  if (rc == 0) {
     ::shutdown(this->socket(), 2);
   }
 
   // done
+  if (_spill_fd != -1) {
+    ::close(_spill_fd);
+  }
   ::close(this->socket());
 
   delete this;
@@ -3166,7 +3166,18 @@ struct bitmask* os::Linux::_numa_membind_bitmask;
 bool os::pd_uncommit_memory(char* addr, size_t size, bool exec) {
   uintptr_t res = (uintptr_t) ::mmap(addr, size, PROT_NONE,
                                      MAP_PRIVATE|MAP_FIXED|MAP_NORESERVE|MAP_ANONYMOUS, -1, 0);
-  return res  != (uintptr_t) MAP_FAILED;
+  if (res == (uintptr_t) MAP_FAILED) {
+    return false;
+  }
+  if (UseTransparentHugePages) {
+    // The fresh mapping dropped the huge page advice of the old one. Restore
+    // it now, so that a later commit of this range stays eligible for huge
+    // pages even when it goes through a path that passes no alignment hint
+    // (and thus does not re-advise). We don't check the return value:
+    // madvise(MADV_HUGEPAGE) may not be supported.
+    ::madvise(addr, size, MADV_HUGEPAGE);
+  }
+  return true;
 }
 
 static address get_stack_commited_bottom(address bottom, size_t size) {
@@ -52,6 +52,7 @@
 
 #include <dirent.h>
 #include <dlfcn.h>
+#include <fcntl.h>
 #include <grp.h>
 #include <netdb.h>
 #include <pwd.h>
@@ -69,6 +70,9 @@
 #include <time.h>
 #include <unistd.h>
 #include <utmpx.h>
+#ifdef LINUX
+  #include <linux/falloc.h>
+#endif
 
 #ifdef __APPLE__
   #include <crt_externs.h>
@@ -667,6 +671,25 @@ int os::ftruncate(int fd, jlong length) {
    return BSD_ONLY(::ftruncate) NOT_BSD(::ftruncate64)(fd, length);
 }
 
+bool os::preallocate(int fd, jlong length) {
+#ifdef LINUX
+  // FALLOC_FL_KEEP_SIZE allocates backing blocks without changing the
+  // visible file size, so concurrent readers of the file are unaffected.
+  return ::fallocate(fd, FALLOC_FL_KEEP_SIZE, 0, (off_t)length) == 0;
+#else
+  return false;
+#endif
+}
+
+void os::release_preallocation(int fd, jlong offset, jlong length) {
+#ifdef LINUX
+  // Blocks preallocated beyond the end of file stay allocated until the
+  // file is deleted or the range is punched out. Best-effort: on a file
+  // system without hole punching the preallocation has failed as well.
+  ::fallocate(fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, (off_t)offset, (off_t)length);
+#endif
+}
+
 const char* os::get_current_directory(char *buf, size_t buflen) {
   return getcwd(buf, buflen);
 }
@@ -4973,6 +4973,15 @@ int os::ftruncate(int fd, jlong length) {
   return 0;
 }
 
+// Windows has no way of preallocating backing store without also changing
+// the visible file size, see os_posix.cpp.
+bool os::preallocate(int fd, jlong length) {
+  return false;
+}
+
+void os::release_preallocation(int fd, jlong offset, jlong length) {
+}
+
 int os::get_fileno(FILE* fp) {
   return _fileno(fp);
 }
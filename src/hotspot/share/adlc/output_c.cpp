@@ -3423,16 +3423,23 @@ public:
 };
 
 
-// Information needed to generate the Rule names for the DFA
+// Information needed to generate the Rule names for the DFA.
+// The table is only used by debug printing. It is an array of pointers, so
+// every entry is patched by a load-time relocation, dirtying the pages in
+// each process; keep it out of product builds so they stay shared.
 class OutputRuleName : public OutputMap {
 public:
   OutputRuleName(FILE *hpp, FILE *cpp, FormDict &globals, ArchDesc &AD)
     : OutputMap(hpp, cpp, globals, AD, "ruleName") {};
 
-  void declaration() { fprintf(_hpp, "extern const char *ruleName[];\n"); }
-  void definition()  { fprintf(_cpp, "const char        *ruleName[] = {\n"); }
+  void declaration() { fprintf(_hpp, "#ifndef PRODUCT\n");
+                       fprintf(_hpp, "extern const char *ruleName[];\n");
+                       fprintf(_hpp, "#endif\n"); }
+  void definition()  { fprintf(_cpp, "#ifndef PRODUCT\n");
+                       fprintf(_cpp, "const char        *ruleName[] = {\n"); }
   void closing()     { fprintf(_cpp, "  \"invalid rule name\" // no trailing comma\n");
                        OutputMap::closing();
+                       fprintf(_cpp, "#endif\n");
   }
   void map(OpClassForm &opc)  { fprintf(_cpp, "  \"%s\"", _AD.machOperEnum(opc._ident) ); }
   void map(OperandForm &oper) { fprintf(_cpp, "  \"%s\"", _AD.machOperEnum(oper._ident) ); }
@@ -701,7 +701,14 @@ void CodeBuffer::copy_code_to(CodeBlob* dest_blob) {
   // Set beginning of constant table before relocating.
   dest_blob->set_ctable_begin(dest.consts()->start());
 
-  relocate_code_to(&dest);
+  {
+    // Nothing executes the blob before the covering flush below, so the
+    // per-instruction flushes issued while patching relocated sites are
+    // redundant. Suppress them to coalesce the icache maintenance into the
+    // one covering flush.
+    ICacheFlushSuppressor sifs;
+    relocate_code_to(&dest);
+  }
 
   // Share assembly remarks and debug strings with the blob.
   NOT_PRODUCT(dest_blob->use_remarks(_asm_remarks));
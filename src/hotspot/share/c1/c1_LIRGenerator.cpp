@@ -904,6 +904,14 @@ LIR_Opr LIRGenerator::force_to_spill(LIR_Opr value, BasicType t) {
   return tmp;
 }
 
+// Profile counter updates are emitted as plain load/add/store sequences with
+// no atomicity: lost updates under contention are acceptable for profiling.
+// The stores do make the MDO cache lines bounce when many threads run the
+// same tier-3 code. Buffering the deltas per thread would require a merge
+// point on every method exit (including deoptimization and exception
+// unwind) and per-thread storage proportional to the live MDO cells, so the
+// contention is accepted until the method tiers up and the profiling code
+// goes away.
 void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
   if (if_instr->should_profile()) {
     ciMethod* method = if_instr->profiled_method();
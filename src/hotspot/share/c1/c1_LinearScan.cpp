@@ -287,7 +287,9 @@ void LinearScan::append_interval(Interval* it) {
   _intervals.append(it);
   IntervalList* new_intervals = _new_intervals_from_allocation;
   if (new_intervals == NULL) {
-    new_intervals = _new_intervals_from_allocation = new IntervalList();
+    // Methods that split one interval usually split many more, so reserve
+    // room for a batch of child intervals up front.
+    new_intervals = _new_intervals_from_allocation = new IntervalList(16);
   }
   new_intervals->append(it);
 }
@@ -1584,14 +1586,24 @@ void LinearScan::sort_intervals_before_allocation() {
   IntervalArray* sorted_list = new IntervalArray(sorted_len, sorted_len, NULL);
 
   // special sorting algorithm: the original interval-list is almost sorted,
-  // only some intervals are swapped. So this is much faster than a complete QuickSort
+  // only some intervals are swapped. So this is much faster than a complete QuickSort.
+  // On very large, branchy methods (e.g. generated parsers) the assumption can
+  // fail for many intervals, which degrades the manual insertion to quadratic
+  // time. Track the insertion work and bail out to a conventional sort of the
+  // whole list when it exceeds a small multiple of the list length.
+  const int max_insertion_work = 8 * unsorted_len;
+  int insertion_work = 0;
+  bool use_full_sort = false;
   for (unsorted_idx = 0; unsorted_idx < unsorted_len; unsorted_idx++) {
     Interval* cur_interval = unsorted_list->at(unsorted_idx);
 
     if (cur_interval != NULL) {
       int cur_from = cur_interval->from();
 
-      if (sorted_from_max <= cur_from) {
+      if (use_full_sort) {
+        // just compact the remaining intervals; the list is sorted below
+        sorted_list->at_put(sorted_idx++, cur_interval);
+      } else if (sorted_from_max <= cur_from) {
         sorted_list->at_put(sorted_idx++, cur_interval);
         sorted_from_max = cur_interval->from();
       } else {
@@ -1600,12 +1612,17 @@ void LinearScan::sort_intervals_before_allocation() {
         int j;
         for (j = sorted_idx - 1; j >= 0 && cur_from < sorted_list->at(j)->from(); j--) {
           sorted_list->at_put(j + 1, sorted_list->at(j));
+          insertion_work++;
         }
         sorted_list->at_put(j + 1, cur_interval);
         sorted_idx++;
+        use_full_sort = insertion_work > max_insertion_work;
       }
     }
   }
+  if (use_full_sort) {
+    sorted_list->sort(interval_cmp);
+  }
   _sorted_intervals = sorted_list;
   assert(is_sorted(_sorted_intervals), "intervals unsorted");
 }
@@ -33,12 +33,15 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionaryShared.hpp"
 #include "classfile/vmClasses.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "interpreter/abstractInterpreter.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allStatic.hpp"
 #include "memory/memRegion.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
 #include "oops/compressedKlass.inline.hpp"
 #include "oops/instanceKlass.hpp"
 #include "oops/klass.inline.hpp"
@@ -46,6 +49,7 @@
 #include "oops/objArrayOop.inline.hpp"
 #include "oops/oopHandle.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/thread.hpp"
@@ -660,9 +664,49 @@ address ArchiveBuilder::get_dumped_addr(address src_obj) const {
   return p->dumped_addr();
 }
 
+// Relocates a claimed chunk of source objects at a time. The copied objects are
+// disjoint, and ArchivePtrMarker marks the pointer locations atomically while a
+// parallel phase is active, so no further synchronization is needed.
+class ArchiveBuilder::RelocateEmbeddedPointersTask : public WorkerTask {
+  ArchiveBuilder* _builder;
+  SourceObjList* _src_objs;
+  volatile int _claimed;
+
+  static const int chunk_size = 256;
+public:
+  RelocateEmbeddedPointersTask(ArchiveBuilder* builder, SourceObjList* src_objs) :
+    WorkerTask("CDS Relocate Embedded Pointers"),
+    _builder(builder), _src_objs(src_objs), _claimed(0) {}
+
+  static int min_parallel_objs() { return chunk_size; }
+
+  void work(uint worker_id) {
+    int len = _src_objs->objs()->length();
+    for (;;) {
+      int start = Atomic::fetch_and_add(&_claimed, chunk_size);
+      if (start >= len) {
+        return;
+      }
+      int end = MIN2(start + chunk_size, len);
+      for (int i = start; i < end; i++) {
+        _src_objs->relocate(i, _builder);
+      }
+    }
+  }
+};
+
 void ArchiveBuilder::relocate_embedded_pointers(ArchiveBuilder::SourceObjList* src_objs) {
-  for (int i = 0; i < src_objs->objs()->length(); i++) {
-    src_objs->relocate(i, this);
+  WorkerThreads* workers = Universe::heap() != NULL ? Universe::heap()->safepoint_workers() : NULL;
+  if (workers != NULL && workers->active_workers() > 1 &&
+      src_objs->objs()->length() >= RelocateEmbeddedPointersTask::min_parallel_objs()) {
+    ArchivePtrMarker::start_parallel_mark();
+    RelocateEmbeddedPointersTask task(this, src_objs);
+    workers->run_task(&task);
+    ArchivePtrMarker::end_parallel_mark();
+  } else {
+    for (int i = 0; i < src_objs->objs()->length(); i++) {
+      src_objs->relocate(i, this);
+    }
   }
 }
 
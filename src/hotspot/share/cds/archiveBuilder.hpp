@@ -256,6 +256,7 @@ private:
   void make_shallow_copy(DumpRegion *dump_region, SourceObjInfo* src_info);
 
   void update_special_refs();
+  class RelocateEmbeddedPointersTask;
   void relocate_embedded_pointers(SourceObjList* src_objs);
 
   bool is_excluded(Klass* k);
@@ -47,6 +47,7 @@ CHeapBitMap* ArchivePtrMarker::_ptrmap = NULL;
 VirtualSpace* ArchivePtrMarker::_vs;
 
 bool ArchivePtrMarker::_compacted;
+bool ArchivePtrMarker::_parallel_mark = false;
 
 void ArchivePtrMarker::initialize(CHeapBitMap* ptrmap, VirtualSpace* vs) {
   assert(_ptrmap == NULL, "initialize only once");
@@ -65,6 +66,23 @@ void ArchivePtrMarker::initialize(CHeapBitMap* ptrmap, VirtualSpace* vs) {
   _ptrmap->initialize(estimated_archive_size / sizeof(intptr_t));
 }
 
+void ArchivePtrMarker::start_parallel_mark() {
+  assert(!_compacted, "cannot mark anymore");
+  assert(!_parallel_mark, "must not be nested");
+  // Pre-size the bitmap to cover the whole committed buffer, so mark_pointer()
+  // never has to expand it while workers are marking concurrently.
+  size_t full_size = ptr_end() - ptr_base();
+  if (_ptrmap->size() < full_size) {
+    _ptrmap->resize(full_size);
+  }
+  _parallel_mark = true;
+}
+
+void ArchivePtrMarker::end_parallel_mark() {
+  assert(_parallel_mark, "must be marking in parallel");
+  _parallel_mark = false;
+}
+
 void ArchivePtrMarker::mark_pointer(address* ptr_loc) {
   assert(_ptrmap != NULL, "not initialized");
   assert(!_compacted, "cannot mark anymore");
@@ -81,10 +99,15 @@ void ArchivePtrMarker::mark_pointer(address* ptr_loc) {
       assert(uintx(ptr_loc) % sizeof(intptr_t) == 0, "pointers must be stored in aligned addresses");
       size_t idx = ptr_loc - ptr_base();
       if (_ptrmap->size() <= idx) {
+        assert(!_parallel_mark, "bitmap is pre-sized for parallel marking");
         _ptrmap->resize((idx + 1) * 2);
       }
       assert(idx < _ptrmap->size(), "must be");
-      _ptrmap->set_bit(idx);
+      if (_parallel_mark) {
+        _ptrmap->par_set_bit(idx);
+      } else {
+        _ptrmap->set_bit(idx);
+      }
       //tty->print_cr("Marking pointer [" PTR_FORMAT "] -> " PTR_FORMAT " @ " SIZE_FORMAT_W(5), p2i(ptr_loc), p2i(*ptr_loc), idx);
     }
   }
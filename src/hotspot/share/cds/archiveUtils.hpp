@@ -48,11 +48,18 @@ class ArchivePtrMarker : AllStatic {
   // avoid unintentional copy operations after the bitmap has been finalized and written.
   static bool         _compacted;
 
+  // While set, multiple workers may call mark_pointer() concurrently. The bitmap
+  // has been pre-sized to cover the whole committed buffer and bits are set
+  // atomically. See start_parallel_mark().
+  static bool         _parallel_mark;
+
   static address* ptr_base() { return (address*)_vs->low();  } // committed lower bound (inclusive)
   static address* ptr_end()  { return (address*)_vs->high(); } // committed upper bound (exclusive)
 
 public:
   static void initialize(CHeapBitMap* ptrmap, VirtualSpace* vs);
+  static void start_parallel_mark();
+  static void end_parallel_mark();
   static void mark_pointer(address* ptr_loc);
   static void clear_pointer(address* ptr_loc);
   static void compact(address relocatable_base, address relocatable_end);
@@ -2286,6 +2286,25 @@ bool FileMapInfo::map_heap_regions(int first, int max,  bool is_open_archive,
     }
   }
 
+  if (PrefetchSharedHeapRegions && !VerifySharedSpaces) {
+    // Touch the mapped pages now, so that the first use of the archived
+    // objects does not pay a long tail of demand faults against the archive
+    // file. A plain load per page is enough; unlike os::pretouch_memory()
+    // this never writes, so the read-only closed regions are not dirtied.
+    // With VerifySharedSpaces the crc check above has already read every page.
+    for (int i = 0; i < num_regions; i++) {
+      char* addr = (char*)regions[i].start();
+      char* end = addr + regions[i].byte_size();
+      int sum = 0;
+      for (char* p = addr; p < end; p += os::vm_page_size()) {
+        sum += *p;
+      }
+      // Defeat dead-load elimination.
+      static volatile int prefetch_sink;
+      prefetch_sink = sum;
+    }
+  }
+
   cleanup._aborted = false;
   // the shared heap data is mapped successfully
   *regions_ret = regions;
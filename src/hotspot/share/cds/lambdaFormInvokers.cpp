@@ -48,6 +48,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
 
 GrowableArrayCHeap<char*, mtClassShared>* LambdaFormInvokers::_lambdaform_lines = nullptr;
 Array<Array<char>*>*  LambdaFormInvokers::_static_archive_invokers = nullptr;
@@ -74,6 +75,15 @@ void LambdaFormInvokers::append(char* line) {
   if (_lambdaform_lines == NULL) {
     _lambdaform_lines = new GrowableArrayCHeap<char*, mtClassShared>(150);
   }
+  // The same invoker shape is logged once per loader or call site that
+  // materializes it. Record each shape only once, so the holder class
+  // regeneration compiles the common shapes exactly once.
+  for (int i = 0; i < _lambdaform_lines->length(); i++) {
+    if (strcmp(_lambdaform_lines->at(i), line) == 0) {
+      os::free(line);
+      return;
+    }
+  }
   _lambdaform_lines->append(line);
 }
 
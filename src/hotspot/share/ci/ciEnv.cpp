@@ -164,6 +164,8 @@ ciEnv::ciEnv(CompileTask* task)
   _the_null_string = NULL;
   _the_min_jint_string = NULL;
 
+  _num_sys_dict_modifications = SystemDictionary::number_of_modifications();
+
   _jvmti_redefinition_count = 0;
   _jvmti_can_hotswap_or_post_breakpoint = false;
   _jvmti_can_access_local_variables = false;
@@ -285,6 +287,8 @@ ciEnv::ciEnv(Arena* arena) : _ciEnv_arena(mtCompiler) {
   _the_null_string = NULL;
   _the_min_jint_string = NULL;
 
+  _num_sys_dict_modifications = SystemDictionary::number_of_modifications();
+
   _jvmti_redefinition_count = 0;
   _jvmti_can_hotswap_or_post_breakpoint = false;
   _jvmti_can_access_local_variables = false;
@@ -1024,7 +1028,14 @@ bool ciEnv::is_in_vm() {
 void ciEnv::validate_compile_task_dependencies(ciMethod* target) {
   if (failing())  return;  // no need for further checks
 
-  Dependencies::DepType result = dependencies()->validate_dependencies(_task);
+  // We hold the Compile_lock, so the hierarchy stamp is stable here. If it
+  // matches the stamp captured when this ciEnv was created, no class was
+  // linked into the hierarchy (or redefined, or made visible to CHA by
+  // linking) during the compilation, and the class hierarchy dependencies
+  // need not be re-walked.
+  bool hierarchy_changed =
+    _num_sys_dict_modifications != SystemDictionary::number_of_modifications();
+  Dependencies::DepType result = dependencies()->validate_dependencies(_task, hierarchy_changed);
   if (result != Dependencies::end_marker) {
     if (result == Dependencies::call_site_target_value) {
       _inc_decompile_count_on_failure = false;
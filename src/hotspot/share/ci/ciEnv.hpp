@@ -78,6 +78,12 @@ private:
   bool  _jvmti_can_get_owned_monitor_info; // includes can_get_owned_monitor_stack_depth_info
   bool  _jvmti_can_walk_any_space;
 
+  // Class hierarchy modification stamp captured before the compilation
+  // performs any class hierarchy queries. If the stamp is unchanged at
+  // code installation time, hierarchy dependencies verified during the
+  // compilation cannot have been invalidated and are not re-walked.
+  uint64_t _num_sys_dict_modifications;
+
   // Cache DTrace flags
   bool  _dtrace_extended_probes;
   bool  _dtrace_method_probes;
@@ -40,6 +40,7 @@ ciKlass::ciKlass(Klass* k) : ciType(k) {
   assert(get_Klass()->is_klass(), "wrong type");
   Klass* klass = get_Klass();
   _layout_helper = klass->layout_helper();
+  _prototype_header = klass->prototype_header().value();
   Symbol* klass_name = klass->name();
   assert(klass_name != NULL, "wrong ciKlass constructor");
   _name = CURRENT_ENV->get_symbol(klass_name);
@@ -53,6 +54,7 @@ ciKlass::ciKlass(Klass* k, ciSymbol* name) : ciType(k) {
   assert(get_Klass()->is_klass(), "wrong type");
   _name = name;
   _layout_helper = Klass::_lh_neutral_value;
+  _prototype_header = 0;
 }
 
 // ------------------------------------------------------------------
@@ -62,6 +64,7 @@ ciKlass::ciKlass(Klass* k, ciSymbol* name) : ciType(k) {
 ciKlass::ciKlass(ciSymbol* name, BasicType bt) : ciType(bt) {
   _name = name;
   _layout_helper = Klass::_lh_neutral_value;
+  _prototype_header = 0;
 }
 
 // ------------------------------------------------------------------
@@ -50,6 +50,7 @@ class ciKlass : public ciType {
 private:
   ciSymbol* _name;
   jint _layout_helper;
+  uintptr_t _prototype_header;
 
 protected:
   ciKlass(Klass* k, ciSymbol* name);
@@ -81,6 +82,10 @@ public:
   // What is its layout helper value?
   jint layout_helper() { return _layout_helper; }
 
+  // Mark word installed in newly allocated instances of this klass,
+  // or 0 if it is not known.
+  uintptr_t prototype_header() { return _prototype_header; }
+
   bool is_subtype_of(ciKlass* klass);
   bool is_subclass_of(ciKlass* klass);
   juint super_depth();
@@ -52,6 +52,7 @@
 #include "oops/markWord.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/os.hpp"
+#include "utilities/bytes.hpp"
 
 // Get the hash code of the classes mirror if it exists, otherwise just
 // return a random number, which is one of the possible hash code used for
@@ -153,11 +154,19 @@ uint32_t AltHashing::halfsiphash_32(uint64_t seed, const void* in, int len) {
   // body
   while (count >= 4) {
 
+#ifdef VM_LITTLE_ENDIAN
+    // The byte assembly below is a little-endian 32-bit load; do it in one
+    // (possibly unaligned) load where that is the native byte order. This
+    // loop dominates the hashing cost of long inputs such as string
+    // deduplication value arrays.
+    newdata = Bytes::get_native_u4((address)&data[off]);
+#else
     // Avoid sign extension with 0x0ff
     newdata = (data[off] & 0x0FF)
         | (data[off + 1] & 0x0FF) << 8
         | (data[off + 2] & 0x0FF) << 16
         | data[off + 3] << 24;
+#endif
 
     count -= 4;
     off += 4;
@@ -199,9 +208,15 @@ uint32_t AltHashing::halfsiphash_32(uint64_t seed, const uint16_t* data, int len
 
   // body
   while (count >= 2) {
+#ifdef VM_LITTLE_ENDIAN
+    // Combining two chars little-endian is a 32-bit load in native byte order.
+    newdata = Bytes::get_native_u4((address)&data[off]);
+    off += 2;
+#else
     uint16_t d1 = data[off++] & 0x0FFFF;
     uint16_t d2 = data[off++];
     newdata = (d1 | d2 << 16);
+#endif
 
     count -= 2;
 
@@ -172,6 +172,7 @@ void ClassFileParser::parse_constant_pool_entries(const ClassFileStream* const s
   int indices[SymbolTable::symbol_alloc_batch_size];
   unsigned int hashValues[SymbolTable::symbol_alloc_batch_size];
   int names_count = 0;
+  const constantPoolHandle cp_handle(THREAD, cp);
 
   // parsing  Index 0 is unused
   for (int index = 1; index < length; index++) {
@@ -337,7 +338,7 @@ void ClassFileParser::parse_constant_pool_entries(const ClassFileStream* const s
           hashValues[names_count++] = hash;
           if (names_count == SymbolTable::symbol_alloc_batch_size) {
             SymbolTable::new_symbols(_loader_data,
-                                     constantPoolHandle(THREAD, cp),
+                                     cp_handle,
                                      names_count,
                                      names,
                                      lengths,
@@ -374,7 +375,7 @@ void ClassFileParser::parse_constant_pool_entries(const ClassFileStream* const s
   // Allocate the remaining symbols
   if (names_count > 0) {
     SymbolTable::new_symbols(_loader_data,
-                             constantPoolHandle(THREAD, cp),
+                             cp_handle,
                              names_count,
                              names,
                              lengths,
@@ -5165,6 +5166,7 @@ static void check_methods_for_intrinsics(const InstanceKlass* ik,
         // Check if an intrinsic is defined for method 'method',
         // but the method is not annotated with @IntrinsicCandidate.
         if (method->intrinsic_id() != vmIntrinsics::_none &&
+            !vmIntrinsics::is_annotation_exempt(method->intrinsic_id()) &&
             !method->intrinsic_candidate()) {
               tty->print("Compiler intrinsic is defined for method [%s], "
               "but the method is not annotated with @IntrinsicCandidate.%s",
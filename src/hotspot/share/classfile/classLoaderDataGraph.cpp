@@ -198,8 +198,13 @@ ClassLoaderData* ClassLoaderDataGraph::_unloading = NULL;
 
 bool ClassLoaderDataGraph::_should_clean_deallocate_lists = false;
 bool ClassLoaderDataGraph::_safepoint_cleanup_needed = false;
+volatile bool ClassLoaderDataGraph::_metaspace_purge_deferred = false;
 bool ClassLoaderDataGraph::_metaspace_oom = false;
 
+bool ClassLoaderDataGraph::should_purge_metaspace_and_reset() {
+  return Atomic::cmpxchg(&_metaspace_purge_deferred, true, false);
+}
+
 // Add a new class loader data node to the list.  Assign the newly created
 // ClassLoaderData into the java/lang/ClassLoader object as a hidden field
 ClassLoaderData* ClassLoaderDataGraph::add_to_graph(Handle loader, bool has_class_mirror_holder) {
@@ -391,6 +396,19 @@ void ClassLoaderDataGraph::modules_unloading_do(void f(ModuleEntry*)) {
   }
 }
 
+void ClassLoaderDataGraph::freeze_module_and_package_tables() {
+  assert_locked_or_safepoint(Module_lock);
+  ClassLoaderDataGraphIterator iter;
+  while (ClassLoaderData* cld = iter.get_next()) {
+    if (cld->modules_defined()) {
+      cld->modules()->freeze();
+    }
+    if (cld->packages() != NULL) {
+      cld->packages()->freeze();
+    }
+  }
+}
+
 void ClassLoaderDataGraph::packages_do(void f(PackageEntry*)) {
   assert_locked_or_safepoint(Module_lock);
   ClassLoaderDataGraphIterator iter;
@@ -556,7 +574,15 @@ void ClassLoaderDataGraph::purge(bool at_safepoint) {
     classes_unloaded = true;
   }
   if (classes_unloaded) {
-    Metaspace::purge();
+    if (at_safepoint) {
+      // The deleted CLDs have already returned their chunks to the free
+      // lists. What remains is uncommitting free chunk memory, which does
+      // not have to happen in the pause; defer it to the ServiceThread,
+      // which is notified below.
+      Atomic::store(&_metaspace_purge_deferred, true);
+    } else {
+      Metaspace::purge();
+    }
     set_metaspace_oom(false);
   }
   DependencyContext::purge_dependency_contexts();
@@ -568,6 +594,11 @@ void ClassLoaderDataGraph::purge(bool at_safepoint) {
     if (should_clean_metaspaces_and_reset()) {
       walk_metadata_and_clean_metaspaces();
     }
+    if (Atomic::load(&_metaspace_purge_deferred)) {
+      // Wake the ServiceThread for the deferred metaspace purge.
+      MutexLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
+      Service_lock->notify_all();
+    }
   } else {
     // Tell service thread this is a good time to check to see if we should
     // clean loaded CLDGs. This causes another safepoint.
@@ -49,6 +49,10 @@ class ClassLoaderDataGraph : public AllStatic {
   static bool _should_clean_deallocate_lists;
   static bool _safepoint_cleanup_needed;
 
+  // Set when reclaiming metaspace memory (uncommitting free chunks) has been
+  // deferred from an unloading safepoint to the ServiceThread.
+  static volatile bool _metaspace_purge_deferred;
+
   // OOM has been seen in metaspace allocation. Used to prevent some
   // allocations until class unloading
   static bool _metaspace_oom;
@@ -82,6 +86,9 @@ class ClassLoaderDataGraph : public AllStatic {
   static void methods_do(void f(Method*));
   static void modules_do(void f(ModuleEntry*));
   static void modules_unloading_do(void f(ModuleEntry*));
+  // Snapshot the module and package tables of all loaded CLDs for lock-free
+  // lookup, called once the boot layer module graph is complete.
+  static void freeze_module_and_package_tables();
   static void packages_do(void f(PackageEntry*));
   static void packages_unloading_do(void f(PackageEntry*));
   static void loaded_classes_do(KlassClosure* klass_closure);
@@ -89,6 +96,7 @@ class ClassLoaderDataGraph : public AllStatic {
   static bool do_unloading();
 
   static inline bool should_clean_metaspaces_and_reset();
+  static bool should_purge_metaspace_and_reset();
   static void set_should_clean_deallocate_lists() { _should_clean_deallocate_lists = true; }
   static void clean_deallocate_lists(bool purge_previous_versions);
   // Called from ServiceThread
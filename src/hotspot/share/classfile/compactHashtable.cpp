@@ -28,10 +28,15 @@
 #include "cds/heapShared.inline.hpp"
 #include "classfile/compactHashtable.hpp"
 #include "classfile/javaClasses.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "logging/logMessage.hpp"
 #include "memory/metadataFactory.hpp"
+#include "memory/universe.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/vmThread.hpp"
 #include "utilities/numberSeq.hpp"
 #include <sys/stat.h>
@@ -119,28 +124,71 @@ void CompactHashtableWriter::allocate_table() {
                                      SharedSpaceObjectAlignment);
 }
 
+// Fill in the entries of a single bucket, at the offset assigned to it by
+// dump_table().
+void CompactHashtableWriter::fill_bucket(int index) {
+  GrowableArray<Entry>* bucket = _buckets[index];
+  int bucket_size = bucket->length();
+  u4 offset = BUCKET_OFFSET(_compact_buckets->at(index));
+  if (bucket_size == 1) {
+    // bucket with one entry is compacted and only has the symbol offset
+    _compact_entries->at_put(offset, bucket->at(0).value());
+  } else {
+    // regular bucket, each entry is a symbol (hash, offset) pair
+    for (int i=0; i<bucket_size; i++) {
+      Entry ent = bucket->at(i);
+      _compact_entries->at_put(offset++, u4(ent.hash())); // write entry hash
+      _compact_entries->at_put(offset++, ent.value());
+    }
+  }
+}
+
+// Fills the entry array with the safepoint workers. The bucket offsets have
+// already been assigned, so each claimed bucket writes to a disjoint slice of
+// the entry array and the result is identical to a serially dumped table.
+class CompactHashtableDumpTask : public WorkerTask {
+  CompactHashtableWriter* _writer;
+  volatile int _claim_index;
+  static const int claim_stride = 256; // buckets claimed at a time
+
+public:
+  CompactHashtableDumpTask(CompactHashtableWriter* writer) :
+    WorkerTask("CompactHashtable dump"), _writer(writer), _claim_index(0) {}
+
+  void work(uint worker_id) {
+    int num_buckets = _writer->_num_buckets;
+    for (;;) {
+      int start = Atomic::fetch_and_add(&_claim_index, claim_stride);
+      if (start >= num_buckets) {
+        return;
+      }
+      int end = MIN2(start + claim_stride, num_buckets);
+      for (int index = start; index < end; index++) {
+        _writer->fill_bucket(index);
+      }
+    }
+  }
+};
+
+// Don't bother distributing the work for small tables.
+static const int parallel_dump_min_buckets = 1024;
+
 // Write the compact table's buckets
 void CompactHashtableWriter::dump_table(NumberSeq* summary) {
+  // First pass: assign each bucket its type and its offset into the entry
+  // array. This is a cheap serial prefix sum over the bucket sizes; it fixes
+  // the layout, so the buckets can afterwards be filled in any order (in
+  // particular in parallel) and still produce a deterministic archive.
   u4 offset = 0;
   for (int index = 0; index < _num_buckets; index++) {
-    GrowableArray<Entry>* bucket = _buckets[index];
-    int bucket_size = bucket->length();
+    int bucket_size = _buckets[index]->length();
     if (bucket_size == 1) {
-      // bucket with one entry is compacted and only has the symbol offset
       _compact_buckets->at_put(index, BUCKET_INFO(offset, VALUE_ONLY_BUCKET_TYPE));
-
-      Entry ent = bucket->at(0);
-      _compact_entries->at_put(offset++, ent.value());
+      offset += 1;
       _num_value_only_buckets++;
     } else {
-      // regular bucket, each entry is a symbol (hash, offset) pair
       _compact_buckets->at_put(index, BUCKET_INFO(offset, REGULAR_BUCKET_TYPE));
-
-      for (int i=0; i<bucket_size; i++) {
-        Entry ent = bucket->at(i);
-        _compact_entries->at_put(offset++, u4(ent.hash())); // write entry hash
-        _compact_entries->at_put(offset++, ent.value());
-      }
+      offset += 2 * bucket_size;
       if (bucket_size == 0) {
         _num_empty_buckets++;
       } else {
@@ -153,6 +201,22 @@ void CompactHashtableWriter::dump_table(NumberSeq* summary) {
   // Mark the end of the buckets
   _compact_buckets->at_put(_num_buckets, BUCKET_INFO(offset, TABLEEND_BUCKET_TYPE));
   assert(offset == (u4)_compact_entries->length(), "sanity");
+
+  // Second pass: fill in the entries, in parallel if the table is large and
+  // workers are available (the static and dynamic dumps both run inside a
+  // safepoint).
+  WorkerThreads* workers = NULL;
+  if (SafepointSynchronize::is_at_safepoint() && _num_buckets >= parallel_dump_min_buckets) {
+    workers = Universe::heap()->safepoint_workers();
+  }
+  if (workers != NULL) {
+    CompactHashtableDumpTask task(this);
+    workers->run_task(&task);
+  } else {
+    for (int index = 0; index < _num_buckets; index++) {
+      fill_bucket(index);
+    }
+  }
 }
 
 
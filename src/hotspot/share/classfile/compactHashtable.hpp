@@ -83,6 +83,7 @@ public:
 // still written out for faster lookup.
 //
 class CompactHashtableWriter: public StackObj {
+  friend class CompactHashtableDumpTask;
 public:
   class Entry {
     unsigned int _hash;
@@ -125,6 +126,7 @@ public:
 private:
   void allocate_table();
   void dump_table(NumberSeq* summary);
+  void fill_bucket(int index);
   static int calculate_num_buckets(int num_entries) {
     int num_buckets = num_entries / SharedSymbolTableBucketSize;
     // calculation of num_buckets can result in zero buckets, we need at least one
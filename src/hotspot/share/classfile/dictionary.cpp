@@ -44,6 +44,7 @@
 #include "runtime/javaCalls.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/safepointVerifiers.hpp"
+#include "runtime/thread.hpp"
 #include "utilities/growableArray.hpp"
 #include "utilities/hashtable.inline.hpp"
 
@@ -94,6 +95,9 @@ void Dictionary::free_entry(DictionaryEntry* entry) {
     entry->release_set_pd_set(to_delete->next_acquire());
     delete to_delete;
   }
+  // The entry's address may be recycled, so stale per-thread approval memos
+  // must not match it anymore.
+  ProtectionDomainMemo::invalidate();
   BasicHashtable<mtClass>::free_entry(entry);
 }
 
@@ -136,9 +140,25 @@ bool Dictionary::resize_if_needed() {
 
 bool DictionaryEntry::is_valid_protection_domain(Handle protection_domain) {
 
-  return protection_domain() == NULL || !java_lang_System::allow_security_manager()
-        ? true
-        : contains_protection_domain(protection_domain());
+  if (protection_domain() == NULL || !java_lang_System::allow_security_manager()) {
+    return true;
+  }
+  Thread* current = Thread::current();
+  if (current->is_Java_thread()) {
+    // With a security manager the same few domains are validated against the
+    // same entries over and over, so check the calling thread's memo of
+    // recently approved pairs before walking the pd_set.
+    ProtectionDomainMemo* memo = JavaThread::cast(current)->pd_memo();
+    if (memo->contains(this, protection_domain())) {
+      return true;
+    }
+    if (contains_protection_domain(protection_domain())) {
+      memo->add(this, protection_domain);
+      return true;
+    }
+    return false;
+  }
+  return contains_protection_domain(protection_domain());
 }
 
 // Reading the pd_set on each DictionaryEntry is lock free and cannot safepoint.
@@ -321,6 +341,19 @@ InstanceKlass* Dictionary::find(unsigned int hash, Symbol* name,
   }
 }
 
+// Lock-free variant of find_class() for read paths that must not take
+// SystemDictionary_lock. This is safe for the same reason find() is:
+// entries are linked into their bucket in an MT-safe manner and are only
+// removed when the owning class loader is unloaded, which cannot happen
+// while a reader holds the loader alive.
+InstanceKlass* Dictionary::find_class_no_lock(unsigned int hash, Symbol* name) {
+  NoSafepointVerifier nsv;
+
+  int index = hash_to_index(hash);
+  DictionaryEntry* entry = get_entry(index, hash, name);
+  return (entry != NULL) ? entry->instance_klass() : NULL;
+}
+
 InstanceKlass* Dictionary::find_class(unsigned int hash,
                                       Symbol* name) {
   assert_locked_or_safepoint(SystemDictionary_lock);
@@ -62,6 +62,7 @@ public:
   void add_klass(unsigned int hash, Symbol* class_name, InstanceKlass* obj);
 
   InstanceKlass* find_class(unsigned int hash, Symbol* name);
+  InstanceKlass* find_class_no_lock(unsigned int hash, Symbol* name);
 
   void classes_do(void f(InstanceKlass*));
   void classes_do(void f(InstanceKlass*, TRAPS), TRAPS);
@@ -26,6 +26,7 @@
 #include "jvm.h"
 #include "classfile/classFileParser.hpp"
 #include "classfile/fieldLayoutBuilder.hpp"
+#include "classfile/fieldLayoutProfile.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/array.hpp"
 #include "oops/fieldStreams.inline.hpp"
@@ -506,6 +507,7 @@ FieldLayoutBuilder::FieldLayoutBuilder(const Symbol* classname, const InstanceKl
   _fields(fields),
   _info(info),
   _root_group(NULL),
+  _hot_group(NULL),
   _contended_groups(GrowableArray<FieldGroup*>(8)),
   _static_fields(NULL),
   _layout(NULL),
@@ -539,6 +541,7 @@ void FieldLayoutBuilder::prologue() {
   _static_layout->initialize_static_layout();
   _static_fields = new FieldGroup();
   _root_group = new FieldGroup();
+  _hot_group = new FieldGroup();
 }
 
 // Field sorting for regular classes:
@@ -546,6 +549,8 @@ void FieldLayoutBuilder::prologue() {
 //   - non-static fields are also sorted according to their contention group
 //     (support of the @Contended annotation)
 //   - @Contended annotation is ignored for static fields
+//   - non-contended fields listed in the field layout profile (if any) are
+//     sorted into a dedicated hot group, allocated ahead of the root group
 void FieldLayoutBuilder::regular_field_sorting() {
   for (AllFieldStream fs(_fields, _constant_pool); !fs.done(); fs.next()) {
     FieldGroup* group = NULL;
@@ -554,6 +559,7 @@ void FieldLayoutBuilder::regular_field_sorting() {
     } else {
       _has_nonstatic_fields = true;
       if (fs.is_contended()) {
+        // Contention isolation takes precedence over the layout profile
         int g = fs.contended_group();
         if (g == 0) {
           group = new FieldGroup(true);
@@ -561,6 +567,9 @@ void FieldLayoutBuilder::regular_field_sorting() {
         } else {
           group = get_or_create_contended_group(g);
         }
+      } else if (FieldLayoutProfile::has_profile() &&
+                 FieldLayoutProfile::is_hot_field(_classname, fs.name())) {
+        group = _hot_group;
       } else {
         group = _root_group;
       }
@@ -588,6 +597,7 @@ void FieldLayoutBuilder::regular_field_sorting() {
     }
   }
   _root_group->sort_by_size();
+  _hot_group->sort_by_size();
   _static_fields->sort_by_size();
   if (!_contended_groups.is_empty()) {
     for (int i = 0; i < _contended_groups.length(); i++) {
@@ -620,6 +630,11 @@ void FieldLayoutBuilder::compute_regular_layout() {
     insert_contended_padding(_layout->start());
     need_tail_padding = true;
   }
+  // Hot fields are allocated first so the best-fit search clusters them
+  // in the first empty slots after the object header, where they share as
+  // few cache lines as possible
+  _layout->add(_hot_group->primitive_fields());
+  _layout->add(_hot_group->oop_fields());
   _layout->add(_root_group->primitive_fields());
   _layout->add(_root_group->oop_fields());
 
@@ -656,6 +671,13 @@ void FieldLayoutBuilder::epilogue() {
     _super_klass->nonstatic_oop_map_count());
   }
 
+  if (_hot_group->oop_fields() != NULL) {
+    for (int i = 0; i < _hot_group->oop_fields()->length(); i++) {
+      LayoutRawBlock* b = _hot_group->oop_fields()->at(i);
+      nonstatic_oop_maps->add(b->offset(), 1);
+    }
+  }
+
   if (_root_group->oop_fields() != NULL) {
     for (int i = 0; i < _root_group->oop_fields()->length(); i++) {
       LayoutRawBlock* b = _root_group->oop_fields()->at(i);
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/fieldLayoutProfile.hpp"
+#include "oops/symbol.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+
+GrowableArrayCHeap<FieldLayoutProfile::HotField, mtClass>* FieldLayoutProfile::_hot_fields = NULL;
+
+// A line is "<classname> <fieldname>", separated by spaces or tabs.
+// Empty lines and lines starting with '#' are ignored.
+void FieldLayoutProfile::parse_line(char* line, int line_no) {
+  while (*line == ' ' || *line == '\t') line++;
+  if (*line == '\0' || *line == '#') {
+    return;
+  }
+  char* class_name = line;
+  while (*line != '\0' && *line != ' ' && *line != '\t') line++;
+  if (*line == '\0') {
+    warning("FieldLayoutProfileFile: line %d has no field name, ignored", line_no);
+    return;
+  }
+  *line++ = '\0';
+  while (*line == ' ' || *line == '\t') line++;
+  char* field_name = line;
+  while (*line != '\0' && *line != ' ' && *line != '\t') line++;
+  *line = '\0';
+  if (*field_name == '\0') {
+    warning("FieldLayoutProfileFile: line %d has no field name, ignored", line_no);
+    return;
+  }
+
+  // Accept class names in the Java language form as well
+  for (char* p = class_name; *p != '\0'; p++) {
+    if (*p == '.') *p = '/';
+  }
+
+  HotField hf;
+  hf._class_name = os::strdup(class_name, mtClass);
+  hf._field_name = os::strdup(field_name, mtClass);
+  _hot_fields->append(hf);
+}
+
+void FieldLayoutProfile::parse_from_file() {
+  FILE* stream = os::fopen(FieldLayoutProfileFile, "rt");
+  if (stream == NULL) {
+    warning("Could not open field layout profile file: %s", FieldLayoutProfileFile);
+    return;
+  }
+
+  _hot_fields = new GrowableArrayCHeap<HotField, mtClass>(16);
+
+  char line[1024];
+  int line_no = 0;
+  while (fgets(line, sizeof(line), stream) != NULL) {
+    line_no++;
+    line[strcspn(line, "\r\n")] = '\0';
+    parse_line(line, line_no);
+  }
+  fclose(stream);
+}
+
+void FieldLayoutProfile::initialize() {
+  if (FieldLayoutProfileFile != NULL) {
+    parse_from_file();
+  }
+}
+
+bool FieldLayoutProfile::is_hot_field(const Symbol* classname, const Symbol* fieldname) {
+  assert(has_profile(), "Should only be called with a profile loaded");
+  for (int i = 0; i < _hot_fields->length(); i++) {
+    const HotField& hf = _hot_fields->at(i);
+    if (classname->equals(hf._class_name) && fieldname->equals(hf._field_name)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void fieldLayoutProfile_init() {
+  FieldLayoutProfile::initialize();
+}
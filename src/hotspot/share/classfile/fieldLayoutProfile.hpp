@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_CLASSFILE_FIELDLAYOUTPROFILE_HPP
+#define SHARE_CLASSFILE_FIELDLAYOUTPROFILE_HPP
+
+#include "memory/allStatic.hpp"
+#include "utilities/growableArray.hpp"
+
+class Symbol;
+
+// FieldLayoutProfile holds the set of hot instance fields read from the file
+// specified with -XX:FieldLayoutProfileFile. The file is a plain text field
+// access profile gathered during a training run, one field per line:
+//
+//     <classname> <fieldname>
+//
+// Class names can use either the internal form (java/util/HashMap) or the
+// Java language form (java.util.HashMap). Empty lines and lines starting
+// with '#' are ignored.
+//
+// FieldLayoutBuilder consults the profile when computing instance layouts
+// and allocates hot fields first, so they cluster in the lowest offsets of
+// the instance, right after the object header (see compute_regular_layout()).
+//
+// The profile is parsed once, before any class is loaded, and is immutable
+// afterwards, so lookups require no synchronization.
+class FieldLayoutProfile : public AllStatic {
+ private:
+  struct HotField {
+    const char* _class_name;  // internal form
+    const char* _field_name;
+  };
+
+  static GrowableArrayCHeap<HotField, mtClass>* _hot_fields;
+
+  static void parse_line(char* line, int line_no);
+  static void parse_from_file();
+
+ public:
+  static void initialize();
+
+  static bool has_profile() { return _hot_fields != NULL; }
+
+  // Returns true if the profile marks classname.fieldname as hot.
+  static bool is_hot_field(const Symbol* classname, const Symbol* fieldname);
+};
+
+#endif // SHARE_CLASSFILE_FIELDLAYOUTPROFILE_HPP
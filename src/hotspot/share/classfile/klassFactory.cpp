@@ -156,6 +156,10 @@ static ClassFileStream* check_class_file_load_hook(ClassFileStream* stream,
                                    end_ptr - ptr,
                                    stream->source(),
                                    stream->need_verify());
+      if (state != NULL && state->get_class_being_redefined() != NULL) {
+        // Let VM_RedefineClasses know the transformation was not a no-op
+        state->set_class_being_redefined_modified();
+      }
     }
   }
 
@@ -38,6 +38,12 @@
 
 MetadataOnStackBuffer* MetadataOnStackMark::_used_buffers = NULL;
 MetadataOnStackBuffer* MetadataOnStackMark::_free_buffers = NULL;
+uint                   MetadataOnStackMark::_free_buffer_count = 0;
+
+// Number of empty buffers kept for reuse by the next walk. Buffers beyond
+// this are freed when a walk completes, so a large redefinition burst does
+// not pin its peak buffer footprint for the rest of the VM's lifetime.
+static const uint max_free_buffers = 8;
 
 MetadataOnStackBuffer* MetadataOnStackMark::_current_buffer = NULL;
 NOT_PRODUCT(bool MetadataOnStackMark::_is_active = false;)
@@ -95,11 +101,17 @@ MetadataOnStackMark::~MetadataOnStackMark() {
 
     MetadataOnStackBuffer* next = buffer->next_used();
 
-    // Move the buffer to the free list.
-    buffer->clear();
-    buffer->set_next_used(NULL);
-    buffer->set_next_free(_free_buffers);
-    _free_buffers = buffer;
+    if (_free_buffer_count < max_free_buffers) {
+      // Move the buffer to the free list.
+      buffer->clear();
+      buffer->set_next_used(NULL);
+      buffer->set_next_free(_free_buffers);
+      _free_buffers = buffer;
+      _free_buffer_count++;
+    } else {
+      // Keep only a small reserve of empty buffers between walks.
+      delete buffer;
+    }
 
     // Step to next used buffer.
     buffer = next;
@@ -130,6 +142,8 @@ MetadataOnStackBuffer* MetadataOnStackMark::allocate_buffer() {
 
   if (allocated != NULL) {
     _free_buffers = allocated->next_free();
+    assert(_free_buffer_count > 0, "free list count out of sync");
+    _free_buffer_count--;
   }
 
   if (allocated == NULL) {
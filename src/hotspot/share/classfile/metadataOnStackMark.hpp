@@ -42,6 +42,7 @@ class MetadataOnStackMark : public StackObj {
   NOT_PRODUCT(static bool _is_active;)
   static MetadataOnStackBuffer* _used_buffers;
   static MetadataOnStackBuffer* _free_buffers;
+  static uint                   _free_buffer_count;
   static MetadataOnStackBuffer* _current_buffer;
 
   static MetadataOnStackBuffer* allocate_buffer();
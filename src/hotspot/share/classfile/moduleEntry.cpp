@@ -37,15 +37,54 @@
 #include "memory/universe.hpp"
 #include "oops/oopHandle.inline.hpp"
 #include "oops/symbol.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "utilities/events.hpp"
 #include "utilities/growableArray.hpp"
 #include "utilities/hashtable.inline.hpp"
 #include "utilities/ostream.hpp"
+#include "utilities/powerOfTwo.hpp"
 #include "utilities/quickSort.hpp"
 #include "utilities/resourceHash.hpp"
 
+FrozenEntryTable::FrozenEntryTable(int num_entries) : _entry_count(num_entries) {
+  assert(num_entries > 0, "sanity");
+  // Keep the load factor at or below 50% so probe sequences stay short.
+  _size = round_up_power_of_2(num_entries * 2);
+  _slots = NEW_C_HEAP_ARRAY(EntryType*, _size, mtModule);
+  for (int i = 0; i < _size; i++) {
+    _slots[i] = NULL;
+  }
+}
+
+FrozenEntryTable::~FrozenEntryTable() {
+  FREE_C_HEAP_ARRAY(EntryType*, _slots);
+}
+
+void FrozenEntryTable::add(EntryType* entry) {
+  int slot = (int)(entry->hash() & (unsigned int)(_size - 1));
+  while (_slots[slot] != NULL) {
+    slot = (slot + 1) & (_size - 1);
+  }
+  _slots[slot] = entry;
+}
+
+HashtableEntry<Symbol*, mtModule>* FrozenEntryTable::lookup(Symbol* name) const {
+  unsigned int hash = (unsigned int)name->identity_hash();
+  int slot = (int)(hash & (unsigned int)(_size - 1));
+  // The load factor guarantees empty slots, so an unsuccessful probe
+  // sequence always terminates at one.
+  while (_slots[slot] != NULL) {
+    EntryType* e = _slots[slot];
+    if (e->hash() == hash && e->literal()->fast_compare(name) == 0) {
+      return e;
+    }
+    slot = (slot + 1) & (_size - 1);
+  }
+  return NULL;
+}
+
 ModuleEntry* ModuleEntryTable::_javabase_module = NULL;
 
 oop ModuleEntry::module() const { return _module.resolve(); }
@@ -326,7 +365,7 @@ void ModuleEntry::delete_unnamed_module() {
 }
 
 ModuleEntryTable::ModuleEntryTable(int table_size)
-  : Hashtable<Symbol*, mtModule>(table_size, sizeof(ModuleEntry))
+  : Hashtable<Symbol*, mtModule>(table_size, sizeof(ModuleEntry)), _frozen_table(NULL)
 {
 }
 
@@ -361,6 +400,7 @@ ModuleEntryTable::~ModuleEntryTable() {
     }
   }
   assert(number_of_entries() == 0, "should have removed all entries");
+  delete _frozen_table;
 }
 
 void ModuleEntry::set_loader_data(ClassLoaderData* cld) {
@@ -633,6 +673,14 @@ ModuleEntry* ModuleEntryTable::locked_create_entry(Handle module_handle,
 // lookup_only by Symbol* to find a ModuleEntry.
 ModuleEntry* ModuleEntryTable::lookup_only(Symbol* name) {
   assert(name != NULL, "name cannot be NULL");
+  FrozenEntryTable* frozen = Atomic::load_acquire(&_frozen_table);
+  if (frozen != NULL) {
+    ModuleEntry* m = (ModuleEntry*)frozen->lookup(name);
+    if (m != NULL || frozen->entry_count() == number_of_entries()) {
+      return m;
+    }
+    // A module was defined after the freeze; check the mutable table.
+  }
   int index = index_for(name);
   for (ModuleEntry* m = bucket(index); m != NULL; m = m->next()) {
     if (m->name()->fast_compare(name) == 0) {
@@ -642,6 +690,21 @@ ModuleEntry* ModuleEntryTable::lookup_only(Symbol* name) {
   return NULL;
 }
 
+void ModuleEntryTable::freeze() {
+  assert(Module_lock->owned_by_self(), "should have the Module_lock");
+  assert(_frozen_table == NULL, "table already frozen");
+  if (number_of_entries() == 0) {
+    return;
+  }
+  FrozenEntryTable* frozen = new FrozenEntryTable(number_of_entries());
+  for (int i = 0; i < table_size(); i++) {
+    for (ModuleEntry* m = bucket(i); m != NULL; m = m->next()) {
+      frozen->add(m);
+    }
+  }
+  Atomic::release_store(&_frozen_table, frozen);
+}
+
 // Remove dead modules from all other alive modules' reads list.
 // This should only occur at class unloading.
 void ModuleEntryTable::purge_all_module_reads() {
@@ -207,6 +207,33 @@ class ModuleClosure: public StackObj {
   virtual void do_module(ModuleEntry* module) = 0;
 };
 
+// A read-only, open-addressed snapshot of a module or package entry table.
+// It is built while holding the Module_lock, once the module graph has been
+// frozen, and is probed lock-free afterwards; it is never mutated once
+// published.  Entries added to the mutable table after the snapshot was taken
+// are not visible here; the owning table detects that case by comparing its
+// current entry count against entry_count() and falls back to the mutable
+// table (see ModuleEntryTable::lookup_only and PackageEntryTable::lookup_only).
+class FrozenEntryTable : public CHeapObj<mtModule> {
+  typedef HashtableEntry<Symbol*, mtModule> EntryType;
+
+  int _size;         // number of slots, a power of two
+  int _entry_count;  // entries in the mutable table when the snapshot was taken
+  EntryType** _slots;
+
+ public:
+  FrozenEntryTable(int num_entries);
+  ~FrozenEntryTable();
+
+  int entry_count() const { return _entry_count; }
+
+  // Insert an entry while building the snapshot.  The entry's stored hash is
+  // the identity hash of its name, see compute_hash() in the entry tables.
+  void add(EntryType* entry);
+
+  EntryType* lookup(Symbol* name) const;
+};
+
 
 // The ModuleEntryTable is a Hashtable containing a list of all modules defined
 // by a particular class loader.  Each module is represented as a ModuleEntry node.
@@ -231,6 +258,10 @@ public:
 private:
   static ModuleEntry* _javabase_module;
 
+  // Read-only snapshot of this table, probed lock-free by lookup_only().
+  // NULL until freeze() has been called.
+  FrozenEntryTable* volatile _frozen_table;
+
   ModuleEntry* new_entry(unsigned int hash, Handle module_handle, bool is_open,
                          Symbol* name, Symbol* version, Symbol* location, ClassLoaderData* loader_data);
   void add_entry(int index, ModuleEntry* new_entry);
@@ -264,6 +295,12 @@ public:
   // Only lookup module within loader's module entry table.  The table read is lock-free.
   ModuleEntry* lookup_only(Symbol* name);
 
+  // Build a read-only snapshot of the current entries, served lock-free by
+  // lookup_only().  Called once the module graph has been frozen; modules
+  // defined after that (dynamic layers) are found through the mutable table.
+  // Assume Module_lock was taken by caller.
+  void freeze();
+
   // purge dead weak references out of reads list
   void purge_all_module_reads();
 
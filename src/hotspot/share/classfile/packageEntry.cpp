@@ -33,6 +33,7 @@
 #include "memory/resourceArea.hpp"
 #include "oops/array.hpp"
 #include "oops/symbol.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/java.hpp"
 #include "runtime/handles.inline.hpp"
 #include "utilities/events.hpp"
@@ -170,7 +171,7 @@ void PackageEntry::delete_qualified_exports() {
 }
 
 PackageEntryTable::PackageEntryTable(int table_size)
-  : Hashtable<Symbol*, mtModule>(table_size, sizeof(PackageEntry))
+  : Hashtable<Symbol*, mtModule>(table_size, sizeof(PackageEntry)), _frozen_table(NULL)
 {
 }
 
@@ -191,6 +192,7 @@ PackageEntryTable::~PackageEntryTable() {
     }
   }
   assert(number_of_entries() == 0, "should have removed all entries");
+  delete _frozen_table;
 }
 
 #if INCLUDE_CDS_JAVA_HEAP
@@ -367,10 +369,33 @@ PackageEntry* PackageEntryTable::lookup(Symbol* name, ModuleEntry* module) {
 
 PackageEntry* PackageEntryTable::lookup_only(Symbol* name) {
   assert(!Module_lock->owned_by_self(), "should not have the Module_lock - use locked_lookup_only");
+  FrozenEntryTable* frozen = Atomic::load_acquire(&_frozen_table);
+  if (frozen != NULL) {
+    PackageEntry* p = (PackageEntry*)frozen->lookup(name);
+    if (p != NULL || frozen->entry_count() == number_of_entries()) {
+      return p;
+    }
+    // A package was created after the freeze; check the mutable table.
+  }
   MutexLocker ml(Module_lock);
   return locked_lookup_only(name);
 }
 
+void PackageEntryTable::freeze() {
+  assert(Module_lock->owned_by_self(), "should have the Module_lock");
+  assert(_frozen_table == NULL, "table already frozen");
+  if (number_of_entries() == 0) {
+    return;
+  }
+  FrozenEntryTable* frozen = new FrozenEntryTable(number_of_entries());
+  for (int i = 0; i < table_size(); i++) {
+    for (PackageEntry* p = bucket(i); p != NULL; p = p->next()) {
+      frozen->add(p);
+    }
+  }
+  Atomic::release_store(&_frozen_table, frozen);
+}
+
 PackageEntry* PackageEntryTable::locked_lookup_only(Symbol* name) {
   assert(Module_lock->owned_by_self(), "should have the Module_lock");
   int index = index_for(name);
@@ -258,6 +258,10 @@ public:
   };
 
 private:
+  // Read-only snapshot of this table, probed lock-free by lookup_only().
+  // NULL until freeze() has been called.
+  FrozenEntryTable* volatile _frozen_table;
+
   PackageEntry* new_entry(unsigned int hash, Symbol* name, ModuleEntry* module);
   void add_entry(int index, PackageEntry* new_entry);
 
@@ -291,9 +295,16 @@ public:
   PackageEntry* lookup(Symbol* name, ModuleEntry* module);
 
   // Only lookup Package within loader's package entry table.
-  // This will acquire the Module lock.
+  // This will acquire the Module lock, unless the lookup can be satisfied
+  // lock-free from the frozen snapshot, see freeze().
   PackageEntry* lookup_only(Symbol* Package);
 
+  // Build a read-only snapshot of the current entries, served lock-free by
+  // lookup_only().  Called once the module graph has been frozen; packages
+  // created after that fall back to the mutable table.  Assume Module lock
+  // was taken by caller.
+  void freeze();
+
   // Only lookup Package within loader's package entry table.  Assume Module lock
   // was taken by caller.
   PackageEntry* locked_lookup_only(Symbol* Package);
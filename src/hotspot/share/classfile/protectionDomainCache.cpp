@@ -38,6 +38,57 @@
 #include "utilities/growableArray.hpp"
 #include "utilities/hashtable.inline.hpp"
 
+volatile int ProtectionDomainMemo::_entry_epoch = 0;
+
+ProtectionDomainMemo::ProtectionDomainMemo() : _epoch(Atomic::load(&_entry_epoch)), _next(0) {
+  for (int i = 0; i < _num_slots; i++) {
+    _slots[i]._entry = NULL;
+  }
+}
+
+ProtectionDomainMemo::~ProtectionDomainMemo() {
+  clear();
+}
+
+void ProtectionDomainMemo::clear() {
+  for (int i = 0; i < _num_slots; i++) {
+    if (_slots[i]._entry != NULL) {
+      _slots[i]._entry = NULL;
+      _slots[i]._pd.release(Universe::vm_weak());
+      _slots[i]._pd = WeakHandle();
+    }
+  }
+  _next = 0;
+}
+
+bool ProtectionDomainMemo::contains(const DictionaryEntry* entry, oop protection_domain) {
+  if (Atomic::load(&_entry_epoch) != _epoch) {
+    // Some dictionary entries have been freed since the slots were filled;
+    // an entry address may have been recycled, so drop everything.
+    clear();
+    _epoch = Atomic::load(&_entry_epoch);
+    return false;
+  }
+  for (int i = 0; i < _num_slots; i++) {
+    // The peek does not keep the protection domain alive, but a hit only
+    // confirms an oop the caller already holds in a Handle.
+    if (_slots[i]._entry == entry && _slots[i]._pd.peek() == protection_domain) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void ProtectionDomainMemo::add(const DictionaryEntry* entry, Handle protection_domain) {
+  Slot* slot = &_slots[_next];
+  _next = (_next + 1) % _num_slots;
+  if (slot->_entry != NULL) {
+    slot->_pd.release(Universe::vm_weak());
+  }
+  slot->_pd = WeakHandle(Universe::vm_weak(), protection_domain);
+  slot->_entry = entry;
+}
+
 unsigned int ProtectionDomainCacheTable::compute_hash(Handle protection_domain) {
   // Identity hash can safepoint, so keep protection domain in a Handle.
   return (unsigned int)(protection_domain->identity_hash());
@@ -30,6 +30,8 @@
 #include "runtime/atomic.hpp"
 #include "utilities/hashtable.hpp"
 
+class DictionaryEntry;
+
 // This class caches the approved protection domains that can access loaded classes.
 // Dictionary entry pd_set point to entries in this hashtable.   Please refer
 // to dictionary.hpp pd_set for more information about how protection domain entries
@@ -102,6 +104,39 @@ public:
 };
 
 
+// Small per-thread memo of recently approved (dictionary entry, protection
+// domain) pairs, checked before walking a dictionary entry's pd_set. With a
+// security manager enabled the same few domains are validated against the
+// same entries over and over, so a handful of slots catches most lookups.
+// The protection domains are held weakly so the memo does not keep them
+// alive; the dictionary entry pointer is only ever compared, never
+// dereferenced, and all memos are invalidated through an epoch counter when
+// dictionary entries are freed.
+class ProtectionDomainMemo : public CHeapObj<mtClass> {
+  static const int _num_slots = 4;
+  static volatile int _entry_epoch;  // bumped when dictionary entries are freed
+
+  struct Slot {
+    const DictionaryEntry* _entry;
+    WeakHandle             _pd;
+  };
+  Slot _slots[_num_slots];
+  int  _epoch;  // value of _entry_epoch when the slots were filled
+  int  _next;   // next slot to replace, round-robin
+
+  void clear();
+ public:
+  ProtectionDomainMemo();
+  ~ProtectionDomainMemo();
+
+  bool contains(const DictionaryEntry* entry, oop protection_domain);
+  void add(const DictionaryEntry* entry, Handle protection_domain);
+
+  // Called when dictionary entries are freed, so a recycled entry address
+  // cannot match a stale memo slot.
+  static void invalidate() { Atomic::inc(&_entry_epoch); }
+};
+
 // This describes the linked list protection domain for each DictionaryEntry in pd_set.
 class ProtectionDomainEntry :public CHeapObj<mtClass> {
   ProtectionDomainCacheEntry* _pd_cache;
@@ -35,6 +35,7 @@
 #include "gc/shared/oopStorage.inline.hpp"
 #include "gc/shared/oopStorageSet.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
@@ -99,6 +100,7 @@ typedef ConcurrentHashTable<StringTableConfig, mtSymbol> StringTableHash;
 static StringTableHash* _local_table = NULL;
 
 volatile bool StringTable::_has_work = false;
+volatile size_t StringTable::_uncleaned_items_count = 0;
 volatile bool StringTable::_needs_rehashing = false;
 OopStorage*   StringTable::_oop_storage;
 
@@ -394,24 +396,30 @@ oop StringTable::do_intern(Handle string_or_null_h, const jchar* name,
 
 // Concurrent work
 void StringTable::grow(JavaThread* jt) {
-  StringTableHash::GrowTask gt(_local_table);
-  if (!gt.prepare(jt)) {
-    return;
-  }
-  log_trace(stringtable)("Started to grow");
-  {
-    TraceTime timer("Grow", TRACETIME_LOG(Debug, stringtable, perf));
-    while (gt.do_task(jt)) {
-      gt.pause(jt);
-      {
-        ThreadBlockInVM tbivm(jt);
+  // One GrowTask doubles the bucket count once. Under a heavy interning burst
+  // the load factor can be several times the preferred value by the time the
+  // service thread gets here, so keep doubling until the table has caught up,
+  // instead of going through a new trigger round for every doubling.
+  do {
+    StringTableHash::GrowTask gt(_local_table);
+    if (!gt.prepare(jt)) {
+      return;
+    }
+    log_trace(stringtable)("Started to grow");
+    {
+      TraceTime timer("Grow", TRACETIME_LOG(Debug, stringtable, perf));
+      while (gt.do_task(jt)) {
+        gt.pause(jt);
+        {
+          ThreadBlockInVM tbivm(jt);
+        }
+        gt.cont(jt);
       }
-      gt.cont(jt);
     }
-  }
-  gt.done(jt);
-  _current_size = table_size();
-  log_debug(stringtable)("Grown to size:" SIZE_FORMAT, _current_size);
+    gt.done(jt);
+    _current_size = table_size();
+    log_debug(stringtable)("Grown to size:" SIZE_FORMAT, _current_size);
+  } while (get_load_factor() > PREF_AVG_LIST_LEN && !_local_table->is_max_size_reached());
 }
 
 struct StringTableDoDelete : StackObj {
@@ -442,6 +450,9 @@ void StringTable::clean_dead_entries(JavaThread* jt) {
     return;
   }
 
+  // Entries dying from here on are reported by the next GC.
+  Atomic::store(&_uncleaned_items_count, (size_t)0);
+
   StringTableDeleteCheck stdc;
   StringTableDoDelete stdd;
   {
@@ -460,6 +471,7 @@ void StringTable::clean_dead_entries(JavaThread* jt) {
 
 void StringTable::gc_notification(size_t num_dead) {
   log_trace(stringtable)("Uncleaned items:" SIZE_FORMAT, num_dead);
+  Atomic::store(&_uncleaned_items_count, num_dead);
 
   if (has_work()) {
     return;
@@ -493,24 +505,58 @@ void StringTable::do_concurrent_work(JavaThread* jt) {
     clean_dead_entries(jt);
   }
   Atomic::release_store(&_has_work, false);
+
+  // Under heavy interning churn one pass can be insufficient: growing may
+  // leave the dead entries from the last GC in place, and cleaning may finish
+  // with the table still over the preferred load factor. Re-trigger instead
+  // of waiting for the next GC notification, so the ServiceThread keeps up.
+  double dead_factor = get_dead_factor(Atomic::load(&_uncleaned_items_count));
+  load_factor = get_load_factor();
+  if ((load_factor > PREF_AVG_LIST_LEN && !_local_table->is_max_size_reached()) ||
+      (dead_factor > CLEAN_DEAD_HIGH_WATER_MARK)) {
+    log_debug(stringtable)("Follow-up concurrent work triggered, live factor: %g dead factor: %g",
+                           load_factor, dead_factor);
+    trigger_concurrent_work();
+  }
 }
 
 // Rehash
-bool StringTable::do_rehash() {
+class StringTableRehashTask : public WorkerTask {
+  StringTableHash::MoveTask& _move_task;
+public:
+  StringTableRehashTask(StringTableHash::MoveTask& move_task) :
+    WorkerTask("Rehash String Table"), _move_task(move_task) {}
+  void work(uint worker_id) {
+    Thread* thread = Thread::current();
+    while (_move_task.do_task(thread)) { /* empty */ }
+  }
+};
+
+bool StringTable::do_rehash(WorkerThreads* workers) {
   if (!_local_table->is_safepoint_safe()) {
     return false;
   }
 
+  Thread* thread = Thread::current();
   // We use current size, not max size.
-  size_t new_size = _local_table->get_size_log2(Thread::current());
+  size_t new_size = _local_table->get_size_log2(thread);
   StringTableHash* new_table = new StringTableHash(new_size, END_SIZE, REHASH_LEN);
   // Use alt hash from now on
   _alt_hash = true;
-  if (!_local_table->try_move_nodes_to(Thread::current(), new_table)) {
+  const bool is_mt = workers != NULL && workers->active_workers() > 1;
+  StringTableHash::MoveTask move_task(_local_table, new_table, is_mt);
+  if (!move_task.prepare(thread)) {
     _alt_hash = false;
     delete new_table;
     return false;
   }
+  if (is_mt) {
+    StringTableRehashTask task(move_task);
+    workers->run_task(&task);
+  } else {
+    while (move_task.do_task(thread)) { /* empty */ }
+  }
+  move_task.done(thread);
 
   // free old table
   delete _local_table;
@@ -519,7 +565,7 @@ bool StringTable::do_rehash() {
   return true;
 }
 
-void StringTable::rehash_table() {
+void StringTable::rehash_table(WorkerThreads* workers) {
   static bool rehashed = false;
   log_debug(stringtable)("Table imbalanced, rehashing called.");
 
@@ -541,7 +587,7 @@ void StringTable::rehash_table() {
 
   _alt_hash_seed = AltHashing::compute_seed();
   {
-    if (do_rehash()) {
+    if (do_rehash(workers)) {
       rehashed = true;
     } else {
       log_info(stringtable)("Resizes in progress rehashing skipped.");
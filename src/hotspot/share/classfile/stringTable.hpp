@@ -39,6 +39,7 @@ class SerializeClosure;
 class StringTable;
 class StringTableConfig;
 class StringTableCreateEntry;
+class WorkerThreads;
 
 class StringTable : public CHeapObj<mtSymbol>{
   friend class VMStructs;
@@ -47,6 +48,9 @@ class StringTable : public CHeapObj<mtSymbol>{
   friend class StringTableCreateEntry;
 
   static volatile bool _has_work;
+  // Number of dead entries reported by the most recent GC, cleared when a
+  // clean pass starts. Used to decide whether a follow-up pass is needed.
+  static volatile size_t _uncleaned_items_count;
 
   // Set if one bucket is out of balance due to hash algorithm deficiency
   static volatile bool _needs_rehashing;
@@ -74,7 +78,7 @@ class StringTable : public CHeapObj<mtSymbol>{
 
   static void print_table_statistics(outputStream* st);
 
-  static bool do_rehash();
+  static bool do_rehash(WorkerThreads* workers);
 
  public:
   static size_t table_size();
@@ -94,8 +98,9 @@ class StringTable : public CHeapObj<mtSymbol>{
   static oop intern(oop string, TRAPS);
   static oop intern(const char *utf8_string, TRAPS);
 
-  // Rehash the string table if it gets out of balance
-  static void rehash_table();
+  // Rehash the string table if it gets out of balance.
+  // The node move is striped over workers when a pool is passed in.
+  static void rehash_table(WorkerThreads* workers = NULL);
   static bool needs_rehashing() { return _needs_rehashing; }
   static inline void update_needs_rehash(bool rehash) {
     if (rehash) {
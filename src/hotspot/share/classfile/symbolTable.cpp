@@ -30,6 +30,7 @@
 #include "classfile/compactHashtable.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/symbolTable.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/metaspaceClosure.hpp"
 #include "memory/resourceArea.hpp"
@@ -459,9 +460,13 @@ Symbol* SymbolTable::lookup_only_unicode(const jchar* name, int utf16_length,
 void SymbolTable::new_symbols(ClassLoaderData* loader_data, const constantPoolHandle& cp,
                               int names_count, const char** names, int* lengths,
                               int* cp_indices, unsigned int* hashValues) {
-  // Note that c_heap will be true for non-strong hidden classes.
-  // even if their loader is the boot loader because they will have a different cld.
-  bool c_heap = !loader_data->is_the_null_class_loader_data();
+  // Classes in a permanent class loader data (one of the three builtin
+  // loaders, and not a non-strong hidden class, which gets its own cld even
+  // under a builtin loader) are never unloaded, so their constant pool
+  // symbols can never be released. Create those symbols permanent: permanent
+  // symbols carry the sticky PERM_REFCOUNT tag, which makes all later
+  // refcount updates a single load-and-branch instead of an atomic update.
+  bool c_heap = !loader_data->is_permanent_class_loader_data();
   for (int i = 0; i < names_count; i++) {
     const char *name = names[i];
     int len = lengths[i];
@@ -678,24 +683,30 @@ void SymbolTable::serialize_shared_table_header(SerializeClosure* soc,
 
 // Concurrent work
 void SymbolTable::grow(JavaThread* jt) {
-  SymbolTableHash::GrowTask gt(_local_table);
-  if (!gt.prepare(jt)) {
-    return;
-  }
-  log_trace(symboltable)("Started to grow");
-  {
-    TraceTime timer("Grow", TRACETIME_LOG(Debug, symboltable, perf));
-    while (gt.do_task(jt)) {
-      gt.pause(jt);
-      {
-        ThreadBlockInVM tbivm(jt);
+  // One GrowTask doubles the bucket count once. A class loading burst can
+  // push the load factor several times over the preferred value before the
+  // service thread gets here, so keep doubling until the table has caught up,
+  // instead of going through a new trigger round for every doubling.
+  do {
+    SymbolTableHash::GrowTask gt(_local_table);
+    if (!gt.prepare(jt)) {
+      return;
+    }
+    log_trace(symboltable)("Started to grow");
+    {
+      TraceTime timer("Grow", TRACETIME_LOG(Debug, symboltable, perf));
+      while (gt.do_task(jt)) {
+        gt.pause(jt);
+        {
+          ThreadBlockInVM tbivm(jt);
+        }
+        gt.cont(jt);
       }
-      gt.cont(jt);
     }
-  }
-  gt.done(jt);
-  _current_size = table_size();
-  log_debug(symboltable)("Grown to size:" SIZE_FORMAT, _current_size);
+    gt.done(jt);
+    _current_size = table_size();
+    log_debug(symboltable)("Grown to size:" SIZE_FORMAT, _current_size);
+  } while (get_load_factor() > PREF_AVG_LIST_LEN && !_local_table->is_max_size_reached());
 }
 
 struct SymbolTableDoDelete : StackObj {
@@ -776,21 +787,42 @@ void SymbolTable::do_concurrent_work(JavaThread* jt) {
 }
 
 // Rehash
-bool SymbolTable::do_rehash() {
+class SymbolTableRehashTask : public WorkerTask {
+  SymbolTableHash::MoveTask& _move_task;
+public:
+  SymbolTableRehashTask(SymbolTableHash::MoveTask& move_task) :
+    WorkerTask("Rehash Symbol Table"), _move_task(move_task) {}
+  void work(uint worker_id) {
+    Thread* thread = Thread::current();
+    while (_move_task.do_task(thread)) { /* empty */ }
+  }
+};
+
+bool SymbolTable::do_rehash(WorkerThreads* workers) {
   if (!_local_table->is_safepoint_safe()) {
     return false;
   }
 
+  Thread* thread = Thread::current();
   // We use current size
-  size_t new_size = _local_table->get_size_log2(Thread::current());
+  size_t new_size = _local_table->get_size_log2(thread);
   SymbolTableHash* new_table = new SymbolTableHash(new_size, END_SIZE, REHASH_LEN);
   // Use alt hash from now on
   _alt_hash = true;
-  if (!_local_table->try_move_nodes_to(Thread::current(), new_table)) {
+  const bool is_mt = workers != NULL && workers->active_workers() > 1;
+  SymbolTableHash::MoveTask move_task(_local_table, new_table, is_mt);
+  if (!move_task.prepare(thread)) {
     _alt_hash = false;
     delete new_table;
     return false;
   }
+  if (is_mt) {
+    SymbolTableRehashTask task(move_task);
+    workers->run_task(&task);
+  } else {
+    while (move_task.do_task(thread)) { /* empty */ }
+  }
+  move_task.done(thread);
 
   // free old table
   delete _local_table;
@@ -799,7 +831,7 @@ bool SymbolTable::do_rehash() {
   return true;
 }
 
-void SymbolTable::rehash_table() {
+void SymbolTable::rehash_table(WorkerThreads* workers) {
   static bool rehashed = false;
   log_debug(symboltable)("Table imbalanced, rehashing called.");
 
@@ -822,7 +854,7 @@ void SymbolTable::rehash_table() {
 
   _alt_hash_seed = AltHashing::compute_seed();
 
-  if (do_rehash()) {
+  if (do_rehash(workers)) {
     rehashed = true;
   } else {
     log_info(symboltable)("Resizes in progress rehashing skipped.");
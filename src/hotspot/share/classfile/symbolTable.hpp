@@ -94,6 +94,7 @@ class SymbolTableCreateEntry;
 
 class constantPoolHandle;
 class SymbolClosure;
+class WorkerThreads;
 
 class SymbolTable : public AllStatic {
   friend class VMStructs;
@@ -149,7 +150,7 @@ class SymbolTable : public AllStatic {
   static void print_table_statistics(outputStream* st);
 
   static void try_rehash_table();
-  static bool do_rehash();
+  static bool do_rehash(WorkerThreads* workers);
 
 public:
   // The symbol table
@@ -157,7 +158,7 @@ public:
   static TableStatistics get_table_statistics();
 
   enum {
-    symbol_alloc_batch_size = 8,
+    symbol_alloc_batch_size = 32,
     // Pick initial size based on java -version size measurements
     symbol_alloc_arena_size = 360*K // TODO (revisit)
   };
@@ -194,8 +195,9 @@ public:
   // Create a symbol in the arena for symbols that are not deleted
   static Symbol* new_permanent_symbol(const char* name);
 
-  // Rehash the string table if it gets out of balance
-  static void rehash_table();
+  // Rehash the symbol table if it gets out of balance.
+  // The node move is striped over workers when a pool is passed in.
+  static void rehash_table(WorkerThreads* workers = NULL);
   static bool needs_rehashing() { return _needs_rehashing; }
   static inline void update_needs_rehash(bool rehash) {
     if (rehash) {
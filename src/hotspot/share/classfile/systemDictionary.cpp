@@ -48,6 +48,7 @@
 #include "code/codeCache.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "interpreter/bootstrapInfo.hpp"
+#include "interpreter/methodLookupCache.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
@@ -68,6 +69,7 @@
 #include "prims/jvmtiExport.hpp"
 #include "prims/methodHandles.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/javaCalls.hpp"
@@ -94,6 +96,16 @@ ProtectionDomainCacheTable*   SystemDictionary::_pd_cache_table = NULL;
 OopHandle   SystemDictionary::_java_system_loader;
 OopHandle   SystemDictionary::_java_platform_loader;
 
+volatile uint64_t SystemDictionary::_number_of_modifications = 0;
+
+uint64_t SystemDictionary::number_of_modifications() {
+  return Atomic::load(&_number_of_modifications);
+}
+
+void SystemDictionary::notice_modification() {
+  Atomic::inc(&_number_of_modifications);
+}
+
 // Default ProtectionDomainCacheSize value
 const int defaultProtectionDomainCacheSize = 1009;
 
@@ -608,6 +620,24 @@ InstanceKlass* SystemDictionary::resolve_instance_class_or_null(Symbol* name,
   InstanceKlass* probe = dictionary->find(name_hash, name, protection_domain);
   if (probe != NULL) return probe;
 
+  // The find() above misses when the class is loaded but the caller's
+  // protection domain has not yet been validated for it, or when a
+  // racing loader completed the load after our probe. Both cases can be
+  // detected with a lock-free re-probe, avoiding serialization on the
+  // class loader object lock for lookups that are effectively hits.
+  InstanceKlass* quick_check = dictionary->find_class_no_lock(name_hash, name);
+  if (quick_check != NULL) {
+    if (class_load_start_event.should_commit()) {
+      post_class_load_event(&class_load_start_event, quick_check, loader_data);
+    }
+    DEBUG_ONLY(verify_dictionary_entry(name, quick_check));
+    if (protection_domain() != NULL) {
+      // Verify protection domain. If it fails an exception is thrown
+      dictionary->validate_protection_domain(name_hash, quick_check, class_loader, protection_domain, CHECK_NULL);
+    }
+    return quick_check;
+  }
+
   // Non-bootstrap class loaders will call out to class loader and
   // define via jvm/jni_DefineClass which will acquire the
   // class loader object lock to protect against multiple threads
@@ -1482,6 +1512,18 @@ InstanceKlass* SystemDictionary::find_or_define_helper(Symbol* class_name, Handl
 
   unsigned int name_hash = dictionary->compute_hash(name_h);
 
+  // Optimistic fast path: if a parallel-capable loader lost the define race
+  // some time ago, the winner's class is already visible in the dictionary
+  // and can be returned without touching SystemDictionary_lock or the
+  // placeholder protocol. Concurrent definers that miss here fall through
+  // to the placeholder token, which remains the arbiter for actual races.
+  if (is_parallelDefine(class_loader)) {
+    InstanceKlass* check = dictionary->find_class_no_lock(name_hash, name_h);
+    if (check != NULL) {
+      return check;
+    }
+  }
+
   // Hold SD lock around find_class and placeholder creation for DEFINE_CLASS
   {
     MutexLocker mu(THREAD, SystemDictionary_lock);
@@ -1578,6 +1620,10 @@ void SystemDictionary::add_to_hierarchy(InstanceKlass* k) {
   k->append_to_sibling_list();                    // add to superklass/sibling list
   k->process_interfaces();                        // handle all "implements" declarations
 
+  // Stamp the modification, so compilations started before this point
+  // know to re-verify their class hierarchy dependencies.
+  notice_modification();
+
   // Now flush all code that depended on old class hierarchy.
   // Note: must be done *after* linking k into the hierarchy (was bug 12/9/97)
   if (Universe::is_fully_initialized()) {
@@ -1606,6 +1652,7 @@ bool SystemDictionary::do_unloading(GCTimer* gc_timer) {
       ClassLoaderDataGraph::clean_module_and_package_info();
       constraints()->purge_loader_constraints();
       resolution_errors()->purge_resolution_errors();
+      MethodLookupCache::clear();
     }
   }
 
@@ -312,6 +312,8 @@ private:
   static OopHandle  _java_system_loader;
   static OopHandle  _java_platform_loader;
 
+  static volatile uint64_t _number_of_modifications;
+
   static ResolutionErrorTable* resolution_errors() { return _resolution_errors; }
   static SymbolPropertyTable* invoke_method_table() { return _invoke_method_table; }
 
@@ -395,6 +397,13 @@ public:
 
   // Setup link to hierarchy
   static void add_to_hierarchy(InstanceKlass* k);
+
+  // Monotonic stamp of class hierarchy modifications (a class was linked
+  // into the hierarchy, or classes were redefined). A reader that verified
+  // hierarchy-based facts can compare stamps to tell whether those facts
+  // may have been invalidated in the meantime.
+  static uint64_t number_of_modifications();
+  static void notice_modification();
 protected:
 
   // Basic find on loaded classes
@@ -152,6 +152,13 @@ void Verifier::log_end_verification(outputStream* st, const char* klassName, Sym
   st->print_cr("End class verification for: %s", klassName);
 }
 
+// Verification runs deliberately on the thread that initiates linking.
+// It is not side-effect free: assignability checks resolve classes through
+// the initiating loader, verification errors must surface as exceptions on
+// the linking thread in linkage order, and recursive re-verification is
+// detected via the current thread's own call chain.  Off-loading per-method
+// checks to worker threads would require replaying all of those effects
+// back on the initiating thread, so keep it serial here.
 bool Verifier::verify(InstanceKlass* klass, bool should_verify_class, TRAPS) {
   HandleMark hm(THREAD);
   ResourceMark rm(THREAD);
@@ -474,6 +474,14 @@ bool vmIntrinsics::disabled_by_jvm_flags(vmIntrinsics::ID id) {
   case vmIntrinsics::_vectorizedMismatch:
     if (!UseVectorizedMismatchIntrinsic) return true;
     break;
+  case vmIntrinsics::_ArraysHashCodeB:
+  case vmIntrinsics::_ArraysHashCodeS:
+  case vmIntrinsics::_ArraysHashCodeC:
+  case vmIntrinsics::_ArraysHashCodeI:
+  case vmIntrinsics::_StringLatin1HashCode:
+  case vmIntrinsics::_StringUTF16HashCode:
+    if (!UseArraysHashCodeIntrinsic) return true;
+    break;
   case vmIntrinsics::_updateBytesAdler32:
   case vmIntrinsics::_updateByteBufferAdler32:
     if (!UseAdler32Intrinsics) return true;
@@ -628,6 +636,23 @@ bool vmIntrinsics::is_disabled_by_flags(const methodHandle& method) {
   return is_disabled_by_flags(id);
 }
 
+bool vmIntrinsics::is_annotation_exempt(vmIntrinsics::ID id) {
+  assert(id != vmIntrinsics::_none, "must be a VM intrinsic");
+  switch (id) {
+  // The polynomial hash code intrinsics bind to pre-existing library
+  // methods which carry no @IntrinsicCandidate annotation.
+  case vmIntrinsics::_ArraysHashCodeB:
+  case vmIntrinsics::_ArraysHashCodeS:
+  case vmIntrinsics::_ArraysHashCodeC:
+  case vmIntrinsics::_ArraysHashCodeI:
+  case vmIntrinsics::_StringLatin1HashCode:
+  case vmIntrinsics::_StringUTF16HashCode:
+    return true;
+  default:
+    return false;
+  }
+}
+
 bool vmIntrinsics::is_disabled_by_flags(vmIntrinsics::ID id) {
   assert(id > _none && id < ID_LIMIT, "must be a VM intrinsic");
 
@@ -409,6 +409,18 @@ class methodHandle;
    do_name(vectorizedMismatch_name, "vectorizedMismatch")                                                               \
    do_signature(vectorizedMismatch_signature, "(Ljava/lang/Object;JLjava/lang/Object;JII)I")                            \
                                                                                                                         \
+  /* polynomial hash codes over primitive arrays (Arrays.hashCode, String.hashCode) */                                  \
+  do_intrinsic(_ArraysHashCodeB,      java_util_Arrays,      hashCode_name, hashCodeB_signature, F_S)                   \
+   do_signature(hashCodeB_signature, "([B)I")                                                                           \
+  do_intrinsic(_ArraysHashCodeS,      java_util_Arrays,      hashCode_name, hashCodeS_signature, F_S)                   \
+   do_signature(hashCodeS_signature, "([S)I")                                                                           \
+  do_intrinsic(_ArraysHashCodeC,      java_util_Arrays,      hashCode_name, hashCodeC_signature, F_S)                   \
+   do_signature(hashCodeC_signature, "([C)I")                                                                           \
+  do_intrinsic(_ArraysHashCodeI,      java_util_Arrays,      hashCode_name, hashCodeI_signature, F_S)                   \
+   do_signature(hashCodeI_signature, "([I)I")                                                                           \
+  do_intrinsic(_StringLatin1HashCode, java_lang_StringLatin1, hashCode_name, hashCodeB_signature, F_S)                  \
+  do_intrinsic(_StringUTF16HashCode,  java_lang_StringUTF16,  hashCode_name, hashCodeB_signature, F_S)                  \
+                                                                                                                        \
   /* java/lang/ref/Reference */                                                                                         \
   do_intrinsic(_Reference_get,              java_lang_ref_Reference, get_name,       void_object_signature,    F_R)     \
   do_intrinsic(_Reference_refersTo0,        java_lang_ref_Reference, refersTo0_name, object_boolean_signature, F_RN)    \
@@ -1422,6 +1434,11 @@ public:
   static bool is_intrinsic_available(vmIntrinsics::ID id) {
     return !is_disabled_by_flags(id);
   }
+
+  // Returns true for intrinsics that bind to library methods purely by name
+  // and signature from the VM side, without the Java method carrying an
+  // @IntrinsicCandidate annotation. CheckIntrinsics does not report these.
+  static bool is_annotation_exempt(vmIntrinsics::ID id);
 };
 
 #undef VM_INTRINSIC_ENUM
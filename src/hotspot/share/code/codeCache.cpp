@@ -552,6 +552,13 @@ CodeBlob* CodeCache::allocate(int size, int code_blob_type, bool handle_alloc_fa
           return allocate(size, type, handle_alloc_failure, orig_code_blob_type);
         }
       }
+      if (heap->unallocated_capacity() > (size_t)size) {
+        // The allocation failed with enough free space left in the heap: the
+        // free space is fragmented into blocks smaller than the request.
+        // Request a sweep so that flushed cold nmethods coalesce with their
+        // free neighbors into contiguous space for later allocations.
+        NMethodSweeper::report_allocation_failure();
+      }
       if (handle_alloc_failure) {
         MutexUnlocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
         CompileBroker::handle_full_code_cache(orig_code_blob_type);
@@ -1052,6 +1059,12 @@ int CodeCache::mark_for_deoptimization(KlassDepChange& changes) {
   }
 #endif
 
+  // Make the dependent nmethods not entrant while still holding the
+  // CodeCache_lock. The change recorded exactly the nmethods it marked, so
+  // this saves the full code cache walk that make_marked_nmethods_not_entrant()
+  // would do, and no marked nmethod can be freed before it is invalidated.
+  changes.make_marked_nmethods_not_entrant();
+
   return number_of_marked_CodeBlobs;
 }
 
@@ -1184,6 +1197,9 @@ int CodeCache::mark_for_deoptimization(Method* dependee) {
     if (nm->is_dependent_on_method(dependee)) {
       ResourceMark rm;
       nm->mark_for_deoptimization();
+      // Make the nmethod not entrant right away, while still holding the
+      // CodeCache_lock; see mark_for_deoptimization(KlassDepChange&).
+      nm->make_not_entrant();
       number_of_marked_CodeBlobs++;
     }
   }
@@ -1220,8 +1236,9 @@ void CodeCache::flush_dependents_on(InstanceKlass* dependee) {
   }
 
   if (marked > 0) {
-    // At least one nmethod has been marked for deoptimization
-    Deoptimization::deoptimize_all_marked();
+    // At least one nmethod has been marked for deoptimization and has
+    // already been made not entrant during marking.
+    Deoptimization::deoptimize_marked_frames();
   }
 }
 
@@ -1232,7 +1249,7 @@ void CodeCache::flush_dependents_on_method(const methodHandle& m_h) {
 
   // Compute the dependent nmethods
   if (mark_for_deoptimization(m_h()) > 0) {
-    Deoptimization::deoptimize_all_marked();
+    Deoptimization::deoptimize_marked_frames();
   }
 }
 
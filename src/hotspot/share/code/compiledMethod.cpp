@@ -76,6 +76,7 @@ void CompiledMethod::init_defaults() {
     _deopt_handler_begin        = NULL;
     _deopt_mh_handler_begin     = NULL;
     _exception_cache            = NULL;
+    _scope_header_cache         = NULL;
   }
   _has_unsafe_access          = 0;
   _has_method_handle_invokes  = 0;
@@ -256,6 +257,56 @@ ExceptionCache* CompiledMethod::exception_cache_entry_for_exception(Handle excep
 
 //-------------end of code for ExceptionCache--------------
 
+const ScopeDescHeader* CompiledMethod::find_scope_header(int decode_offset) const {
+  // We never grab a lock to read the scope header cache; the list only
+  // ever grows while the nmethod is alive, so a miss is always safe and
+  // merely means the caller decodes the header from the stream again.
+  for (ScopeDescHeader* header = Atomic::load_acquire(&_scope_header_cache);
+       header != NULL; header = header->_next) {
+    if (header->_decode_offset == decode_offset) {
+      return header;
+    }
+  }
+  return NULL;
+}
+
+void CompiledMethod::add_scope_header(ScopeDescHeader* header) {
+  // Cap the list so that an nmethod with very many scopes cannot make
+  // lookups degenerate into a long linear scan; the hottest scopes are
+  // decoded (and thus cached) first.
+  const int max_cached_scope_headers = 32;
+  for (;;) {
+    int length = 0;
+    ScopeDescHeader* const head = Atomic::load(&_scope_header_cache);
+    for (ScopeDescHeader* h = head; h != NULL; h = h->_next) {
+      if (h->_decode_offset == header->_decode_offset) {
+        // Lost a race with another thread decoding the same scope
+        delete header;
+        return;
+      }
+      length++;
+    }
+    if (length >= max_cached_scope_headers) {
+      delete header;
+      return;
+    }
+    header->_next = head;
+    if (Atomic::cmpxchg(&_scope_header_cache, head, header) == head) {
+      return;
+    }
+  }
+}
+
+void CompiledMethod::free_scope_header_cache() {
+  ScopeDescHeader* header = _scope_header_cache;
+  _scope_header_cache = NULL;
+  while (header != NULL) {
+    ScopeDescHeader* next = header->_next;
+    delete header;
+    header = next;
+  }
+}
+
 bool CompiledMethod::is_at_poll_return(address pc) {
   RelocIterator iter(this, pc, pc+1);
   while (iter.next()) {
@@ -107,15 +107,21 @@ private:
   address _code_begin;
   PcDesc* _lower;
   PcDesc* _upper;
+  const u2* _pc_index_table;
+  int _pc_index_table_count;
 public:
-  PcDescSearch(address code, PcDesc* lower, PcDesc* upper) :
-    _code_begin(code), _lower(lower), _upper(upper)
+  PcDescSearch(address code, PcDesc* lower, PcDesc* upper,
+               const u2* pc_index_table = NULL, int pc_index_table_count = 0) :
+    _code_begin(code), _lower(lower), _upper(upper),
+    _pc_index_table(pc_index_table), _pc_index_table_count(pc_index_table_count)
   {
   }
 
   address code_begin() const { return _code_begin; }
   PcDesc* scopes_pcs_begin() const { return _lower; }
   PcDesc* scopes_pcs_end() const { return _upper; }
+  const u2* pc_index_table() const { return _pc_index_table; }
+  int pc_index_table_count() const { return _pc_index_table_count; }
 };
 
 class PcDescContainer {
@@ -138,6 +144,37 @@ public:
 };
 
 
+// A decoded ScopeDesc header, cached so that repeated decoding of the same
+// scope (deoptimization storms, sender chain walks, stack sampling) does
+// not re-read the compressed debug info stream every time. Entries are
+// immutable once published and live until the nmethod is flushed, when no
+// activations remain.
+class ScopeDescHeader : public CHeapObj<mtCode> {
+  friend class CompiledMethod;
+ private:
+  ScopeDescHeader* _next;
+  const int        _decode_offset;
+ public:
+  const int     _sender_decode_offset;
+  Method* const _method;
+  const int     _bci;
+  const int     _locals_decode_offset;
+  const int     _expressions_decode_offset;
+  const int     _monitors_decode_offset;
+
+  ScopeDescHeader(int decode_offset, int sender_decode_offset, Method* method, int bci,
+                  int locals_decode_offset, int expressions_decode_offset,
+                  int monitors_decode_offset) :
+      _next(NULL),
+      _decode_offset(decode_offset),
+      _sender_decode_offset(sender_decode_offset),
+      _method(method),
+      _bci(bci),
+      _locals_decode_offset(locals_decode_offset),
+      _expressions_decode_offset(expressions_decode_offset),
+      _monitors_decode_offset(monitors_decode_offset) {}
+};
+
 class CompiledMethod : public CodeBlob {
   friend class VMStructs;
   friend class NMethodSweeper;
@@ -168,6 +205,7 @@ protected:
 
   PcDescContainer _pc_desc_container;
   ExceptionCache * volatile _exception_cache;
+  ScopeDescHeader* volatile _scope_header_cache;
 
   void* _gc_data;
 
@@ -263,6 +301,11 @@ public:
   virtual PcDesc* scopes_pcs_end() const = 0;
   int scopes_pcs_size() const { return (intptr_t) scopes_pcs_end() - (intptr_t) scopes_pcs_begin(); }
 
+  // Optional side table seeding the PcDesc search, empty when not built.
+  virtual u2* pc_index_table_begin() const = 0;
+  virtual u2* pc_index_table_end() const = 0;
+  int pc_index_table_count() const { return (int)(pc_index_table_end() - pc_index_table_begin()); }
+
   address insts_begin() const { return code_begin(); }
   address insts_end() const { return stub_begin(); }
   // Returns true if a given address is in the 'insts' section. The method
@@ -313,6 +356,13 @@ public:
   void add_exception_cache_entry(ExceptionCache* new_entry);
   ExceptionCache* exception_cache_entry_for_exception(Handle exception);
 
+  // Scope header cache support
+  // Note: the cache only ever grows while the nmethod is alive, so entries
+  // may be read concurrently without further synchronization.
+  const ScopeDescHeader* find_scope_header(int decode_offset) const;
+  void add_scope_header(ScopeDescHeader* header);
+  void free_scope_header_cache();
+
   // MethodHandle
   bool is_method_handle_return(address return_pc);
   address deopt_mh_handler_begin() const  { return _deopt_mh_handler_begin; }
@@ -401,7 +451,9 @@ public:
 
 private:
   PcDesc* find_pc_desc(address pc, bool approximate) {
-    return _pc_desc_container.find_pc_desc(pc, approximate, PcDescSearch(code_begin(), scopes_pcs_begin(), scopes_pcs_end()));
+    return _pc_desc_container.find_pc_desc(pc, approximate,
+                                           PcDescSearch(code_begin(), scopes_pcs_begin(), scopes_pcs_end(),
+                                                        pc_index_table_begin(), pc_index_table_count()));
   }
 };
 
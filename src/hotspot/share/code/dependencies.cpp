@@ -41,6 +41,7 @@
 #include "runtime/handles.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/jniHandles.inline.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/perfData.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/vmThread.hpp"
@@ -624,10 +625,19 @@ void Dependencies::check_valid_dependency_type(DepType dept) {
   guarantee(FIRST_TYPE <= dept && dept < TYPE_LIMIT, "invalid dependency type: %d", (int) dept);
 }
 
-Dependencies::DepType Dependencies::validate_dependencies(CompileTask* task, char** failure_detail) {
+Dependencies::DepType Dependencies::validate_dependencies(CompileTask* task, bool hierarchy_changed, char** failure_detail) {
   int klass_violations = 0;
   DepType result = end_marker;
   for (Dependencies::DepStream deps(this); deps.next(); ) {
+    if (!hierarchy_changed && deps.is_klass_type() && deps.type() != evol_method) {
+      // No class was linked into the hierarchy (and none was redefined)
+      // since this dependency was verified under the Compile_lock during
+      // compilation, so it cannot have acquired a witness. Method
+      // evolution dependencies are still checked, as breakpoints can be
+      // set without a hierarchy modification.
+      assert(deps.check_dependency() == NULL, "klass dependency invalidated without hierarchy modification");
+      continue;
+    }
     Klass* witness = deps.check_dependency();
     if (witness != NULL) {
       if (klass_violations == 0) {
@@ -2169,6 +2179,13 @@ Klass* Dependencies::DepStream::spot_check_dependency_at(DepChange& changes) {
 }
 
 
+void DepChange::make_marked_nmethods_not_entrant() {
+  assert_locked_or_safepoint(CodeCache_lock);
+  for (int i = 0; i < _marked_nmethods.length(); i++) {
+    _marked_nmethods.at(i)->make_not_entrant();
+  }
+}
+
 void DepChange::print() {
   int nsup = 0, nint = 0;
   for (ContextStream str(*this); str.next(); ) {
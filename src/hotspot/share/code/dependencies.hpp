@@ -466,7 +466,11 @@ class Dependencies: public ResourceObj {
 
   void copy_to(nmethod* nm);
 
-  DepType validate_dependencies(CompileTask* task, char** failure_detail = NULL);
+  // Re-check all recorded dependencies at code installation time. If
+  // hierarchy_changed is false the class hierarchy has provably not been
+  // modified since the dependencies were verified during compilation, and
+  // the expensive class-hierarchy-walking checks are skipped.
+  DepType validate_dependencies(CompileTask* task, bool hierarchy_changed = true, char** failure_detail = NULL);
 
   void log_all_dependencies();
 
@@ -676,6 +680,17 @@ class DependencySignature : public ResourceObj {
 
 // Every particular DepChange is a sub-class of this class.
 class DepChange : public StackObj {
+ private:
+  // All nmethods marked for deoptimization on behalf of this change. This
+  // lets the invalidation step make exactly these not entrant instead of
+  // walking the whole code cache looking for marked methods.
+  GrowableArray<nmethod*> _marked_nmethods;
+
+ protected:
+  DepChange() : _marked_nmethods(8, mtCode) { }
+
+  void record_marked(nmethod* nm) { _marked_nmethods.append(nm); }
+
  public:
   // What kind of DepChange is this?
   virtual bool is_klass_change()      const { return false; }
@@ -685,6 +700,11 @@ class DepChange : public StackObj {
 
   virtual void mark_for_deoptimization(nmethod* nm) = 0;
 
+  // Make all nmethods marked on behalf of this change not entrant. Must be
+  // called in the same CodeCache_lock critical section that did the marking,
+  // so that none of the recorded nmethods can have been freed in between.
+  void make_marked_nmethods_not_entrant();
+
   // Subclass casting with assertions.
   KlassDepChange*    as_klass_change() {
     assert(is_klass_change(), "bad cast");
@@ -783,6 +803,7 @@ class KlassDepChange : public DepChange {
 
   virtual void mark_for_deoptimization(nmethod* nm) {
     nm->mark_for_deoptimization(/*inc_recompile_counts=*/true);
+    record_marked(nm);
   }
 
   InstanceKlass* type() { return _type; }
@@ -825,6 +846,7 @@ class CallSiteDepChange : public DepChange {
 
   virtual void mark_for_deoptimization(nmethod* nm) {
     nm->mark_for_deoptimization(/*inc_recompile_counts=*/false);
+    record_marked(nm);
   }
 
   oop call_site()     const { return _call_site();     }
@@ -28,6 +28,7 @@
 #include "code/dependencyContext.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/orderAccess.hpp"
 #include "runtime/perfData.hpp"
 #include "utilities/exceptions.hpp"
@@ -174,8 +175,12 @@ void DependencyContext::remove_dependent_nmethod(nmethod* nm) {
 // Reclaim all unused buckets.
 //
 void DependencyContext::purge_dependency_contexts() {
+  // Claim the whole list in a single exchange; the ServiceThread may purge
+  // concurrently with the purge at the end of a class unloading cycle, and
+  // each entry must be deleted exactly once.
+  nmethodBucket* b = Atomic::xchg(&_purge_list, (nmethodBucket*)NULL);
   int removed = 0;
-  for (nmethodBucket* b = _purge_list; b != NULL;) {
+  while (b != NULL) {
     nmethodBucket* next = b->purge_list_next();
     removed++;
     delete b;
@@ -184,7 +189,27 @@ void DependencyContext::purge_dependency_contexts() {
   if (UsePerfData && removed > 0) {
     _perf_total_buckets_deallocated_count->inc(removed);
   }
-  _purge_list = NULL;
+}
+
+// The purge list is normally emptied by ClassLoaderDataGraph::purge() at the
+// end of a class unloading cycle. Buckets released after that point, while
+// the cleaning epoch was still open, would otherwise linger until the next
+// cycle - potentially a long time in applications that rarely unload classes.
+// The ServiceThread reclaims them as soon as the epoch has closed.
+bool DependencyContext::has_stale_entries() {
+  return Atomic::load(&_cleaning_epoch) == 0 && Atomic::load(&_purge_list) != NULL;
+}
+
+void DependencyContext::purge_stale_entries() {
+  if (Atomic::load(&_cleaning_epoch) != 0) {
+    // A new cleaning cycle has started since the work was noticed; its
+    // traversals may still observe entries on the purge list, so deletion
+    // is left to that cycle's purge. This check cannot race with
+    // cleaning_start(): the epoch only moves away from zero in a safepoint,
+    // and this code runs without passing a safepoint check.
+    return;
+  }
+  purge_dependency_contexts();
 }
 
 //
@@ -324,6 +349,12 @@ void DependencyContext::cleaning_start() {
 void DependencyContext::cleaning_end() {
   uint64_t epoch = 0;
   Atomic::store(&_cleaning_epoch, epoch);
+  if (Atomic::load(&_purge_list) != NULL) {
+    // Wake the ServiceThread to reclaim the buckets that were released onto
+    // the purge list after the unloading cycle ran its purge.
+    MutexLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
+    Service_lock->notify_all();
+  }
 }
 
 // This function skips over nmethodBuckets in the list corresponding to
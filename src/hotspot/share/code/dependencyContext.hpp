@@ -123,6 +123,8 @@ class DependencyContext : public StackObj {
   int  remove_all_dependents();
   void clean_unloading_dependents();
   static void purge_dependency_contexts();
+  static bool has_stale_entries();
+  static void purge_stale_entries();
   static void release(nmethodBucket* b);
   static void cleaning_start();
   static void cleaning_end();
@@ -410,6 +410,23 @@ static int adjust_pcs_size(int pcs_size) {
   return nsize;
 }
 
+// The pc index side table maps a granule of code to the index of the last
+// PcDesc preceding the granule, so find_pc_desc_internal can seed its search
+// bounds with two indexed loads instead of stepping through the PcDesc array.
+// Stack walking queries a PcDesc for every compiled frame, which makes the
+// search the dominant cost of walks that miss the small PcDescCache.
+static const int pc_index_table_granule_shift = 7; // 128 bytes of code per entry
+
+static int pc_index_table_bytes(int code_size, int pcs_size) {
+  const int pcs_count = pcs_size / (int)sizeof(PcDesc);
+  if (pcs_count <= 8 || pcs_count >= USHRT_MAX - 2) {
+    // Tiny PcDesc arrays search quickly without a seed; huge ones cannot
+    // be indexed with u2 entries.
+    return 0;
+  }
+  return (int)(((code_size >> pc_index_table_granule_shift) + 2) * sizeof(u2));
+}
+
 
 int nmethod::total_size() const {
   return
@@ -524,6 +541,8 @@ nmethod* nmethod::new_nmethod(const methodHandle& method,
     int nmethod_size =
       CodeBlob::allocation_size(code_buffer, sizeof(nmethod))
       + adjust_pcs_size(debug_info->pcs_size())
+      // total_content_size is an upper bound for the code size used in the constructor
+      + align_up(pc_index_table_bytes(code_buffer->total_content_size(), debug_info->pcs_size()), oopSize)
       + align_up((int)dependencies->size_in_bytes(), oopSize)
       + align_up(checked_cast<int>(native_invokers.data_size_in_bytes()), oopSize)
       + align_up(handler_table->size_in_bytes()    , oopSize)
@@ -629,7 +648,8 @@ nmethod::nmethod(
     _metadata_offset         = _oops_offset         + align_up(code_buffer->total_oop_size(), oopSize);
     scopes_data_offset       = _metadata_offset     + align_up(code_buffer->total_metadata_size(), wordSize);
     _scopes_pcs_offset       = scopes_data_offset;
-    _dependencies_offset     = _scopes_pcs_offset;
+    _pc_index_table_offset   = _scopes_pcs_offset;
+    _dependencies_offset     = _pc_index_table_offset;
     _native_invokers_offset     = _dependencies_offset;
     _handler_table_offset    = _native_invokers_offset;
     _nul_chk_table_offset    = _handler_table_offset;
@@ -804,7 +824,8 @@ nmethod::nmethod(
     int scopes_data_offset   = _metadata_offset      + align_up(code_buffer->total_metadata_size(), wordSize);
 
     _scopes_pcs_offset       = scopes_data_offset    + align_up(debug_info->data_size       (), oopSize);
-    _dependencies_offset     = _scopes_pcs_offset    + adjust_pcs_size(debug_info->pcs_size());
+    _pc_index_table_offset   = _scopes_pcs_offset    + adjust_pcs_size(debug_info->pcs_size());
+    _dependencies_offset     = _pc_index_table_offset + align_up(pc_index_table_bytes(code_size(), debug_info->pcs_size()), oopSize);
     _native_invokers_offset  = _dependencies_offset  + align_up((int)dependencies->size_in_bytes(), oopSize);
     _handler_table_offset    = _native_invokers_offset + align_up(checked_cast<int>(native_invokers.data_size_in_bytes()), oopSize);
     _nul_chk_table_offset    = _handler_table_offset + align_up(handler_table->size_in_bytes(), oopSize);
@@ -827,6 +848,7 @@ nmethod::nmethod(
     // Copy contents of ScopeDescRecorder to nmethod
     code_buffer->copy_values_to(this);
     debug_info->copy_to(this);
+    build_pc_index_table();
     dependencies->copy_to(this);
     if (native_invokers.is_nonempty()) { // can not get address of zero-length array
       // Copy native stubs
@@ -1523,6 +1545,9 @@ void nmethod::flush() {
     ec = next;
   }
 
+  // Likewise for any cached scope headers.
+  free_scope_header_cache();
+
   Universe::heap()->flush_nmethod(this);
   CodeCache::unregister_old_nmethod(this);
 
@@ -2124,6 +2149,30 @@ void nmethod::copy_scopes_data(u_char* buffer, int size) {
   memcpy(scopes_data_begin(), buffer, size);
 }
 
+void nmethod::build_pc_index_table() {
+  u2* const table = pc_index_table_begin();
+  const int count = pc_index_table_count();
+  if (count == 0) {
+    return;
+  }
+  PcDesc* const lower = scopes_pcs_begin();
+  PcDesc* const upper = scopes_pcs_end() - 1; // exclude final sentinel
+  assert(lower < upper, "table is only built when PcDescs are present");
+  assert(upper - lower < USHRT_MAX, "indices must fit in u2 entries");
+  // Entry g holds the index of the last PcDesc whose pc_offset precedes the
+  // granule, so it is a valid lower search bound for any pc in the granule,
+  // and entry g+1 likewise bounds the search from above. Alignment padding
+  // at the end of the table is filled in like any other entry.
+  int index = 0;
+  for (int g = 0; g < count; g++) {
+    const int granule_start = g << pc_index_table_granule_shift;
+    while (lower + index + 1 < upper && (lower + index + 1)->pc_offset() < granule_start) {
+      index++;
+    }
+    table[g] = (u2)index;
+  }
+}
+
 #ifdef ASSERT
 static PcDesc* linear_search(const PcDescSearch& search, int pc_offset, bool approximate) {
   PcDesc* lower = search.scopes_pcs_begin();
@@ -2176,13 +2225,24 @@ PcDesc* PcDescContainer::find_pc_desc_internal(address pc, bool approximate, con
   assert(upper->pc_offset() >= pc_offset, "sanity")
   assert_LU_OK;
 
-  // Use the last successful return as a split point.
-  PcDesc* mid = _pc_desc_cache.last_pc_desc();
-  NOT_PRODUCT(++pc_nmethod_stats.pc_desc_searches);
-  if (mid->pc_offset() < pc_offset) {
-    lower = mid;
+  PcDesc* mid = NULL;
+  const u2* const index_table = search.pc_index_table();
+  const int granule = pc_offset >> pc_index_table_granule_shift;
+  if (index_table != NULL && granule + 1 < search.pc_index_table_count()) {
+    // Seed both bounds from the pc index table, narrowing the search to the
+    // PcDescs of a single granule of code.
+    NOT_PRODUCT(++pc_nmethod_stats.pc_desc_searches);
+    lower = search.scopes_pcs_begin() + index_table[granule];
+    upper = MIN2(search.scopes_pcs_begin() + index_table[granule + 1] + 1, upper);
   } else {
-    upper = mid;
+    // Use the last successful return as a split point.
+    mid = _pc_desc_cache.last_pc_desc();
+    NOT_PRODUCT(++pc_nmethod_stats.pc_desc_searches);
+    if (mid->pc_offset() < pc_offset) {
+      lower = mid;
+    } else {
+      upper = mid;
+    }
   }
 
   // Take giant steps at first (4096, then 256, then 16, then 1)
@@ -2574,6 +2634,10 @@ void nmethod::print(outputStream* st) const {
                                              p2i(scopes_pcs_begin()),
                                              p2i(scopes_pcs_end()),
                                              scopes_pcs_size());
+  if (pc_index_table_count() > 0) st->print_cr(" pc index table [" INTPTR_FORMAT "," INTPTR_FORMAT "] = %d",
+                                             p2i(pc_index_table_begin()),
+                                             p2i(pc_index_table_end()),
+                                             (int)(pc_index_table_count() * sizeof(u2)));
   if (dependencies_size () > 0) st->print_cr(" dependencies   [" INTPTR_FORMAT "," INTPTR_FORMAT "] = %d",
                                              p2i(dependencies_begin()),
                                              p2i(dependencies_end()),
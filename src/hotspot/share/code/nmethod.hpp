@@ -206,6 +206,7 @@ class nmethod : public CompiledMethod {
   int _metadata_offset;                   // embedded meta data table
   int _scopes_data_offset;
   int _scopes_pcs_offset;
+  int _pc_index_table_offset;             // side table seeding the PcDesc search, see build_pc_index_table()
   int _dependencies_offset;
   int _native_invokers_offset;
   int _handler_table_offset;
@@ -406,7 +407,9 @@ class nmethod : public CompiledMethod {
 
   address scopes_data_end       () const          { return           header_begin() + _scopes_pcs_offset    ; }
   PcDesc* scopes_pcs_begin      () const          { return (PcDesc*)(header_begin() + _scopes_pcs_offset   ); }
-  PcDesc* scopes_pcs_end        () const          { return (PcDesc*)(header_begin() + _dependencies_offset) ; }
+  PcDesc* scopes_pcs_end        () const          { return (PcDesc*)(header_begin() + _pc_index_table_offset); }
+  u2*     pc_index_table_begin  () const          { return (u2*)    (header_begin() + _pc_index_table_offset); }
+  u2*     pc_index_table_end    () const          { return (u2*)    (header_begin() + _dependencies_offset) ; }
   address dependencies_begin    () const          { return           header_begin() + _dependencies_offset  ; }
   address dependencies_end      () const          { return           header_begin() + _native_invokers_offset ; }
   RuntimeStub** native_invokers_begin() const     { return (RuntimeStub**)(header_begin() + _native_invokers_offset) ; }
@@ -632,6 +635,9 @@ public:
   void copy_scopes_pcs(PcDesc* pcs, int count);
   void copy_scopes_data(address buffer, int size);
 
+  // fill in the pc index side table from the copied PcDescs
+  void build_pc_index_table();
+
   // Accessor/mutator for the original pc of a frame before a frame was deopted.
   address get_original_pc(const frame* fr) { return *orig_pc_addr(fr); }
   void    set_original_pc(const frame* fr, address pc) { *orig_pc_addr(fr) = pc; }
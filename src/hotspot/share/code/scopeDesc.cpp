@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "classfile/javaClasses.inline.hpp"
+#include "code/compiledMethod.hpp"
 #include "code/debugInfoRec.hpp"
 #include "code/pcDesc.hpp"
 #include "code/scopeDesc.hpp"
@@ -78,6 +79,21 @@ void ScopeDesc::decode_body() {
     _expressions_decode_offset = DebugInformationRecorder::serialized_null;
     _monitors_decode_offset = DebugInformationRecorder::serialized_null;
   } else {
+    // The header for a given decode offset never changes, so decoding it
+    // once per nmethod is enough. This matters for deeply inlined scopes,
+    // where walking the sender chain re-decodes every header, and for
+    // code that repeatedly deoptimizes or is repeatedly sampled.
+    const ScopeDescHeader* header = _code->find_scope_header(decode_offset());
+    if (header != NULL) {
+      _sender_decode_offset      = header->_sender_decode_offset;
+      _method                    = header->_method;
+      _bci                       = header->_bci;
+      _locals_decode_offset      = header->_locals_decode_offset;
+      _expressions_decode_offset = header->_expressions_decode_offset;
+      _monitors_decode_offset    = header->_monitors_decode_offset;
+      return;
+    }
+
     // decode header
     DebugInfoReadStream* stream  = stream_at(decode_offset());
 
@@ -89,6 +105,11 @@ void ScopeDesc::decode_body() {
     _locals_decode_offset      = stream->read_int();
     _expressions_decode_offset = stream->read_int();
     _monitors_decode_offset    = stream->read_int();
+
+    const_cast<CompiledMethod*>(_code)->add_scope_header(
+        new ScopeDescHeader(decode_offset(), _sender_decode_offset, _method, _bci,
+                            _locals_decode_offset, _expressions_decode_offset,
+                            _monitors_decode_offset));
   }
 }
 
@@ -99,6 +99,8 @@ VtableStub* VtableStubs::_table[VtableStubs::N];
 int VtableStubs::_number_of_vtable_stubs = 0;
 int VtableStubs::_vtab_stub_size = 0;
 int VtableStubs::_itab_stub_size = 0;
+address VtableStubs::_vtable_dispatch_body = NULL;
+address VtableStubs::_itable_dispatch_body = NULL;
 
 #if defined(PRODUCT)
   // These values are good for the PRODUCT case (no tracing).
@@ -70,6 +70,12 @@
 // VtableStubs creates the code stubs for compiled calls through vtables.
 // There is one stub per (vtable index, args_size) pair, and the stubs are
 // never deallocated. They don't need to be GCed because they contain no oops.
+//
+// On platforms that support it, indexes at or above VtableStubDedicatedIndexLimit
+// do not get a full dispatch stub each. They get a small trampoline that loads
+// the index into a register and jumps to a dispatch body shared by all such
+// indexes. This keeps interface-heavy applications, which can need stubs for
+// many distinct indexes, from filling the stub space with near-identical code.
 class VtableStub;
 
 class VtableStubs : AllStatic {
@@ -85,9 +91,16 @@ class VtableStubs : AllStatic {
   static int         _number_of_vtable_stubs;    // number of stubs created so far (for statistics)
   static int         _vtab_stub_size;            // current size estimate for vtable stub (quasi-constant)
   static int         _itab_stub_size;            // current size estimate for itable stub (quasi-constant)
+  static address     _vtable_dispatch_body;      // shared dispatch body for vtable calls, or NULL
+  static address     _itable_dispatch_body;      // shared dispatch body for itable calls, or NULL
 
   static VtableStub* create_vtable_stub(int vtable_index);
   static VtableStub* create_itable_stub(int vtable_index);
+  // Shared dispatch support. Implemented by platforms which share a
+  // parameterized dispatch body among indexes beyond the dedicated limit;
+  // other platforms simply never call these.
+  static address     dispatch_body(bool is_vtable_stub);
+  static VtableStub* create_dispatch_trampoline(bool is_vtable_stub, int index);
   static VtableStub* lookup            (bool is_vtable_stub, int vtable_index);
   static void        enter             (bool is_vtable_stub, int vtable_index, VtableStub* s);
   static inline uint hash              (bool is_vtable_stub, int vtable_index);
@@ -125,22 +138,28 @@ class VtableStub {
   const short    _index;             // vtable index
   short          _ame_offset;        // Where an AbstractMethodError might occur
   short          _npe_offset;        // Where a NullPointerException might occur
+  short          _code_length;       // Exact code length, or -1 to use the platform size estimate
   bool           _is_vtable_stub;    // True if vtable stub, false, is itable stub
   /* code follows here */            // The vtableStub code
 
   void* operator new(size_t size, int code_size) throw();
 
-  VtableStub(bool is_vtable_stub, int index)
+  VtableStub(bool is_vtable_stub, int index, int code_length = -1)
         : _next(NULL), _index(index), _ame_offset(-1), _npe_offset(-1),
-          _is_vtable_stub(is_vtable_stub) {}
+          _code_length(code_length), _is_vtable_stub(is_vtable_stub) {}
   VtableStub* next() const                       { return _next; }
   int index() const                              { return _index; }
   static VMReg receiver_location()               { return _receiver_location; }
   void set_next(VtableStub* n)                   { _next = n; }
 
  public:
+  // Pseudo index under which a shared, parameterized dispatch body is
+  // registered in the stub table. Such a body receives the vtable/itable
+  // index in a register from a small per-index trampoline stub.
+  enum { shared_dispatch_index = -1 };
+
   address code_begin() const                     { return (address)(this + 1); }
-  address code_end() const                       { return code_begin() + VtableStubs::code_size_limit(_is_vtable_stub); }
+  address code_end() const                       { return code_begin() + (_code_length >= 0 ? _code_length : VtableStubs::code_size_limit(_is_vtable_stub)); }
   address entry_point() const                    { return code_begin(); }
   static int entry_offset()                      { return sizeof(class VtableStub); }
 
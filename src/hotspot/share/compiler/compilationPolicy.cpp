@@ -234,6 +234,9 @@ public:
     if (CompilerOracle::has_option_value(method, CompileCommand::CompileThresholdScaling, threshold_scaling)) {
       scale *= threshold_scaling;
     }
+    if (SharedMethodThresholdScaling != 1.0 && method->is_shared()) {
+      scale *= SharedMethodThresholdScaling;
+    }
     switch(cur_level) {
     case CompLevel_none:
     case CompLevel_limited_profile:
@@ -272,6 +275,9 @@ public:
     if (CompilerOracle::has_option_value(method, CompileCommand::CompileThresholdScaling, threshold_scaling)) {
       scale *= threshold_scaling;
     }
+    if (SharedMethodThresholdScaling != 1.0 && method->is_shared()) {
+      scale *= SharedMethodThresholdScaling;
+    }
     switch(cur_level) {
     case CompLevel_none:
     case CompLevel_limited_profile:
@@ -616,13 +622,23 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
   Method* max_method = NULL;
 
   jlong t = nanos_to_millis(os::javaTimeNanos());
+  // After bulk enqueues (e.g. right after a deploy) the queue can back up with
+  // thousands of C1 tasks; while it is over the shedding threshold, time those
+  // out much more aggressively so that the highest-rate methods get compiler
+  // threads sooner.
+  bool shed_c1_tasks = CompileQueueSheddingThreshold > 0 &&
+                       compile_queue->size() > CompileQueueSheddingThreshold;
   // Iterate through the queue and find a method with a maximum rate.
   for (CompileTask* task = compile_queue->first(); task != NULL;) {
     CompileTask* next_task = task->next();
     Method* method = task->method();
+    jlong timeout = TieredCompileTaskTimeout;
+    if (shed_c1_tasks && is_c1_compile((CompLevel)task->comp_level())) {
+      timeout = CompileQueueSheddingTimeout;
+    }
     // If a method was unloaded or has been stale for some time, remove it from the queue.
     // Blocking tasks and tasks submitted from whitebox API don't become stale
-    if (task->is_unloaded() || (task->can_become_stale() && is_stale(t, TieredCompileTaskTimeout, method) && !is_old(method))) {
+    if (task->is_unloaded() || (task->can_become_stale() && is_stale(t, timeout, method) && !is_old(method))) {
       if (!task->is_unloaded()) {
         if (PrintTieredEvents) {
           print_event(REMOVE_FROM_QUEUE, method, method, task->osr_bci(), (CompLevel) task->comp_level());
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "classfile/classLoaderDataGraph.hpp"
+#include "classfile/symbolTable.hpp"
+#include "code/codeCache.hpp"
+#include "code/nmethod.hpp"
+#include "compiler/compilationPolicy.hpp"
+#include "compiler/compilationWarmup.hpp"
+#include "compiler/compileBroker.hpp"
+#include "compiler/compilerDefinitions.hpp"
+#include "logging/log.hpp"
+#include "memory/iterator.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/symbol.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/resourceHash.hpp"
+
+// One recorded compilation. Records for the same holder class are
+// chained, with the chain head stored in the replay table.
+class WarmupMethodRecord : public CHeapObj<mtCompiler> {
+private:
+  Symbol* const             _method_name;
+  Symbol* const             _method_signature;
+  const int                 _comp_level;
+  WarmupMethodRecord* const _next;
+
+public:
+  WarmupMethodRecord(Symbol* method_name, Symbol* method_signature,
+                     int comp_level, WarmupMethodRecord* next) :
+      _method_name(method_name),
+      _method_signature(method_signature),
+      _comp_level(comp_level),
+      _next(next) {}
+
+  Symbol* method_name() const               { return _method_name; }
+  Symbol* method_signature() const          { return _method_signature; }
+  int comp_level() const                    { return _comp_level; }
+  WarmupMethodRecord* next() const          { return _next; }
+};
+
+// Holder class name -> chain of recorded compilations. Keyed on interned
+// symbols, so pointer hashing and equality apply. The table is built once
+// during VM initialization and is read-only after that.
+class WarmupReplayTable : public ResourceHashtable<Symbol*, WarmupMethodRecord*, 512,
+                                                   ResourceObj::C_HEAP, mtCompiler> {};
+
+Mutex*             CompilationWarmup::_record_lock   = NULL;
+fileStream*        CompilationWarmup::_record_stream = NULL;
+bool               CompilationWarmup::_record_failed = false;
+WarmupReplayTable* CompilationWarmup::_replay_table  = NULL;
+
+void CompilationWarmup::initialize() {
+  if (WarmupRecordFile != NULL) {
+    _record_lock = new Mutex(Mutex::nosafepoint, "WarmupRecord_lock");
+  }
+}
+
+void CompilationWarmup::record(const methodHandle& method, int entry_bci, int comp_level) {
+  if (_record_lock == NULL || entry_bci != InvocationEntryBci) {
+    // Not recording, or an OSR compilation. OSR entry points are keyed to
+    // a particular backedge and have no value before the loop is reached,
+    // so they are not replayed.
+    return;
+  }
+
+  MutexLocker ml(_record_lock, Mutex::_no_safepoint_check_flag);
+
+  if (_record_stream == NULL) {
+    if (_record_failed) {
+      return;
+    }
+    _record_stream = new (ResourceObj::C_HEAP, mtCompiler) fileStream(WarmupRecordFile, "at");
+    if (!_record_stream->is_open()) {
+      log_warning(compilation)("Failed to open warmup record file '%s'", WarmupRecordFile);
+      delete _record_stream;
+      _record_stream = NULL;
+      _record_failed = true;
+      return;
+    }
+  }
+
+  ResourceMark rm;
+  _record_stream->print_cr("compile %s %s %s %d %d",
+                           method->method_holder()->name()->as_C_string(),
+                           method->name()->as_C_string(),
+                           method->signature()->as_C_string(),
+                           entry_bci, comp_level);
+  _record_stream->flush();
+}
+
+void CompilationWarmup::record_at_exit(JavaThread* thread) {
+  assert(WarmupRecordAtExit, "only for exit-time recording");
+  if (_record_lock == NULL) {
+    return;
+  }
+
+  struct LiveCompilation {
+    Method* _method;
+    int     _comp_level;
+  };
+  GrowableArray<LiveCompilation> live;
+
+  {
+    // Snapshot the code cache first: record() must not be called with the
+    // CodeCache_lock held. The methods cannot go away between the snapshot
+    // and the recording, since nothing unloads classes during before_exit().
+    MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    NMethodIterator iter(NMethodIterator::only_alive_and_not_unloading);
+    while (iter.next()) {
+      nmethod* const nm = iter.method();
+      if (nm->is_in_use() && !nm->is_osr_method() && !nm->is_native_method()) {
+        LiveCompilation lc = { nm->method(), nm->comp_level() };
+        live.append(lc);
+      }
+    }
+  }
+
+  for (int i = 0; i < live.length(); i++) {
+    methodHandle mh(thread, live.at(i)._method);
+    record(mh, InvocationEntryBci, live.at(i)._comp_level);
+  }
+  log_info(compilation)("Warmup record: %d live compilations at exit", live.length());
+}
+
+void CompilationWarmup::parse_replay_file() {
+  FILE* const stream = os::fopen(WarmupReplayFile, "rt");
+  if (stream == NULL) {
+    log_warning(compilation)("Failed to open warmup replay file '%s'", WarmupReplayFile);
+    return;
+  }
+
+  int parsed = 0;
+  char line[4096];
+  char klass_name[1024];
+  char method_name[1024];
+  char method_signature[2048];
+
+  while (fgets(line, sizeof(line), stream) != NULL) {
+    int entry_bci;
+    int comp_level;
+    if (sscanf(line, "compile %1023s %1023s %2047s %d %d",
+               klass_name, method_name, method_signature,
+               &entry_bci, &comp_level) != 5) {
+      // Skip malformed or unrecognized lines
+      continue;
+    }
+    if (entry_bci != InvocationEntryBci) {
+      // OSR compilations are not replayed, see record()
+      continue;
+    }
+
+    // Clamp to the levels available in this VM configuration
+    comp_level = MIN2(comp_level, (int)CompilationPolicy::highest_compile_level());
+    if (comp_level < CompLevel_simple) {
+      continue;
+    }
+
+    if (_replay_table == NULL) {
+      _replay_table = new WarmupReplayTable();
+    }
+
+    Symbol* const k = SymbolTable::new_symbol(klass_name);
+    Symbol* const m = SymbolTable::new_symbol(method_name);
+    Symbol* const s = SymbolTable::new_symbol(method_signature);
+
+    WarmupMethodRecord** const head = _replay_table->get(k);
+    WarmupMethodRecord* const record =
+        new WarmupMethodRecord(m, s, comp_level, head != NULL ? *head : NULL);
+    if (head != NULL) {
+      *head = record;
+    } else {
+      _replay_table->put(k, record);
+    }
+    parsed++;
+  }
+
+  ::fclose(stream);
+  log_info(compilation)("Warmup replay: %d recorded compilations", parsed);
+}
+
+void CompilationWarmup::maybe_compile(const methodHandle& method, int comp_level, TRAPS) {
+  if (method->is_abstract() || method->is_native()) {
+    return;
+  }
+  if (!CompileBroker::should_compile_new_jobs()) {
+    return;
+  }
+
+  // Enqueues a non-blocking compilation with BackgroundCompilation (the
+  // default). Failures are ignored, the method will simply warm up the
+  // usual way.
+  CompileBroker::compile_method(method, InvocationEntryBci, comp_level,
+                                method, 0, CompileTask::Reason_Warmup, THREAD);
+  if (HAS_PENDING_EXCEPTION) {
+    CLEAR_PENDING_EXCEPTION;
+  }
+}
+
+void CompilationWarmup::notify_klass_initialized(InstanceKlass* ik, JavaThread* thread) {
+  if (_replay_table == NULL) {
+    return;
+  }
+
+  WarmupMethodRecord** const head = _replay_table->get(ik->name());
+  if (head == NULL) {
+    return;
+  }
+
+  for (WarmupMethodRecord* record = *head; record != NULL; record = record->next()) {
+    Method* const m = ik->find_method(record->method_name(), record->method_signature());
+    if (m == NULL) {
+      // The method no longer exists in this version of the class
+      continue;
+    }
+    methodHandle mh(thread, m);
+    maybe_compile(mh, record->comp_level(), thread);
+  }
+}
+
+void CompilationWarmup::initialize_replay(JavaThread* thread) {
+  parse_replay_file();
+  if (_replay_table == NULL) {
+    return;
+  }
+
+  // Classes initialized during VM bootstrap never saw a notification.
+  // Sweep the loaded classes and enqueue compilations for them now.
+  class CollectInitializedKlasses : public KlassClosure {
+  public:
+    GrowableArray<InstanceKlass*> _klasses;
+
+    virtual void do_klass(Klass* k) {
+      if (k->is_instance_klass() && InstanceKlass::cast(k)->is_initialized()) {
+        _klasses.append(InstanceKlass::cast(k));
+      }
+    }
+  } collect;
+
+  {
+    // Collect first, since enqueuing compilations while holding the
+    // ClassLoaderDataGraph_lock is not allowed
+    MutexLocker ml(ClassLoaderDataGraph_lock);
+    ClassLoaderDataGraph::classes_do(&collect);
+  }
+
+  for (int i = 0; i < collect._klasses.length(); i++) {
+    notify_klass_initialized(collect._klasses.at(i), thread);
+  }
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_COMPILER_COMPILATIONWARMUP_HPP
+#define SHARE_COMPILER_COMPILATIONWARMUP_HPP
+
+#include "memory/allStatic.hpp"
+#include "oops/method.hpp"
+#include "utilities/exceptions.hpp"
+
+class InstanceKlass;
+class Mutex;
+class WarmupReplayTable;
+class fileStream;
+
+// Record/replay of compilation decisions across VM restarts.
+//
+// With -XX:WarmupRecordFile=<file> every successfully completed standard
+// compilation is appended to the file as a
+//
+//   compile <klass> <name> <signature> <entry_bci> <comp_level>
+//
+// line, matching the format of the compile lines in ciReplay data files.
+// With -XX:+WarmupRecordAtExit the file is instead written once at VM
+// exit from a snapshot of the code cache, so that only methods whose
+// compiled code is still in use are recorded: compilations that were
+// deoptimized, invalidated or replaced in the meantime are not worth
+// replaying.
+// On a later run, -XX:WarmupReplayFile=<file> reads the recorded methods
+// and enqueues each compilation as soon as the holder class has been
+// initialized, instead of waiting for the method to become hot again.
+//
+// Unlike the debug-only ciReplay machinery, which also replays recorded
+// profiles and inlining decisions for a single compilation, warmup replay
+// only replays which methods were compiled and at what level. The replayed
+// compilations use whatever profile the method has gathered at the time
+// the compilation runs.
+
+class CompilationWarmup : public AllStatic {
+private:
+  static Mutex*            _record_lock;
+  static fileStream*       _record_stream;
+  static bool              _record_failed;
+  static WarmupReplayTable* _replay_table;
+
+  static void parse_replay_file();
+  static void maybe_compile(const methodHandle& method, int comp_level, TRAPS);
+
+public:
+  // Called from CompileBroker::compilation_init_phase1()
+  static void initialize();
+
+  // Called from JNI_CreateJavaVM() after VM initialization is complete.
+  // Parses WarmupReplayFile and enqueues compilations for methods whose
+  // holder classes are already initialized.
+  static void initialize_replay(JavaThread* thread);
+
+  // Called by the compiler threads when a compilation has succeeded
+  static void record(const methodHandle& method, int entry_bci, int comp_level);
+
+  // Called from before_exit() with -XX:+WarmupRecordAtExit to record the
+  // methods whose compiled code is still in use
+  static void record_at_exit(JavaThread* thread);
+
+  // Called when a class reaches the fully_initialized state, to enqueue
+  // any compilations recorded for its methods
+  static void notify_klass_initialized(InstanceKlass* ik, JavaThread* thread);
+};
+
+#endif // SHARE_COMPILER_COMPILATIONWARMUP_HPP
@@ -32,6 +32,7 @@
 #include "code/codeHeapState.hpp"
 #include "code/dependencyContext.hpp"
 #include "compiler/compilationPolicy.hpp"
+#include "compiler/compilationWarmup.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compileLog.hpp"
 #include "compiler/compilerEvent.hpp"
@@ -643,6 +644,8 @@ void CompileBroker::compilation_init_phase1(JavaThread* THREAD) {
   _c1_count = CompilationPolicy::c1_count();
   _c2_count = CompilationPolicy::c2_count();
 
+  CompilationWarmup::initialize();
+
 #if INCLUDE_JVMCI
   if (EnableJVMCI) {
     // This is creating a JVMCICompiler singleton.
@@ -2354,6 +2357,10 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
 
   collect_statistics(thread, time, task);
 
+  if (WarmupRecordFile != NULL && !WarmupRecordAtExit && task->is_success()) {
+    CompilationWarmup::record(method, task->osr_bci(), task_level);
+  }
+
   nmethod* nm = task->code();
   if (nm != NULL) {
     nm->maybe_print_nmethod(directive);
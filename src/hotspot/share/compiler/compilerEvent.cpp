@@ -165,3 +165,12 @@ void CompilerEvent::InlineEvent::post(EventCompilerInlining& event, int compile_
   callee_struct.set_descriptor(callee->signature()->as_symbol()->as_utf8());
   post(event, compile_id, caller, callee_struct, success, msg, bci);
 }
+
+void CompilerEvent::BoxEliminationEvent::post(EventCompilerBoxElimination& event, int compile_id, Method* method, int bci, const char* box_type, bool eliminated) {
+  event.set_compileId(compile_id);
+  event.set_method(method);
+  event.set_bci(bci);
+  event.set_boxType(box_type);
+  event.set_eliminated(eliminated);
+  event.commit();
+}
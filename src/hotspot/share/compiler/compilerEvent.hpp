@@ -40,6 +40,7 @@ class GrowableArray;
 class Method;
 class EventCompilation;
 class EventCompilationFailure;
+class EventCompilerBoxElimination;
 class EventCompilerInlining;
 class EventCompilerPhase;
 struct JfrStructCalleeMethod;
@@ -84,5 +85,10 @@ class CompilerEvent : AllStatic {
     static void post(EventCompilerInlining& event, int compile_id, Method* caller, Method* callee, bool success, const char* msg, int bci) NOT_JFR_RETURN();
     static void post(EventCompilerInlining& event, int compile_id, Method* caller, ciMethod* callee, bool success, const char* msg, int bci) NOT_JFR_RETURN();
   };
+
+  class BoxEliminationEvent : AllStatic {
+   public:
+    static void post(EventCompilerBoxElimination& event, int compile_id, Method* method, int bci, const char* box_type, bool eliminated) NOT_JFR_RETURN();
+  };
 };
 #endif // SHARE_COMPILER_COMPILEREVENT_HPP
@@ -138,6 +138,13 @@
           "and the value of the per-method flag.")                          \
           range(0.0, DBL_MAX)                                               \
                                                                             \
+  product(double, SharedMethodThresholdScaling, 1.0, EXPERIMENTAL,          \
+          "Additional CompileThresholdScaling-style factor applied to "     \
+          "methods loaded from the CDS archive. Archived methods were "     \
+          "part of a previous run's working set, so values below 1.0 "      \
+          "rush their compilation during warmup.")                          \
+          range(0.0, DBL_MAX)                                               \
+                                                                            \
   product(intx, Tier0InvokeNotifyFreqLog, 7,                                \
           "Interpreter (tier 0) invocation notification frequency")         \
           range(0, 30)                                                      \
@@ -242,6 +249,19 @@
           "given timeout in milliseconds")                                  \
           range(0, max_intx)                                                \
                                                                             \
+  product(intx, CompileQueueSheddingThreshold, 0, EXPERIMENTAL,             \
+          "If positive and a compile queue holds more tasks than this, "    \
+          "C1 tasks in that queue are considered stale after "              \
+          "CompileQueueSheddingTimeout instead of "                         \
+          "TieredCompileTaskTimeout, shedding low-value work after bulk "   \
+          "enqueues. 0 disables shedding")                                  \
+          range(0, max_intx)                                                \
+                                                                            \
+  product(intx, CompileQueueSheddingTimeout, 10, EXPERIMENTAL,              \
+          "Timeout in milliseconds applied to C1 tasks while their queue "  \
+          "is longer than CompileQueueSheddingThreshold")                   \
+          range(0, max_intx)                                                \
+                                                                            \
   product(intx, TieredStopAtLevel, 4,                                       \
           "Stop at given compilation level")                                \
           range(0, 4)                                                       \
@@ -311,6 +331,20 @@
           "File containing inlining replay information"                     \
           "[default: ./inline_pid%p.log] (%p replaced with pid)")           \
                                                                             \
+  product(ccstr, WarmupRecordFile, NULL, EXPERIMENTAL,                      \
+          "Append every successful compilation to this file, for use "      \
+          "with WarmupReplayFile on a later run")                           \
+                                                                            \
+  product(bool, WarmupRecordAtExit, false, EXPERIMENTAL,                    \
+          "Instead of appending each compilation as it completes, write "   \
+          "WarmupRecordFile once at VM exit with only the compilations "    \
+          "whose code is still live, skipping code that was invalidated "   \
+          "or replaced")                                                    \
+                                                                            \
+  product(ccstr, WarmupReplayFile, NULL, EXPERIMENTAL,                      \
+          "Eagerly compile the methods recorded in this file as their "     \
+          "holder classes are initialized")                                 \
+                                                                            \
   develop(intx, ReplaySuppressInitializers, 2,                              \
           "Control handling of class initialization during replay: "        \
           "0 - don't do anything special; "                                 \
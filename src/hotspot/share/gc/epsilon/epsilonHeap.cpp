@@ -29,6 +29,8 @@
 #include "gc/epsilon/epsilonThreadLocalData.hpp"
 #include "gc/shared/gcArguments.hpp"
 #include "gc/shared/locationPrinter.inline.hpp"
+#include "gc/shared/workerPolicy.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
@@ -37,15 +39,24 @@
 #include "memory/universe.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/vmOperations.hpp"
+#include "runtime/vmThread.hpp"
 
 jint EpsilonHeap::initialize() {
   size_t align = HeapAlignment;
   size_t init_byte_size = align_up(InitialHeapSize, align);
   size_t max_byte_size  = align_up(MaxHeapSize, align);
 
-  // Initialize backing storage
+  // Initialize backing storage. With AlwaysPreTouch the initial commit
+  // first-touches every page, which takes a long time for large heaps when
+  // done from a single thread; stripe it over a worker pool instead. The
+  // workers are kept around to pre-touch later expansions as well.
   ReservedHeapSpace heap_rs = Universe::reserve_heap(max_byte_size, align);
-  _virtual_space.initialize(heap_rs, init_byte_size);
+  if (AlwaysPreTouch) {
+    _pretouch_workers = new WorkerThreads("Pretouch Worker", WorkerPolicy::parallel_worker_threads());
+    _pretouch_workers->initialize_workers();
+  }
+  _virtual_space.initialize(heap_rs, init_byte_size, _pretouch_workers);
 
   MemRegion committed_region((HeapWord*)_virtual_space.low(),          (HeapWord*)_virtual_space.high());
 
@@ -78,6 +89,12 @@ void EpsilonHeap::post_initialize() {
   CollectedHeap::post_initialize();
 }
 
+void EpsilonHeap::gc_threads_do(ThreadClosure* tc) const {
+  if (_pretouch_workers != NULL) {
+    _pretouch_workers->threads_do(tc);
+  }
+}
+
 void EpsilonHeap::initialize_serviceability() {
   _pool = new EpsilonMemoryPool(this);
   _memory_manager.add_pool(_pool);
@@ -132,12 +149,12 @@ HeapWord* EpsilonHeap::allocate_work(size_t size, bool verbose) {
 
       if (want_space < space_left) {
         // Enough space to expand in bulk:
-        bool expand = _virtual_space.expand_by(want_space);
+        bool expand = _virtual_space.expand_by(want_space, false, _pretouch_workers);
         assert(expand, "Should be able to expand");
       } else if (size < space_left) {
         // No space to expand in bulk, and this allocation is still possible,
         // take all the remaining space:
-        bool expand = _virtual_space.expand_by(space_left);
+        bool expand = _virtual_space.expand_by(space_left, false, _pretouch_workers);
         assert(expand, "Should be able to expand");
       } else {
         // No space left:
@@ -242,6 +259,8 @@ HeapWord* EpsilonHeap::allocate_new_tlab(size_t min_size,
   if (res != NULL) {
     // Allocation successful
     *actual_size = size;
+    Atomic::inc(&_tlab_refills);
+    Atomic::add(&_tlab_refill_bytes, size * HeapWordSize);
     if (EpsilonElasticTLABDecay) {
       EpsilonThreadLocalData::set_last_tlab_time(thread, time);
     }
@@ -269,6 +288,13 @@ HeapWord* EpsilonHeap::allocate_loaded_archive_space(size_t size) {
   return allocate_work(size, /* verbose = */false);
 }
 
+// Rewinds heap allocation to the reset mark, see EpsilonHeap::reset_heap().
+class VM_EpsilonResetHeap : public VM_Operation {
+public:
+  virtual VMOp_Type type() const { return VMOp_EpsilonHeapReset; }
+  virtual void doit()            { EpsilonHeap::heap()->reset_heap(); }
+};
+
 void EpsilonHeap::collect(GCCause::Cause cause) {
   switch (cause) {
     case GCCause::_metadata_GC_threshold:
@@ -283,11 +309,53 @@ void EpsilonHeap::collect(GCCause::Cause cause) {
       print_metaspace_info();
       break;
     default:
+      if (EpsilonResetOnSystemGC && GCCause::is_user_requested_gc(cause)) {
+        // The application certifies by an explicit GC request that nothing
+        // allocated after the reset mark is reachable anymore.
+        VM_EpsilonResetHeap op;
+        VMThread::execute(&op);
+        break;
+      }
       log_info(gc)("GC request for \"%s\" is ignored", GCCause::to_string(cause));
   }
   _monitoring_support->update_counters();
 }
 
+void EpsilonHeap::reset_heap() {
+  assert(SafepointSynchronize::is_at_safepoint(), "Expected at safepoint");
+
+  // Retire all TLABs, so that no thread holds a window into the space
+  // being rewound, and allocation after the reset starts from fresh TLABs.
+  ensure_parsability(true);
+
+  if (_reset_mark == NULL) {
+    // The first request establishes the reset point. Everything allocated
+    // before it, including the VM-internal objects like class mirrors,
+    // survives all subsequent resets.
+    _reset_mark = _space->top();
+    log_info(gc)("Heap reset mark set at " SIZE_FORMAT "%s used",
+                 byte_size_in_proper_unit(used()), proper_unit_for_byte_size(used()));
+    return;
+  }
+
+  // Record the high watermark before it is wiped out by the rewind.
+  _monitoring_support->update_counters();
+
+  size_t used_before = used();
+  _space->set_top(_reset_mark);
+  if (ZapUnusedHeapArea) {
+    _space->mangle_unused_area();
+  }
+
+  // Restart occupancy-driven counter updates and heap printing from the new top.
+  Atomic::store(&_last_counter_update, used());
+  Atomic::store(&_last_heap_print, used());
+
+  log_info(gc)("Heap reset: " SIZE_FORMAT "%s used -> " SIZE_FORMAT "%s used",
+               byte_size_in_proper_unit(used_before), proper_unit_for_byte_size(used_before),
+               byte_size_in_proper_unit(used()),      proper_unit_for_byte_size(used()));
+}
+
 void EpsilonHeap::do_full_collection(bool clear_all_soft_refs) {
   collect(gc_cause());
 }
@@ -41,19 +41,31 @@ private:
   GCMemoryManager _memory_manager;
   ContiguousSpace* _space;
   VirtualSpace _virtual_space;
+  WorkerThreads* _pretouch_workers;
   size_t _max_tlab_size;
   size_t _step_counter_update;
   size_t _step_heap_print;
   int64_t _decay_time_ns;
   volatile size_t _last_counter_update;
   volatile size_t _last_heap_print;
+  volatile size_t _tlab_refills;
+  volatile size_t _tlab_refill_bytes;
+
+  // Top of the space at the first user-requested GC, when
+  // EpsilonResetOnSystemGC is enabled. Later requests rewind
+  // allocation to this mark. See reset_heap().
+  HeapWord* _reset_mark;
 
 public:
   static EpsilonHeap* heap();
 
   EpsilonHeap() :
           _memory_manager("Epsilon Heap", ""),
-          _space(NULL) {};
+          _space(NULL),
+          _pretouch_workers(NULL),
+          _tlab_refills(0),
+          _tlab_refill_bytes(0),
+          _reset_mark(NULL) {};
 
   virtual Name kind() const {
     return CollectedHeap::Epsilon;
@@ -100,9 +112,18 @@ public:
   virtual size_t max_tlab_size()                    const { return _max_tlab_size; }
   virtual size_t unsafe_max_tlab_alloc(Thread* thr) const;
 
+  // TLAB refill telemetry
+  size_t tlab_refills()      const { return _tlab_refills;      }
+  size_t tlab_refill_bytes() const { return _tlab_refill_bytes; }
+
   virtual void collect(GCCause::Cause cause);
   virtual void do_full_collection(bool clear_all_soft_refs);
 
+  // Sets the reset mark on the first call, rewinds allocation to the mark
+  // on later calls. Only used with EpsilonResetOnSystemGC; must be called
+  // at a safepoint.
+  void reset_heap();
+
   // Heap walking support
   virtual void object_iterate(ObjectClosure* cl);
 
@@ -115,8 +136,8 @@ public:
   HeapWord* block_start(const void* addr) const { return NULL;  }
   bool block_is_obj(const HeapWord* addr) const { return false; }
 
-  // No GC threads
-  virtual void gc_threads_do(ThreadClosure* tc) const {}
+  // No GC threads, only the pre-touch workers (when AlwaysPreTouch is set)
+  virtual void gc_threads_do(ThreadClosure* tc) const;
 
   // No nmethod handling
   virtual void register_nmethod(nmethod* nm) {}
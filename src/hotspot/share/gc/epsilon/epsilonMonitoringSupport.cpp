@@ -96,9 +96,23 @@ public:
   }
 };
 
-EpsilonMonitoringSupport::EpsilonMonitoringSupport(EpsilonHeap* heap) {
+EpsilonMonitoringSupport::EpsilonMonitoringSupport(EpsilonHeap* heap) :
+  _max_used(NULL),
+  _tlab_refills(NULL),
+  _tlab_refill_bytes(NULL),
+  _peak_used(0) {
   _heap_counters  = new EpsilonGenerationCounters(heap);
   _space_counters = new EpsilonSpaceCounters("Heap", 0, heap->max_capacity(), 0, _heap_counters);
+
+  if (UsePerfData) {
+    EXCEPTION_MARK;
+    _max_used = PerfDataManager::create_variable(SUN_GC, "epsilon.maxUsed",
+                                                 PerfData::U_Bytes, (jlong) 0, CHECK);
+    _tlab_refills = PerfDataManager::create_variable(SUN_GC, "epsilon.tlabRefills",
+                                                     PerfData::U_Events, (jlong) 0, CHECK);
+    _tlab_refill_bytes = PerfDataManager::create_variable(SUN_GC, "epsilon.tlabRefillBytes",
+                                                          PerfData::U_Bytes, (jlong) 0, CHECK);
+  }
 }
 
 void EpsilonMonitoringSupport::update_counters() {
@@ -110,6 +124,15 @@ void EpsilonMonitoringSupport::update_counters() {
     size_t capacity = heap->capacity();
     _heap_counters->update_all();
     _space_counters->update_all(capacity, used);
+
+    // Track the high watermark here, so that it survives heap resets.
+    // Resolution is limited by how often the counters are updated; the
+    // heap makes sure to update them right before a reset.
+    _peak_used = MAX2(_peak_used, used);
+    _max_used->set_value(_peak_used);
+    _tlab_refills->set_value(heap->tlab_refills());
+    _tlab_refill_bytes->set_value(heap->tlab_refill_bytes());
+
     MetaspaceCounters::update_performance_counters();
   }
 }
@@ -30,12 +30,21 @@
 class GenerationCounters;
 class EpsilonSpaceCounters;
 class EpsilonHeap;
+class PerfVariable;
 
 class EpsilonMonitoringSupport : public CHeapObj<mtGC> {
 private:
   GenerationCounters*   _heap_counters;
   EpsilonSpaceCounters* _space_counters;
 
+  // Allocation telemetry: high watermark of heap occupancy, and TLAB
+  // refill statistics for sizing the heap of the batch-style workloads
+  // Epsilon is used for.
+  PerfVariable*         _max_used;
+  PerfVariable*         _tlab_refills;
+  PerfVariable*         _tlab_refill_bytes;
+  size_t                _peak_used;
+
 public:
   EpsilonMonitoringSupport(EpsilonHeap* heap);
   void update_counters();
@@ -86,7 +86,15 @@
   product(size_t, EpsilonMinHeapExpand, 128 * M, EXPERIMENTAL,              \
           "Min expansion step for heap. Larger value improves performance " \
           "at the potential expense of memory waste.")                      \
-          range(1, max_intx)
+          range(1, max_intx)                                                \
+                                                                            \
+  product(bool, EpsilonResetOnSystemGC, false, EXPERIMENTAL,                \
+          "Rewind the heap allocation pointer on user-requested GC "        \
+          "(System.gc() or jcmd GC.run). The first request records the "    \
+          "reset mark, every later request discards everything allocated "  \
+          "after the mark. Unsafe unless the application guarantees that "  \
+          "nothing allocated after the mark is still reachable at the "     \
+          "reset, including classes loaded since the mark.")
 
 // end of GC_EPSILON_FLAGS
 
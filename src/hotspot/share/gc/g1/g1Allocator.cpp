@@ -348,6 +348,13 @@ HeapWord* G1PLABAllocator::allocate_direct_or_new_plab(G1HeapRegionAttr dest,
 
     if (buf != NULL) {
       alloc_buf->set_buf(buf, actual_plab_size);
+      if (dest.is_old()) {
+        // Update the BOT once for the whole PLAB instead of for every object
+        // copied into it. The entries are coarse - they point back to the
+        // PLAB start - but the first card scan walking from there refines
+        // them, and retiring the PLAB keeps the range parseable.
+        _g1h->heap_region_containing(buf)->update_bot_for_block(buf, buf + actual_plab_size);
+      }
 
       HeapWord* const obj = alloc_buf->allocate(word_sz);
       assert(obj != NULL, "PLAB should have been big enough, tried to allocate "
@@ -362,6 +369,9 @@ HeapWord* G1PLABAllocator::allocate_direct_or_new_plab(G1HeapRegionAttr dest,
   HeapWord* result = _allocator->par_allocate_during_gc(dest, word_sz, node_index);
   if (result != NULL) {
     _direct_allocated[dest.type()] += word_sz;
+    if (dest.is_old()) {
+      _g1h->heap_region_containing(result)->update_bot_for_block(result, result + word_sz);
+    }
   }
   return result;
 }
@@ -87,7 +87,8 @@ G1Analytics::G1Analytics(const G1Predictions* predictor) :
     _mixed_cost_per_card_scan_ms_seq(new TruncatedSeq(TruncatedSeqLength)),
     _young_cost_per_card_merge_ms_seq(new TruncatedSeq(TruncatedSeqLength)),
     _mixed_cost_per_card_merge_ms_seq(new TruncatedSeq(TruncatedSeqLength)),
-    _copy_cost_per_byte_ms_seq(new TruncatedSeq(TruncatedSeqLength)),
+    _young_copy_cost_per_byte_ms_seq(new TruncatedSeq(TruncatedSeqLength)),
+    _mixed_copy_cost_per_byte_ms_seq(new TruncatedSeq(TruncatedSeqLength)),
     _constant_other_time_ms_seq(new TruncatedSeq(TruncatedSeqLength)),
     _young_other_cost_per_region_ms_seq(new TruncatedSeq(TruncatedSeqLength)),
     _non_young_other_cost_per_region_ms_seq(new TruncatedSeq(TruncatedSeqLength)),
@@ -112,7 +113,7 @@ G1Analytics::G1Analytics(const G1Predictions* predictor) :
   _young_card_merge_to_scan_ratio_seq->add(young_card_merge_to_scan_ratio_defaults[index]);
   _young_cost_per_card_scan_ms_seq->add(young_only_cost_per_card_scan_ms_defaults[index]);
 
-  _copy_cost_per_byte_ms_seq->add(cost_per_byte_ms_defaults[index]);
+  _young_copy_cost_per_byte_ms_seq->add(cost_per_byte_ms_defaults[index]);
   _constant_other_time_ms_seq->add(constant_other_time_ms_defaults[index]);
   _young_other_cost_per_region_ms_seq->add(young_other_cost_per_region_ms_defaults[index]);
   _non_young_other_cost_per_region_ms_seq->add(non_young_other_cost_per_region_ms_defaults[index]);
@@ -197,11 +198,13 @@ void G1Analytics::report_rs_length_diff(double rs_length_diff) {
   _rs_length_diff_seq->add(rs_length_diff);
 }
 
-void G1Analytics::report_cost_per_byte_ms(double cost_per_byte_ms, bool mark_or_rebuild_in_progress) {
+void G1Analytics::report_cost_per_byte_ms(double cost_per_byte_ms, bool for_young_gc, bool mark_or_rebuild_in_progress) {
   if (mark_or_rebuild_in_progress) {
     _cost_per_byte_ms_during_cm_seq->add(cost_per_byte_ms);
+  } else if (for_young_gc) {
+    _young_copy_cost_per_byte_ms_seq->add(cost_per_byte_ms);
   } else {
-    _copy_cost_per_byte_ms_seq->add(cost_per_byte_ms);
+    _mixed_copy_cost_per_byte_ms_seq->add(cost_per_byte_ms);
   }
 }
 
@@ -267,17 +270,19 @@ double G1Analytics::predict_card_scan_time_ms(size_t card_num, bool for_young_gc
 
 double G1Analytics::predict_object_copy_time_ms_during_cm(size_t bytes_to_copy) const {
   if (!enough_samples_available(_cost_per_byte_ms_during_cm_seq)) {
-    return (1.1 * bytes_to_copy) * predict_zero_bounded(_copy_cost_per_byte_ms_seq);
+    return (1.1 * bytes_to_copy) * predict_zero_bounded(_young_copy_cost_per_byte_ms_seq);
   } else {
     return bytes_to_copy * predict_zero_bounded(_cost_per_byte_ms_during_cm_seq);
   }
 }
 
-double G1Analytics::predict_object_copy_time_ms(size_t bytes_to_copy, bool during_concurrent_mark) const {
+double G1Analytics::predict_object_copy_time_ms(size_t bytes_to_copy, bool for_young_gc, bool during_concurrent_mark) const {
   if (during_concurrent_mark) {
     return predict_object_copy_time_ms_during_cm(bytes_to_copy);
+  } else if (for_young_gc || !enough_samples_available(_mixed_copy_cost_per_byte_ms_seq)) {
+    return bytes_to_copy * predict_zero_bounded(_young_copy_cost_per_byte_ms_seq);
   } else {
-    return bytes_to_copy * predict_zero_bounded(_copy_cost_per_byte_ms_seq);
+    return bytes_to_copy * predict_zero_bounded(_mixed_copy_cost_per_byte_ms_seq);
   }
 }
 
@@ -61,8 +61,9 @@ class G1Analytics: public CHeapObj<mtGC> {
   TruncatedSeq* _young_cost_per_card_merge_ms_seq;
   TruncatedSeq* _mixed_cost_per_card_merge_ms_seq;
 
-  // The cost to copy a byte in ms.
-  TruncatedSeq* _copy_cost_per_byte_ms_seq;
+  // The cost to copy a byte during young-only and mixed gcs in ms.
+  TruncatedSeq* _young_copy_cost_per_byte_ms_seq;
+  TruncatedSeq* _mixed_copy_cost_per_byte_ms_seq;
   TruncatedSeq* _constant_other_time_ms_seq;
   TruncatedSeq* _young_other_cost_per_region_ms_seq;
   TruncatedSeq* _non_young_other_cost_per_region_ms_seq;
@@ -127,7 +128,7 @@ public:
   void report_cost_per_card_merge_ms(double cost_per_card_ms, bool for_young_gc);
   void report_card_merge_to_scan_ratio(double cards_per_entry_ratio, bool for_young_gc);
   void report_rs_length_diff(double rs_length_diff);
-  void report_cost_per_byte_ms(double cost_per_byte_ms, bool mark_or_rebuild_in_progress);
+  void report_cost_per_byte_ms(double cost_per_byte_ms, bool for_young_gc, bool mark_or_rebuild_in_progress);
   void report_young_other_cost_per_region_ms(double other_cost_per_region_ms);
   void report_non_young_other_cost_per_region_ms(double other_cost_per_region_ms);
   void report_constant_other_time_ms(double constant_other_time_ms);
@@ -150,7 +151,7 @@ public:
 
   double predict_object_copy_time_ms_during_cm(size_t bytes_to_copy) const;
 
-  double predict_object_copy_time_ms(size_t bytes_to_copy, bool during_concurrent_mark) const;
+  double predict_object_copy_time_ms(size_t bytes_to_copy, bool for_young_gc, bool during_concurrent_mark) const;
 
   double predict_constant_other_time_ms() const;
 
@@ -92,6 +92,14 @@ void G1BarrierSet::write_ref_array_pre(narrowOop* dst, size_t count, bool dest_u
 void G1BarrierSet::write_ref_field_post_slow(volatile CardValue* byte) {
   // In the slow path, we know a card is not young
   assert(*byte != G1CardTable::g1_young_card_val(), "slow path invoked without filtering");
+  // The card table itself acts as the duplicate filter for enqueued cards:
+  // a card is only enqueued on a clean-to-dirty transition, and repeated
+  // writes to a still-dirty card are filtered below (and in the compiled
+  // barriers) without enqueueing. Any filtering ahead of this fence - for
+  // example a thread-local cache of recently enqueued cards - would be
+  // unsound, because concurrent refinement may have cleaned and scanned the
+  // card since it was recorded, and only the fence plus card re-check
+  // orders this store with that scan.
   OrderAccess::storeload();
   if (*byte != G1CardTable::dirty_card_val()) {
     *byte = G1CardTable::dirty_card_val();
@@ -25,81 +25,67 @@
 #include "precompiled.hpp"
 #include "gc/g1/g1CardCounts.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
-#include "gc/shared/cardTableBarrierSet.hpp"
-#include "services/memTracker.hpp"
+#include "memory/allocation.inline.hpp"
 #include "utilities/copy.hpp"
-
-void G1CardCountsMappingChangedListener::on_commit(uint start_idx, size_t num_regions, bool zero_filled) {
-  if (zero_filled) {
-    return;
-  }
-  MemRegion mr(G1CollectedHeap::heap()->bottom_addr_for_region(start_idx), num_regions * HeapRegion::GrainWords);
-  _counts->clear_range(mr);
-}
-
-size_t G1CardCounts::compute_size(size_t mem_region_size_in_words) {
-  // We keep card counts for every card, so the size of the card counts table must
-  // be the same as the card table.
-  return G1CardTable::compute_size(mem_region_size_in_words);
-}
-
-size_t G1CardCounts::heap_map_factor() {
-  // See G1CardCounts::compute_size() why we reuse the card table value.
-  return G1CardTable::heap_map_factor();
-}
-
-void G1CardCounts::clear_range(size_t from_card_num, size_t to_card_num) {
-  if (has_count_table()) {
-    assert(from_card_num < to_card_num,
-           "Wrong order? from: " SIZE_FORMAT ", to: " SIZE_FORMAT,
-           from_card_num, to_card_num);
-    Copy::fill_to_bytes(&_card_counts[from_card_num], (to_card_num - from_card_num));
-  }
-}
+#include "utilities/powerOfTwo.hpp"
 
 G1CardCounts::G1CardCounts(G1CollectedHeap *g1h):
-  _listener(), _g1h(g1h), _ct(NULL), _card_counts(NULL), _reserved_max_card_num(0), _ct_bot(NULL) {
-  _listener.set_cardcounts(this);
+  _g1h(g1h), _sketch(NULL), _counters_per_row(0), _hash_shift(0) {
 }
 
-void G1CardCounts::initialize(G1RegionToSpaceMapper* mapper) {
+void G1CardCounts::initialize() {
   assert(_g1h->reserved().byte_size() > 0, "initialization order");
-  assert(_g1h->capacity() == 0, "initialization order");
 
   if (G1ConcRSHotCardLimit > 0) {
-    // The max value we can store in the counts table is
-    // max_jubyte. Guarantee the value of the hot
-    // threshold limit is no more than this.
+    // The max value we can store in a sketch counter is max_jubyte.
+    // Guarantee the value of the hot threshold limit is no more than this.
     guarantee(G1ConcRSHotCardLimit <= max_jubyte, "sanity");
 
-    _ct = _g1h->card_table();
-    _ct_bot = _ct->byte_for_const(_g1h->reserved().start());
+    const size_t reserved_cards = _g1h->reserved().byte_size() / G1CardTable::card_size();
+    _counters_per_row = round_up_power_of_2(MAX2(reserved_cards / cards_per_counter,
+                                                 min_counters_per_row));
+    _hash_shift = 64 - log2i_exact(_counters_per_row);
 
-    _card_counts = (jubyte*) mapper->reserved().start();
-    _reserved_max_card_num = mapper->reserved().byte_size();
-    mapper->set_mapping_changed_listener(&_listener);
+    _sketch = NEW_C_HEAP_ARRAY(uint8_t, _counters_per_row * num_rows, mtGC);
+    Copy::fill_to_bytes(_sketch, _counters_per_row * num_rows);
   }
 }
 
+uint8_t* G1CardCounts::counter_for(const CardValue* card_ptr, uint row) {
+  // Multiplicative hashing of the card address. Each row uses a different
+  // odd multiplier so that the rows hash independently; the top bits of
+  // the product are the best mixed.
+  static const uint64_t row_mix[num_rows] = {
+    UINT64_C(0x9E3779B97F4A7C15),
+    UINT64_C(0xC6A4A7935BD1E995)
+  };
+  const uint64_t hash = (uint64_t)(uintptr_t)card_ptr * row_mix[row];
+  const size_t index = (size_t)(hash >> _hash_shift);
+  return &_sketch[row * _counters_per_row + index];
+}
+
 uint G1CardCounts::add_card_count(CardValue* card_ptr) {
-  // Returns the number of times the card has been refined.
-  // If we failed to reserve/commit the counts table, return 0.
-  // If card_ptr is beyond the committed end of the counts table,
-  // return 0.
-  // Otherwise return the actual count.
-  // Unless G1ConcRSHotCardLimit has been set appropriately,
-  // returning 0 will result in the card being considered
-  // cold and will be refined immediately.
+  // Returns the number of times the card has been refined, as estimated
+  // by the sketch. If we failed to allocate the sketch, return 0; unless
+  // G1ConcRSHotCardLimit has been set appropriately, returning 0 will
+  // result in the card being considered cold and refined immediately.
   uint count = 0;
   if (has_count_table()) {
-    size_t card_num = ptr_2_card_num(card_ptr);
-    assert(card_num < _reserved_max_card_num,
-           "Card " SIZE_FORMAT " outside of card counts table (max size " SIZE_FORMAT ")",
-           card_num, _reserved_max_card_num);
-    count = (uint) _card_counts[card_num];
+    uint8_t* const c0 = counter_for(card_ptr, 0);
+    uint8_t* const c1 = counter_for(card_ptr, 1);
+    count = MIN2((uint)*c0, (uint)*c1);
     if (count < G1ConcRSHotCardLimit) {
-      _card_counts[card_num] =
-        (jubyte)(MIN2((uintx)(_card_counts[card_num] + 1), G1ConcRSHotCardLimit));
+      // Conservative update: only bump counters that hold the minimum, so
+      // a counter shared with a hotter card is not inflated further. As
+      // with the byte-per-card table this used to be, concurrent updates
+      // may lose an increment; that is benign.
+      const uint8_t next = (uint8_t)(count + 1);
+      if (*c0 == count) {
+        *c0 = next;
+      }
+      if (*c1 == count) {
+        *c1 = next;
+      }
     }
   }
   return count;
@@ -109,49 +95,9 @@ bool G1CardCounts::is_hot(uint count) {
   return (count >= G1ConcRSHotCardLimit);
 }
 
-void G1CardCounts::clear_region(HeapRegion* hr) {
-  MemRegion mr(hr->bottom(), hr->end());
-  clear_range(mr);
-}
-
-void G1CardCounts::clear_range(MemRegion mr) {
-  if (has_count_table()) {
-    const CardValue* from_card_ptr = _ct->byte_for_const(mr.start());
-    // We use the last address in the range as the range could represent the
-    // last region in the heap. In which case trying to find the card will be an
-    // OOB access to the card table.
-    const CardValue* last_card_ptr = _ct->byte_for_const(mr.last());
-
-#ifdef ASSERT
-    HeapWord* start_addr = _ct->addr_for(from_card_ptr);
-    assert(start_addr == mr.start(), "MemRegion start must be aligned to a card.");
-    HeapWord* last_addr = _ct->addr_for(last_card_ptr);
-    assert((last_addr + G1CardTable::card_size_in_words()) == mr.end(), "MemRegion end must be aligned to a card.");
-#endif // ASSERT
-
-    // Clear the counts for the (exclusive) card range.
-    size_t from_card_num = ptr_2_card_num(from_card_ptr);
-    size_t to_card_num = ptr_2_card_num(last_card_ptr) + 1;
-    clear_range(from_card_num, to_card_num);
-  }
-}
-
-class G1CardCountsClearClosure : public HeapRegionClosure {
- private:
-  G1CardCounts* _card_counts;
- public:
-  G1CardCountsClearClosure(G1CardCounts* card_counts) :
-    HeapRegionClosure(), _card_counts(card_counts) { }
-
-
-  virtual bool do_heap_region(HeapRegion* r) {
-    _card_counts->clear_region(r);
-    return false;
-  }
-};
-
 void G1CardCounts::clear_all() {
   assert(SafepointSynchronize::is_at_safepoint(), "don't call this otherwise");
-  G1CardCountsClearClosure cl(this);
-  _g1h->heap_region_iterate(&cl);
+  if (has_count_table()) {
+    Copy::fill_to_bytes(_sketch, _counters_per_row * num_rows);
+  }
 }
@@ -26,93 +26,66 @@
 #define SHARE_GC_G1_G1CARDCOUNTS_HPP
 
 #include "gc/g1/g1CardTable.hpp"
-#include "gc/g1/g1RegionToSpaceMapper.hpp"
 #include "memory/allocation.hpp"
-#include "memory/virtualspace.hpp"
 #include "utilities/globalDefinitions.hpp"
 
-class CardTableBarrierSet;
-class G1CardCounts;
 class G1CollectedHeap;
-class G1RegionToSpaceMapper;
-class HeapRegion;
 
-class G1CardCountsMappingChangedListener : public G1MappingChangedListener {
- private:
-  G1CardCounts* _counts;
- public:
-  void set_cardcounts(G1CardCounts* counts) { _counts = counts; }
-
-  virtual void on_commit(uint start_idx, size_t num_regions, bool zero_filled);
-};
-
-// Table to track the number of times a card has been refined. Once
-// a card has been refined a certain number of times, it is
-// considered 'hot' and its refinement is delayed by inserting the
-// card into the hot card cache. The card will then be refined when
-// it is evicted from the hot card cache, or when the hot card cache
-// is 'drained' during the next evacuation pause.
+// Approximate table tracking the number of times a card has been refined.
+// Once a card has been refined a certain number of times, it is considered
+// 'hot' and its refinement is delayed by inserting the card into the hot
+// card cache. The card will then be refined when it is evicted from the
+// hot card cache, or when the hot card cache is 'drained' during the next
+// evacuation pause.
+//
+// Counts are kept in a count-min sketch instead of a byte per card: each
+// card hashes to one counter per row, the reported count is the minimum
+// over the rows, and only counters holding the minimum are incremented.
+// Hash collisions can only over-estimate a count, which at worst defers a
+// cold card to the next pause, so an exact table is not required. The
+// sketch is a small fraction of the size of a byte-per-card table, which
+// matters on very large heaps.
+//
+// The sketch is reset wholesale when the hot card cache is re-enabled at
+// the end of a pause. This replaces per-region clearing and also ages out
+// heat accumulated by cards that merely collided with hot cards.
 
 class G1CardCounts: public CHeapObj<mtGC> {
 public:
   typedef CardTable::CardValue CardValue;
 
 private:
-  G1CardCountsMappingChangedListener _listener;
+  // Number of sketch rows. Two rows keep the per-refinement cost at two
+  // counter probes while already making it unlikely that a cold card
+  // collides with a hot card in both rows.
+  static const uint num_rows = 2;
+
+  // Heap cards covered per sketch counter in each row.
+  static const size_t cards_per_counter = 64;
+
+  // Lower bound on the number of counters per row, to keep collision
+  // rates reasonable on small heaps.
+  static const size_t min_counters_per_row = 64 * K;
 
   G1CollectedHeap* _g1h;
-  G1CardTable*     _ct;
-
-  // The table of counts
-  uint8_t* _card_counts;
-
-  // Max capacity of the reserved space for the counts table
-  size_t _reserved_max_card_num;
-
-  // CardTable bottom.
-  const CardValue* _ct_bot;
-
-  // Returns true if the card counts table has been reserved.
-  bool has_reserved_count_table() { return _card_counts != NULL; }
-
-  // Returns true if the card counts table has been reserved and committed.
-  bool has_count_table() {
-    return has_reserved_count_table();
-  }
-
-  size_t ptr_2_card_num(const CardValue* card_ptr) {
-    assert(card_ptr >= _ct_bot,
-           "Invalid card pointer: "
-           "card_ptr: " PTR_FORMAT ", "
-           "_ct_bot: " PTR_FORMAT,
-           p2i(card_ptr), p2i(_ct_bot));
-    size_t card_num = pointer_delta(card_ptr, _ct_bot, sizeof(CardValue));
-    assert(card_num < _reserved_max_card_num,
-           "card pointer out of range: " PTR_FORMAT, p2i(card_ptr));
-    return card_num;
-  }
-
-  CardValue* card_num_2_ptr(size_t card_num) {
-    assert(card_num < _reserved_max_card_num,
-           "card num out of range: " SIZE_FORMAT, card_num);
-    return (CardValue*) (_ct_bot + card_num);
-  }
-
-  // Clear the counts table for the given (exclusive) index range.
-  void clear_range(size_t from_card_num, size_t to_card_num);
 
- public:
-  G1CardCounts(G1CollectedHeap* g1h);
+  // The sketch; num_rows consecutive rows of _counters_per_row counters.
+  uint8_t* _sketch;
 
-  // Return the number of slots needed for a card counts table
-  // that covers mem_region_words words.
-  static size_t compute_size(size_t mem_region_size_in_words);
+  size_t _counters_per_row;
 
-  // Returns how many bytes of the heap a single byte of the card counts table
-  // corresponds to.
-  static size_t heap_map_factor();
+  // Right shift turning a mixed 64-bit hash into a row index.
+  uint _hash_shift;
 
-  void initialize(G1RegionToSpaceMapper* mapper);
+  // Returns true if the sketch has been allocated.
+  bool has_count_table() { return _sketch != NULL; }
+
+  uint8_t* counter_for(const CardValue* card_ptr, uint row);
+
+ public:
+  G1CardCounts(G1CollectedHeap* g1h);
+
+  void initialize();
 
   // Increments the refinement count for the given card.
   // Returns the pre-increment count value.
@@ -122,13 +95,7 @@ private:
   // 'hot'; false otherwise.
   bool is_hot(uint count);
 
-  // Clears the card counts for the cards spanned by the region
-  void clear_region(HeapRegion* hr);
-
-  // Clears the card counts for the cards spanned by the MemRegion
-  void clear_range(MemRegion mr);
-
-  // Clear the entire card counts table during GC.
+  // Reset all counts in the sketch.
   void clear_all();
 };
 
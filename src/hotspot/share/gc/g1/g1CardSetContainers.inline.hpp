@@ -205,7 +205,22 @@ inline G1AddCardResult G1CardSetArray::add(uint card_idx) {
 inline bool G1CardSetArray::contains(uint card_idx) {
   EntryCountType num_entries = Atomic::load_acquire(&_num_entries) & EntryMask;
 
-  for (EntryCountType idx = 0; idx < num_entries; idx++) {
+  // Membership test is the hot operation during refinement. Scan four
+  // 16-bit entries at a time with a SWAR equality test: xor makes the
+  // matching lane zero, and the (x - 0x0001..) & ~x & 0x8000.. idiom
+  // lights up the top bit of any zero lane. Entries are only ever
+  // appended, so reading up to the snapshotted count is safe.
+  const uint64_t pattern = (uint64_t)(EntryDataType)card_idx * 0x0001000100010001ULL;
+  EntryCountType idx = 0;
+  for (; idx + 4 <= num_entries; idx += 4) {
+    uint64_t data;
+    memcpy(&data, &_data[idx], sizeof(data));
+    uint64_t diff = data ^ pattern;
+    if (((diff - 0x0001000100010001ULL) & ~diff & 0x8000800080008000ULL) != 0) {
+      return true;
+    }
+  }
+  for (; idx < num_entries; idx++) {
     if (_data[idx] == card_idx) {
       return true;
     }
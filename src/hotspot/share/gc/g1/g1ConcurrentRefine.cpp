@@ -30,8 +30,10 @@
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/iterator.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/java.hpp"
+#include "runtime/os.hpp"
 #include "runtime/thread.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/formatBuffer.hpp"
@@ -237,7 +239,9 @@ G1ConcurrentRefine::G1ConcurrentRefine(size_t green_zone,
   _green_zone(green_zone),
   _yellow_zone(yellow_zone),
   _red_zone(red_zone),
-  _min_yellow_zone_size(min_yellow_zone_size)
+  _min_yellow_zone_size(min_yellow_zone_size),
+  _prev_num_cards(0),
+  _prev_sample_counter(0)
 {
   assert_zone_constraints_gyr(green_zone, yellow_zone, red_zone);
 }
@@ -458,8 +462,51 @@ uint G1ConcurrentRefine::worker_id_offset() {
   return G1DirtyCardQueueSet::num_par_ids();
 }
 
+// When predicting queue growth, extrapolate the observed net rate of change
+// over this many milliseconds.  Roughly the time to refine a few buffers, so
+// a thread activated because of a prediction has work waiting by the time it
+// is running.
+static const double prediction_horizon_ms = 2.0;
+
+// Samples further apart than this are discarded; a rate estimated over a
+// long interval (e.g. one spanning a GC pause) says nothing about the
+// current mutator burst.
+static const double max_sample_age_ms = 10.0;
+
+// Estimate the number of pending cards a short time from now, by
+// extrapolating the net rate of change of the queue between refinement
+// steps.  The sampling state is shared between the refinement threads and
+// updated racily; an occasional lost or stale sample just makes a single
+// prediction conservative.
+size_t G1ConcurrentRefine::predict_num_cards(size_t num_cur_cards) {
+  jlong now = os::elapsed_counter();
+  jlong prev_counter = Atomic::load(&_prev_sample_counter);
+  size_t prev_cards = Atomic::load(&_prev_num_cards);
+  Atomic::store(&_prev_num_cards, num_cur_cards);
+  Atomic::store(&_prev_sample_counter, now);
+  double elapsed_ms = (now - prev_counter) * 1000.0 / os::elapsed_frequency();
+  if (elapsed_ms <= 0.0 ||
+      elapsed_ms > max_sample_age_ms ||
+      num_cur_cards <= prev_cards) {
+    // No usable sample, or the queue is shrinking; predict no growth.
+    return num_cur_cards;
+  }
+  double growth_rate = (num_cur_cards - prev_cards) / elapsed_ms;
+  return num_cur_cards + static_cast<size_t>(growth_rate * prediction_horizon_ms);
+}
+
 void G1ConcurrentRefine::maybe_activate_more_threads(uint worker_id, size_t num_cur_cards) {
-  if (num_cur_cards > activation_threshold(worker_id + 1)) {
+  size_t threshold = activation_threshold(worker_id + 1);
+  if (num_cur_cards > threshold) {
+    _thread_control.maybe_activate_next(worker_id);
+  } else if (G1UseAdaptiveConcRefinement &&
+             predict_num_cards(num_cur_cards) > threshold) {
+    // The queue is growing fast enough that it is expected to pass the
+    // threshold shortly; activate the next thread now instead of letting
+    // cards accumulate while this one works through the backlog.
+    log_trace(gc, refine)("Early activation of worker %u, current: " SIZE_FORMAT
+                          ", threshold: " SIZE_FORMAT,
+                          worker_id + 1, num_cur_cards, threshold);
     _thread_control.maybe_activate_next(worker_id);
   }
 }
@@ -99,6 +99,14 @@ class G1ConcurrentRefine : public CHeapObj<mtGC> {
   size_t _red_zone;
   size_t _min_yellow_zone_size;
 
+  // Sampling state for predicting near-term growth of the dirty card
+  // queue, used to activate additional refinement threads before the
+  // corresponding activation thresholds are actually reached.  Updated
+  // racily by the refinement threads; a lost update only delays the next
+  // prediction by one refinement step.
+  volatile size_t _prev_num_cards;
+  volatile jlong _prev_sample_counter;
+
   G1ConcurrentRefine(size_t green_zone,
                      size_t yellow_zone,
                      size_t red_zone,
@@ -110,6 +118,7 @@ class G1ConcurrentRefine : public CHeapObj<mtGC> {
                     double goal_ms);
 
   static uint worker_id_offset();
+  size_t predict_num_cards(size_t num_cur_cards);
   void maybe_activate_more_threads(uint worker_id, size_t num_cur_cards);
 
   jint initialize();
@@ -33,9 +33,12 @@
 #include "gc/g1/g1OopClosures.inline.hpp"
 #include "gc/g1/heapRegion.hpp"
 #include "gc/g1/heapRegionRemSet.inline.hpp"
+#include "memory/allocation.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/compressedOops.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 class RemoveSelfForwardPtrObjClosure {
   G1CollectedHeap* _g1h;
@@ -49,14 +52,15 @@ class RemoveSelfForwardPtrObjClosure {
 public:
   RemoveSelfForwardPtrObjClosure(HeapRegion* hr,
                                  bool during_concurrent_start,
-                                 uint worker_id) :
+                                 uint worker_id,
+                                 HeapWord* first_gap_start) :
     _g1h(G1CollectedHeap::heap()),
     _cm(_g1h->concurrent_mark()),
     _hr(hr),
     _marked_words(0),
     _during_concurrent_start(during_concurrent_start),
     _worker_id(worker_id),
-    _last_forwarded_object_end(hr->bottom()) { }
+    _last_forwarded_object_end(first_gap_start) { }
 
   size_t marked_bytes() { return _marked_words * HeapWordSize; }
 
@@ -136,87 +140,150 @@ public:
     assert(!_cm->is_marked_in_prev_bitmap(cast_to_oop(start)), "should not be marked in prev bitmap");
   }
 
-  void zap_remainder() {
-    zap_dead_objects(_last_forwarded_object_end, _hr->top());
-  }
-};
-
-class RemoveSelfForwardPtrHRClosure: public HeapRegionClosure {
-  G1CollectedHeap* _g1h;
-  uint _worker_id;
-
-  G1EvacFailureRegions* _evac_failure_regions;
-
-  G1GCPhaseTimes* _phase_times;
-
-public:
-  RemoveSelfForwardPtrHRClosure(uint worker_id,
-                                G1EvacFailureRegions* evac_failure_regions) :
-    _g1h(G1CollectedHeap::heap()),
-    _worker_id(worker_id),
-    _evac_failure_regions(evac_failure_regions),
-    _phase_times(G1CollectedHeap::heap()->phase_times()) {
+  // Zap the dead gap following the last object this closure has applied,
+  // up to the given end address.
+  void zap_to(HeapWord* end) {
+    zap_dead_objects(_last_forwarded_object_end, end);
   }
 
-  size_t remove_self_forward_ptr_by_walking_hr(HeapRegion* hr,
-                                               bool during_concurrent_start) {
-    RemoveSelfForwardPtrObjClosure rspc(hr,
-                                        during_concurrent_start,
-                                        _worker_id);
+  HeapWord* last_forwarded_object_end() const { return _last_forwarded_object_end; }
+};
 
-    // All objects that failed evacuation has been marked in the prev bitmap.
-    // Use the bitmap to apply the above closure to all failing objects.
-    G1CMBitMap* bitmap = const_cast<G1CMBitMap*>(_g1h->concurrent_mark()->prev_mark_bitmap());
-    hr->apply_to_marked_objects(bitmap, &rspc);
-    // Need to zap the remainder area of the processed region.
-    rspc.zap_remainder();
+// Number of chunks we aim to hand every worker, so that the chunk claims
+// even out differences in the amount of live data per chunk.
+static const uint ChunksPerWorkerTarget = 4;
+
+// Number of chunks every failed region is split into. We aim at a few
+// chunks per worker even if only a single region failed, while keeping
+// chunks large enough that the claim overhead stays negligible.
+static uint calc_chunks_per_region(uint num_failed_regions) {
+  uint num_workers = G1CollectedHeap::heap()->workers()->active_workers();
+  uint total_target = num_workers * ChunksPerWorkerTarget;
+  uint per_region = MAX2(total_target / MAX2(num_failed_regions, 1u), 1u);
+  return clamp(round_up_power_of_2(per_region), 1u, 256u);
+}
 
-    return rspc.marked_bytes();
+G1ParRemoveSelfForwardPtrsTask::G1ParRemoveSelfForwardPtrsTask(G1EvacFailureRegions* evac_failure_regions) :
+  WorkerTask("G1 Remove Self-forwarding Pointers"),
+  _g1h(G1CollectedHeap::heap()),
+  _evac_failure_regions(evac_failure_regions),
+  _chunks_per_region(calc_chunks_per_region(evac_failure_regions->num_regions_failed_evacuation())),
+  _cur_chunk(0),
+  _chunks_processed(NEW_C_HEAP_ARRAY(uint, evac_failure_regions->num_regions_failed_evacuation(), mtGC)),
+  _live_bytes(NEW_C_HEAP_ARRAY(size_t, evac_failure_regions->num_regions_failed_evacuation(), mtGC)) {
+
+  // The task is constructed by the VM thread at the safepoint, before the
+  // workers run, so the regions can be prepared without synchronization.
+  uint num_failed = _evac_failure_regions->num_regions_failed_evacuation();
+  for (uint i = 0; i < num_failed; i++) {
+    _chunks_processed[i] = 0;
+    _live_bytes[i] = 0;
+    prepare_region(_g1h->region_at(_evac_failure_regions->regions_failed_evacuation()[i]));
   }
+}
 
-  bool do_heap_region(HeapRegion *hr) {
-    assert(!hr->is_pinned(), "Unexpected pinned region at index %u", hr->hrm_index());
-    assert(hr->in_collection_set(), "bad CS");
-    assert(_evac_failure_regions->contains(hr->hrm_index()), "precondition");
+G1ParRemoveSelfForwardPtrsTask::~G1ParRemoveSelfForwardPtrsTask() {
+  FREE_C_HEAP_ARRAY(uint, _chunks_processed);
+  FREE_C_HEAP_ARRAY(size_t, _live_bytes);
+}
 
-    hr->clear_index_in_opt_cset();
+void G1ParRemoveSelfForwardPtrsTask::prepare_region(HeapRegion* hr) {
+  assert(!hr->is_pinned(), "Unexpected pinned region at index %u", hr->hrm_index());
+  assert(hr->in_collection_set(), "bad CS");
+  assert(_evac_failure_regions->contains(hr->hrm_index()), "precondition");
 
-    bool during_concurrent_start = _g1h->collector_state()->in_concurrent_start_gc();
-    bool during_concurrent_mark = _g1h->collector_state()->mark_or_rebuild_in_progress();
+  hr->clear_index_in_opt_cset();
 
-    hr->note_self_forwarding_removal_start(during_concurrent_start,
-                                           during_concurrent_mark);
+  bool during_concurrent_start = _g1h->collector_state()->in_concurrent_start_gc();
+  bool during_concurrent_mark = _g1h->collector_state()->mark_or_rebuild_in_progress();
 
-    _phase_times->record_or_add_thread_work_item(G1GCPhaseTimes::RestoreRetainedRegions,
-                                                   _worker_id,
-                                                   1,
-                                                   G1GCPhaseTimes::RestoreRetainedRegionsNum);
+  hr->note_self_forwarding_removal_start(during_concurrent_start,
+                                         during_concurrent_mark);
+}
 
-    size_t live_bytes = remove_self_forward_ptr_by_walking_hr(hr, during_concurrent_start);
+void G1ParRemoveSelfForwardPtrsTask::process_chunk(uint worker_id, uint chunk_idx) {
+  uint region_pos = chunk_idx / _chunks_per_region;
+  uint chunk_in_region = chunk_idx % _chunks_per_region;
+  HeapRegion* hr = _g1h->region_at(_evac_failure_regions->regions_failed_evacuation()[region_pos]);
+
+  // All objects that failed evacuation have been marked in the prev bitmap.
+  G1CMBitMap* bitmap = const_cast<G1CMBitMap*>(_g1h->concurrent_mark()->prev_mark_bitmap());
+  HeapWord* bottom = hr->bottom();
+  HeapWord* top = hr->top();
+  size_t chunk_words = HeapRegion::GrainWords / _chunks_per_region;
+  HeapWord* chunk_start = bottom + chunk_in_region * chunk_words;
+  HeapWord* chunk_end = chunk_start + chunk_words;
+  HeapWord* walk_limit = MIN2(chunk_end, top);
+
+  // The chunk owner handles exactly the marked objects whose start is inside
+  // its chunk, plus the dead gap following each of them, which may stretch
+  // beyond the chunk boundary up to the next marked object or top. The first
+  // chunk additionally owns the gap from bottom to the region's first marked
+  // object. This way every dead gap is zapped by exactly one worker, and the
+  // BOT updates of different workers are for disjoint blocks.
+  HeapWord* first = (chunk_start < top) ? bitmap->get_next_marked_addr(chunk_start, top) : top;
+
+  size_t live_bytes = 0;
+  if (first < walk_limit || chunk_in_region == 0) {
+    RemoveSelfForwardPtrObjClosure rspc(hr,
+                                        _g1h->collector_state()->in_concurrent_start_gc(),
+                                        worker_id,
+                                        chunk_in_region == 0 ? bottom : first);
+    HeapWord* cur = first;
+    while (cur < walk_limit) {
+      HeapWord* obj_end = cur + rspc.apply(cast_to_oop(cur));
+      cur = (obj_end < top) ? bitmap->get_next_marked_addr(obj_end, top) : top;
+    }
+    // Zap from the end of our last object (or from bottom, for a first chunk
+    // without any marked objects) up to the next marked object or top. All
+    // addresses below walk_limit have been consumed by the loop above, so
+    // the search can start at the chunk boundary.
+    HeapWord* from = MAX2(rspc.last_forwarded_object_end(), walk_limit);
+    HeapWord* next = (from < top) ? bitmap->get_next_marked_addr(from, top) : top;
+    rspc.zap_to(next);
+
+    live_bytes = rspc.marked_bytes();
+  }
 
-    hr->rem_set()->clean_code_roots(hr);
-    hr->rem_set()->clear_locked(true);
+  if (live_bytes > 0) {
+    Atomic::add(&_live_bytes[region_pos], live_bytes);
+  }
+  // The worker that retires the last chunk of the region completes it.
+  uint chunks_processed = Atomic::add(&_chunks_processed[region_pos], 1u);
+  if (chunks_processed == _chunks_per_region) {
+    complete_region(hr, region_pos, worker_id);
+  }
+}
 
-    hr->note_self_forwarding_removal_end(live_bytes);
-    _g1h->verifier()->check_bitmaps("Self-Forwarding Ptr Removal", hr);
+void G1ParRemoveSelfForwardPtrsTask::complete_region(HeapRegion* hr, uint region_pos, uint worker_id) {
+  hr->rem_set()->clean_code_roots(hr);
+  hr->rem_set()->clear_locked(true);
 
-    return false;
-  }
-};
+  hr->note_self_forwarding_removal_end(Atomic::load(&_live_bytes[region_pos]));
+  _g1h->verifier()->check_bitmaps("Self-Forwarding Ptr Removal", hr);
 
-G1ParRemoveSelfForwardPtrsTask::G1ParRemoveSelfForwardPtrsTask(G1EvacFailureRegions* evac_failure_regions) :
-  WorkerTask("G1 Remove Self-forwarding Pointers"),
-  _g1h(G1CollectedHeap::heap()),
-  _hrclaimer(_g1h->workers()->active_workers()),
-  _evac_failure_regions(evac_failure_regions) { }
+  _g1h->phase_times()->record_or_add_thread_work_item(G1GCPhaseTimes::RestoreRetainedRegions,
+                                                      worker_id,
+                                                      1,
+                                                      G1GCPhaseTimes::RestoreRetainedRegionsNum);
+}
 
-void G1ParRemoveSelfForwardPtrsTask::work(uint worker_id) {
-  RemoveSelfForwardPtrHRClosure rsfp_cl(worker_id, _evac_failure_regions);
+uint G1ParRemoveSelfForwardPtrsTask::num_total_chunks() const {
+  return _evac_failure_regions->num_regions_failed_evacuation() * _chunks_per_region;
+}
 
-  // Iterate through all regions that failed evacuation during the entire collection.
-  _evac_failure_regions->par_iterate(&rsfp_cl, &_hrclaimer, worker_id);
+double G1ParRemoveSelfForwardPtrsTask::worker_cost() const {
+  return MAX2((double)num_total_chunks() / ChunksPerWorkerTarget, 1.0);
 }
 
-uint G1ParRemoveSelfForwardPtrsTask::num_failed_regions() const {
-  return _evac_failure_regions->num_regions_failed_evacuation();
+void G1ParRemoveSelfForwardPtrsTask::work(uint worker_id) {
+  uint total_chunks = num_total_chunks();
+
+  // Self-claiming loop over all (region, chunk) pairs of the regions that
+  // failed evacuation during the entire collection.
+  for (uint chunk_idx = Atomic::fetch_and_add(&_cur_chunk, 1u);
+       chunk_idx < total_chunks;
+       chunk_idx = Atomic::fetch_and_add(&_cur_chunk, 1u)) {
+    process_chunk(worker_id, chunk_idx);
+  }
 }
@@ -26,29 +26,51 @@
 #define SHARE_GC_G1_G1EVACFAILURE_HPP
 
 #include "gc/g1/g1OopClosures.hpp"
-#include "gc/g1/heapRegionManager.hpp"
 #include "gc/shared/workerThread.hpp"
 #include "utilities/globalDefinitions.hpp"
 
 class G1CollectedHeap;
 class G1EvacFailureRegions;
+class HeapRegion;
 
 // Task to fixup self-forwarding pointers
 // installed as a result of an evacuation failure.
+//
+// Every failed region is split into equally sized chunks that are claimed
+// individually by the workers, so recovery scales with the active workers
+// even when only a few (or a single, large) region failed evacuation. The
+// regions themselves are prepared up front by the VM thread; the worker
+// that processes the last chunk of a region completes it.
 class G1ParRemoveSelfForwardPtrsTask: public WorkerTask {
-protected:
   G1CollectedHeap* _g1h;
-  HeapRegionClaimer _hrclaimer;
 
   G1EvacFailureRegions* _evac_failure_regions;
-  uint volatile _num_failed_regions;
+
+  // Number of chunks every failed region is split into. Always a power of
+  // two that divides the region size.
+  uint _chunks_per_region;
+  // Global claim counter over all (region, chunk) pairs.
+  volatile uint _cur_chunk;
+  // Per failed region: number of chunks processed so far (updated
+  // atomically by the chunk workers).
+  uint* _chunks_processed;
+  // Per failed region: bytes of live (self-forwarded) objects, accumulated
+  // atomically by the chunk workers.
+  size_t* _live_bytes;
+
+  void prepare_region(HeapRegion* hr);
+  void process_chunk(uint worker_id, uint chunk_idx);
+  void complete_region(HeapRegion* hr, uint region_pos, uint worker_id);
+
+  uint num_total_chunks() const;
 
 public:
   G1ParRemoveSelfForwardPtrsTask(G1EvacFailureRegions* evac_failure_regions);
+  ~G1ParRemoveSelfForwardPtrsTask();
 
   void work(uint worker_id);
 
-  uint num_failed_regions() const;
+  double worker_cost() const;
 };
 
 #endif // SHARE_GC_G1_G1EVACFAILURE_HPP
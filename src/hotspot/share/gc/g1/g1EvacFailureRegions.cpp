@@ -55,16 +55,6 @@ void G1EvacFailureRegions::post_collection() {
   _max_regions = 0; // To have any record() attempt fail in the future.
 }
 
-void G1EvacFailureRegions::par_iterate(HeapRegionClosure* closure,
-                                       HeapRegionClaimer* _hrclaimer,
-                                       uint worker_id) const {
-  G1CollectedHeap::heap()->par_iterate_regions_array(closure,
-                                                     _hrclaimer,
-                                                     _evac_failure_regions,
-                                                     Atomic::load(&_evac_failure_regions_cur_length),
-                                                     worker_id);
-}
-
 bool G1EvacFailureRegions::contains(uint region_idx) const {
   assert(region_idx < _max_regions, "must be");
   return _regions_failed_evacuation.par_at(region_idx, memory_order_relaxed);
@@ -28,9 +28,6 @@
 #include "runtime/atomic.hpp"
 #include "utilities/bitMap.hpp"
 
-class HeapRegionClosure;
-class HeapRegionClaimer;
-
 // This class records for every region on the heap whether evacuation failed for it,
 // and records for every evacuation failure region to speed up iteration of these
 // regions in post evacuation phase.
@@ -54,9 +51,12 @@ public:
   void post_collection();
 
   bool contains(uint region_idx) const;
-  void par_iterate(HeapRegionClosure* closure,
-                   HeapRegionClaimer* _hrclaimer,
-                   uint worker_id) const;
+
+  // Array of the indices of the regions that failed evacuation in the
+  // current collection, for direct indexing during chunked iteration.
+  const uint* regions_failed_evacuation() const {
+    return _evac_failure_regions;
+  }
 
   uint num_regions_failed_evacuation() const {
     return Atomic::load(&_evac_failure_regions_cur_length);
@@ -304,7 +304,7 @@ void G1FullCollector::phase1_mark_live_objects() {
 void G1FullCollector::phase2_prepare_compaction() {
   GCTraceTime(Info, gc, phases) info("Phase 2: Prepare compaction", scope()->timer());
 
-  _heap->forwarding()->clear();
+  _heap->forwarding()->clear(_heap->workers());
 
   phase2a_determine_worklists();
 
@@ -35,7 +35,7 @@ G1HotCardCache::G1HotCardCache(G1CollectedHeap *g1h):
   _hot_cache_idx(0), _hot_cache_par_claimed_idx(0), _cache_wrapped_around(false)
 {}
 
-void G1HotCardCache::initialize(G1RegionToSpaceMapper* card_counts_storage) {
+void G1HotCardCache::initialize() {
   if (default_use_cache()) {
     _use_cache = true;
 
@@ -50,7 +50,7 @@ void G1HotCardCache::initialize(G1RegionToSpaceMapper* card_counts_storage) {
 
     _cache_wrapped_around = false;
 
-    _card_counts.initialize(card_counts_storage);
+    _card_counts.initialize();
   }
 }
 
@@ -116,7 +116,3 @@ void G1HotCardCache::drain(G1CardTableEntryClosure* cl, uint worker_id) {
   // The existing entries in the hot card cache, which were just refined
   // above, are discarded prior to re-enabling the cache near the end of the GC.
 }
-
-void G1HotCardCache::reset_card_counts(HeapRegion* hr) {
-  _card_counts.clear_region(hr);
-}
@@ -33,7 +33,6 @@
 
 class G1CardTableEntryClosure;
 class G1CollectedHeap;
-class HeapRegion;
 
 // An evicting cache of cards that have been logged by the G1 post
 // write barrier. Placing a card in the cache delays the refinement
@@ -97,7 +96,7 @@ private:
   G1HotCardCache(G1CollectedHeap* g1h);
   ~G1HotCardCache();
 
-  void initialize(G1RegionToSpaceMapper* card_counts_storage);
+  void initialize();
 
   bool use_cache() { return _use_cache; }
 
@@ -130,12 +129,13 @@ private:
     assert(SafepointSynchronize::is_at_safepoint(), "Should be at a safepoint");
     if (default_use_cache()) {
       reset_hot_cache_internal();
+      // Also reset the card count sketch, so that heat accumulated for
+      // reclaimed regions and for cards that merely collided with hot
+      // cards ages out.
+      _card_counts.clear_all();
     }
   }
 
-  // Zeros the values in the card counts table for the given region
-  void reset_card_counts(HeapRegion* hr);
-
   // Number of entries in the HCC.
   size_t num_entries() const {
     return _cache_wrapped_around ? _hot_cache_size : _hot_cache_idx + 1;
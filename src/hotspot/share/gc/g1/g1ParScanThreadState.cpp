@@ -433,12 +433,6 @@ void G1ParScanThreadState::undo_allocation(G1HeapRegionAttr dest_attr,
   _plab_allocator->undo_allocation(dest_attr, obj_ptr, word_sz, node_index);
 }
 
-void G1ParScanThreadState::update_bot_after_copying(oop obj, size_t word_sz) {
-  HeapWord* obj_start = cast_from_oop<HeapWord*>(obj);
-  HeapRegion* region = _g1h->heap_region_containing(obj_start);
-  region->update_bot_for_obj(obj_start, word_sz);
-}
-
 // Private inline function, for direct internal use and providing the
 // implementation of the public not-inline function.
 MAYBE_INLINE_EVACUATION
@@ -515,9 +509,10 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
         obj->incr_age();
       }
       _age_table.add(age, word_sz);
-    } else {
-      update_bot_after_copying(obj, word_sz);
     }
+    // No per-object BOT update is needed for old destinations; the BOT was
+    // updated in bulk when the destination PLAB (or direct allocation) was
+    // set up, see G1PLABAllocator::allocate_direct_or_new_plab().
 
     // Most objects are not arrays, so do one array check rather than
     // checking for each array category for each object.
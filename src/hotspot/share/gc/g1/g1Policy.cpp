@@ -82,6 +82,7 @@ G1Policy::G1Policy(STWGCTimer* gc_timer) :
   _phase_times(NULL),
   _mark_remark_start_sec(0),
   _mark_cleanup_start_sec(0),
+  _last_evac_termination_ratio(0.0),
   _tenuring_threshold(MaxTenuringThreshold),
   _max_survivor_regions(0),
   _survivors_age_table(true)
@@ -696,6 +697,16 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
 
   _eden_surv_rate_group->start_adding_regions();
 
+  double evac_time_ms = p->cur_collection_par_time_ms();
+  if (update_stats && evac_time_ms > 0.0) {
+    // Remember which share of the parallel evacuation the average worker
+    // spent waiting to terminate; the next pause trims its worker count by
+    // it (see G1YoungCollector::set_young_collection_default_active_worker_threads).
+    double termination_time_ms = average_time_ms(G1GCPhaseTimes::Termination) +
+                                 average_time_ms(G1GCPhaseTimes::OptTermination);
+    _last_evac_termination_ratio = MIN2(termination_time_ms / evac_time_ms, 1.0);
+  }
+
   double merge_hcc_time_ms = average_time_ms(G1GCPhaseTimes::MergeHCC);
   if (update_stats) {
     size_t const total_log_buffer_cards = p->sum_thread_work_items(G1GCPhaseTimes::MergeHCC, G1GCPhaseTimes::MergeHCCDirtyCards) +
@@ -754,7 +765,9 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
 
     if (copied_bytes > 0) {
       double cost_per_byte_ms = (average_time_ms(G1GCPhaseTimes::ObjCopy) + average_time_ms(G1GCPhaseTimes::OptObjCopy)) / copied_bytes;
-      _analytics->report_cost_per_byte_ms(cost_per_byte_ms, collector_state()->mark_or_rebuild_in_progress());
+      _analytics->report_cost_per_byte_ms(cost_per_byte_ms,
+                                          G1GCPauseTypeHelper::is_young_only_pause(this_pause),
+                                          collector_state()->mark_or_rebuild_in_progress());
     }
 
     if (_collection_set->young_region_length() > 0) {
@@ -931,12 +944,16 @@ double G1Policy::predict_eden_copy_time_ms(uint count, size_t* bytes_to_copy) co
   if (bytes_to_copy != NULL) {
     *bytes_to_copy = expected_bytes;
   }
-  return _analytics->predict_object_copy_time_ms(expected_bytes, collector_state()->mark_or_rebuild_in_progress());
+  return _analytics->predict_object_copy_time_ms(expected_bytes,
+                                                 collector_state()->in_young_only_phase(),
+                                                 collector_state()->mark_or_rebuild_in_progress());
 }
 
-double G1Policy::predict_region_copy_time_ms(HeapRegion* hr) const {
+double G1Policy::predict_region_copy_time_ms(HeapRegion* hr, bool for_young_gc) const {
   size_t const bytes_to_copy = predict_bytes_to_copy(hr);
-  return _analytics->predict_object_copy_time_ms(bytes_to_copy, collector_state()->mark_or_rebuild_in_progress());
+  return _analytics->predict_object_copy_time_ms(bytes_to_copy,
+                                                 for_young_gc,
+                                                 collector_state()->mark_or_rebuild_in_progress());
 }
 
 double G1Policy::predict_region_non_copy_time_ms(HeapRegion* hr,
@@ -959,7 +976,7 @@ double G1Policy::predict_region_non_copy_time_ms(HeapRegion* hr,
 }
 
 double G1Policy::predict_region_total_time_ms(HeapRegion* hr, bool for_young_gc) const {
-  return predict_region_non_copy_time_ms(hr, for_young_gc) + predict_region_copy_time_ms(hr);
+  return predict_region_non_copy_time_ms(hr, for_young_gc) + predict_region_copy_time_ms(hr, for_young_gc);
 }
 
 bool G1Policy::should_allocate_mutator_region() const {
@@ -1014,6 +1031,14 @@ void G1Policy::update_survivors_policy() {
   size_t const survivor_size = desired_survivor_size(desired_max_survivor_regions);
 
   _tenuring_threshold = _survivors_age_table.compute_tenuring_threshold(survivor_size);
+  // A threshold driven down by a large mass of freshly copied eden objects
+  // prematurely promotes the older, long-lived mode of a bimodal workload.
+  // Log the origin split so that such distributions can be recognized and
+  // countered with SurvivorRatio/TargetSurvivorRatio tuning.
+  log_debug(gc, age)("Survivors by origin: eden " SIZE_FORMAT "B, survivor space " SIZE_FORMAT "B (threshold %u)",
+                     _survivors_age_table.eden_origin_words() * oopSize,
+                     _survivors_age_table.survivor_origin_words() * oopSize,
+                     _tenuring_threshold);
   if (UsePerfData) {
     _policy_counters->tenuring_threshold()->set_value(_tenuring_threshold);
     _policy_counters->desired_survivor_size()->set_value(survivor_size * oopSize);
@@ -143,7 +143,7 @@ public:
 private:
   double predict_base_elapsed_time_ms(size_t num_pending_cards, size_t rs_length) const;
 
-  double predict_region_copy_time_ms(HeapRegion* hr) const;
+  double predict_region_copy_time_ms(HeapRegion* hr, bool for_young_gc) const;
 
 public:
 
@@ -193,6 +193,10 @@ private:
   double _mark_remark_start_sec;
   double _mark_cleanup_start_sec;
 
+  // Share of the previous parallel evacuation that the average worker spent
+  // waiting in termination; used to trim the worker count of the next pause.
+  double _last_evac_termination_ratio;
+
   // Updates the internal young list maximum and target lengths. Returns the
   // unbounded young list target length. If no rs_length parameter is passed,
   // predict the RS length using the prediction model, otherwise use the
@@ -316,6 +320,8 @@ public:
   void record_young_collection_start();
   void record_young_collection_end(bool concurrent_operation_is_full_mark, bool evacuation_failure);
 
+  double last_evac_termination_ratio() const { return _last_evac_termination_ratio; }
+
   // Record the start and end of a full collection.
   void record_full_collection_start();
   void record_full_collection_end();
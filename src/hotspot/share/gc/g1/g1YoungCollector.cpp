@@ -464,6 +464,19 @@ void G1YoungCollector::set_young_collection_default_active_worker_threads(){
   uint active_workers = WorkerPolicy::calc_active_workers(workers()->max_workers(),
                                                           workers()->active_workers(),
                                                           Threads::number_of_non_daemon_threads());
+  if (UseDynamicNumberOfGCThreads && FLAG_IS_DEFAULT(ParallelGCThreads)) {
+    // Trim by the termination-wait share measured in the previous
+    // evacuation: a worker parked in offer_termination contributes nothing,
+    // so if the average worker spent, say, a quarter of the evacuation
+    // waiting, about a quarter of the workers can be dropped without
+    // lengthening the pause. Small shares are normal termination protocol
+    // cost and ignored.
+    double termination_ratio = policy()->last_evac_termination_ratio();
+    if (termination_ratio > 0.1) {
+      uint trimmed = (uint)ceil(active_workers * (1.0 - termination_ratio));
+      active_workers = MAX2(trimmed, 2u);
+    }
+  }
   active_workers = workers()->set_active_workers(active_workers);
   log_info(gc,task)("Using %u workers of %u for evacuation", active_workers, workers()->max_workers());
 }
@@ -76,7 +76,6 @@ class HeapRegionManager: public CHeapObj<mtGC> {
 
   G1RegionToSpaceMapper* _bot_mapper;
   G1RegionToSpaceMapper* _cardtable_mapper;
-  G1RegionToSpaceMapper* _card_counts_mapper;
 
   // Keeps track of the currently committed regions in the heap. The committed regions
   // can either be active (ready for use) or inactive (ready for uncommit).
@@ -98,8 +97,12 @@ class HeapRegionManager: public CHeapObj<mtGC> {
   // the index of the first region or G1_NO_HRM_INDEX if the search was unsuccessful.
   // Start and end defines the range to seek in, policy is first-fit.
   uint find_contiguous_in_range(uint start, uint end, uint num_regions);
+  // As above, but policy is last-fit: returns the highest such set in the range.
+  uint find_contiguous_in_range_reverse(uint start, uint end, uint num_regions);
   // Find a contiguous set of empty regions of length num_regions. Returns the start index
-  // of that set, or G1_NO_HRM_INDEX.
+  // of that set, or G1_NO_HRM_INDEX. Prefers the highest fit, so that humongous
+  // objects cluster at the top of the committed space instead of interleaving
+  // with the regular region allocation at the bottom.
   uint find_contiguous_in_free_list(uint num_regions);
   // Find a contiguous set of empty or unavailable regions of length num_regions. Returns the
   // start index of that set, or G1_NO_HRM_INDEX.
@@ -165,8 +168,7 @@ public:
                   G1RegionToSpaceMapper* prev_bitmap,
                   G1RegionToSpaceMapper* next_bitmap,
                   G1RegionToSpaceMapper* bot,
-                  G1RegionToSpaceMapper* cardtable,
-                  G1RegionToSpaceMapper* card_counts);
+                  G1RegionToSpaceMapper* cardtable);
 
   // Return the "dummy" region used for G1AllocRegion. This is currently a hardwired
   // new HeapRegion that owns HeapRegion at index 0. Since at the moment we commit
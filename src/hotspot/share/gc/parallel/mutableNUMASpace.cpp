@@ -167,9 +167,23 @@ size_t MutableNUMASpace::free_in_words() const {
 }
 
 
+int MutableNUMASpace::current_lgrp_id(Thread* thr) const {
+  int lgrp_id = thr->lgrp_id();
+  // Without group homing a thread can migrate between nodes at any time, so
+  // the cached group only reflects where the thread allocated last. Refresh
+  // it from the current CPU so that TLAB sizing and allocation consistently
+  // target the node the thread runs on now. Only the thread itself can
+  // sample its residency; for other threads return the cached value.
+  if ((lgrp_id == -1 || !os::numa_has_group_homing()) && thr == Thread::current()) {
+    lgrp_id = os::numa_get_group_id();
+    thr->set_lgrp_id(lgrp_id);
+  }
+  return lgrp_id;
+}
+
 size_t MutableNUMASpace::tlab_capacity(Thread *thr) const {
   guarantee(thr != NULL, "No thread");
-  int lgrp_id = thr->lgrp_id();
+  int lgrp_id = current_lgrp_id(thr);
   if (lgrp_id == -1) {
     // This case can occur after the topology of the system has
     // changed. Thread can change their location, the new home
@@ -194,7 +208,7 @@ size_t MutableNUMASpace::tlab_capacity(Thread *thr) const {
 size_t MutableNUMASpace::tlab_used(Thread *thr) const {
   // Please see the comments for tlab_capacity().
   guarantee(thr != NULL, "No thread");
-  int lgrp_id = thr->lgrp_id();
+  int lgrp_id = current_lgrp_id(thr);
   if (lgrp_id == -1) {
     if (lgrp_spaces()->length() > 0) {
       return (used_in_bytes()) / lgrp_spaces()->length();
@@ -214,7 +228,7 @@ size_t MutableNUMASpace::tlab_used(Thread *thr) const {
 size_t MutableNUMASpace::unsafe_max_tlab_alloc(Thread *thr) const {
   // Please see the comments for tlab_capacity().
   guarantee(thr != NULL, "No thread");
-  int lgrp_id = thr->lgrp_id();
+  int lgrp_id = current_lgrp_id(thr);
   if (lgrp_id == -1) {
     if (lgrp_spaces()->length() > 0) {
       return free_in_bytes() / lgrp_spaces()->length();
@@ -233,7 +247,7 @@ size_t MutableNUMASpace::unsafe_max_tlab_alloc(Thread *thr) const {
 
 size_t MutableNUMASpace::capacity_in_words(Thread* thr) const {
   guarantee(thr != NULL, "No thread");
-  int lgrp_id = thr->lgrp_id();
+  int lgrp_id = current_lgrp_id(thr);
   if (lgrp_id == -1) {
     if (lgrp_spaces()->length() > 0) {
       return capacity_in_words() / lgrp_spaces()->length();
@@ -795,11 +809,7 @@ void MutableNUMASpace::clear(bool mangle_space) {
 
 HeapWord* MutableNUMASpace::cas_allocate(size_t size) {
   Thread* thr = Thread::current();
-  int lgrp_id = thr->lgrp_id();
-  if (lgrp_id == -1 || !os::numa_has_group_homing()) {
-    lgrp_id = os::numa_get_group_id();
-    thr->set_lgrp_id(lgrp_id);
-  }
+  int lgrp_id = current_lgrp_id(thr);
 
   int i = lgrp_spaces()->find(&lgrp_id, LGRPSpace::equals);
   // It is possible that a new CPU has been hotplugged and
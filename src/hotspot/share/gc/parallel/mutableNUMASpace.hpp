@@ -192,6 +192,12 @@ class MutableNUMASpace : public MutableSpace {
   void merge_regions(MemRegion new_region, MemRegion* intersection,
                      MemRegion *invalid_region);
 
+  // Return the locality group of the thread, refreshing the cached value
+  // from the thread's current CPU when the system does not home threads to
+  // a group. Returns -1 if the group is unknown (e.g. the thread has never
+  // allocated and the query is made from another thread).
+  int current_lgrp_id(Thread* thr) const;
+
  public:
   GrowableArray<LGRPSpace*>* lgrp_spaces() const     { return _lgrp_spaces;       }
   MutableNUMASpace(size_t alignment);
@@ -142,7 +142,26 @@ bool ObjectStartArray::object_starts_in_range(HeapWord* start_addr,
   jbyte* start_block = block_for_addr(start_addr);
   jbyte* end_block = block_for_addr(end_addr - 1);
 
-  for (jbyte* block = start_block; block <= end_block; block++) {
+  jbyte* block = start_block;
+
+  // Check leading entries up to the first word boundary.
+  for (; !is_aligned(block, sizeof(uintx)) && block <= end_block; block++) {
+    if (*block != clean_block) {
+      return true;
+    }
+  }
+
+  // Check a word of entries at a time. clean_block is -1, so a word of
+  // clean entries reads as all-ones; anything else means some entry in the
+  // word is set, and every entry in the word is within the queried range.
+  for (; block + sizeof(uintx) <= end_block + 1; block += sizeof(uintx)) {
+    if (*(uintx*)block != ~(uintx)0) {
+      return true;
+    }
+  }
+
+  // Check the remaining trailing entries.
+  for (; block <= end_block; block++) {
     if (*block != clean_block) {
       return true;
     }
@@ -27,6 +27,8 @@
 
 #include "gc/parallel/objectStartArray.hpp"
 
+#include "utilities/align.hpp"
+
 // Optimized for finding the first object that crosses into
 // a given block. The blocks contain the offset of the last
 // object in that block. Scroll backwards by one, and the first
@@ -36,6 +38,16 @@ HeapWord* ObjectStartArray::object_start(HeapWord* addr) const {
   jbyte* block = block_for_addr(addr);
   HeapWord* scroll_forward = offset_addr_for_block(block--);
   while (scroll_forward > addr) {
+    // A large object spans many blocks, all of them clean. Instead of
+    // scrolling over them one entry at a time, skip whole words of clean
+    // entries: clean_block is -1, so a word of clean entries reads as
+    // all-ones. A racy read here is no worse than the byte-sized reads
+    // below; at most we fall back to scrolling entry by entry.
+    while (is_aligned(block + 1, sizeof(uintx)) &&
+           block + 1 - sizeof(uintx) >= _raw_base &&
+           *(uintx*)(block + 1 - sizeof(uintx)) == ~(uintx)0) {
+      block -= sizeof(uintx);
+    }
     scroll_forward = offset_addr_for_block(block--);
   }
 
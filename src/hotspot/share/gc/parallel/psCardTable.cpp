@@ -126,7 +126,22 @@ static void prefetch_write(void *p) {
 // postcondition: ret is a dirty card or end_card
 CardTable::CardValue* PSCardTable::find_first_dirty_card(CardValue* const start_card,
                                                          CardValue* const end_card) {
-  for (CardValue* i_card = start_card; i_card < end_card; ++i_card) {
+  CardValue* i_card = start_card;
+  // Scan byte-wise up to the first word boundary.
+  while (i_card < end_card && !is_aligned(i_card, BytesPerWord)) {
+    if (*i_card != PSCardTable::clean_card_val()) {
+      return i_card;
+    }
+    i_card++;
+  }
+  // Fast forward over whole words of clean cards, as non_clean_card_iterate
+  // does for the serial collector. This loop compares a card-table word per
+  // iteration and is simple enough for compilers to vectorize.
+  for (CardValue* const aligned_end = align_down(end_card, BytesPerWord);
+       i_card < aligned_end && *((const intptr_t*)i_card) == clean_card_row_val();
+       i_card += BytesPerWord) {}
+  // Locate the dirty card within the mixed word, or finish the unaligned tail.
+  for (/* empty */; i_card < end_card; ++i_card) {
     if (*i_card != PSCardTable::clean_card_val()) {
       return i_card;
     }
@@ -2424,6 +2424,39 @@ public:
   }
 };
 
+class UpdateDeferredObjectsTask : public WorkerTask {
+  // Deferred object updates are independent of each other (there is at most
+  // one deferred object per region), so workers claim region ranges from
+  // per-space counters. Most regions have no deferred object and scanning
+  // their descriptors is cheap, hence the coarse claim granularity.
+  static const size_t RegionsPerClaim = 128;
+
+  size_t          _end_region[PSParallelCompact::last_space_id];
+  volatile size_t _counter[PSParallelCompact::last_space_id];
+
+public:
+  UpdateDeferredObjectsTask() : WorkerTask("UpdateDeferredObjectsTask") {
+    const ParallelCompactData& sd = PSParallelCompact::summary_data();
+    for (uint id = PSParallelCompact::old_space_id; id < PSParallelCompact::last_space_id; ++id) {
+      PSParallelCompact::SpaceId space_id = PSParallelCompact::SpaceId(id);
+      // Only regions outside the dense prefix can have a deferred object.
+      _counter[id] = sd.addr_to_region_idx(PSParallelCompact::dense_prefix(space_id));
+      _end_region[id] = sd.addr_to_region_idx(sd.region_align_up(PSParallelCompact::new_top(space_id)));
+    }
+  }
+
+  virtual void work(uint worker_id) {
+    ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(worker_id);
+    for (uint id = PSParallelCompact::old_space_id; id < PSParallelCompact::last_space_id; ++id) {
+      size_t beg;
+      while ((beg = Atomic::fetch_and_add(&_counter[id], RegionsPerClaim)) < _end_region[id]) {
+        size_t end = MIN2(beg + RegionsPerClaim, _end_region[id]);
+        PSParallelCompact::update_deferred_objects(cm, PSParallelCompact::SpaceId(id), beg, end);
+      }
+    }
+  }
+};
+
 void PSParallelCompact::compact() {
   GCTraceTime(Info, gc, phases) tm("Compaction Phase", &_gc_timer);
 
@@ -2460,10 +2493,8 @@ void PSParallelCompact::compact() {
   {
     GCTraceTime(Trace, gc, phases) tm("Deferred Updates", &_gc_timer);
     // Update the deferred objects, if any.
-    ParCompactionManager* cm = ParCompactionManager::get_vmthread_cm();
-    for (unsigned int id = old_space_id; id < last_space_id; ++id) {
-      update_deferred_objects(cm, SpaceId(id));
-    }
+    UpdateDeferredObjectsTask task;
+    ParallelScavengeHeap::heap()->workers().run_task(&task);
   }
 
   DEBUG_ONLY(write_block_fill_histogram());
@@ -2593,23 +2624,16 @@ PSParallelCompact::SpaceId PSParallelCompact::space_id(HeapWord* addr) {
 }
 
 void PSParallelCompact::update_deferred_objects(ParCompactionManager* cm,
-                                                SpaceId id) {
+                                                SpaceId id,
+                                                size_t beg_region,
+                                                size_t end_region) {
   assert(id < last_space_id, "bad space id");
 
   ParallelCompactData& sd = summary_data();
-  const SpaceInfo* const space_info = _space_info + id;
-  ObjectStartArray* const start_array = space_info->start_array();
-
-  const MutableSpace* const space = space_info->space();
-  assert(space_info->dense_prefix() >= space->bottom(), "dense_prefix not set");
-  HeapWord* const beg_addr = space_info->dense_prefix();
-  HeapWord* const end_addr = sd.region_align_up(space_info->new_top());
-
-  const RegionData* const beg_region = sd.addr_to_region_ptr(beg_addr);
-  const RegionData* const end_region = sd.addr_to_region_ptr(end_addr);
-  const RegionData* cur_region;
-  for (cur_region = beg_region; cur_region < end_region; ++cur_region) {
-    HeapWord* const addr = cur_region->deferred_obj_addr();
+  ObjectStartArray* const start_array = _space_info[id].start_array();
+
+  for (size_t cur = beg_region; cur < end_region; ++cur) {
+    HeapWord* const addr = sd.region(cur)->deferred_obj_addr();
     if (addr != NULL) {
       if (start_array != NULL) {
         start_array->allocate_block(addr);
@@ -1248,8 +1248,9 @@ class PSParallelCompact : AllStatic {
   // Fill in the block table for the specified region.
   static void fill_blocks(size_t region_idx);
 
-  // Update the deferred objects in the space.
-  static void update_deferred_objects(ParCompactionManager* cm, SpaceId id);
+  // Update the deferred objects in the given region index range of the space.
+  static void update_deferred_objects(ParCompactionManager* cm, SpaceId id,
+                                      size_t beg_region, size_t end_region);
 
   static ParMarkBitMap* mark_bitmap() { return &_mark_bitmap; }
   static ParallelCompactData& summary_data() { return _summary_data; }
@@ -230,20 +230,42 @@ void PSPromotionManager::drain_stacks_depth(bool totally_drain) {
 
   PSScannerTasksQueue* const tq = claimed_stack_depth();
   do {
-    ScannerTask task;
+    // Each loop below pops one task ahead of the one it processes, so the
+    // object the next task points to can be prefetched while the current
+    // one is processed (see prefetch_popped_location_depth).
+    ScannerTask next;
+    bool has_next;
 
     // Drain overflow stack first, so other threads can steal from
     // claimed stack while we work.
-    while (tq->pop_overflow(task)) {
+    has_next = tq->pop_overflow(next);
+    while (has_next) {
+      ScannerTask task = next;
+      has_next = tq->pop_overflow(next);
+      if (has_next) {
+        prefetch_popped_location_depth(next);
+      }
       process_popped_location_depth(task);
     }
 
     if (totally_drain) {
-      while (tq->pop_local(task)) {
+      has_next = tq->pop_local(next);
+      while (has_next) {
+        ScannerTask task = next;
+        has_next = tq->pop_local(next);
+        if (has_next) {
+          prefetch_popped_location_depth(next);
+        }
         process_popped_location_depth(task);
       }
     } else {
-      while (tq->size() > _target_stack_size && tq->pop_local(task)) {
+      has_next = tq->size() > _target_stack_size && tq->pop_local(next);
+      while (has_next) {
+        ScannerTask task = next;
+        has_next = tq->size() > _target_stack_size && tq->pop_local(next);
+        if (has_next) {
+          prefetch_popped_location_depth(next);
+        }
         process_popped_location_depth(task);
       }
     }
@@ -165,6 +165,7 @@ class PSPromotionManager {
   }
 
   inline void process_popped_location_depth(ScannerTask task);
+  inline void prefetch_popped_location_depth(ScannerTask task);
 
   static bool should_scavenge(oop* p, bool check_to_space = false);
   static bool should_scavenge(narrowOop* p, bool check_to_space = false);
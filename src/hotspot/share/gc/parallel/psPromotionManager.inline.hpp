@@ -334,6 +334,23 @@ inline void PSPromotionManager::process_popped_location_depth(ScannerTask task)
   }
 }
 
+// Prefetch the object a popped task points to. The drain loops pop one task
+// ahead of processing, so the prefetch has the processing time of the
+// preceding task to pull the mark word into the cache before the copy code
+// reads and CASes it. The prefetch issued when the task was pushed is
+// usually long evicted by the time the task is popped again.
+inline void PSPromotionManager::prefetch_popped_location_depth(ScannerTask task) {
+  if (!task.is_partial_array_task()) {
+    oop obj;
+    if (task.is_narrow_oop_ptr()) {
+      obj = RawAccess<IS_NOT_NULL>::oop_load(task.to_narrow_oop_ptr());
+    } else {
+      obj = RawAccess<IS_NOT_NULL>::oop_load(task.to_oop_ptr());
+    }
+    Prefetch::write(obj->mark_addr(), 0);
+  }
+}
+
 inline bool PSPromotionManager::steal_depth(int queue_num, ScannerTask& t) {
   return stack_array_depth()->steal(queue_num, t);
 }
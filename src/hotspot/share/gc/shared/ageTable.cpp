@@ -76,6 +76,14 @@ void AgeTable::merge(AgeTable* subTable) {
   }
 }
 
+size_t AgeTable::survivor_origin_words() const {
+  size_t total = 0;
+  for (int i = 2; i < table_size; i++) {
+    total += sizes[i];
+  }
+  return total;
+}
+
 uint AgeTable::compute_tenuring_threshold(size_t desired_survivor_size) {
   uint result;
 
@@ -65,6 +65,12 @@ class AgeTable {
   // for parallel young generation gc.
   void merge(AgeTable* subTable);
 
+  // Objects copied out of eden surface at age 1; everything older was
+  // copied out of survivor space. The split characterizes bimodal lifetime
+  // distributions without any extra bookkeeping during evacuation.
+  size_t eden_origin_words() const { return sizes[1]; }
+  size_t survivor_origin_words() const;
+
   // Calculate new tenuring threshold based on age information.
   uint compute_tenuring_threshold(size_t desired_survivor_size);
   void print_age_table(uint tenuring_threshold);
@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "gc/shared/barrierSet.hpp"
 #include "gc/shared/barrierSetAssembler.hpp"
+#include "oops/access.hpp"
 #include "runtime/thread.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/macros.hpp"
@@ -35,6 +36,11 @@ void BarrierSet::set_barrier_set(BarrierSet* barrier_set) {
   assert(_barrier_set == NULL, "Already initialized");
   _barrier_set = barrier_set;
 
+  // Now that the barrier set is known, resolve the runtime-dispatched
+  // accessors for the hottest access shapes up front, so they never take
+  // the lazy resolution path.
+  AccessInternal::eagerly_resolve_accessors();
+
   // Notify barrier set of the current (main) thread.  Normally the
   // Thread constructor deals with this, but the main thread is
   // created before we get here.  Verify it isn't yet on the thread
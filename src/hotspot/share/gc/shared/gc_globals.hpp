@@ -173,6 +173,11 @@
           "blocked by the GC locker")                                       \
           range(0, max_uintx)                                               \
                                                                             \
+  product(bool, LazyZeroMarkBitmaps, false, DIAGNOSTIC,                     \
+          "Remap whole pages of the marking bitmap when clearing large "    \
+          "ranges, instead of zeroing them with stores. The OS zeroes "     \
+          "the remapped pages lazily on first access.")                     \
+                                                                            \
   product(uintx, ParallelGCBufferWastePct, 10,                              \
           "Wasted fraction of parallel allocation buffer")                  \
           range(0, 100)                                                     \
@@ -23,9 +23,12 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/gc_globals.hpp"
 #include "gc/shared/markBitMap.inline.hpp"
 #include "memory/universe.hpp"
 #include "memory/virtualspace.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
 
 void MarkBitMap::print_on_error(outputStream* st, const char* prefix) const {
   _bm.print_on_error(st, prefix);
@@ -41,10 +44,42 @@ size_t MarkBitMap::mark_distance() {
 
 void MarkBitMap::initialize(MemRegion heap, MemRegion storage) {
   _covered = heap;
+  _map_base = (char*) storage.start();
 
   _bm = BitMapView((BitMap::bm_word_t*) storage.start(), _covered.word_size() >> _shifter);
 }
 
+// A lazily cleared range must span at least this many pages: below that, the
+// two mapping syscalls and the subsequent soft page faults cost more than
+// clearing the bits with stores.
+static const size_t lazy_clear_min_pages = 16;
+
+bool MarkBitMap::do_clear_lazy(size_t beg, size_t end) {
+  assert(LazyZeroMarkBitmaps, "Only used when lazy zeroing is enabled");
+  const size_t page_size = (size_t)os::vm_page_size();
+  // Shrink the bit range to whole bytes, then to whole pages. The page
+  // boundaries are word-aligned, so the head and tail leftovers can be
+  // cleared bit-wise without touching the remapped interior.
+  char* const page_beg = align_up(_map_base + align_up(beg, (size_t)BitsPerByte) / BitsPerByte, page_size);
+  char* const page_end = align_down(_map_base + align_down(end, (size_t)BitsPerByte) / BitsPerByte, page_size);
+  if (page_beg >= page_end ||
+      pointer_delta(page_end, page_beg, 1) < lazy_clear_min_pages * page_size) {
+    return false;
+  }
+  const size_t size = pointer_delta(page_end, page_beg, 1);
+  if (!os::uncommit_memory(page_beg, size)) {
+    // Backing pages that cannot be remapped, e.g. pinned large pages, are
+    // cleared with stores instead.
+    return false;
+  }
+  // Recommitting previously committed memory should only fail under severe
+  // memory pressure; the fresh pages are zeroed by the OS on first access.
+  os::commit_memory_or_exit(page_beg, size, !ExecMem, "Marking bitmap");
+  _bm.clear_range(beg, pointer_delta(page_beg, _map_base, 1) * BitsPerByte);
+  _bm.clear_range(pointer_delta(page_end, _map_base, 1) * BitsPerByte, end);
+  return true;
+}
+
 void MarkBitMap::do_clear(MemRegion mr, bool large) {
   MemRegion intersection = mr.intersection(_covered);
   assert(!intersection.is_empty(),
@@ -54,7 +89,9 @@ void MarkBitMap::do_clear(MemRegion mr, bool large) {
   size_t beg = addr_to_offset(intersection.start());
   size_t end = addr_to_offset(intersection.end());
   if (large) {
-    _bm.clear_large_range(beg, end);
+    if (!LazyZeroMarkBitmaps || !do_clear_lazy(beg, end)) {
+      _bm.clear_large_range(beg, end);
+    }
   } else {
     _bm.clear_range(beg, end);
   }
@@ -39,6 +39,8 @@ protected:
 
   BitMapView _bm;        // The actual bitmap.
 
+  char* _map_base;       // Start of the bitmap backing storage.
+
   virtual void check_mark(HeapWord* addr) NOT_DEBUG_RETURN;
 
   // Convert from bit offset to address.
@@ -53,6 +55,13 @@ protected:
   // Clear bitmap range
   void do_clear(MemRegion mr, bool large);
 
+  // Remap the fully covered pages of the given bit range, so that the OS
+  // hands back zeroed pages on the next access instead of us clearing the
+  // range with stores. Returns false if the range does not cover enough
+  // whole pages to pay for the remapping, or if the backing pages cannot
+  // be remapped; the range is left untouched in that case.
+  bool do_clear_lazy(size_t beg, size_t end);
+
 public:
   static size_t compute_size(size_t heap_size);
   // Returns the amount of bytes on the heap between two marks in the bitmap.
@@ -63,7 +72,7 @@ public:
     return mark_distance();
   }
 
-  MarkBitMap() : _covered(), _shifter(LogMinObjAlignment), _bm() {}
+  MarkBitMap() : _covered(), _shifter(LogMinObjAlignment), _bm(), _map_base(NULL) {}
 
   // Initializes the underlying BitMap to cover the given area.
   void initialize(MemRegion heap, MemRegion storage);
@@ -376,6 +376,20 @@ void MemAllocator::mem_clear(HeapWord* mem) const {
   assert(mem != NULL, "cannot initialize NULL object");
   const size_t hs = oopDesc::header_size();
   assert(_word_size >= hs, "unexpected object size");
+  if (ZeroTLAB && UseTLAB) {
+    // A refilled TLAB is zeroed in full under ZeroTLAB, and bump-pointer
+    // allocation hands its memory out untouched, so anything carved from the
+    // current TLAB is already clear.
+    ThreadLocalAllocBuffer& tlab = _thread->tlab();
+    if (mem >= tlab.start() && mem < tlab.top()) {
+#ifdef ASSERT
+      for (size_t i = hs; i < _word_size; i++) {
+        assert(*(intptr_t*)(mem + i) == 0, "TLAB memory must be pre-zeroed");
+      }
+#endif
+      return;
+    }
+  }
   Copy::fill_to_aligned_words(mem + hs, _word_size - hs);
 }
 
@@ -330,12 +330,15 @@ inline uintx OopStorage::Block::bitmask_for_index(unsigned index) const {
 
 // Provide const or non-const iteration, depending on whether BlockPtr
 // is const Block* or Block*, respectively.
+// The bit-scan over the allocated bitmask visits only allocated entries,
+// so sweep cost scales with the block's population, not its capacity;
+// wholly empty blocks cost one bitmask test.
 template<typename F, typename BlockPtr> // BlockPtr := [const] Block*
 inline bool OopStorage::Block::iterate_impl(F f, BlockPtr block) {
   uintx bitmask = block->allocated_bitmask();
   while (bitmask != 0) {
     unsigned index = count_trailing_zeros(bitmask);
-    bitmask ^= block->bitmask_for_index(index);
+    bitmask &= bitmask - 1;     // Clear the bit just found.
     if (!f(block->get_pointer(index))) {
       return false;
     }
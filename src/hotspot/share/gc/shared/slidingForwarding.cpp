@@ -24,6 +24,8 @@
 
 #include "precompiled.hpp"
 #include "gc/shared/slidingForwarding.hpp"
+#include "gc/shared/workerThread.hpp"
+#include "runtime/atomic.hpp"
 
 #ifdef _LP64
 HeapWord* const SlidingForwarding::UNUSED_BASE = reinterpret_cast<HeapWord*>(0x1);
@@ -67,3 +69,54 @@ void SlidingForwarding::clear() {
   }
 #endif
 }
+
+#ifdef _LP64
+class SlidingForwardingClearTask : public WorkerTask {
+  // Clear the table in chunks large enough to amortize the claiming
+  // CAS, but small enough to balance across uneven workers.
+  static const size_t CHUNK_SIZE = 64 * K;
+
+  HeapWord** const _table;
+  HeapWord*  const _fill_value;
+  const size_t     _num_entries;
+  volatile size_t  _claimed;
+
+public:
+  SlidingForwardingClearTask(HeapWord** table, HeapWord* fill_value, size_t num_entries) :
+    WorkerTask("Sliding Forwarding Clear"),
+    _table(table),
+    _fill_value(fill_value),
+    _num_entries(num_entries),
+    _claimed(0) {}
+
+  static size_t chunk_size() { return CHUNK_SIZE; }
+
+  void work(uint worker_id) {
+    for (;;) {
+      size_t start = Atomic::fetch_and_add(&_claimed, CHUNK_SIZE);
+      if (start >= _num_entries) {
+        return;
+      }
+      size_t end = MIN2(start + CHUNK_SIZE, _num_entries);
+      for (size_t i = start; i < end; i++) {
+        _table[i] = _fill_value;
+      }
+    }
+  }
+};
+#endif
+
+void SlidingForwarding::clear(WorkerThreads* workers) {
+#ifdef _LP64
+  size_t num_entries = _num_regions * (ONE << NUM_REGION_BITS);
+  // A single chunk does not benefit from dispatching to the workers.
+  if (workers == NULL || num_entries <= SlidingForwardingClearTask::chunk_size()) {
+    clear();
+    return;
+  }
+  SlidingForwardingClearTask task(_target_base_table, UNUSED_BASE, num_entries);
+  workers->run_task(&task);
+#else
+  clear();
+#endif
+}
@@ -29,6 +29,8 @@
 #include "memory/memRegion.hpp"
 #include "oops/oopsHierarchy.hpp"
 
+class WorkerThreads;
+
 /**
  * SlidingForwarding is a method to store forwarding information in a compressed form into the object header,
  * that has been specifically designed for sliding compaction GCs.
@@ -105,6 +107,11 @@ public:
   ~SlidingForwarding();
 
   void clear();
+  // Clears the target base table in parallel, striped over the given
+  // workers. Used by the parallel full collectors, where the table can
+  // grow large enough on big heaps for serial clearing to show up in
+  // pause tails.
+  void clear(WorkerThreads* workers);
   inline void forward_to(oop original, oop target);
   inline oop forwardee(oop original) const;
 };
@@ -331,9 +331,20 @@ typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_b
       }
     }
 
+    // Prefer victims with nearby ids for the second candidate: worker
+    // threads are created in id order and tend to be placed on the same
+    // socket, so id distance is a cheap proxy for topology distance.
+    // One of four choices stays uniformly random so remote queues are
+    // still drained when the neighborhood runs empty.
     uint k2 = queue_num;
     while (k2 == queue_num || k2 == k1) {
-      k2 = local_queue->next_random_queue_id() % _n;
+      if (UseNUMA && (local_queue->next_random_queue_id() & 3) != 0) {
+        const uint window = MIN2(8u, _n - 1);
+        uint offset = (local_queue->next_random_queue_id() % window) + 1;
+        k2 = (queue_num + offset) % _n;
+      } else {
+        k2 = local_queue->next_random_queue_id() % _n;
+      }
     }
     // Sample both and try the larger.
     uint sz1 = queue(k1)->size();
@@ -56,7 +56,8 @@ ThreadLocalAllocBuffer::ThreadLocalAllocBuffer() :
   _gc_waste(0),
   _slow_allocations(0),
   _allocated_size(0),
-  _allocation_fraction(TLABAllocationWeight) {
+  _allocation_fraction(TLABAllocationWeight),
+  _allocation_fraction_peak(0.0f) {
 
   // do nothing. TLABs must be inited by initialize() calls
 }
@@ -99,7 +100,7 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
       // to filter them out here we just cap the fraction to be at most 1.0.
       // Keep alloc_frac as float and not double to avoid the double to float conversion
       float alloc_frac = MIN2(1.0f, allocated_since_last_gc / (float) used);
-      _allocation_fraction.sample(alloc_frac);
+      sample_allocation_fraction(alloc_frac);
     }
 
     stats->update_fast_allocations(_number_of_refills,
@@ -152,10 +153,24 @@ void ThreadLocalAllocBuffer::retire_before_allocation() {
   retire();
 }
 
+// Record an allocation fraction sample in the decaying average and,
+// for TLABPeakSizing, in the decaying peak. The peak tracks a high
+// percentile of the recent samples with O(1) state: it follows bursts
+// immediately and forgets them at TLABPeakDecayPercent per sample, so
+// a bursty thread is not shrunk to its between-burst average only to
+// storm through refills when the next burst arrives.
+void ThreadLocalAllocBuffer::sample_allocation_fraction(float alloc_frac) {
+  _allocation_fraction.sample(alloc_frac);
+  float decayed_peak = _allocation_fraction_peak * (TLABPeakDecayPercent / 100.0f);
+  _allocation_fraction_peak = MAX2(alloc_frac, decayed_peak);
+}
+
 void ThreadLocalAllocBuffer::resize() {
   // Compute the next tlab size using expected allocation amount
   assert(ResizeTLAB, "Should not call this otherwise");
-  size_t alloc = (size_t)(_allocation_fraction.average() *
+  float alloc_frac = TLABPeakSizing ? MAX2(_allocation_fraction_peak, _allocation_fraction.average())
+                                    : _allocation_fraction.average();
+  size_t alloc = (size_t)(alloc_frac *
                           (Universe::heap()->tlab_capacity(thread()) / HeapWordSize));
   size_t new_size = alloc / _target_refills;
 
@@ -215,7 +230,7 @@ void ThreadLocalAllocBuffer::initialize() {
   size_t capacity = Universe::heap()->tlab_capacity(thread()) / HeapWordSize;
   // Keep alloc_frac as float and not double to avoid the double to float conversion
   float alloc_frac = desired_size() * target_refills() / (float) capacity;
-  _allocation_fraction.sample(alloc_frac);
+  sample_allocation_fraction(alloc_frac);
 
   set_refill_waste_limit(initial_refill_waste_limit());
 
@@ -69,6 +69,10 @@ private:
   size_t    _allocated_size;
 
   AdaptiveWeightedAverage _allocation_fraction;  // fraction of eden allocated in tlabs
+  float     _allocation_fraction_peak;           // decaying peak of the sampled fraction,
+                                                 // used by TLABPeakSizing
+
+  void sample_allocation_fraction(float alloc_frac);
 
   void reset_statistics();
 
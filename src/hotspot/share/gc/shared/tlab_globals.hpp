@@ -70,6 +70,17 @@
           "Allocation averaging weight")                                    \
           range(0, 100)                                                     \
                                                                             \
+  product(bool, TLABPeakSizing, false, EXPERIMENTAL,                        \
+          "Size TLABs from a decaying peak of the per-thread allocation "   \
+          "fraction instead of its average. Keeps TLABs of bursty "        \
+          "threads sized for their bursts, at the cost of more eden "       \
+          "committed to mostly idle threads.")                              \
+                                                                            \
+  product(uintx, TLABPeakDecayPercent, 95,                                  \
+          "Per-GC decay (in percent) of the peak allocation fraction "      \
+          "used by TLABPeakSizing")                                         \
+          range(1, 100)                                                     \
+                                                                            \
   /* Limit the lower bound of this flag to 1 as it is used  */              \
   /* in a division expression.                              */              \
   product(uintx, TLABWasteTargetPercent, 1,                                 \
@@ -31,6 +31,7 @@
 #include "gc/shenandoah/shenandoahHeapRegion.inline.hpp"
 #include "logging/log.hpp"
 #include "logging/logTag.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/quickSort.hpp"
 
 // These constants are used to adjust the margin of error for the moving
@@ -39,6 +40,12 @@
 const double ShenandoahAdaptiveHeuristics::FULL_PENALTY_SD = 0.2;
 const double ShenandoahAdaptiveHeuristics::DEGENERATE_PENALTY_SD = 0.1;
 
+// The maximum adjustment applied for accumulated allocation stall time. A
+// stall usually ends in a degenerated or full GC, which carries its own flat
+// penalty; this one scales with the stall duration, so that a second of
+// mutators blocked on allocation pushes the triggers as hard as a full GC.
+const double ShenandoahAdaptiveHeuristics::STALL_PENALTY_SD = 0.2;
+
 // These are used to decide if we want to make any adjustments at all
 // at the end of a successful concurrent cycle.
 const double ShenandoahAdaptiveHeuristics::LOWEST_EXPECTED_AVAILABLE_AT_END = -0.5;
@@ -58,7 +65,8 @@ ShenandoahAdaptiveHeuristics::ShenandoahAdaptiveHeuristics() :
   ShenandoahHeuristics(),
   _margin_of_error_sd(ShenandoahAdaptiveInitialConfidence),
   _spike_threshold_sd(ShenandoahAdaptiveInitialSpikeThreshold),
-  _last_trigger(OTHER) { }
+  _last_trigger(OTHER),
+  _allocation_stall_ms(0) { }
 
 ShenandoahAdaptiveHeuristics::~ShenandoahAdaptiveHeuristics() {}
 
@@ -183,6 +191,12 @@ void ShenandoahAdaptiveHeuristics::record_success_degenerated() {
   adjust_spike_threshold(DEGENERATE_PENALTY_SD);
 }
 
+void ShenandoahAdaptiveHeuristics::record_allocation_stall(double stall_sec) {
+  // Called by the stalled mutator threads themselves; the accumulated time
+  // is consumed by the control thread in should_start_gc().
+  Atomic::add(&_allocation_stall_ms, (size_t)(stall_sec * 1000.0));
+}
+
 void ShenandoahAdaptiveHeuristics::record_success_full() {
   ShenandoahHeuristics::record_success_full();
   // Adjust both trigger's parameters in the case of a full GC because
@@ -206,6 +220,18 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() {
   size_t soft_tail = max_capacity - capacity;
   available = (available > soft_tail) ? (available - soft_tail) : 0;
 
+  // Mutators blocked on allocation failure since the last check mean the
+  // triggers fired too late. Tighten both of them proportionally to the
+  // accumulated stall time: a long stall is stronger evidence than the flat
+  // penalty applied when the resulting degenerated or full GC completes.
+  size_t stall_ms = Atomic::xchg(&_allocation_stall_ms, (size_t)0);
+  if (stall_ms > 0) {
+    double amount = saturate(stall_ms / 1000.0, 0.0, 1.0) * STALL_PENALTY_SD;
+    log_debug(gc, ergo)("Adjusting triggers for " SIZE_FORMAT " ms of allocation stalls", stall_ms);
+    adjust_margin_of_error(amount);
+    adjust_spike_threshold(amount);
+  }
+
   // Track allocation rate even if we decide to start a cycle for other reasons.
   double rate = _allocation_rate.sample(allocated);
   _last_trigger = OTHER;
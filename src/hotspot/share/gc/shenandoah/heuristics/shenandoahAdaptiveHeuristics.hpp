@@ -65,6 +65,7 @@ public:
   void record_success_concurrent();
   void record_success_degenerated();
   void record_success_full();
+  virtual void record_allocation_stall(double stall_sec);
 
   virtual bool should_start_gc();
 
@@ -78,6 +79,7 @@ public:
   // margin of error and spike threshold trend in opposite directions.
   const static double FULL_PENALTY_SD;
   const static double DEGENERATE_PENALTY_SD;
+  const static double STALL_PENALTY_SD;
 
   const static double MINIMUM_CONFIDENCE;
   const static double MAXIMUM_CONFIDENCE;
@@ -126,6 +128,11 @@ public:
   // establishes what is 'normal' for the application and is used as a
   // source of feedback to adjust trigger parameters.
   TruncatedSeq _available;
+
+  // Time that mutator threads spent blocked on allocation failure since the
+  // control thread last checked the triggers. Accumulated by the stalled
+  // mutators themselves and consumed (and reset) in should_start_gc().
+  volatile size_t _allocation_stall_ms;
 };
 
 #endif // SHARE_GC_SHENANDOAH_HEURISTICS_SHENANDOAHADAPTIVEHEURISTICS_HPP
@@ -39,6 +39,14 @@ int ShenandoahHeuristics::compare_by_garbage(RegionData a, RegionData b) {
     return -1;
   else if (a._garbage < b._garbage)
     return 1;
+  // At equal garbage, prefer regions the mutator has allocated into least:
+  // evacuating regions full of recently allocated objects makes mutators
+  // chase the forwarded copies through load-reference barriers, so steer
+  // the collection set towards colder regions when it costs no garbage.
+  else if (a._mutator_allocs < b._mutator_allocs)
+    return -1;
+  else if (a._mutator_allocs > b._mutator_allocs)
+    return 1;
   else return 0;
 }
 
@@ -113,6 +121,7 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
         // This is our candidate for later consideration.
         candidates[cand_idx]._region = region;
         candidates[cand_idx]._garbage = garbage;
+        candidates[cand_idx]._mutator_allocs = region->get_tlab_allocs() + region->get_shared_allocs();
         cand_idx++;
       }
     } else if (region->is_humongous_start()) {
@@ -251,6 +260,10 @@ void ShenandoahHeuristics::record_allocation_failure_gc() {
   // Do nothing.
 }
 
+void ShenandoahHeuristics::record_allocation_stall(double stall_sec) {
+  // Do nothing.
+}
+
 void ShenandoahHeuristics::record_requested_gc() {
   // Assume users call System.gc() when external state changes significantly,
   // which forces us to re-learn the GC timings and allocation rates.
@@ -67,6 +67,12 @@ protected:
   typedef struct {
     ShenandoahHeapRegion* _region;
     size_t _garbage;
+    // Bytes allocated into the region by mutators (TLAB and shared allocs)
+    // since it was last recycled. Used as a cheap hotness proxy: regions
+    // filled by mutator allocation hold young objects the application is
+    // likely still referencing, while regions filled by evacuation hold
+    // older survivors. See compare_by_garbage().
+    size_t _mutator_allocs;
   } RegionData;
 
   RegionData* _region_data;
@@ -116,6 +122,11 @@ public:
 
   virtual void record_allocation_failure_gc();
 
+  // Called by a mutator thread after it was blocked waiting for a GC to
+  // recover from allocation failure. Runs outside of GC locks; heuristics
+  // that act on this must tolerate concurrent calls from multiple threads.
+  virtual void record_allocation_stall(double stall_sec);
+
   virtual void record_requested_gc();
 
   virtual void choose_collection_set(ShenandoahCollectionSet* collection_set);
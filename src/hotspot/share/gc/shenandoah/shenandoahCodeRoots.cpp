@@ -34,6 +34,7 @@
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/sweeper.hpp"
 #include "utilities/powerOfTwo.hpp"
 
 ShenandoahParallelCodeCacheIterator::ShenandoahParallelCodeCacheIterator(const GrowableArray<CodeHeap*>* heaps) {
@@ -185,6 +186,87 @@ void ShenandoahCodeRoots::disarm_nmethods() {
   }
 }
 
+// Heals and disarms nmethods that have recently been active, so that their
+// next invocation does not take the entry barrier slow path. Cold nmethods
+// are deliberately left armed: healing during concurrent mark keeps the
+// nmethod's oops alive, and doing that for code that is never going to be
+// executed again would prevent it from being unloaded.
+class ShenandoahDisarmHotNMethodClosure : public NMethodClosure {
+private:
+  ShenandoahHeap* const    _heap;
+  BarrierSetNMethod* const _bs;
+  const int                _hotness_threshold;
+
+public:
+  ShenandoahDisarmHotNMethodClosure() :
+    _heap(ShenandoahHeap::heap()),
+    _bs(BarrierSet::barrier_set()->barrier_set_nmethod()),
+    // Seen on a stack within the last MinPassesBeforeFlush sweeps, the
+    // same bound the sweeper uses to consider an nmethod still in use.
+    _hotness_threshold(NMethodSweeper::hotness_counter_reset_val() - (int)MinPassesBeforeFlush) {
+  }
+
+  virtual void do_nmethod(nmethod* nm) {
+    assert(_heap->is_concurrent_mark_in_progress(), "Only during concurrent mark");
+
+    if (!nm->is_alive() || nm->is_unloading()) {
+      // Leave it to the entry barrier and the unlink pass.
+      return;
+    }
+
+    if (nm->hotness_counter() < _hotness_threshold) {
+      // Cold nmethod, heal lazily on its next invocation, if any.
+      return;
+    }
+
+    ShenandoahNMethod* data = ShenandoahNMethod::gc_data(nm);
+    assert(!data->is_unregistered(), "Should not see unregistered entry");
+
+    ShenandoahReentrantLocker locker(data->lock());
+    if (_bs->is_armed(nm)) {
+      ShenandoahNMethod::heal_nmethod(nm);
+      _bs->disarm(nm);
+    }
+  }
+};
+
+class ShenandoahDisarmHotNMethodsTask : public WorkerTask {
+private:
+  ShenandoahDisarmHotNMethodClosure   _cl;
+  ShenandoahConcurrentNMethodIterator _iterator;
+
+public:
+  ShenandoahDisarmHotNMethodsTask() :
+    WorkerTask("Shenandoah Disarm Hot NMethods"),
+    _iterator(ShenandoahCodeRoots::table()) {
+    MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    _iterator.nmethods_do_begin();
+  }
+
+  ~ShenandoahDisarmHotNMethodsTask() {
+    MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    _iterator.nmethods_do_end();
+  }
+
+  virtual void work(uint worker_id) {
+    ShenandoahConcurrentWorkerSession worker_session(worker_id);
+    ShenandoahSuspendibleThreadSetJoiner stsj(ShenandoahSuspendibleWorkers);
+    _iterator.nmethods_do(&_cl);
+  }
+};
+
+void ShenandoahCodeRoots::disarm_hot_nmethods() {
+  assert(ShenandoahHeap::heap()->is_concurrent_mark_in_progress(), "Only during concurrent mark");
+  // Without code cache sweeping the hotness counters never decay and all
+  // nmethods would appear hot, turning this pass into a keep-alive of the
+  // entire code cache.
+  if (ShenandoahNMethodBarrier && ShenandoahProactiveNMethodDisarm &&
+      MethodFlushing && UseCodeCacheFlushing) {
+    ShenandoahDisarmHotNMethodsTask task;
+    ShenandoahHeap::heap()->workers()->run_task(&task);
+  }
+}
+
 class ShenandoahNMethodUnlinkClosure : public NMethodClosure {
 private:
   bool                      _unloading_occurred;
@@ -99,6 +99,7 @@ public:
   static void purge(WorkerThreads* workers);
   static void arm_nmethods();
   static void disarm_nmethods();
+  static void disarm_hot_nmethods();
   static int  disarmed_value()         { return _disarmed_value; }
   static int* disarmed_value_address() { return &_disarmed_value; }
 
@@ -553,6 +553,15 @@ void ShenandoahConcurrentGC::op_init_mark() {
 
 void ShenandoahConcurrentGC::op_mark_roots() {
   _mark.mark_concurrent_roots();
+
+  // If nmethods were armed at init mark, every invocation of not-yet-healed
+  // code during the marking phase takes the entry barrier slow path. Heal and
+  // disarm the recently active nmethods up front, so that warm code does not
+  // pay that price on its first call after the arming safepoint.
+  ShenandoahHeap* const heap = ShenandoahHeap::heap();
+  if (heap->unload_classes()) {
+    ShenandoahCodeRoots::disarm_hot_nmethods();
+  }
 }
 
 void ShenandoahConcurrentGC::op_mark() {
@@ -826,11 +835,13 @@ void ShenandoahConcurrentGC::op_class_unloading() {
 
 class ShenandoahEvacUpdateCodeCacheClosure : public NMethodClosure {
 private:
+  ShenandoahHeap* const                     _heap;
   BarrierSetNMethod* const                  _bs;
   ShenandoahEvacuateUpdateMetadataClosure<> _cl;
 
 public:
   ShenandoahEvacUpdateCodeCacheClosure() :
+    _heap(ShenandoahHeap::heap()),
     _bs(BarrierSet::barrier_set()->barrier_set_nmethod()),
     _cl() {
   }
@@ -838,6 +849,15 @@ public:
   void do_nmethod(nmethod* n) {
     ShenandoahNMethod* data = ShenandoahNMethod::gc_data(n);
     ShenandoahReentrantLocker locker(data->lock());
+    if (ShenandoahNMethodBarrier && !data->has_cset_oops(_heap)) {
+      // None of this nmethod's oops are in the collection set, so nothing
+      // it references moves in this cycle and there is nothing to heal
+      // eagerly. Leave it armed: the entry barrier disarms it on its next
+      // invocation. This keeps the pass proportional to the nmethods that
+      // actually reference the collection set instead of the size of the
+      // code cache.
+      return;
+    }
     // Setup EvacOOM scope below reentrant lock to avoid deadlock with
     // nmethod_entry_barrier
     ShenandoahEvacOOMScope oom;
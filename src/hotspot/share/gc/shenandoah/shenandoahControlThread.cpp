@@ -535,10 +535,17 @@ void ShenandoahControlThread::handle_alloc_failure(ShenandoahAllocRequest& req)
     heap->cancel_gc(GCCause::_allocation_failure);
   }
 
-  MonitorLocker ml(&_alloc_failure_waiters_lock);
-  while (is_alloc_failure_gc()) {
-    ml.wait();
+  double stall_start = os::elapsedTime();
+  {
+    MonitorLocker ml(&_alloc_failure_waiters_lock);
+    while (is_alloc_failure_gc()) {
+      ml.wait();
+    }
   }
+
+  // Tell the heuristics how long this thread was blocked, so that triggers
+  // can be tightened to avoid stalling again.
+  heap->heuristics()->record_allocation_stall(os::elapsedTime() - stall_start);
 }
 
 void ShenandoahControlThread::handle_alloc_failure_evac(size_t words) {
@@ -183,7 +183,7 @@ void ShenandoahFullGC::do_it(GCCause::Cause gc_cause) {
 
     // The rest of prologue:
     _preserved_marks->init(heap->workers()->active_workers());
-    heap->forwarding()->clear();
+    heap->forwarding()->clear(heap->workers());
 
     assert(heap->has_forwarded_objects() == has_forwarded_objects, "This should not change");
   }
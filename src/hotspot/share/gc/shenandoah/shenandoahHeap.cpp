@@ -1936,8 +1936,16 @@ void ShenandoahHeap::unpin_object(JavaThread* thr, oop o) {
 }
 
 void ShenandoahHeap::sync_pinned_region_status() {
+  if (!_has_region_pins.is_set()) {
+    // No region has taken a critical pin since the last walk observed an
+    // all-clear, so the status of every region is already in sync.
+    assert_pinned_region_status();
+    return;
+  }
+
   ShenandoahHeapLocker locker(lock());
 
+  bool all_clear = true;
   for (size_t i = 0; i < num_regions(); i++) {
     ShenandoahHeapRegion *r = get_region(i);
     if (r->is_active()) {
@@ -1950,8 +1958,15 @@ void ShenandoahHeap::sync_pinned_region_status() {
           r->make_pinned();
         }
       }
+      if (r->is_pinned() || r->pin_count() > 0) {
+        all_clear = false;
+      }
     }
   }
+  if (all_clear) {
+    // We run at a safepoint, so no new pins can appear until mutators resume.
+    _has_region_pins.unset();
+  }
 
   assert_pinned_region_status();
 }
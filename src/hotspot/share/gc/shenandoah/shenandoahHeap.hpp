@@ -516,9 +516,18 @@ public:
   oop pin_object(JavaThread* thread, oop obj);
   void unpin_object(JavaThread* thread, oop obj);
 
+  // Called by a region when it takes its first critical pin, so that the
+  // next sync_pinned_region_status() actually walks the regions.
+  void note_region_pinned() { _has_region_pins.set(); }
+
   void sync_pinned_region_status();
   void assert_pinned_region_status() NOT_DEBUG_RETURN;
 
+private:
+  ShenandoahSharedFlag _has_region_pins;
+
+public:
+
 // ---------- Concurrent Stack Processing support
 //
 public:
@@ -670,7 +670,11 @@ void ShenandoahHeapRegion::set_state(RegionState to) {
 }
 
 void ShenandoahHeapRegion::record_pin() {
-  Atomic::add(&_critical_pins, (size_t)1);
+  if (Atomic::add(&_critical_pins, (size_t)1) == 1) {
+    // First pin in this region; tell the heap so the next pin status sync
+    // does not skip the region walk.
+    ShenandoahHeap::heap()->note_region_pinned();
+  }
 }
 
 void ShenandoahHeapRegion::record_unpin() {
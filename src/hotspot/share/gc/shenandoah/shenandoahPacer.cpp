@@ -248,6 +248,18 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
   double start = os::elapsedTime();
 
   size_t max_ms = ShenandoahPacingMaxDelay;
+
+  // Fairness: scale the maximum stall down for threads that have already
+  // paid a lot of pacing tax in the current cycle, so the pacing-induced
+  // latency spreads across allocating threads instead of repeatedly
+  // stalling a few unlucky ones for the full delay. Halve the stall for
+  // each full max delay already paid, floored at 1 ms so that heavy
+  // allocators still yield to GC progress.
+  size_t paced_ms = (size_t)(ShenandoahThreadLocalData::paced_time(JavaThread::current()) * 1000);
+  for (size_t paid = paced_ms; paid >= ShenandoahPacingMaxDelay && max_ms > 1; paid -= ShenandoahPacingMaxDelay) {
+    max_ms /= 2;
+  }
+
   size_t total_ms = 0;
 
   while (true) {
@@ -290,6 +302,9 @@ void ShenandoahPacer::flush_stats_to_cycle() {
   double sum = 0;
   for (JavaThreadIteratorWithHandle jtiwh; JavaThread *t = jtiwh.next(); ) {
     sum += ShenandoahThreadLocalData::paced_time(t);
+    // Restart the per-cycle accrual, so that the fairness scaling in
+    // pace_for_alloc() sees only the tax paid in the current cycle.
+    ShenandoahThreadLocalData::flush_paced_time(t);
   }
   ShenandoahHeap::heap()->phase_timings()->record_phase_time(ShenandoahPhaseTimings::pacing, sum);
 }
@@ -308,7 +323,7 @@ void ShenandoahPacer::print_cycle_on(outputStream* out) {
   size_t threads_nz = 0;
   double sum = 0;
   for (JavaThreadIteratorWithHandle jtiwh; JavaThread *t = jtiwh.next(); ) {
-    double d = ShenandoahThreadLocalData::paced_time(t);
+    double d = ShenandoahThreadLocalData::prev_paced_time(t);
     if (d > 0) {
       threads_nz++;
       sum += d;
@@ -316,7 +331,6 @@ void ShenandoahPacer::print_cycle_on(outputStream* out) {
               d * 1000, total * 1000, d/total*100, t->name());
     }
     threads_total++;
-    ShenandoahThreadLocalData::reset_paced_time(t);
   }
   out->print_cr("  %5.0f of %5.0f ms (%5.1f%%): <total>",
           sum * 1000, total * 1000, sum/total*100);
@@ -144,14 +144,16 @@ static void soft_reference_update_clock() {
 }
 
 ShenandoahRefProcThreadLocal::ShenandoahRefProcThreadLocal() :
-  _discovered_list(NULL),
+  _discovered_list(),
   _encountered_count(),
   _discovered_count(),
   _enqueued_count() {
 }
 
 void ShenandoahRefProcThreadLocal::reset() {
-  _discovered_list = NULL;
+  for (uint i = 0; i < discovered_list_stripes; i++) {
+    _discovered_list[i] = NULL;
+  }
   _mark_closure = NULL;
   for (uint i = 0; i < reference_type_count; i++) {
     _encountered_count[i] = 0;
@@ -161,28 +163,35 @@ void ShenandoahRefProcThreadLocal::reset() {
 }
 
 template <typename T>
-T* ShenandoahRefProcThreadLocal::discovered_list_addr() {
-  return reinterpret_cast<T*>(&_discovered_list);
+T* ShenandoahRefProcThreadLocal::discovered_list_addr(uint stripe) {
+  assert(stripe < discovered_list_stripes, "invalid stripe");
+  return reinterpret_cast<T*>(&_discovered_list[stripe]);
 }
 
 template <>
-oop ShenandoahRefProcThreadLocal::discovered_list_head<oop>() const {
-  return *reinterpret_cast<const oop*>(&_discovered_list);
+oop ShenandoahRefProcThreadLocal::discovered_list_head<oop>(uint stripe) const {
+  return *reinterpret_cast<const oop*>(&_discovered_list[stripe]);
 }
 
 template <>
-oop ShenandoahRefProcThreadLocal::discovered_list_head<narrowOop>() const {
-  return CompressedOops::decode(*reinterpret_cast<const narrowOop*>(&_discovered_list));
+oop ShenandoahRefProcThreadLocal::discovered_list_head<narrowOop>(uint stripe) const {
+  return CompressedOops::decode(*reinterpret_cast<const narrowOop*>(&_discovered_list[stripe]));
 }
 
 template <>
-void ShenandoahRefProcThreadLocal::set_discovered_list_head<narrowOop>(oop head) {
-  *discovered_list_addr<narrowOop>() = CompressedOops::encode(head);
+void ShenandoahRefProcThreadLocal::set_discovered_list_head<narrowOop>(uint stripe, oop head) {
+  *discovered_list_addr<narrowOop>(stripe) = CompressedOops::encode(head);
 }
 
 template <>
-void ShenandoahRefProcThreadLocal::set_discovered_list_head<oop>(oop head) {
-  *discovered_list_addr<oop>() = head;
+void ShenandoahRefProcThreadLocal::set_discovered_list_head<oop>(uint stripe, oop head) {
+  *discovered_list_addr<oop>(stripe) = head;
+}
+
+// Stripe selection for discovery. Use middle address bits so references
+// allocated back-to-back still spread over the stripes.
+static uint discovered_list_stripe_for(oop reference) {
+  return (uint)((cast_from_oop<uintptr_t>(reference) >> 8) & (ShenandoahRefProcThreadLocal::discovered_list_stripes - 1));
 }
 
 ShenandoahReferenceProcessor::ShenandoahReferenceProcessor(uint max_workers) :
@@ -339,15 +348,16 @@ bool ShenandoahReferenceProcessor::discover(oop reference, ReferenceType type, u
 
   // Add reference to discovered list
   ShenandoahRefProcThreadLocal& refproc_data = _ref_proc_thread_locals[worker_id];
-  oop discovered_head = refproc_data.discovered_list_head<T>();
+  uint stripe = discovered_list_stripe_for(reference);
+  oop discovered_head = refproc_data.discovered_list_head<T>(stripe);
   if (discovered_head == NULL) {
     // Self-loop tail of list. We distinguish discovered from not-discovered references by looking at their
     // discovered field: if it is NULL, then it is not-yet discovered, otherwise it is discovered
     discovered_head = reference;
   }
   if (reference_cas_discovered<T>(reference, discovered_head)) {
-    refproc_data.set_discovered_list_head<T>(reference);
-    assert(refproc_data.discovered_list_head<T>() == reference, "reference must be new discovered head");
+    refproc_data.set_discovered_list_head<T>(stripe, reference);
+    assert(refproc_data.discovered_list_head<T>(stripe) == reference, "reference must be new discovered head");
     log_trace(gc, ref)("Discovered Reference: " PTR_FORMAT " (%s)", p2i(reference), reference_type_name(type));
     _ref_proc_thread_locals[worker_id].inc_discovered(type);
   }
@@ -402,9 +412,9 @@ T* ShenandoahReferenceProcessor::keep(oop reference, ReferenceType type, uint wo
 }
 
 template <typename T>
-void ShenandoahReferenceProcessor::process_references(ShenandoahRefProcThreadLocal& refproc_data, uint worker_id) {;
-  log_trace(gc, ref)("Processing discovered list #%u : " PTR_FORMAT, worker_id, p2i(refproc_data.discovered_list_head<T>()));
-  T* list = refproc_data.discovered_list_addr<T>();
+void ShenandoahReferenceProcessor::process_references(ShenandoahRefProcThreadLocal& refproc_data, uint worker_id, uint stripe) {;
+  log_trace(gc, ref)("Processing discovered list #%u/%u : " PTR_FORMAT, worker_id, stripe, p2i(refproc_data.discovered_list_head<T>(stripe)));
+  T* list = refproc_data.discovered_list_addr<T>(stripe);
   // The list head is basically a GC root, we need to resolve and update it,
   // otherwise we will later swap a from-space ref into Universe::pending_list().
   if (!CompressedOops::is_null(*list)) {
@@ -451,16 +461,21 @@ void ShenandoahReferenceProcessor::process_references(ShenandoahRefProcThreadLoc
 }
 
 void ShenandoahReferenceProcessor::work() {
-  // Process discovered references
-  uint max_workers = ShenandoahHeap::heap()->max_workers();
-  uint worker_id = Atomic::add(&_iterate_discovered_list_id, 1U, memory_order_relaxed) - 1;
-  while (worker_id < max_workers) {
+  // Process discovered lists. Claim (worker, stripe) units so that the
+  // stripes of one worker's discovery can be processed by several
+  // workers.
+  const uint stripes = ShenandoahRefProcThreadLocal::discovered_list_stripes;
+  uint max_units = ShenandoahHeap::heap()->max_workers() * stripes;
+  uint unit = Atomic::add(&_iterate_discovered_list_id, 1U, memory_order_relaxed) - 1;
+  while (unit < max_units) {
+    uint worker_id = unit / stripes;
+    uint stripe = unit % stripes;
     if (UseCompressedOops) {
-      process_references<narrowOop>(_ref_proc_thread_locals[worker_id], worker_id);
+      process_references<narrowOop>(_ref_proc_thread_locals[worker_id], worker_id, stripe);
     } else {
-      process_references<oop>(_ref_proc_thread_locals[worker_id], worker_id);
+      process_references<oop>(_ref_proc_thread_locals[worker_id], worker_id, stripe);
     }
-    worker_id = Atomic::add(&_iterate_discovered_list_id, 1U, memory_order_relaxed) - 1;
+    unit = Atomic::add(&_iterate_discovered_list_id, 1U, memory_order_relaxed) - 1;
   }
 }
 
@@ -556,10 +571,12 @@ void ShenandoahReferenceProcessor::clean_discovered_list(T* list) {
 void ShenandoahReferenceProcessor::abandon_partial_discovery() {
   uint max_workers = ShenandoahHeap::heap()->max_workers();
   for (uint index = 0; index < max_workers; index++) {
-    if (UseCompressedOops) {
-      clean_discovered_list<narrowOop>(_ref_proc_thread_locals[index].discovered_list_addr<narrowOop>());
-    } else {
-      clean_discovered_list<oop>(_ref_proc_thread_locals[index].discovered_list_addr<oop>());
+    for (uint stripe = 0; stripe < ShenandoahRefProcThreadLocal::discovered_list_stripes; stripe++) {
+      if (UseCompressedOops) {
+        clean_discovered_list<narrowOop>(_ref_proc_thread_locals[index].discovered_list_addr<narrowOop>(stripe));
+      } else {
+        clean_discovered_list<oop>(_ref_proc_thread_locals[index].discovered_list_addr<oop>(stripe));
+      }
     }
   }
   if (_pending_list != NULL) {
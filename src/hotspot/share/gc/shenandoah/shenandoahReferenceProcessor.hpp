@@ -76,8 +76,16 @@ typedef size_t Counters[reference_type_count];
  */
 
 class ShenandoahRefProcThreadLocal : public CHeapObj<mtGC> {
+public:
+  // Each worker discovers into several striped lists, selected by
+  // reference address. The stripes multiply the number of independently
+  // claimable units in process_references(), so one unusually long
+  // discovered list does not leave a single worker processing the tail
+  // of the phase alone.
+  static const uint discovered_list_stripes = 4;
+
 private:
-  void* _discovered_list;
+  void* _discovered_list[discovered_list_stripes];
   ShenandoahMarkRefsSuperClosure* _mark_closure;
   Counters _encountered_count;
   Counters _discovered_count;
@@ -98,11 +106,11 @@ public:
   }
 
   template<typename T>
-  T* discovered_list_addr();
+  T* discovered_list_addr(uint stripe);
   template<typename T>
-  oop discovered_list_head() const;
+  oop discovered_list_head(uint stripe) const;
   template<typename T>
-  void set_discovered_list_head(oop head);
+  void set_discovered_list_head(uint stripe, oop head);
 
   size_t encountered(ReferenceType type) const {
     return _encountered_count[type];
@@ -160,7 +168,7 @@ private:
   T* keep(oop reference, ReferenceType type, uint worker_id);
 
   template <typename T>
-  void process_references(ShenandoahRefProcThreadLocal& refproc_data, uint worker_id);
+  void process_references(ShenandoahRefProcThreadLocal& refproc_data, uint worker_id, uint stripe);
   void enqueue_references_locked();
   void enqueue_references(bool concurrent);
 
@@ -46,6 +46,7 @@ private:
   size_t _gclab_size;
   int  _disarmed_value;
   double _paced_time;
+  double _prev_paced_time;
 
   ShenandoahThreadLocalData() :
     _gc_state(0),
@@ -55,7 +56,8 @@ private:
     _gclab(NULL),
     _gclab_size(0),
     _disarmed_value(0),
-    _paced_time(0) {
+    _paced_time(0),
+    _prev_paced_time(0) {
 
     // At least on x86_64, nmethod entry barrier encodes _disarmed_value offset
     // in instruction as disp8 immed
@@ -125,8 +127,17 @@ public:
     return data(thread)->_paced_time;
   }
 
-  static void reset_paced_time(Thread* thread) {
-    data(thread)->_paced_time = 0;
+  static double prev_paced_time(Thread* thread) {
+    return data(thread)->_prev_paced_time;
+  }
+
+  // Rolls the accrued paced time over to the previous-cycle slot, where the
+  // cycle statistics printer picks it up, and restarts the accrual for the
+  // next cycle.
+  static void flush_paced_time(Thread* thread) {
+    ShenandoahThreadLocalData* td = data(thread);
+    td->_prev_paced_time = td->_paced_time;
+    td->_paced_time = 0;
   }
 
   static void set_disarmed_value(Thread* thread, int value) {
@@ -355,6 +355,11 @@
   product(bool, ShenandoahNMethodBarrier, true, DIAGNOSTIC,                 \
           "Turn on/off NMethod entry barriers in Shenandoah")               \
                                                                             \
+  product(bool, ShenandoahProactiveNMethodDisarm, true, DIAGNOSTIC,         \
+          "Concurrently heal and disarm recently active nmethods right "    \
+          "after they have been armed for concurrent marking, instead of "  \
+          "taking the entry barrier slow path on their next invocation")    \
+                                                                            \
   product(bool, ShenandoahStackWatermarkBarrier, true, DIAGNOSTIC,          \
           "Turn on/off stack watermark barriers in Shenandoah")             \
                                                                             \
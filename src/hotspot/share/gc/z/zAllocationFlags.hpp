@@ -31,18 +31,20 @@
 // Allocation flags layout
 // -----------------------
 //
-//   7     2 1 0
-//  +-----+-+-+-+
-//  |00000|1|1|1|
-//  +-----+-+-+-+
-//  |     | | |
-//  |     | | * 0-0 Non-Blocking Flag (1-bit)
-//  |     | |
-//  |     | * 1-1 Worker Relocation Flag (1-bit)
-//  |     |
-//  |     * 2-2 Low Address Flag (1-bit)
+//   7    3 2 1 0
+//  +----+-+-+-+-+
+//  |0000|1|1|1|1|
+//  +----+-+-+-+-+
+//  |    | | | |
+//  |    | | | * 0-0 Non-Blocking Flag (1-bit)
+//  |    | | |
+//  |    | | * 1-1 Worker Relocation Flag (1-bit)
+//  |    | |
+//  |    | * 2-2 Low Address Flag (1-bit)
+//  |    |
+//  |    * 3-3 Pre-Map Flag (1-bit)
 //  |
-//  * 7-3 Unused (5-bits)
+//  * 7-4 Unused (4-bits)
 //
 
 class ZAllocationFlags {
@@ -50,6 +52,7 @@ private:
   typedef ZBitField<uint8_t, bool, 0, 1> field_non_blocking;
   typedef ZBitField<uint8_t, bool, 1, 1> field_worker_relocation;
   typedef ZBitField<uint8_t, bool, 2, 1> field_low_address;
+  typedef ZBitField<uint8_t, bool, 3, 1> field_pre_map;
 
   uint8_t _flags;
 
@@ -69,6 +72,10 @@ public:
     _flags |= field_low_address::encode(true);
   }
 
+  void set_pre_map() {
+    _flags |= field_pre_map::encode(true);
+  }
+
   bool non_blocking() const {
     return field_non_blocking::decode(_flags);
   }
@@ -80,6 +87,10 @@ public:
   bool low_address() const {
     return field_low_address::decode(_flags);
   }
+
+  bool pre_map() const {
+    return field_pre_map::decode(_flags);
+  }
 };
 
 #endif // SHARE_GC_Z_ZALLOCATIONFLAGS_HPP
@@ -99,16 +99,92 @@ uintptr_t ZBarrier::mark(uintptr_t addr) {
   return good_addr;
 }
 
+//
+// Remap cache
+//
+// Small per-thread direct-mapped cache of recent forwarding table
+// translations. Pointer-chasing workloads re-traverse the same hot
+// structures right after relocation starts, looking up the same
+// forwardings over and over; remembering the last translations avoids
+// the shared table probes for such hits. The cache is keyed by the
+// current good mask, so a phase flip invalidates all entries. Within
+// one good mask window the translation for an offset is stable, which
+// is the same invariant the forwarding table itself relies on.
+//
+// Only the translation is cached. Marking is done by the callers after
+// remap/relocate return, so a cache hit never skips a mark.
+//
+static const size_t ZRemapCacheEntries = 32;
+
+struct ZRemapCache {
+  uintptr_t _good_mask;
+  struct {
+    uintptr_t _offset;
+    uintptr_t _good_addr;
+  } _entries[ZRemapCacheEntries];
+};
+
+static THREAD_LOCAL ZRemapCache z_remap_cache;
+
+static size_t remap_cache_index(uintptr_t offset) {
+  return (offset >> ZObjectAlignmentSmallShift) & (ZRemapCacheEntries - 1);
+}
+
+// Returns the cached translation for offset, or 0 on miss
+static uintptr_t remap_cache_lookup(uintptr_t offset) {
+  ZRemapCache* const cache = &z_remap_cache;
+  if (cache->_good_mask != ZAddressGoodMask) {
+    // Phase flip since last use; all cached translations are stale
+    for (size_t i = 0; i < ZRemapCacheEntries; i++) {
+      cache->_entries[i]._good_addr = 0;
+    }
+    cache->_good_mask = ZAddressGoodMask;
+    return 0;
+  }
+
+  const size_t index = remap_cache_index(offset);
+  if (cache->_entries[index]._offset == offset) {
+    return cache->_entries[index]._good_addr;
+  }
+
+  return 0;
+}
+
+static void remap_cache_insert(uintptr_t offset, uintptr_t good_addr) {
+  ZRemapCache* const cache = &z_remap_cache;
+  const size_t index = remap_cache_index(offset);
+  cache->_entries[index]._offset = offset;
+  cache->_entries[index]._good_addr = good_addr;
+}
+
 uintptr_t ZBarrier::remap(uintptr_t addr) {
   assert(!ZAddress::is_good(addr), "Should not be good");
   assert(!ZAddress::is_weak_good(addr), "Should not be weak good");
-  return ZHeap::heap()->remap_object(addr);
+
+  const uintptr_t offset = ZAddress::offset(addr);
+  uintptr_t good_addr = remap_cache_lookup(offset);
+  if (good_addr == 0) {
+    good_addr = ZHeap::heap()->remap_object(addr);
+    remap_cache_insert(offset, good_addr);
+  }
+
+  assert(ZAddress::is_good(good_addr), "Should be good");
+  return good_addr;
 }
 
 uintptr_t ZBarrier::relocate(uintptr_t addr) {
   assert(!ZAddress::is_good(addr), "Should not be good");
   assert(!ZAddress::is_weak_good(addr), "Should not be weak good");
-  return ZHeap::heap()->relocate_object(addr);
+
+  const uintptr_t offset = ZAddress::offset(addr);
+  uintptr_t good_addr = remap_cache_lookup(offset);
+  if (good_addr == 0) {
+    good_addr = ZHeap::heap()->relocate_object(addr);
+    remap_cache_insert(offset, good_addr);
+  }
+
+  assert(ZAddress::is_good(good_addr), "Should be good");
+  return good_addr;
 }
 
 uintptr_t ZBarrier::relocate_or_mark(uintptr_t addr) {
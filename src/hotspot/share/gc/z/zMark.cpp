@@ -372,14 +372,26 @@ bool ZMark::drain(ZMarkContext* context, T* timeout) {
   return !timeout->has_expired();
 }
 
+// Returns the id of the i'th victim stripe to visit when stealing. Workers
+// homed on the same stripe would otherwise all sweep the victims in the same
+// order and converge on the same stripe; instead, the k'th worker homed on a
+// stripe starts its scan k victims further on, so co-homed workers fan out
+// across the other stripes while each still visits every victim once.
+size_t ZMark::victim_stripe_id(ZMarkStripe* stripe, size_t i) const {
+  const size_t nstripes = _stripes.nstripes();
+  const size_t nvictims = nstripes - 1;
+  const size_t home = _stripes.stripe_id(stripe);
+  const size_t worker_offset = ZThread::worker_id() / nstripes;
+  return (home + 1 + (worker_offset + i) % nvictims) % nstripes;
+}
+
 bool ZMark::try_steal_local(ZMarkContext* context) {
   ZMarkStripe* const stripe = context->stripe();
   ZMarkThreadLocalStacks* const stacks = context->stacks();
 
   // Try to steal a local stack from another stripe
-  for (ZMarkStripe* victim_stripe = _stripes.stripe_next(stripe);
-       victim_stripe != stripe;
-       victim_stripe = _stripes.stripe_next(victim_stripe)) {
+  for (size_t i = 0; i < _stripes.nstripes() - 1; i++) {
+    ZMarkStripe* const victim_stripe = _stripes.stripe_at(victim_stripe_id(stripe, i));
     ZMarkStack* const stack = stacks->steal(&_stripes, victim_stripe);
     if (stack != NULL) {
       // Success, install the stolen stack
@@ -397,9 +409,8 @@ bool ZMark::try_steal_global(ZMarkContext* context) {
   ZMarkThreadLocalStacks* const stacks = context->stacks();
 
   // Try to steal a stack from another stripe
-  for (ZMarkStripe* victim_stripe = _stripes.stripe_next(stripe);
-       victim_stripe != stripe;
-       victim_stripe = _stripes.stripe_next(victim_stripe)) {
+  for (size_t i = 0; i < _stripes.nstripes() - 1; i++) {
+    ZMarkStripe* const victim_stripe = _stripes.stripe_at(victim_stripe_id(stripe, i));
     ZMarkStack* const stack = victim_stripe->steal_stack();
     if (stack != NULL) {
       // Success, install the stolen stack
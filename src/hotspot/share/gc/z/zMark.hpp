@@ -67,6 +67,7 @@ private:
   void mark_and_follow(ZMarkContext* context, ZMarkStackEntry entry);
 
   template <typename T> bool drain(ZMarkContext* context, T* timeout);
+  size_t victim_stripe_id(ZMarkStripe* stripe, size_t i) const;
   bool try_steal_local(ZMarkContext* context);
   bool try_steal_global(ZMarkContext* context);
   bool try_steal(ZMarkContext* context);
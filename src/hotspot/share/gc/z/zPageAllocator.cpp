@@ -32,6 +32,7 @@
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAllocator.inline.hpp"
 #include "gc/z/zPageCache.hpp"
+#include "gc/z/zPreMapper.hpp"
 #include "gc/z/zSafeDelete.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "gc/z/zTask.hpp"
@@ -51,6 +52,10 @@ static const ZStatCounter       ZCounterPageCacheFlush("Memory", "Page Cache Flu
 static const ZStatCounter       ZCounterDefragment("Memory", "Defragment", ZStatUnitOpsPerSecond);
 static const ZStatCriticalPhase ZCriticalPhaseAllocationStall("Allocation Stall");
 
+// Horizon, in seconds, over which predicted allocation demand is translated
+// into a reservoir of committed memory that uncommit leaves untouched.
+static const double uncommit_reservoir_seconds = 10.0;
+
 enum ZPageAllocationStall {
   ZPageAllocationStallSuccess,
   ZPageAllocationStallFailed,
@@ -150,6 +155,7 @@ ZPageAllocator::ZPageAllocator(ZWorkers* workers,
     _satisfied(),
     _unmapper(new ZUnmapper(this)),
     _uncommitter(new ZUncommitter(this)),
+    _pre_mapper(new ZPreMapper(this)),
     _safe_delete(),
     _initialized(false) {
 
@@ -684,13 +690,16 @@ retry:
   page->reset();
 
   // Update allocation statistics. Exclude worker relocations to avoid
-  // artificial inflation of the allocation rate during relocation.
-  if (!flags.worker_relocation() && is_init_completed()) {
+  // artificial inflation of the allocation rate during relocation. Also
+  // exclude pre-map allocations, whose pages go straight back into the
+  // page cache and are counted when a mutator later takes them out.
+  if (!flags.worker_relocation() && !flags.pre_map() && is_init_completed()) {
     // Note that there are two allocation rate counters, which have
     // different purposes and are sampled at different frequencies.
     const size_t bytes = page->size();
     ZStatInc(ZCounterAllocationRate, bytes);
     ZStatInc(ZStatAllocRate::counter(), bytes);
+    _pre_mapper->record_alloc_page(type, bytes);
   }
 
   // Send event
@@ -770,14 +779,28 @@ size_t ZPageAllocator::uncommit(uint64_t* timeout) {
     SuspendibleThreadSetJoiner joiner(!ZVerifyViews);
     ZLocker<ZLock> locker(&_lock);
 
-    // Never uncommit below min capacity. We flush out and uncommit chunks at
-    // a time (~0.8% of the max capacity, but at least one granule and at most
-    // 256M), in case demand for memory increases while we are uncommitting.
-    const size_t retain = MAX2(_used, _min_capacity);
-    const size_t release = _capacity - retain;
+    // Never uncommit below min capacity. On top of that, retain a reservoir
+    // of committed memory sized to the allocation demand predicted from the
+    // recent allocation-rate history, so that a ramp-up in load is satisfied
+    // from the page cache instead of stalling on commit. The prediction uses
+    // the same model as the GC director: the higher of the predicted and
+    // average rates, scaled by the spike tolerance, plus ~3.3 sigma to cover
+    // allocation-rate variance. We flush out and uncommit chunks at a time
+    // (~0.8% of the max capacity, but at least one granule and at most 256M),
+    // in case demand for memory increases while we are uncommitting.
+    const double one_in_1000 = 3.290527;
+    const double alloc_rate = (MAX2(ZStatAllocRate::predict(), ZStatAllocRate::avg()) * ZAllocationSpikeTolerance) +
+                              (ZStatAllocRate::sd() * one_in_1000);
+    const size_t reservoir = align_up((size_t)(alloc_rate * uncommit_reservoir_seconds), ZGranuleSize);
+    const size_t retain = MAX2(_used + reservoir, _min_capacity);
+    const size_t release = _capacity - MIN2(retain, _capacity);
     const size_t limit = MIN2(align_up(_current_max_capacity >> 7, ZGranuleSize), 256 * M);
     const size_t flush = MIN2(release, limit);
 
+    if (reservoir > 0) {
+      log_debug(gc, heap)("Uncommit Reservoir: " SIZE_FORMAT "M", reservoir / M);
+    }
+
     // Flush pages to uncommit
     flushed = _cache.flush_for_uncommit(flush, &pages, timeout);
     if (flushed == 0) {
@@ -867,4 +890,5 @@ void ZPageAllocator::check_out_of_memory() {
 void ZPageAllocator::threads_do(ThreadClosure* tc) const {
   tc->do_thread(_unmapper);
   tc->do_thread(_uncommitter);
+  tc->do_thread(_pre_mapper);
 }
@@ -36,12 +36,14 @@
 class ThreadClosure;
 class ZPageAllocation;
 class ZPageAllocatorStats;
+class ZPreMapper;
 class ZWorkers;
 class ZUncommitter;
 class ZUnmapper;
 
 class ZPageAllocator {
   friend class VMStructs;
+  friend class ZPreMapper;
   friend class ZUnmapper;
   friend class ZUncommitter;
 
@@ -64,6 +66,7 @@ private:
   ZList<ZPageAllocation>     _satisfied;
   ZUnmapper*                 _unmapper;
   ZUncommitter*              _uncommitter;
+  ZPreMapper*                _pre_mapper;
   mutable ZSafeDelete<ZPage> _safe_delete;
   bool                       _initialized;
 
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/z/zAllocationFlags.hpp"
+#include "gc/z/zGlobals.hpp"
+#include "gc/z/zLock.inline.hpp"
+#include "gc/z/zPage.inline.hpp"
+#include "gc/z/zPageAllocator.hpp"
+#include "gc/z/zPreMapper.hpp"
+#include "gc/z/zStat.hpp"
+#include "logging/log.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+
+static const ZStatCounter ZCounterPreMap("Memory", "Pre-Map", ZStatUnitBytesPerSecond);
+
+// Interval at which consumption is sampled and the reservoir refilled
+static const uint64_t ZPreMapIntervalMS = 1000;
+
+ZPreMapper::ZPreMapper(ZPageAllocator* page_allocator) :
+    _page_allocator(page_allocator),
+    _lock(),
+    _allocated_small(0),
+    _allocated_medium(0),
+    _rate_small(),
+    _rate_medium(),
+    _stop(false) {
+  set_name("ZPreMapper");
+  create_and_start();
+}
+
+bool ZPreMapper::wait() const {
+  ZLocker<ZConditionLock> locker(&_lock);
+  while (!ZPreMap && !_stop) {
+    _lock.wait();
+  }
+
+  if (!_stop) {
+    _lock.wait(ZPreMapIntervalMS);
+  }
+
+  return !_stop;
+}
+
+bool ZPreMapper::should_continue() const {
+  ZLocker<ZConditionLock> locker(&_lock);
+  return !_stop;
+}
+
+void ZPreMapper::record_alloc_page(uint8_t type, size_t size) {
+  if (type == ZPageTypeSmall) {
+    Atomic::add(&_allocated_small, size);
+  } else if (type == ZPageTypeMedium) {
+    Atomic::add(&_allocated_medium, size);
+  }
+
+  // Large pages are excluded. Their sizes are allocation-specific,
+  // so a reservoir of pre-mapped pages can't be built for them.
+}
+
+size_t ZPreMapper::pre_map(uint8_t type, size_t size) {
+  ZAllocationFlags flags;
+  flags.set_non_blocking();
+  flags.set_pre_map();
+
+  ZPage* const page = _page_allocator->alloc_page(type, size, flags);
+  if (page == NULL) {
+    // Out of memory or capacity, back off until the next interval
+    return 0;
+  }
+
+  // Pre-touch page so that mutators don't take the faults
+  _page_allocator->_physical.pretouch(page->start(), page->size());
+
+  // Park page in the page cache
+  _page_allocator->free_page(page, false /* reclaimed */);
+
+  return size;
+}
+
+void ZPreMapper::run_service() {
+  while (wait()) {
+    // Sample per size class consumption over the last interval
+    _rate_small.add(Atomic::xchg(&_allocated_small, (size_t)0));
+    _rate_medium.add(Atomic::xchg(&_allocated_medium, (size_t)0));
+
+    // Predict consumption over the next interval
+    const size_t predict_small = (size_t)MAX2(_rate_small.predict_next(), 0.0);
+    size_t predict_medium = (size_t)MAX2(_rate_medium.predict_next(), 0.0);
+    const size_t target = predict_small + predict_medium;
+
+    // Memory already committed but unused, most of which sits in the page
+    // cache, counts against the target for all size classes, since cached
+    // pages of any size can be split to satisfy any page allocation.
+    const size_t unused = _page_allocator->unused();
+    if (target <= unused) {
+      // Reservoir is large enough
+      continue;
+    }
+
+    size_t pre_mapped = 0;
+    size_t deficit = target - unused;
+
+    while (should_continue() && deficit > 0) {
+      uint8_t type = ZPageTypeSmall;
+      size_t size = ZPageSizeSmall;
+
+      if (ZPageSizeMedium > 0 && predict_medium >= ZPageSizeMedium) {
+        type = ZPageTypeMedium;
+        size = ZPageSizeMedium;
+        predict_medium -= ZPageSizeMedium;
+      }
+
+      const size_t mapped = pre_map(type, size);
+      if (mapped == 0) {
+        break;
+      }
+
+      pre_mapped += mapped;
+      deficit -= MIN2(deficit, mapped);
+    }
+
+    if (pre_mapped > 0) {
+      // Update statistics
+      ZStatInc(ZCounterPreMap, pre_mapped);
+      log_debug(gc, heap)("Pre-mapped: " SIZE_FORMAT "M", pre_mapped / M);
+    }
+  }
+}
+
+void ZPreMapper::stop_service() {
+  ZLocker<ZConditionLock> locker(&_lock);
+  _stop = true;
+  _lock.notify_all();
+}
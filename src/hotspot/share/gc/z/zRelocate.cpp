@@ -26,6 +26,7 @@
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "gc/z/zAbort.inline.hpp"
 #include "gc/z/zAddress.inline.hpp"
+#include "gc/z/zArray.inline.hpp"
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zForwarding.inline.hpp"
 #include "gc/z/zHeap.inline.hpp"
@@ -178,10 +179,6 @@ public:
     }
   }
 
-  void free_relocated_page(ZPage* page) {
-    free_page(page);
-  }
-
   uintptr_t alloc_object(ZPage* page, size_t size) const {
     return (page != NULL) ? page->alloc_object(size) : 0;
   }
@@ -255,10 +252,6 @@ public:
     // Does nothing
   }
 
-  void free_relocated_page(ZPage* page) {
-    free_page(page);
-  }
-
   uintptr_t alloc_object(ZPage* page, size_t size) const {
     return (page != NULL) ? page->alloc_object_atomic(size) : 0;
   }
@@ -275,9 +268,22 @@ public:
 template <typename Allocator>
 class ZRelocateClosure : public ObjectClosure {
 private:
+  // Relocated source pages are freed in batches, so that the page
+  // allocator lock and the page table updates are taken once per batch
+  // instead of once per page.
+  static const int FreedPagesBatchSize = 16;
+
   Allocator* const _allocator;
   ZForwarding*     _forwarding;
   ZPage*           _target;
+  ZArray<ZPage*>   _freed_pages;
+
+  void flush_freed_pages() {
+    if (!_freed_pages.is_empty()) {
+      ZHeap::heap()->free_pages(&_freed_pages, true /* reclaimed */);
+      _freed_pages.clear();
+    }
+  }
 
   bool relocate_object(uintptr_t from_addr) const {
     ZForwardingCursor cursor;
@@ -343,9 +349,11 @@ public:
   ZRelocateClosure(Allocator* allocator) :
       _allocator(allocator),
       _forwarding(NULL),
-      _target(NULL) {}
+      _target(NULL),
+      _freed_pages() {}
 
   ~ZRelocateClosure() {
+    flush_freed_pages();
     _allocator->free_target_page(_target);
   }
 
@@ -377,7 +385,10 @@ public:
     } else {
       // Detach and free relocated page
       ZPage* const page = _forwarding->detach_page();
-      _allocator->free_relocated_page(page);
+      _freed_pages.append(page);
+      if (_freed_pages.length() >= FreedPagesBatchSize) {
+        flush_freed_pages();
+      }
     }
   }
 };
@@ -48,6 +48,10 @@
   product(bool, ZProactive, true,                                           \
           "Enable proactive GC cycles")                                     \
                                                                             \
+  product(bool, ZPreMap, true,                                              \
+          "Keep a pre-mapped and pre-touched page reservoir sized after "   \
+          "the predicted allocation rate")                                  \
+                                                                            \
   product(bool, ZUncommit, true,                                            \
           "Uncommit unused memory")                                         \
                                                                             \
@@ -157,14 +157,13 @@ void BytecodePairHistogram::reset() {
 }
 
 
-void BytecodePairHistogram::print(float cutoff) {
-  ResourceMark rm;
-  GrowableArray<HistoEntry*>* profile = sorted_array(_counters, number_of_pairs);
+static void print_pair_profile(int* counters, int length, float cutoff, const char* title) {
+  GrowableArray<HistoEntry*>* profile = sorted_array(counters, length);
   // print profile
   int tot     = total_count(profile);
   int abs_sum = 0;
   tty->cr();   //0123456789012345678901234567890123456789012345678901234567890123456789
-  tty->print_cr("Histogram of %d executed bytecode pairs:", tot);
+  tty->print_cr("Histogram of %d %s:", tot, title);
   tty->cr();
   tty->print_cr("  absolute  relative    codes    1st bytecode        2nd bytecode");
   tty->print_cr("----------------------------------------------------------------------");
@@ -174,8 +173,8 @@ void BytecodePairHistogram::print(float cutoff) {
     int       abs = e->count();
     float     rel = abs * 100.0F / tot;
     if (cutoff <= rel) {
-      int   c1 = e->index() % number_of_codes;
-      int   c2 = e->index() / number_of_codes;
+      int   c1 = e->index() % BytecodePairHistogram::number_of_codes;
+      int   c2 = e->index() / BytecodePairHistogram::number_of_codes;
       tty->print_cr("%10d   %6.3f%%    %02x %02x    %-19s %s", abs, rel, c1, c2, name_for(c1), name_for(c2));
       abs_sum += abs;
     }
@@ -186,4 +185,31 @@ void BytecodePairHistogram::print(float cutoff) {
   tty->cr();
 }
 
+
+void BytecodePairHistogram::print(float cutoff) {
+  ResourceMark rm;
+  print_pair_profile(_counters, number_of_pairs, cutoff, "executed bytecode pairs");
+
+  // With bytecode rewriting enabled the raw profile is dominated by _fast
+  // codes and already-fused pairs, which hides the source-level pairs. Fold
+  // each code back to its Java form and print the resulting histogram as
+  // well; this is the profile to consult when selecting candidate pairs for
+  // RewriteFrequentPairs.
+  int* folded = NEW_RESOURCE_ARRAY(int, number_of_pairs);
+  int i = number_of_pairs;
+  while (i-- > 0) folded[i] = 0;
+  i = number_of_pairs;
+  while (i-- > 0) {
+    int count = _counters[i];
+    if (count != 0) {
+      int c1 = i % number_of_codes;
+      int c2 = i / number_of_codes;
+      if (Bytecodes::is_defined(c1)) c1 = Bytecodes::java_code(Bytecodes::cast(c1));
+      if (Bytecodes::is_defined(c2)) c2 = Bytecodes::java_code(Bytecodes::cast(c2));
+      folded[c1 + (c2 << log2_number_of_codes)] += count;
+    }
+  }
+  print_pair_profile(folded, number_of_pairs, cutoff, "executed bytecode pairs (folded to Java bytecodes)");
+}
+
 #endif
@@ -1106,6 +1106,15 @@ JRT_ENTRY(void, InterpreterRuntime::update_mdp_for_ret(JavaThread* current, int
 JRT_END
 
 JRT_ENTRY(MethodCounters*, InterpreterRuntime::build_method_counters(JavaThread* current, Method* m))
+  // Optionally defer the metaspace allocation until the method has shown
+  // some activity; vast numbers of methods are only ever invoked a few
+  // times. Returning NULL makes the interpreter skip the counter update
+  // for this activation (the same way a failed allocation does), so the
+  // only cost of deferring is re-entering here on the next update.
+  if (MethodCountersDeferThreshold > 0 &&
+      m->inc_early_invocation_count() < MethodCountersDeferThreshold) {
+    return NULL;
+  }
   return Method::build_method_counters(current, m);
 JRT_END
 
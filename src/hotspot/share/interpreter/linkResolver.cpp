@@ -39,6 +39,7 @@
 #include "interpreter/bytecode.hpp"
 #include "interpreter/interpreterRuntime.hpp"
 #include "interpreter/linkResolver.hpp"
+#include "interpreter/methodLookupCache.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -730,8 +731,16 @@ Method* LinkResolver::resolve_method(const LinkInfo& link_info,
     THROW_MSG_NULL(vmSymbols::java_lang_IncompatibleClassChangeError(), ss.as_string());
   }
 
-  // 3. lookup method in resolved klass and its super klasses
-  methodHandle resolved_method(THREAD, lookup_method_in_klasses(link_info, true, false));
+  // 3. lookup method in resolved klass and its super klasses. The walk
+  // depends only on the resolved klass, name and signature, so its result
+  // is shared between call sites and class loaders.
+  methodHandle resolved_method(THREAD, MethodLookupCache::lookup(resolved_klass, link_info.name(),
+                                                                 link_info.signature(), false));
+  bool cache_result = false;
+  if (resolved_method.is_null()) {
+    resolved_method = methodHandle(THREAD, lookup_method_in_klasses(link_info, true, false));
+    cache_result = true;
+  }
 
   // 4. lookup method in all the interfaces implemented by the resolved klass
   if (resolved_method.is_null() && !resolved_klass->is_array_klass()) { // not found in the class hierarchy
@@ -745,9 +754,15 @@ Method* LinkResolver::resolve_method(const LinkInfo& link_info,
         nested_exception = Handle(THREAD, PENDING_EXCEPTION);
         CLEAR_PENDING_EXCEPTION;
       }
+      // Synthetic polymorphic methods are call site specific, never cache them
+      cache_result = false;
     }
   }
 
+  if (cache_result && resolved_method.not_null()) {
+    MethodLookupCache::add(resolved_klass, link_info.name(), link_info.signature(), false, resolved_method());
+  }
+
   // 5. method lookup failed
   if (resolved_method.is_null()) {
     ResourceMark rm(THREAD);
@@ -838,13 +853,23 @@ Method* LinkResolver::resolve_interface_method(const LinkInfo& link_info, Byteco
 
   // lookup method in this interface or its super, java.lang.Object
   // JDK8: also look for static methods
-  methodHandle resolved_method(THREAD, lookup_method_in_klasses(link_info, false, true));
+  methodHandle resolved_method(THREAD, MethodLookupCache::lookup(resolved_klass, link_info.name(),
+                                                                 link_info.signature(), true));
+  bool cache_result = false;
+  if (resolved_method.is_null()) {
+    resolved_method = methodHandle(THREAD, lookup_method_in_klasses(link_info, false, true));
+    cache_result = true;
+  }
 
   if (resolved_method.is_null() && !resolved_klass->is_array_klass()) {
     // lookup method in all the super-interfaces
     resolved_method = methodHandle(THREAD, lookup_method_in_interfaces(link_info));
   }
 
+  if (cache_result && resolved_method.not_null()) {
+    MethodLookupCache::add(resolved_klass, link_info.name(), link_info.signature(), true, resolved_method());
+  }
+
   if (resolved_method.is_null()) {
     // no method found
     ResourceMark rm(THREAD);
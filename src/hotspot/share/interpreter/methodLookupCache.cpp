@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "interpreter/methodLookupCache.hpp"
+#include "memory/allocation.hpp"
+#include "oops/klass.hpp"
+#include "oops/method.hpp"
+#include "oops/symbol.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/globalCounter.inline.hpp"
+
+class MethodLookupCacheEntry : public CHeapObj<mtClass> {
+public:
+  Klass* const   _klass;
+  Symbol* const  _name;
+  Symbol* const  _signature;
+  const bool     _interface_resolve;
+  Method* const  _method;
+
+  // Chains entries that have been unlinked from the table but may still
+  // have concurrent readers, until the next clear() deletes them
+  MethodLookupCacheEntry* _stale_next;
+
+  MethodLookupCacheEntry(Klass* klass, Symbol* name, Symbol* signature,
+                         bool interface_resolve, Method* method) :
+      _klass(klass),
+      _name(name),
+      _signature(signature),
+      _interface_resolve(interface_resolve),
+      _method(method),
+      _stale_next(NULL) {}
+
+  bool matches(Klass* klass, Symbol* name, Symbol* signature, bool interface_resolve) const {
+    return _klass == klass &&
+           _name == name &&
+           _signature == signature &&
+           _interface_resolve == interface_resolve;
+  }
+};
+
+static const unsigned int table_size = 1024;
+
+static MethodLookupCacheEntry* volatile _table[table_size];
+static MethodLookupCacheEntry* volatile _stale_list = NULL;
+
+static unsigned int entry_index(Klass* klass, Symbol* name, Symbol* signature) {
+  // Symbols and klasses are interned/unique, so their addresses hash well
+  const uintptr_t h = (uintptr_t)klass ^ ((uintptr_t)name >> 2) ^ ((uintptr_t)signature >> 4);
+  return (unsigned int)((h >> 3) * 2654435761u) & (table_size - 1);
+}
+
+static void push_stale(MethodLookupCacheEntry* entry) {
+  MethodLookupCacheEntry* head;
+  do {
+    head = Atomic::load(&_stale_list);
+    entry->_stale_next = head;
+  } while (Atomic::cmpxchg(&_stale_list, head, entry) != head);
+}
+
+Method* MethodLookupCache::lookup(Klass* klass, Symbol* name, Symbol* signature, bool interface_resolve) {
+  if (!UseMethodLookupCache) {
+    return NULL;
+  }
+
+  const unsigned int index = entry_index(klass, name, signature);
+
+  // The entry may be concurrently unlinked and, after a write_synchronize,
+  // deleted by clear(). Hold a critical section across the accesses.
+  GlobalCounter::CriticalSection cs(Thread::current());
+  MethodLookupCacheEntry* const entry = Atomic::load_acquire(&_table[index]);
+  if (entry != NULL && entry->matches(klass, name, signature, interface_resolve)) {
+    return entry->_method;
+  }
+  return NULL;
+}
+
+void MethodLookupCache::add(Klass* klass, Symbol* name, Symbol* signature, bool interface_resolve, Method* method) {
+  if (!UseMethodLookupCache) {
+    return;
+  }
+  assert(method != NULL, "only successful lookups are cached");
+
+  const unsigned int index = entry_index(klass, name, signature);
+  MethodLookupCacheEntry* const entry =
+      new MethodLookupCacheEntry(klass, name, signature, interface_resolve, method);
+
+  MethodLookupCacheEntry* const old = Atomic::load(&_table[index]);
+  if (Atomic::cmpxchg(&_table[index], old, entry) != old) {
+    // Lost a race with another writer, discard. The entry was never
+    // published, so it can be deleted immediately.
+    delete entry;
+    return;
+  }
+
+  if (old != NULL) {
+    // Unlinked, but concurrent readers may still hold it
+    push_stale(old);
+  }
+}
+
+void MethodLookupCache::clear() {
+  // Unlink every entry. The xchg makes each entry the property of exactly
+  // one clear() call, so concurrent clears (e.g. concurrent class
+  // unloading racing with a redefinition safepoint) are safe.
+  MethodLookupCacheEntry* doomed = Atomic::xchg(&_stale_list, (MethodLookupCacheEntry*)NULL);
+  for (unsigned int i = 0; i < table_size; i++) {
+    MethodLookupCacheEntry* const entry = Atomic::xchg(&_table[i], (MethodLookupCacheEntry*)NULL);
+    if (entry != NULL) {
+      entry->_stale_next = doomed;
+      doomed = entry;
+    }
+  }
+
+  if (doomed == NULL) {
+    return;
+  }
+
+  // Wait for concurrent readers to leave their critical sections before
+  // freeing the unlinked entries
+  GlobalCounter::write_synchronize();
+
+  while (doomed != NULL) {
+    MethodLookupCacheEntry* const next = doomed->_stale_next;
+    delete doomed;
+    doomed = next;
+  }
+}
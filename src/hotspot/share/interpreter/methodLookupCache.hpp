@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_INTERPRETER_METHODLOOKUPCACHE_HPP
+#define SHARE_INTERPRETER_METHODLOOKUPCACHE_HPP
+
+#include "memory/allStatic.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class Klass;
+class Method;
+class Symbol;
+
+// Cache for the method lookup phase of LinkResolver::resolve_method()
+// and resolve_interface_method().
+//
+// The lookup walks the resolved klass, its supers, its default methods
+// and its super-interfaces, and its result depends only on the resolved
+// klass and the method name and signature - not on who is asking. Since
+// every class loader resolves symbolic references separately, a
+// deployment with many loaders repeats the identical walk over (mostly
+// JDK) classes once per loader. This cache lets all of them share the
+// result. Access checks and loader constraint checks still run per
+// caller in LinkResolver, so no per-loader correctness is lost.
+//
+// The cache is a fixed-size, direct-mapped table of immutable entries.
+// Readers are lock-free inside a GlobalCounter critical section; writers
+// publish entries with a compare-and-swap. Entries are removed wholesale
+// when classes are unloaded or redefined, after a write_synchronize to
+// let concurrent readers drain.
+
+class MethodLookupCache : public AllStatic {
+public:
+  // Returns the cached lookup result, or NULL for a miss
+  static Method* lookup(Klass* klass, Symbol* name, Symbol* signature, bool interface_resolve);
+
+  // Installs a lookup result. May discard the entry on collisions.
+  static void add(Klass* klass, Symbol* name, Symbol* signature, bool interface_resolve, Method* method);
+
+  // Empties the cache. Called when classes are unloaded or redefined;
+  // safe to call concurrently with readers.
+  static void clear();
+};
+
+#endif // SHARE_INTERPRETER_METHODLOOKUPCACHE_HPP
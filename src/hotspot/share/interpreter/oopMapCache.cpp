@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "interpreter/bytecodeStream.hpp"
 #include "interpreter/oopMapCache.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
@@ -46,6 +47,11 @@ class OopMapCacheEntry: private InterpreterOopMap {
  protected:
   // Initialization
   void fill(const methodHandle& method, int bci);
+  // Same, but additionally fills the given secondary entries for other bcis
+  // of the method from the same analysis pass. See OopMapCache::lookup.
+  void fill(const methodHandle& method, int bci,
+            GrowableArray<int>* prefill_bcis,
+            GrowableArray<OopMapCacheEntry*>* prefill_entries);
   // fills the bit mask for native calls
   void fill_for_native(const methodHandle& method);
   void set_mask(CellTypeState* vars, CellTypeState* stack, int stack_top);
@@ -76,6 +82,13 @@ class OopMapForCacheEntry: public GenerateOopMap {
   int               _bci;
   int               _stack_top;
 
+  // Secondary (bci, entry) targets, filled from the same analysis pass as
+  // the primary target. See OopMapCache::lookup.
+  GrowableArray<int>*               _prefill_bcis;
+  GrowableArray<OopMapCacheEntry*>* _prefill_entries;
+
+  void fill_prefill_targets();
+
   virtual bool report_results() const     { return false; }
   virtual bool possible_gc_point          (BytecodeStream *bcs);
   virtual void fill_stackmap_prolog       (int nof_gc_points);
@@ -89,6 +102,12 @@ class OopMapForCacheEntry: public GenerateOopMap {
  public:
   OopMapForCacheEntry(const methodHandle& method, int bci, OopMapCacheEntry *entry);
 
+  void set_prefill_targets(GrowableArray<int>* bcis,
+                           GrowableArray<OopMapCacheEntry*>* entries) {
+    _prefill_bcis    = bcis;
+    _prefill_entries = entries;
+  }
+
   // Computes stack map for (method,bci) and initialize entry
   bool compute_map(Thread* current);
   int  size();
@@ -96,9 +115,11 @@ class OopMapForCacheEntry: public GenerateOopMap {
 
 
 OopMapForCacheEntry::OopMapForCacheEntry(const methodHandle& method, int bci, OopMapCacheEntry* entry) : GenerateOopMap(method) {
-  _bci       = bci;
-  _entry     = entry;
-  _stack_top = -1;
+  _bci             = bci;
+  _entry           = entry;
+  _stack_top       = -1;
+  _prefill_bcis    = NULL;
+  _prefill_entries = NULL;
 }
 
 
@@ -114,11 +135,35 @@ bool OopMapForCacheEntry::compute_map(Thread* current) {
       return false;
     }
     result_for_basicblock(_bci);
+    fill_prefill_targets();
   }
   return true;
 }
 
 
+// Fills the secondary targets from the analysis results of the preceding
+// GenerateOopMap::compute_map call. Re-interpreting a single basic block per
+// target is much cheaper than a full analysis pass per bci. Entries for bcis
+// the analysis found unreachable are left empty.
+void OopMapForCacheEntry::fill_prefill_targets() {
+  if (_prefill_bcis == NULL) {
+    return;
+  }
+  for (int i = 0; i < _prefill_bcis->length(); i++) {
+    int bci = _prefill_bcis->at(i);
+    BasicBlock* bb = get_basic_block_containing(bci);
+    if (bb == NULL || !bb->is_reachable()) {
+      continue;
+    }
+    _entry = _prefill_entries->at(i);
+    _bci   = bci;
+    _entry->set_method(method());
+    _entry->set_bci(bci);
+    result_for_basicblock(bci);
+  }
+}
+
+
 bool OopMapForCacheEntry::possible_gc_point(BytecodeStream *bcs) {
   return false; // We are not reporting any result. We call result_for_basicblock directly
 }
@@ -328,6 +373,12 @@ void OopMapCacheEntry::fill_for_native(const methodHandle& mh) {
 
 
 void OopMapCacheEntry::fill(const methodHandle& method, int bci) {
+  fill(method, bci, NULL, NULL);
+}
+
+void OopMapCacheEntry::fill(const methodHandle& method, int bci,
+                            GrowableArray<int>* prefill_bcis,
+                            GrowableArray<OopMapCacheEntry*>* prefill_entries) {
   // Flush entry to deallocate an existing entry
   flush();
   set_method(method());
@@ -335,9 +386,11 @@ void OopMapCacheEntry::fill(const methodHandle& method, int bci) {
   if (method->is_native()) {
     // Native method activations have oops only among the parameters and one
     // extra oop following the parameters (the mirror for static native methods).
+    assert(prefill_bcis == NULL, "no secondary bcis in native methods");
     fill_for_native(method);
   } else {
     OopMapForCacheEntry gen(method, bci, this);
+    gen.set_prefill_targets(prefill_bcis, prefill_entries);
     if (!gen.compute_map(Thread::current())) {
       fatal("Unrecoverable verification or out-of-memory error");
     }
@@ -463,6 +516,18 @@ bool OopMapCache::put_at(int i, OopMapCacheEntry* entry, OopMapCacheEntry* old)
   return Atomic::cmpxchg(&_array[i % _size], old, entry) == old;
 }
 
+// Installs a pre-filled entry into an empty slot of its probe window.
+// Pre-filled entries never evict existing ones.
+bool OopMapCache::put_if_empty(const methodHandle& method, int bci, OopMapCacheEntry* entry) {
+  int probe = hash_value_for(method, bci);
+  for (int i = 0; i < _probe_depth; i++) {
+    if (entry_at(probe + i) == NULL && put_at(probe + i, entry, NULL)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void OopMapCache::flush() {
   for (int i = 0; i < _size; i++) {
     OopMapCacheEntry* entry = _array[i];
@@ -528,7 +593,53 @@ void OopMapCache::lookup(const methodHandle& method,
 
   OopMapCacheEntry* tmp = NEW_C_HEAP_OBJ(OopMapCacheEntry, mtClass);
   tmp->initialize();
-  tmp->fill(method, bci);
+  if (method->is_native() || method->should_not_be_cached()) {
+    tmp->fill(method, bci);
+  } else {
+    // The analysis pass over the method dominates the cost of a miss, so use
+    // its results to also pre-fill empty cache slots for the method's invoke
+    // bytecodes: those are the bcis that other, deeper activations of this
+    // method can be suspended at. A scan of a deep recursive stack then does
+    // not run one full pass per distinct frame bci. Pre-filling only claims
+    // empty slots and never evicts, so it cannot wash out other entries.
+    ResourceMark rm;
+    GrowableArray<int> prefill_bcis;
+    GrowableArray<OopMapCacheEntry*> prefill_entries;
+    BytecodeStream bcs(method);
+    Bytecodes::Code code;
+    while ((code = bcs.next()) >= 0 && prefill_bcis.length() < _size) {
+      if (!Bytecodes::is_invoke(code) || bcs.bci() == bci) {
+        continue;
+      }
+      // Skip bcis that are already cached.
+      int p = hash_value_for(method, bcs.bci());
+      bool cached = false;
+      for (int j = 0; j < _probe_depth; j++) {
+        OopMapCacheEntry* e = entry_at(p + j);
+        if (e != NULL && !e->is_empty() && e->match(method, bcs.bci())) {
+          cached = true;
+          break;
+        }
+      }
+      if (cached) {
+        continue;
+      }
+      OopMapCacheEntry* pe = NEW_C_HEAP_OBJ(OopMapCacheEntry, mtClass);
+      pe->initialize();
+      prefill_bcis.push(bcs.bci());
+      prefill_entries.push(pe);
+    }
+    tmp->fill(method, bci, &prefill_bcis, &prefill_entries);
+    for (int j = 0; j < prefill_entries.length(); j++) {
+      OopMapCacheEntry* pe = prefill_entries.at(j);
+      // Entries for unreachable bcis are left empty by the analysis; those
+      // and entries that lost the race for an empty slot are freed here.
+      if (pe->is_empty() || !put_if_empty(method, prefill_bcis.at(j), pe)) {
+        pe->flush();
+        FREE_C_HEAP_OBJ(pe);
+      }
+    }
+  }
   entry_for->resource_copy(tmp);
 
   if (method->should_not_be_cached()) {
@@ -156,6 +156,7 @@ class OopMapCache : public CHeapObj<mtClass> {
   unsigned int hash_value_for(const methodHandle& method, int bci) const;
   OopMapCacheEntry* entry_at(int i) const;
   bool put_at(int i, OopMapCacheEntry* entry, OopMapCacheEntry* old);
+  bool put_if_empty(const methodHandle& method, int bci, OopMapCacheEntry* entry);
 
   static void enqueue_for_cleanup(OopMapCacheEntry* entry);
 
@@ -48,10 +48,12 @@ static void send_event(const FinalizerEntry* fe, const InstanceKlass* ik, const
   if (fe == NULL) {
     event.set_objects(0);
     event.set_totalFinalizersRun(0);
+    event.set_totalFinalizersRegistered(0);
   } else {
     assert(fe->klass() == ik, "invariant");
     event.set_objects(fe->objects_on_heap());
     event.set_totalFinalizersRun(fe->total_finalizers_run());
+    event.set_totalFinalizersRegistered(fe->total_registered());
   }
   event.commit();
 }
@@ -73,7 +75,7 @@ class FinalizerStatisticsEventClosure : public FinalizerEntryClosure {
   const JfrTicks _timestamp;
  public:
   FinalizerStatisticsEventClosure(Thread* thread) : _thread(thread), _timestamp(JfrTicks::now()) {}
-  virtual bool do_entry(const FinalizerEntry* fe) {
+  virtual bool do_entry(FinalizerEntry* fe) {
     assert(fe != NULL, "invariant");
     send_event(fe, fe->klass(), _timestamp, _thread);
     return true;
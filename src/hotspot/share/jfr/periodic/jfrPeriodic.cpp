@@ -63,8 +63,12 @@
 #include "runtime/vmThread.hpp"
 #include "runtime/vm_version.hpp"
 #include "services/classLoadingService.hpp"
+#include "services/mallocTracker.hpp"
 #include "services/management.hpp"
+#include "services/memTracker.hpp"
+#include "services/nmtCommon.hpp"
 #include "services/threadService.hpp"
+#include "services/virtualMemoryTracker.hpp"
 #include "utilities/exceptions.hpp"
 #include "utilities/globalDefinitions.hpp"
 #if INCLUDE_G1GC
@@ -463,6 +467,49 @@ TRACE_REQUEST_FUNC(PhysicalMemory) {
   event.commit();
 }
 
+TRACE_REQUEST_FUNC(NativeMemoryUsage) {
+  if (!MemTracker::enabled()) {
+    return;
+  }
+  // Take local copies so that all per-type events in this batch reflect the
+  // same snapshot, even if tracking data changes while we emit them.
+  MallocMemorySnapshot malloc_snapshot;
+  MallocMemorySummary::snapshot(&malloc_snapshot);
+  VirtualMemorySnapshot vm_snapshot;
+  VirtualMemorySummary::snapshot(&vm_snapshot);
+  const JfrTicks timestamp = JfrTicks::now();
+  for (int i = 0; i < mt_number_of_types; i++) {
+    const MEMFLAGS flag = NMTUtil::index_to_flag(i);
+    if (flag == mtNone) {
+      continue;
+    }
+    const MallocMemory* malloc_memory = malloc_snapshot.by_type(flag);
+    const VirtualMemory* virtual_memory = vm_snapshot.by_type(flag);
+    const size_t malloc_and_arena = malloc_memory->malloc_size() + malloc_memory->arena_size();
+    EventNativeMemoryUsage event(UNTIMED);
+    event.set_endtime(timestamp);
+    event.set_type(NMTUtil::flag_to_name(flag));
+    event.set_reserved(malloc_and_arena + virtual_memory->reserved());
+    event.set_committed(malloc_and_arena + virtual_memory->committed());
+    event.commit();
+  }
+}
+
+TRACE_REQUEST_FUNC(NativeMemoryUsageTotal) {
+  if (!MemTracker::enabled()) {
+    return;
+  }
+  MallocMemorySnapshot malloc_snapshot;
+  MallocMemorySummary::snapshot(&malloc_snapshot);
+  VirtualMemorySnapshot vm_snapshot;
+  VirtualMemorySummary::snapshot(&vm_snapshot);
+  const size_t malloc_and_arena = malloc_snapshot.total();
+  EventNativeMemoryUsageTotal event;
+  event.set_reserved(malloc_and_arena + vm_snapshot.total_reserved());
+  event.set_committed(malloc_and_arena + vm_snapshot.total_committed());
+  event.commit();
+}
+
 TRACE_REQUEST_FUNC(JavaThreadStatistics) {
   EventJavaThreadStatistics event;
   event.set_activeCount(ThreadService::get_live_thread_count());
@@ -59,6 +59,7 @@ static jlong ticks_now() {
 
 JfrChunk::JfrChunk() :
   _path(NULL),
+  _frequency(0),
   _start_ticks(0),
   _previous_start_ticks(invalid_time),
   _start_nanos(0),
@@ -111,8 +112,8 @@ u2 JfrChunk::flags() const {
 }
 
 int64_t JfrChunk::cpu_frequency() const {
-  static const jlong frequency = JfrTime::frequency();
-  return frequency;
+  assert(_frequency != 0, "invariant");
+  return _frequency;
 }
 
 void JfrChunk::set_last_checkpoint_offset(int64_t offset) {
@@ -144,6 +145,10 @@ int64_t JfrChunk::previous_start_nanos() const {
 
 void JfrChunk::update_start_ticks() {
   _start_ticks = ticks_now();
+  // Fix the tick frequency for this chunk, corrected for the drift of the
+  // fast timestamp counter observed so far. Constant event parsing within
+  // the chunk is preserved while bounding drift across a long recording.
+  _frequency = JfrTime::calibrated_frequency();
 }
 
 void JfrChunk::update_start_nanos() {
@@ -36,6 +36,7 @@ class JfrChunk : public JfrCHeapObj {
   friend class JfrChunkHeadWriter;
  private:
   char* _path;
+  int64_t _frequency;
   int64_t _start_ticks;
   int64_t _previous_start_ticks;
   int64_t _start_nanos;
@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "jfr/recorder/repository/jfrChunk.hpp"
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
+#include "jfr/recorder/service/jfrOptionSet.hpp"
 #include "jfr/utilities/jfrTime.hpp"
 #include "jfr/utilities/jfrTypes.hpp"
 #include "runtime/mutexLocker.hpp"
@@ -226,7 +227,7 @@ int64_t JfrChunkWriter::flush_chunk(bool flushpoint) {
   return sz_written;
 }
 
-JfrChunkWriter::JfrChunkWriter() : JfrChunkWriterBase(NULL), _chunk(new JfrChunk()) {}
+JfrChunkWriter::JfrChunkWriter() : JfrChunkWriterBase(NULL), _chunk(new JfrChunk()), _preallocated_size(0) {}
 
 JfrChunkWriter::~JfrChunkWriter() {
   assert(_chunk != NULL, "invariant");
@@ -279,6 +280,11 @@ bool JfrChunkWriter::open() {
   if (is_open) {
     assert(0 == this->current_offset(), "invariant");
     _chunk->reset();
+    // Preallocate backing store for a full chunk up front, so that flushes
+    // do not stall on block allocation in the file system. The visible file
+    // size is unchanged, see os::preallocate().
+    const int64_t chunk_size = JfrOptionSet::max_chunk_size();
+    _preallocated_size = os::preallocate(this->fd(), chunk_size) ? chunk_size : 0;
     JfrChunkHeadWriter head(this, HEADER_SIZE);
   }
   return is_open;
@@ -287,6 +293,10 @@ bool JfrChunkWriter::open() {
 int64_t JfrChunkWriter::close() {
   assert(this->has_valid_fd(), "invariant");
   const int64_t size_written = flush_chunk(false);
+  if (size_written < _preallocated_size) {
+    // Return the unused tail of the preallocation to the file system
+    os::release_preallocation(this->fd(), size_written, _preallocated_size - size_written);
+  }
   this->close_fd();
   assert(!this->is_valid(), "invariant");
   return size_written;
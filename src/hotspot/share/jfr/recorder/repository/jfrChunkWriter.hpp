@@ -41,6 +41,7 @@ class JfrChunkWriter : public JfrChunkWriterBase {
   friend class JfrRepository;
  private:
   JfrChunk* _chunk;
+  int64_t _preallocated_size;
   void set_path(const char* path);
   int64_t flush_chunk(bool flushpoint);
   bool open();
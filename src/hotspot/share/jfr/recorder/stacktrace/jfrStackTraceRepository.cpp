@@ -28,7 +28,10 @@
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 
 /*
  * There are two separate repository instances.
@@ -51,8 +54,20 @@ static JfrStackTraceRepository& leak_profiler_instance() {
   return *_leak_profiler_instance;
 }
 
-JfrStackTraceRepository::JfrStackTraceRepository() : _last_entries(0), _entries(0) {
-  memset(_table, 0, sizeof(_table));
+JfrStackTraceRepository::JfrStackTraceRepository() : _last_entries(0), _entries(0), _concurrent_readers(0) {
+  memset((void*)_table, 0, sizeof(_table));
+}
+
+// Wait for concurrent lock-free lookups to leave the table. Only called with
+// the JfrStacktrace_lock held and after the bucket heads have been cleared,
+// so no new lookup can reach the detached chains; the spin is bounded by the
+// time to walk a single chain.
+void JfrStackTraceRepository::drain_readers() {
+  assert(JfrStacktrace_lock->owned_by_self(), "invariant");
+  OrderAccess::fence();
+  while (Atomic::load_acquire(&_concurrent_readers) != 0) {
+    os::naked_yield();
+  }
 }
 
 JfrStackTraceRepository* JfrStackTraceRepository::create() {
@@ -103,9 +118,21 @@ size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
   }
   MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
   assert(_entries > 0, "invariant");
+  JfrStackTrace** detached = NULL;
+  if (clear) {
+    // Detach the chains before freeing anything, so that concurrent
+    // lock-free lookups can no longer reach the entries, then wait for
+    // in-flight lookups to leave the table.
+    detached = NEW_C_HEAP_ARRAY(JfrStackTrace*, TABLE_SIZE, mtTracing);
+    for (u4 i = 0; i < TABLE_SIZE; ++i) {
+      detached[i] = _table[i];
+      Atomic::release_store(&_table[i], (JfrStackTrace*)NULL);
+    }
+    drain_readers();
+  }
   int count = 0;
   for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = _table[i];
+    JfrStackTrace* stacktrace = clear ? detached[i] : _table[i];
     while (stacktrace != NULL) {
       JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
       if (stacktrace->should_write()) {
@@ -119,7 +146,7 @@ size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
     }
   }
   if (clear) {
-    memset(_table, 0, sizeof(_table));
+    FREE_C_HEAP_ARRAY(JfrStackTrace*, detached);
     _entries = 0;
   }
   _last_entries = _entries;
@@ -131,15 +158,23 @@ size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
   if (repo._entries == 0) {
     return 0;
   }
+  // Detach the chains and wait out in-flight lock-free lookups before
+  // freeing the entries, see write().
+  JfrStackTrace** detached = NEW_C_HEAP_ARRAY(JfrStackTrace*, TABLE_SIZE, mtTracing);
+  for (u4 i = 0; i < TABLE_SIZE; ++i) {
+    detached[i] = repo._table[i];
+    Atomic::release_store(&repo._table[i], (JfrStackTrace*)NULL);
+  }
+  repo.drain_readers();
   for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = repo._table[i];
+    JfrStackTrace* stacktrace = detached[i];
     while (stacktrace != NULL) {
       JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
       delete stacktrace;
       stacktrace = next;
     }
   }
-  memset(repo._table, 0, sizeof(repo._table));
+  FREE_C_HEAP_ARRAY(JfrStackTrace*, detached);
   const size_t processed = repo._entries;
   repo._entries = 0;
   repo._last_entries = 0;
@@ -198,10 +233,28 @@ void JfrStackTraceRepository::record_for_leak_profiler(JavaThread* thread, int s
 }
 
 traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
   const size_t index = stacktrace._hash % TABLE_SIZE;
-  const JfrStackTrace* table_entry = _table[index];
 
+  // Lock-free lookup of the common case: the trace is already in the table.
+  // Entries are published with a release store, their chain links are
+  // immutable, and rotation waits for the reader count to drain before it
+  // frees detached entries, so traversal here is safe without the lock.
+  Atomic::inc(&_concurrent_readers);
+  const JfrStackTrace* table_entry = Atomic::load_acquire(&_table[index]);
+  while (table_entry != NULL) {
+    if (table_entry->equals(stacktrace)) {
+      const traceid id = table_entry->id();
+      Atomic::dec(&_concurrent_readers);
+      return id;
+    }
+    table_entry = table_entry->next();
+  }
+  Atomic::dec(&_concurrent_readers);
+
+  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+  // Re-check the chain under the lock; another thread may have inserted the
+  // trace after the lock-free lookup missed.
+  table_entry = _table[index];
   while (table_entry != NULL) {
     if (table_entry->equals(stacktrace)) {
       return table_entry->id();
@@ -214,7 +267,7 @@ traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
   }
 
   traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
+  Atomic::release_store(&_table[index], new JfrStackTrace(id, stacktrace, _table[index]));
   ++_entries;
   return id;
 }
@@ -45,9 +45,17 @@ class JfrStackTraceRepository : public JfrCHeapObj {
 
  private:
   static const u4 TABLE_SIZE = 2053;
-  JfrStackTrace* _table[TABLE_SIZE];
+  // Bucket heads are published with release stores and the chains are
+  // immutable once published, so lookups can run without taking the
+  // JfrStacktrace_lock. See add_trace().
+  JfrStackTrace* volatile _table[TABLE_SIZE];
   u4 _last_entries;
   u4 _entries;
+  // Number of in-flight lock-free lookups. Rotation detaches the chains and
+  // waits for this count to drain before freeing the detached entries.
+  volatile int _concurrent_readers;
+
+  void drain_readers();
 
   JfrStackTraceRepository();
   static JfrStackTraceRepository& instance();
@@ -68,7 +68,8 @@ void JfrStorage::destroy() {
 
 JfrStorage::JfrStorage(JfrChunkWriter& chunkwriter, JfrPostBox& post_box) :
   _control(NULL),
-  _global_mspace(NULL),
+  _global_mspaces(NULL),
+  _global_stripe_count(0),
   _thread_local_mspace(NULL),
   _chunkwriter(chunkwriter),
   _post_box(post_box) {}
@@ -77,8 +78,13 @@ JfrStorage::~JfrStorage() {
   if (_control != NULL) {
     delete _control;
   }
-  if (_global_mspace != NULL) {
-    delete _global_mspace;
+  if (_global_mspaces != NULL) {
+    for (size_t i = 0; i < _global_stripe_count; ++i) {
+      if (_global_mspaces[i] != NULL) {
+        delete _global_mspaces[i];
+      }
+    }
+    JfrCHeapObj::free(_global_mspaces, _global_stripe_count * sizeof(JfrStorageMspace*));
   }
   if (_thread_local_mspace != NULL) {
     delete _thread_local_mspace;
@@ -92,10 +98,14 @@ JfrStorage::~JfrStorage() {
 static const size_t thread_local_cache_count = 8;
 // start to discard data when the only this number of free buffers are left
 static const size_t in_memory_discard_threshold_delta = 2;
+// each global stripe needs enough buffers to be useful on its own;
+// small pools remain unstriped
+static const size_t max_global_stripes = 8;
+static const size_t min_stripe_buffer_count = 4;
 
 bool JfrStorage::initialize() {
   assert(_control == NULL, "invariant");
-  assert(_global_mspace == NULL, "invariant");
+  assert(_global_mspaces == NULL, "invariant");
   assert(_thread_local_mspace == NULL, "invariant");
 
   const size_t num_global_buffers = (size_t)JfrOptionSet::num_global_buffers();
@@ -107,15 +117,28 @@ bool JfrStorage::initialize() {
   if (_control == NULL) {
     return false;
   }
-  _global_mspace = create_mspace<JfrStorageMspace>(global_buffer_size,
-                                                   num_global_buffers, // cache count limit
-                                                   num_global_buffers, // cache_preallocate count
-                                                   false, // preallocate_to_free_list (== preallocate directly to live list)
-                                                   this);
-  if (_global_mspace == NULL) {
+  _global_stripe_count = MAX2((size_t)1, MIN2(max_global_stripes, num_global_buffers / min_stripe_buffer_count));
+  _global_mspaces = JfrCHeapObj::new_array<JfrStorageMspace*>(_global_stripe_count);
+  if (_global_mspaces == NULL) {
     return false;
   }
-  assert(_global_mspace->live_list_is_nonempty(), "invariant");
+  for (size_t i = 0; i < _global_stripe_count; ++i) {
+    _global_mspaces[i] = NULL;
+  }
+  for (size_t i = 0; i < _global_stripe_count; ++i) {
+    // distribute the global buffers evenly over the stripes
+    const size_t stripe_buffer_count = num_global_buffers / _global_stripe_count +
+                                       (i < num_global_buffers % _global_stripe_count ? 1 : 0);
+    _global_mspaces[i] = create_mspace<JfrStorageMspace>(global_buffer_size,
+                                                         stripe_buffer_count, // cache count limit
+                                                         stripe_buffer_count, // cache_preallocate count
+                                                         false, // preallocate_to_free_list (== preallocate directly to live list)
+                                                         this);
+    if (_global_mspaces[i] == NULL) {
+      return false;
+    }
+    assert(_global_mspaces[i]->live_list_is_nonempty(), "invariant");
+  }
   _thread_local_mspace = create_mspace<JfrThreadLocalMspace>(thread_buffer_size,
                                                              thread_local_cache_count, // cache count limit
                                                              thread_local_cache_count, // cache preallocate count
@@ -160,24 +183,43 @@ BufferPtr JfrStorage::acquire_transient(size_t size, Thread* thread) {
   return buffer;
 }
 
-static BufferPtr acquire_lease(size_t size, JfrStorageMspace* mspace, JfrStorage& storage_instance, size_t retry_count, Thread* thread) {
-  assert(size <= mspace->min_element_size(), "invariant");
+size_t JfrStorage::global_stripe_index(const Thread* thread) const {
+  assert(thread != NULL, "invariant");
+  // mix the thread address down to a stripe index
+  return (((uintptr_t)thread >> 4) * 2654435761u) % _global_stripe_count;
+}
+
+// Acquisition starts at the stripe the thread hashes to and falls back to the
+// other stripes, so a thread only contends on neighbouring stripes when its
+// home stripe is exhausted.
+BufferPtr JfrStorage::acquire_lease(size_t size, size_t retry_count, Thread* thread) {
+  assert(size <= _global_mspaces[0]->min_element_size(), "invariant");
+  const size_t home = global_stripe_index(thread);
   while (true) {
-    BufferPtr buffer = mspace_acquire_lease_with_retry(size, mspace, retry_count, thread);
-    if (buffer == NULL && storage_instance.control().should_discard()) {
-      storage_instance.discard_oldest(thread);
+    BufferPtr buffer = NULL;
+    for (size_t i = 0; i < _global_stripe_count && buffer == NULL; ++i) {
+      JfrStorageMspace* const mspace = _global_mspaces[(home + i) % _global_stripe_count];
+      buffer = mspace_acquire_lease_with_retry(size, mspace, retry_count, thread);
+    }
+    if (buffer == NULL && control().should_discard()) {
+      discard_oldest(thread);
       continue;
     }
     return buffer;
   }
 }
 
-static BufferPtr acquire_promotion_buffer(size_t size, JfrStorageMspace* mspace, JfrStorage& storage_instance, size_t retry_count, Thread* thread) {
-  assert(size <= mspace->min_element_size(), "invariant");
+BufferPtr JfrStorage::acquire_promotion_buffer(size_t size, size_t retry_count, Thread* thread) {
+  assert(size <= _global_mspaces[0]->min_element_size(), "invariant");
+  const size_t home = global_stripe_index(thread);
   while (true) {
-    BufferPtr buffer= mspace_acquire_live_with_retry(size, mspace, retry_count, thread);
-    if (buffer == NULL && storage_instance.control().should_discard()) {
-      storage_instance.discard_oldest(thread);
+    BufferPtr buffer = NULL;
+    for (size_t i = 0; i < _global_stripe_count && buffer == NULL; ++i) {
+      JfrStorageMspace* const mspace = _global_mspaces[(home + i) % _global_stripe_count];
+      buffer = mspace_acquire_live_with_retry(size, mspace, retry_count, thread);
+    }
+    if (buffer == NULL && control().should_discard()) {
+      discard_oldest(thread);
       continue;
     }
     return buffer;
@@ -188,10 +230,10 @@ static const size_t lease_retry = 10;
 
 BufferPtr JfrStorage::acquire_large(size_t size, Thread* thread) {
   JfrStorage& storage_instance = instance();
-  const size_t max_elem_size = storage_instance._global_mspace->min_element_size(); // min is also max
+  const size_t max_elem_size = storage_instance._global_mspaces[0]->min_element_size(); // min is also max
   // if not too large and capacity is still available, ask for a lease from the global system
   if (size < max_elem_size && storage_instance.control().is_global_lease_allowed()) {
-    BufferPtr const buffer = acquire_lease(size, storage_instance._global_mspace, storage_instance, lease_retry, thread);
+    BufferPtr const buffer = storage_instance.acquire_lease(size, lease_retry, thread);
     if (buffer != NULL) {
       assert(buffer->acquired_by_self(), "invariant");
       assert(!buffer->transient(), "invariant");
@@ -252,7 +294,7 @@ bool JfrStorage::flush_regular_buffer(BufferPtr buffer, Thread* thread) {
     return true;
   }
 
-  BufferPtr const promotion_buffer = acquire_promotion_buffer(unflushed_size, _global_mspace, *this, promotion_retry, thread);
+  BufferPtr const promotion_buffer = acquire_promotion_buffer(unflushed_size, promotion_retry, thread);
   if (promotion_buffer == NULL) {
     write_data_loss(buffer, thread);
     return false;
@@ -516,9 +558,11 @@ size_t JfrStorage::write() {
   ReleaseThreadLocalOperation rtlo(_thread_local_mspace, _thread_local_mspace->live_list());
   ConcurrentWriteReleaseThreadLocalOperation tlop(&cnewo, &rtlo);
   process_live_list(tlop, _thread_local_mspace);
-  assert(_global_mspace->free_list_is_empty(), "invariant");
-  assert(_global_mspace->live_list_is_nonempty(), "invariant");
-  process_live_list(cnewo, _global_mspace);
+  for (size_t i = 0; i < _global_stripe_count; ++i) {
+    assert(_global_mspaces[i]->free_list_is_empty(), "invariant");
+    assert(_global_mspaces[i]->live_list_is_nonempty(), "invariant");
+    process_live_list(cnewo, _global_mspaces[i]);
+  }
   return full_elements + wo.elements();
 }
 
@@ -529,9 +573,11 @@ size_t JfrStorage::write_at_safepoint() {
   NonExcluded ne;
   ConcurrentNonExcludedWriteOperation cnewo(wo, ne); // concurrent because of gc's
   process_live_list(cnewo, _thread_local_mspace);
-  assert(_global_mspace->free_list_is_empty(), "invariant");
-  assert(_global_mspace->live_list_is_nonempty(), "invariant");
-  process_live_list(cnewo, _global_mspace);
+  for (size_t i = 0; i < _global_stripe_count; ++i) {
+    assert(_global_mspaces[i]->free_list_is_empty(), "invariant");
+    assert(_global_mspaces[i]->live_list_is_nonempty(), "invariant");
+    process_live_list(cnewo, _global_mspaces[i]);
+  }
   return full_elements + wo.elements();
 }
 
@@ -544,9 +590,11 @@ size_t JfrStorage::clear() {
   ReleaseThreadLocalOperation rtlo(_thread_local_mspace, _thread_local_mspace->live_list());
   DiscardReleaseThreadLocalOperation tldo(&discarder, &rtlo);
   process_live_list(tldo, _thread_local_mspace);
-  assert(_global_mspace->free_list_is_empty(), "invariant");
-  assert(_global_mspace->live_list_is_nonempty(), "invariant");
-  process_live_list(discarder, _global_mspace);
+  for (size_t i = 0; i < _global_stripe_count; ++i) {
+    assert(_global_mspaces[i]->free_list_is_empty(), "invariant");
+    assert(_global_mspaces[i]->live_list_is_nonempty(), "invariant");
+    process_live_list(discarder, _global_mspaces[i]);
+  }
   return full_elements + discarder.elements();
 }
 
@@ -52,12 +52,18 @@ class JfrStorage : public JfrCHeapObj {
 
  private:
   JfrStorageControl* _control;
-  JfrStorageMspace* _global_mspace;
+  // The global buffer pool is striped by thread to reduce contention on
+  // buffer promotion and leasing when many writer threads flush concurrently.
+  JfrStorageMspace** _global_mspaces;
+  size_t _global_stripe_count;
   JfrThreadLocalMspace* _thread_local_mspace;
   JfrFullList* _full_list;
   JfrChunkWriter& _chunkwriter;
   JfrPostBox& _post_box;
 
+  size_t global_stripe_index(const Thread* thread) const;
+  BufferPtr acquire_lease(size_t size, size_t retry_count, Thread* thread);
+  BufferPtr acquire_promotion_buffer(size_t size, size_t retry_count, Thread* thread);
   BufferPtr acquire_large(size_t size, Thread* thread);
   BufferPtr acquire_transient(size_t size, Thread* thread);
   bool flush_regular_buffer(BufferPtr buffer, Thread* thread);
@@ -31,8 +31,67 @@
 
 static THREAD_LOCAL int64_t _last_allocated_bytes = 0;
 
+// The event throttler enforces a fixed budget for ObjectAllocationSample but
+// spends it uniformly over the incoming sampling attempts. A handful of hot
+// allocation sites typically issue nearly all attempts, so rarely allocating
+// sites hardly ever make it into a recording. Each thread therefore tracks the
+// share every class has of its recent attempts in a small direct-mapped sketch
+// and holds back attempts from classes that are over-represented; the throttler
+// budget then shifts towards the tail sites. Held back attempts lose nothing:
+// _last_allocated_bytes does not advance, so the bytes carry over into the
+// weight of the next sample that does get through.
+
+static const uint site_sketch_size = 32;          // direct-mapped, power of two
+static const uint site_sketch_window = 1024;      // attempts between count decays
+static const uint site_fair_share_multiple = 4;   // tolerated over-representation
+
+struct JfrSiteSketchEntry {
+  const Klass* klass;
+  uint32_t count;
+};
+
+static THREAD_LOCAL JfrSiteSketchEntry _site_sketch[site_sketch_size] = {};
+static THREAD_LOCAL uint32_t _site_sketch_attempts = 0;
+
+static JfrSiteSketchEntry& site_sketch_entry(const Klass* klass) {
+  const uintptr_t hash = (uintptr_t)klass >> 3;
+  return _site_sketch[(hash ^ (hash >> 7)) & (site_sketch_size - 1)];
+}
+
+static bool should_defer_sample(const Klass* klass) {
+  if (++_site_sketch_attempts == site_sketch_window) {
+    // Halve the counts so the sketch tracks the recent allocation mix
+    // rather than the history of the whole thread.
+    for (uint i = 0; i < site_sketch_size; i++) {
+      _site_sketch[i].count >>= 1;
+    }
+    _site_sketch_attempts = site_sketch_window / 2;
+  }
+  JfrSiteSketchEntry& entry = site_sketch_entry(klass);
+  if (entry.klass != klass) {
+    // Frequent-style eviction: a new tenant must outlast the incumbent.
+    if (entry.count > 0) {
+      entry.count--;
+      return false;
+    }
+    entry.klass = klass;
+    entry.count = 1;
+    return false;
+  }
+  entry.count++;
+  const uint32_t fair_count = (site_fair_share_multiple * _site_sketch_attempts) / site_sketch_size + 1;
+  if (entry.count <= fair_count) {
+    return false;
+  }
+  // Over-represented: let through only a fair-share proportional fraction.
+  return entry.count % (entry.count / fair_count + 1) != 0;
+}
+
 inline void send_allocation_sample(const Klass* klass, int64_t allocated_bytes) {
   assert(allocated_bytes > 0, "invariant");
+  if (should_defer_sample(klass)) {
+    return;
+  }
   EventObjectAllocationSample event;
   if (event.should_commit()) {
     const int64_t weight = allocated_bytes - _last_allocated_bytes;
@@ -46,6 +105,9 @@ inline void send_allocation_sample(const Klass* klass, int64_t allocated_bytes)
 
 inline bool send_allocation_sample_with_result(const Klass* klass, int64_t allocated_bytes) {
   assert(allocated_bytes > 0, "invariant");
+  if (should_defer_sample(klass)) {
+    return false;
+  }
   EventObjectAllocationSample event;
   if (event.should_commit()) {
     const int64_t weight = allocated_bytes - _last_allocated_bytes;
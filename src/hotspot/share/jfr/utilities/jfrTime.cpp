@@ -33,11 +33,21 @@
 
 bool JfrTime::_ft_enabled = false;
 
+// Paired readings of the os monotonic clock and the fast timestamp
+// counter, taken at initialization. They form the baseline against which
+// the fast counter frequency is periodically recalibrated.
+static jlong _calibration_os_start = 0;
+static jlong _calibration_ft_start = 0;
+
 bool JfrTime::initialize() {
   static bool initialized = false;
   if (!initialized) {
 #if defined(X86) && !defined(ZERO)
     _ft_enabled = Rdtsc::initialize();
+    if (_ft_enabled) {
+      _calibration_os_start = os::elapsed_counter();
+      _calibration_ft_start = Rdtsc::elapsed_counter();
+    }
 #else
     _ft_enabled = false;
 #endif
@@ -71,3 +81,31 @@ jlong JfrTime::frequency() {
 #endif
 }
 
+jlong JfrTime::calibrated_frequency() {
+#if defined(X86) && !defined(ZERO)
+  if (!_ft_enabled) {
+    return os::elapsed_frequency();
+  }
+  const jlong os_freq = os::elapsed_frequency();
+  const jlong os_delta = os::elapsed_counter() - _calibration_os_start;
+  if (os_delta < os_freq) {
+    // Less than a second of baseline; measurement noise would dominate
+    // the correction. Use the nominal frequency.
+    return frequency();
+  }
+  const jlong ft_delta = Rdtsc::elapsed_counter() - _calibration_ft_start;
+  const double measured = (double)ft_delta * (double)os_freq / (double)os_delta;
+  const double nominal = (double)frequency();
+  // The nominal frequency is derived from the cpu brand string and is
+  // typically off by at most a few hundred ppm. A larger discrepancy
+  // indicates a disturbed measurement (e.g. a suspended guest); keep the
+  // nominal value in that case.
+  if (measured < nominal * 0.99 || measured > nominal * 1.01) {
+    return frequency();
+  }
+  return (jlong)measured;
+#else
+  return os::elapsed_frequency();
+#endif
+}
+
@@ -38,6 +38,11 @@ class JfrTime {
   static bool is_ft_enabled() { return _ft_enabled; }
   static bool is_ft_supported();
   static jlong frequency();
+  // The nominal fast timestamp frequency corrected for drift, measured
+  // against the os monotonic clock since JFR was initialized. Falls back
+  // to frequency() when the fast path is disabled or the measurement
+  // baseline is still too short to be trustworthy.
+  static jlong calibrated_frequency();
   static const void* time_function();
 };
 
@@ -49,6 +49,7 @@ class StreamWriterHost : public MemoryWriterHost<Adapter, AP> {
   bool has_valid_fd() const;
 
  public:
+  fio_fd fd() const;
   int64_t current_offset() const;
   void seek(int64_t offset);
   void flush();
@@ -101,6 +101,11 @@ inline bool StreamWriterHost<Adapter, AP>::has_valid_fd() const {
   return invalid_fd != _fd;
 }
 
+template <typename Adapter, typename AP>
+inline fio_fd StreamWriterHost<Adapter, AP>::fd() const {
+  return _fd;
+}
+
 template <typename Adapter, typename AP>
 inline int64_t StreamWriterHost<Adapter, AP>::current_offset() const {
   return current_stream_position();
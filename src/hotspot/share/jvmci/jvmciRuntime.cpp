@@ -1936,7 +1936,8 @@ JVMCI::CodeInstallResult JVMCIRuntime::validate_compile_task_dependencies(Depend
   }
 
   CompileTask* task = compile_state == NULL ? NULL : compile_state->task();
-  Dependencies::DepType result = dependencies->validate_dependencies(task, failure_detail);
+  // JVMCI compilations do not track the hierarchy stamp; always re-walk.
+  Dependencies::DepType result = dependencies->validate_dependencies(task, true /* hierarchy_changed */, failure_detail);
   if (result == Dependencies::end_marker) {
     return JVMCI::ok;
   }
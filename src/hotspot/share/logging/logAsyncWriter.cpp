@@ -44,12 +44,21 @@ class AsyncLogWriter::AsyncLogLocker : public StackObj {
 
 void AsyncLogWriter::enqueue_locked(const AsyncLogMessage& msg) {
   if (_buffer.size() >= _buffer_max_size) {
-    bool p_created;
-    uint32_t* counter = _stats.put_if_absent(msg.output(), 0, &p_created);
-    *counter = *counter + 1;
-    // drop the enqueueing message.
-    os::free(msg.message());
-    return;
+    // The buffer is full. Chatty messages (info and below) are dropped and
+    // counted per output, so that a burst of e.g. -Xlog:gc*=debug output
+    // cannot wash rare but important messages out of the buffer. Warnings
+    // and errors are enqueued past the logical capacity, like the flush
+    // tokens; the hard cap at twice the capacity keeps a pathological
+    // warning flood from exhausting native memory.
+    if (msg.decorations().level() < LogLevel::Warning ||
+        _buffer.size() >= 2 * _buffer_max_size) {
+      bool p_created;
+      uint32_t* counter = _stats.put_if_absent(msg.output(), 0, &p_created);
+      *counter = *counter + 1;
+      // drop the enqueueing message.
+      os::free(msg.message());
+      return;
+    }
   }
 
   _buffer.push_back(msg);
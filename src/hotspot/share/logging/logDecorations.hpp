@@ -64,6 +64,10 @@ class LogDecorations {
     _level = level;
   }
 
+  LogLevelType level() const {
+    return _level;
+  }
+
   void print_decoration(LogDecorators::Decorator decorator, outputStream* st) const;
   const char* decoration(LogDecorators::Decorator decorator, char* buf, size_t buflen) const;
 
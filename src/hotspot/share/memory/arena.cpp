@@ -26,8 +26,10 @@
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
+#include "runtime/thread.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/memTracker.hpp"
 #include "utilities/align.hpp"
@@ -46,48 +48,39 @@ STATIC_ASSERT(is_aligned((int)Chunk::non_pool_size, ARENA_AMALLOC_ALIGNMENT));
 
 // MT-safe pool of same-sized chunks to reduce malloc/free thrashing
 // NB: not using Mutex because pools are used before Threads are initialized
+// With UseNUMA, cached chunks are kept on per-node freelists so a freed
+// chunk is preferentially reused by a thread running on the node whose
+// memory backs it, instead of bouncing chunk payloads across sockets.
 class ChunkPool {
-  Chunk*       _first;        // first cached Chunk; its first word points to next chunk
-  size_t       _num_chunks;   // number of unused chunks in pool
-  const size_t _size;         // (inner payload) size of the chunks this pool serves
+  // Maximum number of node-local freelists; nodes beyond that share a list.
+  static const int _num_lists = 8;
+
+  Chunk*       _first[_num_lists];      // first cached Chunk; its first word points to next chunk
+  size_t       _num_chunks[_num_lists]; // number of unused chunks per freelist
+  const size_t _size;                   // (inner payload) size of the chunks this pool serves
 
   // Our four static pools
   static const int _num_pools = 4;
   static ChunkPool _pools[_num_pools];
 
- public:
-  ChunkPool(size_t size) : _first(NULL), _num_chunks(0), _size(size) {}
-
-  // Allocate a chunk from the pool; returns NULL if pool is empty.
-  Chunk* allocate() {
-    ThreadCritical tc;
-    Chunk* c = _first;
-    if (_first != nullptr) {
-      _first = _first->next();
-      _num_chunks--;
+  // Freelist preferred by the calling thread; without NUMA all threads share list 0.
+  static int current_list() {
+    if (UseNUMA) {
+      return (int)((uint)os::numa_get_group_id() % _num_lists);
     }
-    return c;
+    return 0;
   }
 
-  // Return a chunk to the pool
-  void free(Chunk* chunk) {
-    assert(chunk->length() == _size, "wrong pool for this chunk");
-    ThreadCritical tc;
-    chunk->set_next(_first);
-    _first = chunk;
-    _num_chunks++;
-  }
-
-  // Prune the pool
-  void prune() {
+  // Prune one freelist
+  void prune_list(int list) {
     static const int blocksToKeep = 5;
     Chunk* cur = NULL;
     Chunk* next;
     // if we have more than n chunks, free all of them
     ThreadCritical tc;
-    if (_num_chunks > blocksToKeep) {
+    if (_num_chunks[list] > blocksToKeep) {
       // free chunks at end of queue, for better locality
-      cur = _first;
+      cur = _first[list];
       for (size_t i = 0; i < (blocksToKeep - 1); i++) {
         assert(cur != NULL, "counter out of sync?");
         cur = cur->next();
@@ -103,12 +96,55 @@ class ChunkPool {
       while(cur != NULL) {
         next = cur->next();
         os::free(cur);
-        _num_chunks--;
+        _num_chunks[list]--;
         cur = next;
       }
     }
   }
 
+ public:
+  ChunkPool(size_t size) : _size(size) {
+    for (int i = 0; i < _num_lists; i++) {
+      _first[i] = NULL;
+      _num_chunks[i] = 0;
+    }
+  }
+
+  // Allocate a chunk from the pool; returns NULL if pool is empty.
+  Chunk* allocate() {
+    const int home = current_list();
+    ThreadCritical tc;
+    // Prefer the node-local freelist, but rather than returning NULL and
+    // going to malloc, take a remote cached chunk if that is all we have.
+    for (int i = 0; i < _num_lists; i++) {
+      const int list = (home + i) % _num_lists;
+      Chunk* c = _first[list];
+      if (c != nullptr) {
+        _first[list] = c->next();
+        _num_chunks[list]--;
+        return c;
+      }
+    }
+    return NULL;
+  }
+
+  // Return a chunk to the pool
+  void free(Chunk* chunk) {
+    assert(chunk->length() == _size, "wrong pool for this chunk");
+    const int list = current_list();
+    ThreadCritical tc;
+    chunk->set_next(_first[list]);
+    _first[list] = chunk;
+    _num_chunks[list]++;
+  }
+
+  // Prune the pool
+  void prune() {
+    for (int i = 0; i < _num_lists; i++) {
+      prune_list(i);
+    }
+  }
+
   static void clean() {
     for (int i = 0; i < _num_pools; i++) {
       _pools[i].prune();
@@ -146,6 +182,19 @@ class ChunkPoolCleaner : public PeriodicTask {
 //--------------------------------------------------------------------------------------
 // Chunk implementation
 
+// Chunks at least this large are backed by dedicated virtual memory mappings
+// instead of C-heap, so that freeing them returns the pages to the operating
+// system immediately rather than lingering in malloc freelists. Giant chunks
+// come from outsized single allocations (e.g. C2 liveness sets for huge
+// methods) and are rarely of a reusable size. The same predicate on the
+// payload length identifies these chunks again when they are deleted.
+static const size_t mmap_chunk_threshold = 1*M;
+
+// Size of the memory mapping backing a chunk with the given payload length.
+static size_t mmap_chunk_size(size_t length) {
+  return align_up(ARENA_ALIGN(sizeof(Chunk)) + length, os::vm_page_size());
+}
+
 void* Chunk::operator new (size_t sizeofChunk, AllocFailType alloc_failmode, size_t length) throw() {
   // - requested_size = sizeof(Chunk)
   // - length = payload size
@@ -168,6 +217,19 @@ void* Chunk::operator new (size_t sizeofChunk, AllocFailType alloc_failmode, siz
   assert(sizeofChunk == sizeof(Chunk), "weird request size");
   assert(is_aligned(length, ARENA_AMALLOC_ALIGNMENT), "chunk payload length misaligned: "
          SIZE_FORMAT ".", length);
+  // Fast path: reuse the chunk cached by the calling thread if it has the
+  // requested size. This serves the common pattern where a scope (HandleMark,
+  // ResourceMark) repeatedly overflows into one extra chunk and gives it back
+  // on reset - e.g. a hot JNI upcall at a fixed stack depth - without
+  // round-tripping through the locked pools below on every iteration.
+  Thread* thread = Thread::current_or_null();
+  if (thread != NULL) {
+    Chunk* c = thread->cached_chunk();
+    if (c != NULL && c->length() == length) {
+      thread->set_cached_chunk(NULL);
+      return c;
+    }
+  }
   // Try to reuse a freed chunk from the pool
   ChunkPool* pool = ChunkPool::get_pool_for_size(length);
   if (pool != NULL) {
@@ -177,6 +239,21 @@ void* Chunk::operator new (size_t sizeofChunk, AllocFailType alloc_failmode, siz
       return c;
     }
   }
+  // Giant chunks get their own memory mapping, see mmap_chunk_threshold above.
+  if (length >= mmap_chunk_threshold) {
+    size_t bytes = mmap_chunk_size(length);
+    char* p = os::reserve_memory(bytes, false, mtChunk);
+    if (p != NULL && !os::commit_memory(p, bytes, false)) {
+      os::release_memory(p, bytes);
+      p = NULL;
+    }
+    if (p == NULL && alloc_failmode == AllocFailStrategy::EXIT_OOM) {
+      vm_exit_out_of_memory(bytes, OOM_MMAP_ERROR, "Chunk::new");
+    }
+    // Mapped memory is page aligned, which satisfies the payload alignment
+    // checked below.
+    return p;
+  }
   // Either the pool was empty, or this is a non-standard length. Allocate a new Chunk from C-heap.
   size_t bytes = ARENA_ALIGN(sizeofChunk) + length;
   void* p = os::malloc(bytes, mtChunk, CALLER_PC);
@@ -191,8 +268,23 @@ void* Chunk::operator new (size_t sizeofChunk, AllocFailType alloc_failmode, siz
 void Chunk::operator delete(void* p) {
   // If this is a standard-sized chunk, return it to its pool; otherwise free it.
   Chunk* c = (Chunk*)p;
+  if (c->length() >= mmap_chunk_threshold) {
+    // Return the backing mapping to the operating system right away, so
+    // that a giant chunk does not stay resident beyond the lifetime of the
+    // arena (typically a single compilation) that needed it.
+    os::release_memory((char*)c, mmap_chunk_size(c->length()));
+    return;
+  }
   ChunkPool* pool = ChunkPool::get_pool_for_size(c->length());
   if (pool != NULL) {
+    // One-slot per-thread cache in front of the shared pools, see operator new.
+    // Only pool-sized chunks are cached, so retention per thread is bounded by
+    // the largest standard chunk size.
+    Thread* thread = Thread::current_or_null();
+    if (thread != NULL && thread->cached_chunk() == NULL) {
+      thread->set_cached_chunk(c);
+      return;
+    }
     pool->free(c);
   } else {
     ThreadCritical tc;  // Free chunks under TC lock so that NMT adjustment is stable.
@@ -220,6 +312,16 @@ void Chunk::next_chop() {
   _next = NULL;
 }
 
+void Chunk::flush_thread_cache(Thread* thread) {
+  Chunk* c = thread->cached_chunk();
+  if (c != NULL) {
+    thread->set_cached_chunk(NULL);
+    ChunkPool* pool = ChunkPool::get_pool_for_size(c->length());
+    assert(pool != NULL, "only pool-sized chunks are cached");
+    pool->free(c);
+  }
+}
+
 void Chunk::start_chunk_pool_cleaner_task() {
 #ifdef ASSERT
   static bool task_created = false;
@@ -232,7 +334,7 @@ void Chunk::start_chunk_pool_cleaner_task() {
 
 //------------------------------Arena------------------------------------------
 
-Arena::Arena(MEMFLAGS flag, size_t init_size) : _flags(flag), _size_in_bytes(0)  {
+Arena::Arena(MEMFLAGS flag, size_t init_size) : _flags(flag), _size_in_bytes(0), _peak_in_bytes(0)  {
   init_size = ARENA_ALIGN(init_size);
   _first = _chunk = new (AllocFailStrategy::EXIT_OOM, init_size) Chunk(init_size);
   _hwm = _chunk->bottom();      // Save the cached hwm, max
@@ -241,7 +343,7 @@ Arena::Arena(MEMFLAGS flag, size_t init_size) : _flags(flag), _size_in_bytes(0)
   set_size_in_bytes(init_size);
 }
 
-Arena::Arena(MEMFLAGS flag) : _flags(flag), _size_in_bytes(0) {
+Arena::Arena(MEMFLAGS flag) : _flags(flag), _size_in_bytes(0), _peak_in_bytes(0) {
   _first = _chunk = new (AllocFailStrategy::EXIT_OOM, Chunk::init_size) Chunk(Chunk::init_size);
   _hwm = _chunk->bottom();      // Save the cached hwm, max
   _max = _chunk->top();
@@ -315,6 +417,9 @@ void Arena::set_size_in_bytes(size_t size) {
   if (_size_in_bytes != size) {
     ssize_t delta = size - size_in_bytes();
     _size_in_bytes = size;
+    if (size > _peak_in_bytes) {
+      _peak_in_bytes = size;
+    }
     MemTracker::record_arena_size_change(delta, _flags);
   }
 }
@@ -37,6 +37,8 @@
 #define ARENA_AMALLOC_ALIGNMENT BytesPerLong
 #define ARENA_ALIGN(x) (align_up((x), ARENA_AMALLOC_ALIGNMENT))
 
+class Thread;
+
 //------------------------------Chunk------------------------------------------
 // Linked list of raw memory chunks
 class Chunk: CHeapObj<mtChunk> {
@@ -82,6 +84,10 @@ class Chunk: CHeapObj<mtChunk> {
 
   // Start the chunk_pool cleaner task
   static void start_chunk_pool_cleaner_task();
+
+  // Return the chunk cached by the given thread (if any) to its pool,
+  // called when the thread exits
+  static void flush_thread_cache(Thread* thread);
 };
 
 //------------------------------Arena------------------------------------------
@@ -100,6 +106,7 @@ protected:
   // Get a new Chunk of at least size x
   void* grow(size_t x, AllocFailType alloc_failmode = AllocFailStrategy::EXIT_OOM);
   size_t _size_in_bytes;        // Size of arena (used for native memory tracking)
+  size_t _peak_in_bytes;        // Largest size this arena has ever had
 
   debug_only(void* malloc(size_t size);)
 
@@ -185,6 +192,11 @@ protected:
   size_t size_in_bytes() const         {  return _size_in_bytes; };
   void set_size_in_bytes(size_t size);
 
+  // High-water mark of size_in_bytes() over the life of this arena. Useful
+  // to right-size initial chunk sizes for arenas with known usage patterns
+  // (not reset by move_contents() or destruct_contents()).
+  size_t peak_size_in_bytes() const    {  return _peak_in_bytes; };
+
   static void free_malloced_objects(Chunk* chunk, char* hwm, char* max, char* hwm2)  PRODUCT_RETURN;
   static void free_all(char** start, char** end)                                     PRODUCT_RETURN;
 
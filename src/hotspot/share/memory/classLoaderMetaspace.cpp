@@ -51,10 +51,29 @@ using metaspace::InternalStats;
 #define LOGFMT         "CLMS @" PTR_FORMAT " "
 #define LOGFMT_ARGS    p2i(this)
 
+// Dispatch-critical metadata types. Segregating them into their own arena
+// packs the hot metadata of a loader densely instead of interleaving it with
+// annotations and other metadata that is rarely, if ever, touched after
+// class loading.
+static bool is_hot_metadata(MetaspaceObj::Type type) {
+  switch (type) {
+  case MetaspaceObj::MethodType:
+  case MetaspaceObj::ConstMethodType:
+  case MetaspaceObj::MethodDataType:
+  case MetaspaceObj::MethodCountersType:
+  case MetaspaceObj::ConstantPoolType:
+  case MetaspaceObj::ConstantPoolCacheType:
+    return true;
+  default:
+    return false;
+  }
+}
+
 ClassLoaderMetaspace::ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType space_type) :
   _lock(lock),
   _space_type(space_type),
   _non_class_space_arena(NULL),
+  _hot_non_class_space_arena(NULL),
   _class_space_arena(NULL)
 {
   ChunkManager* const non_class_cm =
@@ -71,6 +90,20 @@ ClassLoaderMetaspace::ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType
       RunningCounters::used_nonclass_counter(),
       "non-class sm");
 
+  // Reflection and hidden-class loaders typically hold a single small class;
+  // for those the footprint of a second arena outweighs any locality gain,
+  // so only standard and boot loaders segregate hot metadata.
+  if (space_type == Metaspace::StandardMetaspaceType ||
+      space_type == Metaspace::BootMetaspaceType) {
+    _hot_non_class_space_arena = new MetaspaceArena(
+        non_class_cm,
+        ArenaGrowthPolicy::policy_for_space_type(space_type, false),
+        metaspace::MetaspaceMinAlignmentWords,
+        lock,
+        RunningCounters::used_nonclass_counter(),
+        "hot non-class sm");
+  }
+
   // If needed, initialize class arena
   if (Metaspace::using_class_space()) {
     // Klass instances live in class space and must be aligned correctly.
@@ -90,14 +123,16 @@ ClassLoaderMetaspace::ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType
     NOT_LP64(STATIC_ASSERT(metaspace::MetaspaceMinAlignmentBytes == KlassAlignmentInBytes));
   }
 
-  UL2(debug, "born (nonclass arena: " PTR_FORMAT ", class arena: " PTR_FORMAT ".",
-      p2i(_non_class_space_arena), p2i(_class_space_arena));
+  UL2(debug, "born (nonclass arena: " PTR_FORMAT ", hot nonclass arena: " PTR_FORMAT
+      ", class arena: " PTR_FORMAT ".",
+      p2i(_non_class_space_arena), p2i(_hot_non_class_space_arena), p2i(_class_space_arena));
 }
 
 ClassLoaderMetaspace::~ClassLoaderMetaspace() {
   UL(debug, "dies.");
 
   delete _non_class_space_arena;
+  delete _hot_non_class_space_arena;
   delete _class_space_arena;
 
 }
@@ -111,6 +146,18 @@ MetaWord* ClassLoaderMetaspace::allocate(size_t word_size, Metaspace::MetadataTy
   }
 }
 
+// Allocate word_size words from Metaspace, using the object type to place
+// dispatch-critical metadata in the hot arena if this loader has one.
+MetaWord* ClassLoaderMetaspace::allocate(size_t word_size, MetaspaceObj::Type type) {
+  const Metaspace::MetadataType mdType =
+      (type == MetaspaceObj::ClassType) ? Metaspace::ClassType : Metaspace::NonClassType;
+  if (!Metaspace::is_class_space_allocation(mdType) &&
+      hot_non_class_space_arena() != NULL && is_hot_metadata(type)) {
+    return hot_non_class_space_arena()->allocate(word_size);
+  }
+  return allocate(word_size, mdType);
+}
+
 // Attempt to expand the GC threshold to be good for at least another word_size words
 // and allocate. Returns NULL if failure. Used during Metaspace GC.
 MetaWord* ClassLoaderMetaspace::expand_and_allocate(size_t word_size, Metaspace::MetadataType mdType) {
@@ -147,6 +194,11 @@ MetaWord* ClassLoaderMetaspace::expand_and_allocate(size_t word_size, Metaspace:
 void ClassLoaderMetaspace::deallocate(MetaWord* ptr, size_t word_size, bool is_class) {
   if (Metaspace::using_class_space() && is_class) {
     class_space_arena()->deallocate(ptr, word_size);
+  } else if (hot_non_class_space_arena() != NULL &&
+             hot_non_class_space_arena()->contains(ptr)) {
+    // Callers freeing non-class metadata do not know whether it was
+    // allocated from the hot arena, so route the block by containment.
+    hot_non_class_space_arena()->deallocate(ptr, word_size);
   } else {
     non_class_space_arena()->deallocate(ptr, word_size);
   }
@@ -158,6 +210,9 @@ void ClassLoaderMetaspace::add_to_statistics(metaspace::ClmsStats* out) const {
   if (non_class_space_arena() != NULL) {
     non_class_space_arena()->add_to_statistics(&out->_arena_stats_nonclass);
   }
+  if (hot_non_class_space_arena() != NULL) {
+    hot_non_class_space_arena()->add_to_statistics(&out->_arena_stats_nonclass);
+  }
   if (class_space_arena() != NULL) {
     class_space_arena()->add_to_statistics(&out->_arena_stats_class);
   }
@@ -168,6 +223,9 @@ void ClassLoaderMetaspace::verify() const {
   if (non_class_space_arena() != NULL) {
     non_class_space_arena()->verify();
   }
+  if (hot_non_class_space_arena() != NULL) {
+    hot_non_class_space_arena()->verify();
+  }
   if (class_space_arena() != NULL) {
     class_space_arena()->verify();
   }
@@ -184,6 +242,12 @@ void ClassLoaderMetaspace::calculate_jfr_stats(size_t* p_used_bytes, size_t* p_c
   if (non_class_space_arena() != NULL) {
     non_class_space_arena()->usage_numbers(&used_nc, NULL, &cap_nc);
   }
+  if (hot_non_class_space_arena() != NULL) {
+    size_t used_hot = 0, cap_hot = 0;
+    hot_non_class_space_arena()->usage_numbers(&used_hot, NULL, &cap_hot);
+    used_nc += used_hot;
+    cap_nc += cap_hot;
+  }
   if (class_space_arena() != NULL) {
     class_space_arena()->usage_numbers(&used_c, NULL, &cap_c);
   }
@@ -42,6 +42,12 @@ namespace metaspace {
 // it owns two - one for the Klass* objects from the class space, one for the other
 // types of MetaspaceObjs from the non-class space.
 //
+// For standard and boot loaders, the non-class space is further split by
+// metadata type: dispatch-critical metadata (methods, constant pools and
+// their caches, profiling data) goes to a separate "hot" arena, so the hot
+// metadata of a loader packs densely into few pages instead of being
+// interleaved with annotations and other rarely touched metadata.
+//
 // +------+       +----------------------+       +-------------------+
 // | CLD  | --->  | ClassLoaderMetaspace | ----> | (non class) Arena |
 // +------+       +----------------------+  |    +-------------------+     allocation top
@@ -49,6 +55,13 @@ namespace metaspace {
 //                                          |       + chunk -- chunk ... -- chunk
 //                                          |
 //                                          |    +-------------------+
+//                                          +--> | (hot non class)   |
+//                                          |    |  Arena            |
+//                                          |    +-------------------+
+//                                          |       |
+//                                          |       + chunk ... chunk
+//                                          |
+//                                          |    +-------------------+
 //                                          +--> | (class) Arena     |
 //                                               +-------------------+
 //                                                  |
@@ -67,13 +80,19 @@ class ClassLoaderMetaspace : public CHeapObj<mtClass> {
   //  (resp. for all allocations if -XX:-UseCompressedClassPointers).
   metaspace::MetaspaceArena* _non_class_space_arena;
 
+  // Arena for dispatch-critical non-class metadata
+  //  (NULL for loaders too small to benefit from segregation; those
+  //   use _non_class_space_arena for everything).
+  metaspace::MetaspaceArena* _hot_non_class_space_arena;
+
   // Arena for allocations from class space
   //  (NULL if -XX:-UseCompressedClassPointers).
   metaspace::MetaspaceArena* _class_space_arena;
 
   Mutex* lock() const                             { return _lock; }
-  metaspace::MetaspaceArena* non_class_space_arena() const   { return _non_class_space_arena; }
-  metaspace::MetaspaceArena* class_space_arena() const       { return _class_space_arena; }
+  metaspace::MetaspaceArena* non_class_space_arena() const      { return _non_class_space_arena; }
+  metaspace::MetaspaceArena* hot_non_class_space_arena() const  { return _hot_non_class_space_arena; }
+  metaspace::MetaspaceArena* class_space_arena() const          { return _class_space_arena; }
 
 public:
 
@@ -86,6 +105,11 @@ public:
   // Allocate word_size words from Metaspace.
   MetaWord* allocate(size_t word_size, Metaspace::MetadataType mdType);
 
+  // Type-aware variant: routes dispatch-critical metadata types to the hot
+  // arena if this loader has one. Callers that only know the metadata type
+  // (e.g. GC retry paths) use the MetadataType variant above.
+  MetaWord* allocate(size_t word_size, MetaspaceObj::Type type);
+
   // Attempt to expand the GC threshold to be good for at least another word_size words
   // and allocate. Returns NULL if failure. Used during Metaspace GC.
   MetaWord* expand_and_allocate(size_t word_size, Metaspace::MetadataType mdType);
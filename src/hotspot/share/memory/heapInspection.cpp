@@ -170,6 +170,7 @@ public:
 
 KlassInfoTable::KlassInfoTable(bool add_all_classes) {
   _size_of_instances_in_words = 0;
+  _last_entry = NULL;
   _ref = (HeapWord*) Universe::boolArrayKlassObj();
   _buckets =
     (KlassInfoBucket*)  AllocateHeap(sizeof(KlassInfoBucket) * _num_buckets,
@@ -214,7 +215,11 @@ KlassInfoEntry* KlassInfoTable::lookup(Klass* k) {
 // of running out of space required to create a new entry.
 bool KlassInfoTable::record_instance(const oop obj) {
   Klass*        k = obj->klass();
-  KlassInfoEntry* elt = lookup(k);
+  KlassInfoEntry* elt = _last_entry;
+  if (elt == NULL || elt->klass() != k) {
+    elt = lookup(k);
+    _last_entry = elt;
+  }
   // elt may be NULL if it's a new klass for which we
   // could not allocate space for a new entry in the hashtable.
   if (elt != NULL) {
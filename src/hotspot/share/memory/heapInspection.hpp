@@ -113,6 +113,10 @@ class KlassInfoTable: public StackObj {
   HeapWord* _ref;
 
   KlassInfoBucket* _buckets;
+  // Entry of the most recently recorded klass.  Object iteration visits long
+  // runs of instances of the same klass, so this avoids a hashtable lookup
+  // per object for most of them.
+  KlassInfoEntry* _last_entry;
   uint hash(const Klass* p);
   KlassInfoEntry* lookup(Klass* k); // allocates if not found!
 
@@ -384,6 +384,18 @@ void MetaspaceArena::deallocate(MetaWord* p, size_t word_size) {
   deallocate_locked(p, word_size);
 }
 
+// Returns true if the given pointer points into the used area of one of
+// this arena's chunks.
+bool MetaspaceArena::contains(const MetaWord* p) const {
+  MutexLocker cl(lock(), Mutex::_no_safepoint_check_flag);
+  for (const Metachunk* c = _chunks.first(); c != NULL; c = c->next()) {
+    if (c->base() <= p && p < c->top()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 // Update statistics. This walks all in-use chunks.
 void MetaspaceArena::add_to_statistics(ArenaStats* out) const {
   MutexLocker cl(lock(), Mutex::_no_safepoint_check_flag);
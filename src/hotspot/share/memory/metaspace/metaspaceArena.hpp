@@ -185,6 +185,10 @@ public:
   // needed anymore.
   void deallocate(MetaWord* p, size_t word_size);
 
+  // Returns true if the given pointer points into the used area of one of
+  // this arena's chunks.
+  bool contains(const MetaWord* p) const;
+
   // Update statistics. This walks all in-use chunks.
   void add_to_statistics(ArenaStats* out) const;
 
@@ -110,6 +110,15 @@ bool VirtualSpaceNode::commit_range(MetaWord* p, size_t word_size) {
     vm_exit_out_of_memory(word_size * BytesPerWord, OOM_MMAP_ERROR, "Failed to commit metaspace.");
   }
 
+  // Metaspace carves chunks from the committed range with bump-pointer
+  // allocation, so metadata of classes loaded together - Klass structures
+  // with their embedded vtables in particular - ends up densely packed in
+  // load order. Hint to the OS that it may coalesce the range into huge
+  // pages, which lets the hot vtables share a handful of dTLB entries.
+  // No-op unless the platform and flags support it (on Linux, requires
+  // +UseTransparentHugePages).
+  os::realign_memory((char*)p, word_size * BytesPerWord, os::large_page_size());
+
   if (AlwaysPreTouch) {
     os::pretouch_memory(p, p + word_size);
   }
@@ -70,6 +70,7 @@
 #include "runtime/init.hpp"
 #include "runtime/java.hpp"
 #include "runtime/jniHandles.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/timerTrace.hpp"
 #include "services/memoryService.hpp"
@@ -952,6 +953,12 @@ void universe2_init() {
 // Set after initialization of the module runtime, call_initModuleRuntime
 void universe_post_module_init() {
   Universe::_module_initialized = true;
+  // The boot layer module graph is now complete.  Snapshot the module and
+  // package tables built so far for lock-free lookup; modules or packages
+  // defined later are found through the mutable tables.
+  MutexLocker m1(ClassLoaderDataGraph_lock);
+  MutexLocker m2(Module_lock);
+  ClassLoaderDataGraph::freeze_module_and_package_tables();
 }
 
 bool universe_post_init() {
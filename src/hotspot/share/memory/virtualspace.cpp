@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/pretouchTask.hpp"
 #include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/virtualspace.hpp"
@@ -690,12 +691,13 @@ VirtualSpace::VirtualSpace() {
 }
 
 
-bool VirtualSpace::initialize(ReservedSpace rs, size_t committed_size) {
+bool VirtualSpace::initialize(ReservedSpace rs, size_t committed_size, WorkerThreads* pretouch_workers) {
   const size_t max_commit_granularity = os::page_size_for_region_unaligned(rs.size(), 1);
-  return initialize_with_granularity(rs, committed_size, max_commit_granularity);
+  return initialize_with_granularity(rs, committed_size, max_commit_granularity, pretouch_workers);
 }
 
-bool VirtualSpace::initialize_with_granularity(ReservedSpace rs, size_t committed_size, size_t max_commit_granularity) {
+bool VirtualSpace::initialize_with_granularity(ReservedSpace rs, size_t committed_size, size_t max_commit_granularity,
+                                               WorkerThreads* pretouch_workers) {
   if(!rs.is_reserved()) return false;  // allocation failed.
   assert(_low_boundary == NULL, "VirtualSpace already initialized");
   assert(max_commit_granularity > 0, "Granularity must be non-zero.");
@@ -735,7 +737,7 @@ bool VirtualSpace::initialize_with_granularity(ReservedSpace rs, size_t committe
 
   // commit to initial size
   if (committed_size > 0) {
-    if (!expand_by(committed_size)) {
+    if (!expand_by(committed_size, false, pretouch_workers)) {
       return false;
     }
   }
@@ -824,17 +826,19 @@ bool VirtualSpace::contains(const void* p) const {
   return low() <= (const char*) p && (const char*) p < high();
 }
 
-static void pretouch_expanded_memory(void* start, void* end) {
+static void pretouch_expanded_memory(void* start, void* end, WorkerThreads* pretouch_workers) {
   assert(is_aligned(start, os::vm_page_size()), "Unexpected alignment");
   assert(is_aligned(end,   os::vm_page_size()), "Unexpected alignment");
 
-  os::pretouch_memory(start, end);
+  PretouchTask::pretouch("VirtualSpace PreTouch", (char*)start, (char*)end,
+                         os::vm_page_size(), pretouch_workers);
 }
 
-static bool commit_expanded(char* start, size_t size, size_t alignment, bool pre_touch, bool executable) {
+static bool commit_expanded(char* start, size_t size, size_t alignment, bool pre_touch, bool executable,
+                            WorkerThreads* pretouch_workers) {
   if (os::commit_memory(start, size, alignment, executable)) {
     if (pre_touch || AlwaysPreTouch) {
-      pretouch_expanded_memory(start, start + size);
+      pretouch_expanded_memory(start, start + size, pretouch_workers);
     }
     return true;
   }
@@ -859,7 +863,7 @@ static bool commit_expanded(char* start, size_t size, size_t alignment, bool pre
    page address and the pages after the last large page address must be
    allocated with default pages.
 */
-bool VirtualSpace::expand_by(size_t bytes, bool pre_touch) {
+bool VirtualSpace::expand_by(size_t bytes, bool pre_touch, WorkerThreads* pretouch_workers) {
   if (uncommitted_size() < bytes) {
     return false;
   }
@@ -921,7 +925,7 @@ bool VirtualSpace::expand_by(size_t bytes, bool pre_touch) {
   // Commit regions
   if (lower_needs > 0) {
     assert(lower_high() + lower_needs <= lower_high_boundary(), "must not expand beyond region");
-    if (!commit_expanded(lower_high(), lower_needs, _lower_alignment, pre_touch, _executable)) {
+    if (!commit_expanded(lower_high(), lower_needs, _lower_alignment, pre_touch, _executable, pretouch_workers)) {
       return false;
     }
     _lower_high += lower_needs;
@@ -929,7 +933,7 @@ bool VirtualSpace::expand_by(size_t bytes, bool pre_touch) {
 
   if (middle_needs > 0) {
     assert(middle_high() + middle_needs <= middle_high_boundary(), "must not expand beyond region");
-    if (!commit_expanded(middle_high(), middle_needs, _middle_alignment, pre_touch, _executable)) {
+    if (!commit_expanded(middle_high(), middle_needs, _middle_alignment, pre_touch, _executable, pretouch_workers)) {
       return false;
     }
     _middle_high += middle_needs;
@@ -937,7 +941,7 @@ bool VirtualSpace::expand_by(size_t bytes, bool pre_touch) {
 
   if (upper_needs > 0) {
     assert(upper_high() + upper_needs <= upper_high_boundary(), "must not expand beyond region");
-    if (!commit_expanded(upper_high(), upper_needs, _upper_alignment, pre_touch, _executable)) {
+    if (!commit_expanded(upper_high(), upper_needs, _upper_alignment, pre_touch, _executable, pretouch_workers)) {
       return false;
     }
     _upper_high += upper_needs;
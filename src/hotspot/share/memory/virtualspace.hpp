@@ -29,6 +29,7 @@
 #include "utilities/globalDefinitions.hpp"
 
 class outputStream;
+class WorkerThreads;
 
 // ReservedSpace is a data structure for reserving a contiguous address range.
 
@@ -214,8 +215,9 @@ class VirtualSpace {
  public:
   // Initialization
   VirtualSpace();
-  bool initialize_with_granularity(ReservedSpace rs, size_t committed_byte_size, size_t max_commit_ganularity);
-  bool initialize(ReservedSpace rs, size_t committed_byte_size);
+  bool initialize_with_granularity(ReservedSpace rs, size_t committed_byte_size, size_t max_commit_ganularity,
+                                   WorkerThreads* pretouch_workers = NULL);
+  bool initialize(ReservedSpace rs, size_t committed_byte_size, WorkerThreads* pretouch_workers = NULL);
 
   // Destruction
   ~VirtualSpace();
@@ -233,7 +235,9 @@ class VirtualSpace {
 
   // Operations
   // returns true on success, false otherwise
-  bool expand_by(size_t bytes, bool pre_touch = false);
+  // Pre-touching is striped over pretouch_workers when a worker pool is
+  // passed in; otherwise the calling thread touches the pages itself.
+  bool expand_by(size_t bytes, bool pre_touch = false, WorkerThreads* pretouch_workers = NULL);
   void shrink_by(size_t bytes);
   void release();
 
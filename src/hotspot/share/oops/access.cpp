@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "oops/access.inline.hpp"
+
+// Eager resolution of the hottest runtime-dispatched accessors.
+//
+// Runtime-dispatched accesses normally start out pointing to a resolution
+// function and get patched to the selected BarrierSet::AccessBarrier accessor
+// the first time each instantiation is called. For the access shapes that
+// dominate runtime code - oop loads and stores in the heap and to oop roots -
+// we resolve the dispatch table entries up front when the barrier set is
+// installed, so these accesses call the GC accessor directly from the very
+// first invocation.
+//
+// Each helper below replays the decorator expansion performed by the
+// corresponding public Access entry point (cf. AccessInternal::load_at et al.
+// in accessBackend.hpp), so it names the same RuntimeDispatch instantiation
+// that the real callers reach.
+
+namespace AccessInternal {
+  template <DecoratorSet decorators>
+  static void resolve_oop_load() {
+    const DecoratorSet expanded_decorators =
+        DecoratorFixup<decorators | INTERNAL_VALUE_IS_OOP>::value;
+    RuntimeDispatch<expanded_decorators, oop, BARRIER_LOAD>::resolve();
+  }
+
+  template <DecoratorSet decorators>
+  static void resolve_oop_store() {
+    const DecoratorSet expanded_decorators =
+        DecoratorFixup<decorators | INTERNAL_VALUE_IS_OOP>::value;
+    RuntimeDispatch<expanded_decorators, oop, BARRIER_STORE>::resolve();
+  }
+
+  template <DecoratorSet decorators>
+  static void resolve_oop_load_at() {
+    const DecoratorSet expanded_decorators =
+        DecoratorFixup<decorators | INTERNAL_VALUE_IS_OOP | INTERNAL_CONVERT_COMPRESSED_OOP>::value;
+    RuntimeDispatch<expanded_decorators, oop, BARRIER_LOAD_AT>::resolve();
+  }
+
+  template <DecoratorSet decorators>
+  static void resolve_oop_store_at() {
+    const DecoratorSet expanded_decorators =
+        DecoratorFixup<decorators | INTERNAL_VALUE_IS_OOP | INTERNAL_CONVERT_COMPRESSED_OOP>::value;
+    RuntimeDispatch<expanded_decorators, oop, BARRIER_STORE_AT>::resolve();
+  }
+
+  void eagerly_resolve_accessors() {
+    // In-heap oop loads and stores: plain fields, fields of statically
+    // unknown reference strength (Unsafe, reflection) and object array
+    // elements.
+    resolve_oop_load_at<IN_HEAP>();
+    resolve_oop_store_at<IN_HEAP>();
+    resolve_oop_load_at<IN_HEAP | ON_UNKNOWN_OOP_REF>();
+    resolve_oop_store_at<IN_HEAP | ON_UNKNOWN_OOP_REF>();
+    resolve_oop_load_at<IN_HEAP | IS_ARRAY>();
+    resolve_oop_store_at<IN_HEAP | IS_ARRAY>();
+    // Oop roots: JNI handles, Handles and OopStorage.
+    resolve_oop_load<IN_NATIVE>();
+    resolve_oop_store<IN_NATIVE>();
+    resolve_oop_load<IN_NATIVE | ON_PHANTOM_OOP_REF>();
+  }
+}
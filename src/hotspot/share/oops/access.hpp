@@ -366,4 +366,12 @@ void Access<decorators>::verify_decorators() {
   ));
 }
 
+namespace AccessInternal {
+  // Eagerly resolve the runtime-dispatched accessors for the hottest access
+  // shapes, so those accesses never take the lazy resolution path. Called
+  // once the barrier set has been installed and the compressed oops mode is
+  // known.
+  void eagerly_resolve_accessors();
+}
+
 #endif // SHARE_OOPS_ACCESS_HPP
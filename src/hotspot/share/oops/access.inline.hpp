@@ -272,7 +272,9 @@ namespace AccessInternal {
   // barriers). The way it works is that a function pointer initially pointing to an
   // accessor resolution function gets called for each access. Upon first invocation,
   // it resolves which accessor to be used in future invocations and patches the
-  // function pointer to this new accessor.
+  // function pointer to this new accessor. The hottest load and store shapes are
+  // resolved eagerly when the barrier set is installed (cf. access.cpp), so they
+  // never take the lazy resolution path.
 
   template <DecoratorSet decorators, typename T>
   void RuntimeDispatch<decorators, T, BARRIER_STORE>::store_init(void* addr, T value) {
@@ -281,6 +283,11 @@ namespace AccessInternal {
     function(addr, value);
   }
 
+  template <DecoratorSet decorators, typename T>
+  void RuntimeDispatch<decorators, T, BARRIER_STORE>::resolve() {
+    _store_func = BarrierResolver<decorators, func_t, BARRIER_STORE>::resolve_barrier();
+  }
+
   template <DecoratorSet decorators, typename T>
   void RuntimeDispatch<decorators, T, BARRIER_STORE_AT>::store_at_init(oop base, ptrdiff_t offset, T value) {
     func_t function = BarrierResolver<decorators, func_t, BARRIER_STORE_AT>::resolve_barrier();
@@ -288,6 +295,11 @@ namespace AccessInternal {
     function(base, offset, value);
   }
 
+  template <DecoratorSet decorators, typename T>
+  void RuntimeDispatch<decorators, T, BARRIER_STORE_AT>::resolve() {
+    _store_at_func = BarrierResolver<decorators, func_t, BARRIER_STORE_AT>::resolve_barrier();
+  }
+
   template <DecoratorSet decorators, typename T>
   T RuntimeDispatch<decorators, T, BARRIER_LOAD>::load_init(void* addr) {
     func_t function = BarrierResolver<decorators, func_t, BARRIER_LOAD>::resolve_barrier();
@@ -295,6 +307,11 @@ namespace AccessInternal {
     return function(addr);
   }
 
+  template <DecoratorSet decorators, typename T>
+  void RuntimeDispatch<decorators, T, BARRIER_LOAD>::resolve() {
+    _load_func = BarrierResolver<decorators, func_t, BARRIER_LOAD>::resolve_barrier();
+  }
+
   template <DecoratorSet decorators, typename T>
   T RuntimeDispatch<decorators, T, BARRIER_LOAD_AT>::load_at_init(oop base, ptrdiff_t offset) {
     func_t function = BarrierResolver<decorators, func_t, BARRIER_LOAD_AT>::resolve_barrier();
@@ -302,6 +319,11 @@ namespace AccessInternal {
     return function(base, offset);
   }
 
+  template <DecoratorSet decorators, typename T>
+  void RuntimeDispatch<decorators, T, BARRIER_LOAD_AT>::resolve() {
+    _load_at_func = BarrierResolver<decorators, func_t, BARRIER_LOAD_AT>::resolve_barrier();
+  }
+
   template <DecoratorSet decorators, typename T>
   T RuntimeDispatch<decorators, T, BARRIER_ATOMIC_CMPXCHG>::atomic_cmpxchg_init(void* addr, T compare_value, T new_value) {
     func_t function = BarrierResolver<decorators, func_t, BARRIER_ATOMIC_CMPXCHG>::resolve_barrier();
@@ -449,6 +449,7 @@ namespace AccessInternal {
     static func_t _store_func;
 
     static void store_init(void* addr, T value);
+    static void resolve();
 
     static inline void store(void* addr, T value) {
       _store_func(addr, value);
@@ -461,6 +462,7 @@ namespace AccessInternal {
     static func_t _store_at_func;
 
     static void store_at_init(oop base, ptrdiff_t offset, T value);
+    static void resolve();
 
     static inline void store_at(oop base, ptrdiff_t offset, T value) {
       _store_at_func(base, offset, value);
@@ -473,6 +475,7 @@ namespace AccessInternal {
     static func_t _load_func;
 
     static T load_init(void* addr);
+    static void resolve();
 
     static inline T load(void* addr) {
       return _load_func(addr);
@@ -485,6 +488,7 @@ namespace AccessInternal {
     static func_t _load_at_func;
 
     static T load_at_init(oop base, ptrdiff_t offset);
+    static void resolve();
 
     static inline T load_at(oop base, ptrdiff_t offset) {
       return _load_at_func(base, offset);
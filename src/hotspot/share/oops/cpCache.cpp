@@ -709,6 +709,14 @@ void ConstantPoolCache::verify_just_initialized() {
   DEBUG_ONLY(walk_entries_for_initialization(/*check_only = */ true));
 }
 
+// Note that invokedynamic entries are always stored unresolved. Archiving a
+// resolved entry would require archiving the CallSite/MethodHandle object
+// graph the resolved_references entry points at, plus a runtime check that
+// the recorded bootstrap outcome is still valid (same bootstrap method,
+// static arguments and class file version). Neither exists here; what we do
+// archive instead are the lambda proxy classes and the regenerated
+// LambdaForm invoker holders, which remove the class-spinning part of the
+// bootstrap cost. See SystemDictionaryShared and LambdaFormInvokers.
 void ConstantPoolCache::remove_unshareable_info() {
   walk_entries_for_initialization(/*check_only = */ false);
 }
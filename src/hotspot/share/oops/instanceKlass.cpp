@@ -44,6 +44,7 @@
 #include "code/codeCache.hpp"
 #include "code/dependencyContext.hpp"
 #include "compiler/compilationPolicy.hpp"
+#include "compiler/compilationWarmup.hpp"
 #include "compiler/compileBroker.hpp"
 #include "gc/shared/collectedHeap.inline.hpp"
 #include "interpreter/oopMapCache.hpp"
@@ -956,6 +957,10 @@ bool InstanceKlass::link_class_impl(TRAPS) {
         MutexLocker ml(THREAD, Compile_lock);
         set_init_state(linked);
 
+        // Becoming linked makes this class visible to vtable-based CHA, so
+        // stamp a hierarchy modification just like add_to_hierarchy() does.
+        SystemDictionary::notice_modification();
+
         // Now flush all code that assume the class is not linked.
         if (Universe::is_fully_initialized()) {
           CodeCache::flush_dependents_on(this);
@@ -1187,6 +1192,9 @@ void InstanceKlass::initialize_impl(TRAPS) {
   if (!HAS_PENDING_EXCEPTION) {
     set_initialization_state_and_notify(fully_initialized, CHECK);
     debug_only(vtable().verify(tty, true);)
+
+    // Enqueue any compilations recorded for this class in a previous run
+    CompilationWarmup::notify_klass_initialized(this, jt);
   }
   else {
     // Step 10 and 11
@@ -2548,6 +2556,7 @@ void InstanceKlass::remove_unshareable_info() {
   _breakpoints = NULL;
   _previous_versions = NULL;
   _cached_class_file = NULL;
+  _reconstituted_class_file = NULL;
   _jvmti_cached_class_field_map = NULL;
 #endif
 
@@ -2776,6 +2785,7 @@ void InstanceKlass::release_C_heap_structures(bool release_constant_pool) {
     os::free(_cached_class_file);
     _cached_class_file = NULL;
   }
+  clear_reconstituted_class_file();
 #endif
 
   FREE_C_HEAP_ARRAY(char, _source_debug_extension);
@@ -4232,6 +4242,22 @@ jint InstanceKlass::get_cached_class_file_len() {
 unsigned char * InstanceKlass::get_cached_class_file_bytes() {
   return VM_RedefineClasses::get_cached_class_file_bytes(_cached_class_file);
 }
+
+JvmtiCachedClassFileData* InstanceKlass::get_reconstituted_class_file() const {
+  return Atomic::load(&_reconstituted_class_file);
+}
+
+bool InstanceKlass::try_set_reconstituted_class_file(JvmtiCachedClassFileData* data) {
+  return Atomic::cmpxchg(&_reconstituted_class_file, (JvmtiCachedClassFileData*)NULL, data) == NULL;
+}
+
+void InstanceKlass::clear_reconstituted_class_file() {
+  JvmtiCachedClassFileData* reconstituted = Atomic::load(&_reconstituted_class_file);
+  if (reconstituted != NULL) {
+    os::free(reconstituted);
+    Atomic::store(&_reconstituted_class_file, (JvmtiCachedClassFileData*)NULL);
+  }
+}
 #endif
 
 // Make a step iterating over the class hierarchy under the root class.
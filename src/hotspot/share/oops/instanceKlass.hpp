@@ -266,6 +266,9 @@ class InstanceKlass: public Klass {
   // JVMTI fields can be moved to their own structure - see 6315920
   // JVMTI: cached class file, before retransformable agent modified it in CFLH
   JvmtiCachedClassFileData* _cached_class_file;
+  // JVMTI: class file bytes reconstituted from the VM representation for
+  // RetransformClasses, stale once this class is redefined
+  JvmtiCachedClassFileData* volatile _reconstituted_class_file;
 #endif
 
 #if INCLUDE_JVMTI
@@ -807,6 +810,14 @@ public:
   jint get_cached_class_file_len();
   unsigned char * get_cached_class_file_bytes();
 
+  // JVMTI: Support for caching class file bytes reconstituted from the VM
+  // representation for RetransformClasses. Installed racily by retransforming
+  // threads; the loser of the race frees its copy. Cleared when the class is
+  // redefined, which happens in a safepoint.
+  JvmtiCachedClassFileData* get_reconstituted_class_file() const;
+  bool try_set_reconstituted_class_file(JvmtiCachedClassFileData* data);
+  void clear_reconstituted_class_file();
+
   // JVMTI: Support for caching of field indices, types, and offsets
   void set_jvmti_cached_class_field_map(JvmtiCachedClassFieldMap* descriptor) {
     _jvmti_cached_class_field_map = descriptor;
@@ -34,6 +34,7 @@
 #include "oops/klass.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
@@ -87,7 +88,12 @@ ALWAYSINLINE void InstanceKlass::oop_oop_iterate_oop_map(OopMapBlock* map, oop o
   T* p         = obj->field_addr<T>(map->offset());
   T* const end = p + map->count();
 
+  // The oop maps are a run-length encoding of the reference fields, so
+  // pointer-dense objects are scanned as a few long strides.  Prefetch
+  // ahead within the stride to hide the field loads on large objects.
+  const intx interval = PrefetchScanIntervalInBytes;
   for (; p < end; ++p) {
+    Prefetch::read(p, interval);
     Devirtualizer::do_oop(closure, p);
   }
 }
@@ -121,7 +127,9 @@ ALWAYSINLINE void InstanceKlass::oop_oop_iterate_oop_map_bounded(OopMapBlock* ma
     end = h;
   }
 
+  const intx interval = PrefetchScanIntervalInBytes;
   for (;p < end; ++p) {
+    Prefetch::read(p, interval);
     Devirtualizer::do_oop(closure, p);
   }
 }
@@ -57,6 +57,15 @@
 //
 //    We assume that stack/thread pointers have the lowest two bits cleared.
 //
+//  - with -XX:+UseFastLocking there are no displaced headers on stacks:
+//    the "locked" state instead keeps the real header in place with the
+//    lock bits cleared (fast-locked), and ownership is recorded in the
+//    owning thread's LockStack. INFLATING() is never installed in this
+//    mode, because the header of a fast-locked object can be read directly
+//    from its mark word.
+//
+//    [header          | 00]  fast-locked        regular object header, lock bits clear
+//
 //  - INFLATING() is a distinguished markword value of all zeros that is
 //    used when inflating an existing stack-lock into an ObjectMonitor.
 //    See below for is_being_inflated() and INFLATING().
@@ -184,6 +193,17 @@ class markWord {
   bool has_locker() const {
     return ((value() & lock_mask_in_place) == locked_value);
   }
+  // Fast-locking (-XX:+UseFastLocking) reuses the locked_value lock bits but
+  // keeps the rest of the header in place instead of displacing it to the
+  // stack; is_fast_locked()/has_locker() then denote the same mark state.
+  bool is_fast_locked() const {
+    assert(UseFastLocking, "only with fast-locking");
+    return ((value() & lock_mask_in_place) == locked_value);
+  }
+  markWord set_fast_locked() const {
+    assert(UseFastLocking, "only with fast-locking");
+    return markWord(value() & ~lock_mask_in_place);
+  }
   BasicLock* locker() const {
     assert(has_locker(), "check");
     return (BasicLock*) value();
@@ -197,6 +217,11 @@ class markWord {
     return (ObjectMonitor*) (value() ^ monitor_value);
   }
   bool has_displaced_mark_helper() const {
+    if (UseFastLocking) {
+      // A fast-locked mark keeps the header bits in place; only an
+      // inflated monitor displaces them.
+      return has_monitor();
+    }
     return ((value() & unlocked_value) == 0);
   }
   markWord displaced_mark_helper() const;
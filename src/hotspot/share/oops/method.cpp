@@ -107,6 +107,7 @@ Method::Method(ConstMethod* xconst, AccessFlags access_flags, Symbol* name) {
   set_has_injected_profile(false);
   set_method_data(NULL);
   clear_method_counters();
+  _early_invocation_count = 0;
   set_vtable_index(Method::garbage_vtable_index);
 
   // Fix and bury in Method*
@@ -95,6 +95,11 @@ class Method : public Metadata {
   };
   mutable u2 _flags;
 
+  // Number of interpreted invocations observed before MethodCounters are
+  // allocated, when MethodCountersDeferThreshold is set. Updates are racy;
+  // a lost increment just defers the allocation by one more invocation.
+  u2 _early_invocation_count;
+
   JFR_ONLY(DEFINE_TRACE_FLAG;)
 
 #ifndef PRODUCT
@@ -923,6 +928,15 @@ public:
     return _method_counters;
   }
 
+  // Returns the previous value, saturating at the type maximum.
+  u2 inc_early_invocation_count() {
+    u2 count = _early_invocation_count;
+    if (count < max_jushort) {
+      _early_invocation_count = count + 1;
+    }
+    return count;
+  }
+
   bool   is_not_c1_compilable() const         { return access_flags().is_not_c1_compilable();  }
   void  set_not_c1_compilable()               {       _access_flags.set_not_c1_compilable();   }
   void clear_not_c1_compilable()              {       _access_flags.clear_not_c1_compilable(); }
@@ -28,9 +28,9 @@
 #include "runtime/handles.inline.hpp"
 
 MethodCounters::MethodCounters(const methodHandle& mh) :
+  _nmethod_age(INT_MAX),
   _prev_time(0),
   _rate(0),
-  _nmethod_age(INT_MAX),
   _highest_comp_level(0),
   _highest_osr_comp_level(0)
 {
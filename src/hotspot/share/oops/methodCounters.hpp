@@ -29,34 +29,43 @@
 #include "compiler/compilerDefinitions.hpp"
 #include "compiler/compilerOracle.hpp"
 #include "interpreter/invocationCounter.hpp"
+#include "memory/padded.hpp"
 #include "utilities/align.hpp"
 
 class MethodCounters : public Metadata {
  friend class VMStructs;
  friend class JVMCIVMStructs;
  private:
+  // Fields are grouped by writer. The group below is hammered by mutator
+  // threads - the interpreter bumps the counters on every activation and
+  // backedge, compiled code decrements the nmethod age - while the group
+  // after the pad is written by compiler threads sampling method rates when
+  // they scan the compile queue (CompilationPolicy::update_rate). Without
+  // the split, every rate sample during warmup invalidates the cache line
+  // holding the invocation counters on all cores running the method.
   InvocationCounter _invocation_counter;         // Incremented before each activation of the method - used to trigger frequency-based optimizations
   InvocationCounter _backedge_counter;           // Incremented before each backedge taken - used to trigger frequency-based optimizations
-  jlong             _prev_time;                   // Previous time the rate was acquired
-  float             _rate;                        // Events (invocation and backedge counter increments) per millisecond
+  // NMethod age is a counter for warm methods detection in the code cache sweeper.
+  // The counter is reset by the sweeper and is decremented by some of the compiled
+  // code. The counter values are interpreted as follows:
+  // 1. (HotMethodDetection..INT_MAX] - initial value, no counters inserted
+  // 2. [1..HotMethodDetectionLimit)  - the method is warm, the counter is used
+  //                                    to figure out which methods can be flushed.
+  // 3. (INT_MIN..0]                  - method is hot and will deopt and get
+  //                                    recompiled without the counters
   int               _nmethod_age;
   int               _invoke_mask;                 // per-method Tier0InvokeNotifyFreqLog
   int               _backedge_mask;               // per-method Tier0BackedgeNotifyFreqLog
-  int               _prev_event_count;            // Total number of events saved at previous callback
 #if COMPILER2_OR_JVMCI
   u2                _interpreter_throwout_count; // Count of times method was exited via exception while interpreting
 #endif
 #if INCLUDE_JVMTI
   u2                _number_of_breakpoints;      // fullspeed debugging support
 #endif
-  // NMethod age is a counter for warm methods detection in the code cache sweeper.
-  // The counter is reset by the sweeper and is decremented by some of the compiled
-  // code. The counter values are interpreted as follows:
-  // 1. (HotMethodDetection..INT_MAX] - initial value, no counters inserted
-  // 2. [1..HotMethodDetectionLimit)  - the method is warm, the counter is used
-  //                                    to figure out which methods can be flushed.
-  // 3. (INT_MIN..0]                  - method is hot and will deopt and get
-  //                                    recompiled without the counters
+  DEFINE_PAD_MINUS_SIZE(0, DEFAULT_CACHE_LINE_SIZE, 0);
+  jlong             _prev_time;                   // Previous time the rate was acquired
+  float             _rate;                        // Events (invocation and backedge counter increments) per millisecond
+  int               _prev_event_count;            // Total number of events saved at previous callback
   u1                _highest_comp_level;          // Highest compile level this method has ever seen.
   u1                _highest_osr_comp_level;      // Same for OSR level
 
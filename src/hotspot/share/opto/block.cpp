@@ -1636,7 +1636,13 @@ void PhaseBlockLayout::merge_traces(bool fall_thru_only) {
     } else if (e->state() == CFGEdge::open) {
       // Append traces, even without a fall-thru connection.
       // But leave root entry at the beginning of the block list.
-      if (targ_trace != trace(_cfg.get_root_block())) {
+      // Traces headed by an uncommon block reached over an infrequent edge
+      // (trap triggers, slow paths) are also left unconnected: the frequency
+      // sort in reorder_traces() then sinks them past all warmer traces, so
+      // they are placed out of line at the end of the method instead of
+      // being dragged in between hot blocks by the edge.
+      if (targ_trace != trace(_cfg.get_root_block()) &&
+          !(e->infrequent() && _cfg.is_uncommon(targ_block))) {
         e->set_state(CFGEdge::connected);
         src_trace->append(targ_trace);
         union_traces(src_trace, targ_trace);
@@ -112,6 +112,26 @@ static bool is_unboxing_method(ciMethod* callee_method, Compile* C) {
   return C->eliminate_boxing() && callee_method->is_unboxing_method();
 }
 
+/**
+ * Does the callee take or return a boxed primitive? Inlining such
+ * methods keeps box/unbox pairs inside one compilation unit so that
+ * escape analysis can eliminate the box allocation.
+ */
+static bool has_boxed_signature_with_ea(ciMethod* callee_method, Compile* C) {
+  if (!C->eliminate_boxing()) {
+    return false;
+  }
+  ciSignature* sig = callee_method->signature();
+  for (int i = 0; i < sig->count(); i++) {
+    ciType* t = sig->type_at(i);
+    if (t->is_instance_klass() && t->as_instance_klass()->is_box_klass()) {
+      return true;
+    }
+  }
+  ciType* ret = sig->return_type();
+  return ret->is_instance_klass() && ret->as_instance_klass()->is_box_klass();
+}
+
 // positive filter: should callee be inlined?
 bool InlineTree::should_inline(ciMethod* callee_method, ciMethod* caller_method,
                                int caller_bci, NOT_PRODUCT_ARG(bool& should_delay) ciCallProfile& profile) {
@@ -167,6 +187,7 @@ bool InlineTree::should_inline(ciMethod* callee_method, ciMethod* caller_method,
   // bump the max size if the call is frequent
   if ((freq >= InlineFrequencyRatio) ||
       is_unboxing_method(callee_method, C) ||
+      has_boxed_signature_with_ea(callee_method, C) ||
       is_init_with_ea(callee_method, caller_method, C)) {
 
     max_inline_size = C->freq_inline_size();
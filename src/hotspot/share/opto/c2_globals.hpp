@@ -189,6 +189,10 @@
   product(bool, PostLoopMultiversioning, false, EXPERIMENTAL,               \
            "Multi versioned post loops to eliminate range checks")          \
                                                                             \
+  product(bool, UseLoopDataPrefetch, false, EXPERIMENTAL,                   \
+           "Insert software prefetches for strided loads in inner loops, "  \
+           "AllocatePrefetchDistance bytes ahead of the access")            \
+                                                                            \
   notproduct(bool, TraceSuperWordLoopUnrollAnalysis, false,                 \
           "Trace what Superword Level Parallelism analysis applies")        \
                                                                             \
@@ -345,6 +349,10 @@
   product(bool, SuperWordReductions, true,                                  \
           "Enable reductions support in superword.")                        \
                                                                             \
+  product(bool, SuperWordGatherLoads, false, EXPERIMENTAL,                  \
+          "Vectorize indirectly indexed loads in superword as vector "      \
+          "gather operations on platforms that support them")               \
+                                                                            \
   product(bool, UseCMoveUnconditionally, false,                             \
           "Use CMove (scalar and vector) ignoring profitability test.")     \
                                                                             \
@@ -421,6 +429,10 @@
           "Maximum number of nodes")                                        \
           range(1000, max_jint / 3)                                         \
                                                                             \
+  product(size_t, CompileMemoryLimit, 0, DIAGNOSTIC,                        \
+          "Bail out of a compilation once its arenas exceed this many "     \
+          "bytes, leaving the method at a lower tier (0 means no limit)")   \
+                                                                            \
   product(intx, NodeLimitFudgeFactor, 2000,                                 \
           "Fudge Factor for certain optimizations")                         \
           constraint(NodeLimitFudgeFactorConstraintFunc, AfterErgo)         \
@@ -694,6 +694,12 @@ bool C2Compiler::is_intrinsic_supported(const methodHandle& method, bool is_virt
   case vmIntrinsics::_bigIntegerRightShiftWorker:
   case vmIntrinsics::_bigIntegerLeftShiftWorker:
   case vmIntrinsics::_vectorizedMismatch:
+  case vmIntrinsics::_ArraysHashCodeB:
+  case vmIntrinsics::_ArraysHashCodeS:
+  case vmIntrinsics::_ArraysHashCodeC:
+  case vmIntrinsics::_ArraysHashCodeI:
+  case vmIntrinsics::_StringLatin1HashCode:
+  case vmIntrinsics::_StringUTF16HashCode:
   case vmIntrinsics::_ghash_processBlocks:
   case vmIntrinsics::_base64_encodeBlock:
   case vmIntrinsics::_base64_decodeBlock:
@@ -1675,6 +1675,19 @@ void AllocateNode::compute_MemBar_redundancy(ciMethod* initializer)
 }
 Node *AllocateNode::make_ideal_mark(PhaseGVN *phase, Node* obj, Node* control, Node* mem) {
   Node* klass_node = in(AllocateNode::KlassNode);
+  // The prototype header is installed when the Klass is created and never
+  // changes afterwards. If the allocated klass is known at compile time the
+  // mark word is a constant and the header can be initialized with an
+  // immediate store; consecutive allocations then set up their headers
+  // without a dependent load from the Klass each.
+  const TypeKlassPtr* tklass = phase->type(klass_node)->isa_klassptr();
+  if (tklass != NULL && tklass->klass_is_exact() &&
+      tklass->klass() != NULL && tklass->klass()->is_loaded()) {
+    uintptr_t proto = tklass->klass()->prototype_header();
+    if (proto != 0) {
+      return phase->MakeConX((intptr_t)proto);
+    }
+  }
   Node* proto_adr = phase->transform(new AddPNode(klass_node, klass_node, phase->MakeConX(in_bytes(Klass::prototype_header_offset()))));
   Node* mark_node = LoadNode::make(*phase, control, mem, proto_adr, TypeRawPtr::BOTTOM, TypeX_X, TypeX_X->basic_type(), MemNode::unordered);
   return mark_node;
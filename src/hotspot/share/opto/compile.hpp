@@ -767,11 +767,24 @@ class Compile : public Phase {
     if (live_nodes() + margin > max_node_limit()) {
       record_method_not_compilable(reason);
       return true;
+    } else if (CompileMemoryLimit != 0 && arena_footprint() > CompileMemoryLimit) {
+      record_method_not_compilable("compile memory limit exceeded");
+      return true;
     } else {
       return false;
     }
   }
 
+  // Combined footprint of the arenas owned by this compilation, used to
+  // enforce CompileMemoryLimit. A pathological method keeps the method at
+  // a lower tier instead of growing the arenas without bound.
+  size_t arena_footprint() const {
+    return _comp_arena.size_in_bytes() +
+           _node_arena.size_in_bytes() +
+           _old_arena.size_in_bytes() +
+           _Compile_types.size_in_bytes();
+  }
+
   // Node management
   uint         unique() const              { return _unique; }
   uint         next_unique()               { return _unique++; }
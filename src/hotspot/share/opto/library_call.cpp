@@ -589,6 +589,21 @@ bool LibraryCallKit::try_to_inline(int predicate) {
   case vmIntrinsics::_vectorizedMismatch:
     return inline_vectorizedMismatch();
 
+  case vmIntrinsics::_ArraysHashCodeB:
+    return inline_arrays_hashcode(T_BYTE, T_BYTE, 1);
+  case vmIntrinsics::_ArraysHashCodeS:
+    return inline_arrays_hashcode(T_SHORT, T_SHORT, 1);
+  case vmIntrinsics::_ArraysHashCodeC:
+    return inline_arrays_hashcode(T_CHAR, T_CHAR, 1);
+  case vmIntrinsics::_ArraysHashCodeI:
+    return inline_arrays_hashcode(T_INT, T_INT, 1);
+  case vmIntrinsics::_StringLatin1HashCode:
+    // Latin-1 characters hash as unsigned bytes.
+    return inline_arrays_hashcode(T_BYTE, T_BOOLEAN, 0);
+  case vmIntrinsics::_StringUTF16HashCode:
+    // UTF-16 characters are stored two bytes each in a byte array.
+    return inline_arrays_hashcode(T_BYTE, T_CHAR, 0);
+
   case vmIntrinsics::_ghash_processBlocks:
     return inline_ghash_processBlocks();
   case vmIntrinsics::_base64_encodeBlock:
@@ -3946,6 +3961,13 @@ bool LibraryCallKit::inline_native_hashcode(bool is_virtual, bool is_static) {
   result_mem->init_req(_fast_path, init_mem);
 
   // Generate code for the slow case.  We make a call to hashCode().
+  // Note that this call is what keeps identity-hashed objects from being
+  // scalar replaced: the receiver escapes into the call, so escape analysis
+  // marks the allocation GlobalEscape.  Avoiding that would require
+  // materializing a stable identity hash for an eliminated allocation
+  // (consistent across reexecution and deoptimization), not just tweaking
+  // the escape state.  Lock elimination is unaffected either way; it keys
+  // on the escape state of the locked object, not on its hash state.
   set_control(_gvn.transform(slow_region));
   if (!stopped()) {
     // No need for PreserveJVMState, because we're using up the present state.
@@ -5396,6 +5418,47 @@ bool LibraryCallKit::inline_bigIntegerShift(bool isRightShift) {
   return true;
 }
 
+//-------------inline_arrays_hashcode---------------------------------
+//
+// Computes a 31-polynomial hash over a primitive array via a SIMD stub:
+//   result = initial * 31^cnt + sum(a[i] * 31^(cnt - 1 - i))
+//
+// array_elem_bt is the storage type of the array, hash_elem_bt selects the
+// stub kernel (element width and signedness of the hashed values). They
+// differ for the String cases, where chars or unsigned bytes are hashed
+// out of a byte array.
+bool LibraryCallKit::inline_arrays_hashcode(BasicType array_elem_bt, BasicType hash_elem_bt,
+                                            int initial_value) {
+  assert(UseArraysHashCodeIntrinsic, "not implemented on this platform");
+
+  address stub_addr = StubRoutines::arrays_hashcode(hash_elem_bt);
+  if (stub_addr == NULL) {
+    return false;
+  }
+
+  Node* ary = argument(0);
+  // A null argument is rare; let the uncommon trap re-execute the bytecode,
+  // which handles it (Arrays.hashCode(null) returns 0).
+  ary = null_check(ary);
+  if (stopped()) {
+    return true;
+  }
+
+  Node* cnt = load_array_length(ary);
+  if (array_elem_bt == T_BYTE && hash_elem_bt == T_CHAR) {
+    // UTF-16: two bytes of backing store per hashed char.
+    cnt = _gvn.transform(new URShiftINode(cnt, intcon(1)));
+  }
+  Node* ary_start = array_element_address(ary, intcon(0), array_elem_bt);
+
+  Node* call = make_runtime_call(RC_LEAF,
+                                 OptoRuntime::arraysHashCode_Type(),
+                                 stub_addr, "arrays_hashcode", TypePtr::BOTTOM,
+                                 ary_start, cnt, intcon(initial_value));
+  set_result(_gvn.transform(new ProjNode(call, TypeFunc::Parms)));
+  return true;
+}
+
 //-------------inline_vectorizedMismatch------------------------------
 bool LibraryCallKit::inline_vectorizedMismatch() {
   assert(UseVectorizedMismatchIntrinsic, "not implemented on this platform");
@@ -303,6 +303,7 @@ class LibraryCallKit : public GraphKit {
   bool inline_montgomeryMultiply();
   bool inline_montgomerySquare();
   bool inline_bigIntegerShift(bool isRightShift);
+  bool inline_arrays_hashcode(BasicType array_elem_bt, BasicType hash_elem_bt, int initial_value);
   bool inline_vectorizedMismatch();
   bool inline_fma(vmIntrinsics::ID id);
   bool inline_character_compare(vmIntrinsics::ID id);
@@ -2815,6 +2815,17 @@ Node* PhaseIdealLoop::add_range_check_predicate(IdealLoopTree* loop, CountedLoop
 
 //------------------------------do_range_check---------------------------------
 // Eliminate range-checks and other trip-counter vs loop-invariant tests.
+//
+// Loops indexing several arrays are handled one check at a time: each
+// eliminated check tightens the shared pre- and main-loop limits (see
+// add_constraint), so the main loop ends up covering the intersection of all
+// the per-array safe iteration ranges. There is no fused predicate comparing
+// against a combined bound such as min of the array lengths - the graph does
+// not represent any relation between distinct LoadRange nodes, so a single
+// combined guard could not be proven stronger than the per-array skeleton
+// predicates emitted below. Checks that survive here (e.g. offsets pinned
+// below the zero-trip guard by a previous round) are left for loop
+// predication to hoist individually.
 int PhaseIdealLoop::do_range_check(IdealLoopTree *loop, Node_List &old_new) {
 #ifndef PRODUCT
   if (PrintOpto && VerifyLoopOptimizations) {
@@ -4192,3 +4203,132 @@ bool PhaseIdealLoop::intrinsify_fill(IdealLoopTree* lpt) {
 
   return true;
 }
+
+//=============================================================================
+// Process all inner counted loops and insert software prefetches for
+// strided loads.
+void PhaseIdealLoop::do_insert_data_prefetches() {
+  for (LoopTreeIterator iter(_ltree_root); !iter.done(); iter.next()) {
+    IdealLoopTree* lpt = iter.current();
+    insert_data_prefetches(lpt);
+  }
+}
+
+// Insert software prefetches for strided loads in an inner counted loop.
+// Loads off a loop-invariant base whose address varies with the trip counter
+// walk memory with a fixed stride; when the stride exceeds what the hardware
+// prefetchers track, such loops are limited by demand-miss latency. Prefetch
+// AllocatePrefetchDistance bytes ahead of each such access, reusing the
+// allocation prefetch node. The prefetches are hung off the I/O edge of the
+// loop safepoint, which keeps them alive and ordered without touching the
+// memory graph.
+void PhaseIdealLoop::insert_data_prefetches(IdealLoopTree* lpt) {
+  // Only for counted inner loops with a known stride direction
+  if (!lpt->is_counted() || !lpt->is_innermost()) {
+    return;
+  }
+  CountedLoopNode* head = lpt->_head->as_CountedLoop();
+  if (!head->is_valid_counted_loop(T_INT) ||
+      head->is_pre_loop() || head->is_post_loop()) {
+    return;
+  }
+  if (AllocatePrefetchDistance <= 0) {
+    return;
+  }
+  // The node is typed as a raw memory producer when AllocatePrefetchStyle == 3
+  // (BIS-style allocation prefetch), only the I/O variant is usable here.
+  if (AllocatePrefetchStyle == 3) {
+    return;
+  }
+
+  // Find the safepoint that carries the prefetches on its I/O edge. For a
+  // strip mined loop that is the safepoint of the outer loop; otherwise look
+  // for a safepoint in the loop body. Loops that had their safepoint removed
+  // have a provably short trip count and are not worth prefetching for.
+  SafePointNode* sfpt = NULL;
+  Node* pin_ctrl = NULL;
+  if (head->is_strip_mined()) {
+    sfpt = head->outer_safepoint();
+    // The safepoint executes once per outer iteration; the prefetches still
+    // execute once per inner iteration, at the loop exit test.
+    pin_ctrl = head->loopexit()->in(0);
+  } else {
+    for (uint i = 0; i < lpt->_body.size(); i++) {
+      Node* n = lpt->_body.at(i);
+      if (n->Opcode() == Op_SafePoint) {
+        sfpt = n->as_SafePoint();
+        break;
+      }
+    }
+    if (sfpt == NULL) {
+      return;
+    }
+    pin_ctrl = sfpt->in(TypeFunc::Control);
+  }
+
+  // Already processed in a previous round of loop opts
+  if (sfpt->in(TypeFunc::I_O)->Opcode() == Op_PrefetchAllocation) {
+    return;
+  }
+
+  // Prefetch in the direction the loop walks memory
+  const intptr_t delta = head->stride_con() > 0 ? (intptr_t)AllocatePrefetchDistance
+                                                : -(intptr_t)AllocatePrefetchDistance;
+
+  // More than a few independent prefetch streams compete with the demand
+  // loads for load ports and fill buffers.
+  const int max_prefetches = 4;
+  int prefetches = 0;
+
+  Node_List prefetched_adrs;
+  Node* i_o = sfpt->in(TypeFunc::I_O);
+  for (uint i = 0; i < lpt->_body.size() && prefetches < max_prefetches; i++) {
+    Node* n = lpt->_body.at(i);
+    if (!n->is_Load()) {
+      continue;
+    }
+    Node* adr = n->in(MemNode::Address);
+    if (!adr->is_AddP()) {
+      continue;
+    }
+    // A loop-invariant address hits the same cache line every iteration
+    if (lpt->is_invariant(adr)) {
+      continue;
+    }
+    // An invariant base rules out pointer chasing, where the next address
+    // is unknown until the current load retires
+    Node* base = adr->in(AddPNode::Base);
+    if (!lpt->is_invariant(base)) {
+      continue;
+    }
+    // The address must be available where the prefetch is pinned
+    Node* adr_ctrl = has_ctrl(adr) ? get_ctrl(adr) : adr;
+    if (!is_dominator(adr_ctrl, pin_ctrl)) {
+      continue;
+    }
+    // One prefetch per address expression
+    bool seen = false;
+    for (uint j = 0; j < prefetched_adrs.size(); j++) {
+      if (prefetched_adrs.at(j) == adr) {
+        seen = true;
+        break;
+      }
+    }
+    if (seen) {
+      continue;
+    }
+    prefetched_adrs.push(adr);
+
+    Node* pf_adr = new AddPNode(base, adr, _igvn.MakeConX(delta));
+    register_new_node(pf_adr, pin_ctrl);
+    Node* pf = new PrefetchAllocationNode(i_o, pf_adr);
+    pf->init_req(0, pin_ctrl);
+    register_new_node(pf, pin_ctrl);
+    i_o = pf;
+    prefetches++;
+  }
+
+  if (prefetches > 0) {
+    _igvn.replace_input_of(sfpt, TypeFunc::I_O, i_o);
+  }
+}
@@ -4585,6 +4585,12 @@ void PhaseIdealLoop::build_and_optimize() {
     }
   }
 
+  // Insert software prefetches for strided loads once the loop shapes are
+  // final, so the prefetches are not duplicated by unrolling or cloning.
+  if (UseLoopDataPrefetch && C->has_loops() && !C->major_progress()) {
+    do_insert_data_prefetches();
+  }
+
   // disable assert until issue with split_flow_path is resolved (6742111)
   // assert(!_has_irreducible_loops || C->parsed_irreducible_loop() || C->is_osr_compilation(),
   //        "shouldn't introduce irreducible loops");
@@ -1513,6 +1513,10 @@ public:
   bool match_fill_loop(IdealLoopTree* lpt, Node*& store, Node*& store_value,
                        Node*& shift, Node*& offset);
 
+  // Insertion of software prefetches for strided loads in inner loops
+  void do_insert_data_prefetches();
+  void insert_data_prefetches(IdealLoopTree* lpt);
+
 private:
   // Return a type based on condition control flow
   const TypeInt* filtered_type( Node *n, Node* n_ctrl);
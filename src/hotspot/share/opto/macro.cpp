@@ -24,8 +24,10 @@
 
 #include "precompiled.hpp"
 #include "compiler/compileLog.hpp"
+#include "compiler/compilerEvent.hpp"
 #include "gc/shared/collectedHeap.inline.hpp"
 #include "gc/shared/tlab_globals.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "libadt/vectset.hpp"
 #include "memory/universe.hpp"
 #include "opto/addnode.hpp"
@@ -1008,6 +1010,32 @@ void PhaseMacroExpand::process_users_of_allocation(CallNode *alloc) {
   }
 }
 
+// Post a JFR event recording whether a box allocation was eliminated.
+// The call is either the boxing CallStaticJava itself or an Allocate
+// left behind by an inlined box method; report the caller frame where
+// the boxed value is used so events can be aggregated by site.
+static void post_box_elimination_event(Compile* C, CallNode* call, bool eliminated) {
+  EventCompilerBoxElimination event;
+  if (!event.should_commit()) {
+    return;
+  }
+  JVMState* jvms = call->jvms();
+  if (jvms == NULL || jvms->method() == NULL) {
+    return;
+  }
+  const char* box_type;
+  if (call->is_CallStaticJava()) {
+    box_type = call->as_CallStaticJava()->method()->holder()->name()->as_utf8();
+  } else {
+    assert(jvms->method()->is_boxing_method(), "allocation must come from an inlined box method");
+    box_type = jvms->method()->holder()->name()->as_utf8();
+  }
+  if (jvms->method()->is_boxing_method() && jvms->caller() != NULL && jvms->caller()->method() != NULL) {
+    jvms = jvms->caller();
+  }
+  CompilerEvent::BoxEliminationEvent::post(event, C->compile_id(), jvms->method()->get_Method(), jvms->bci(), box_type, eliminated);
+}
+
 bool PhaseMacroExpand::eliminate_allocate_node(AllocateNode *alloc) {
   // If reallocation fails during deoptimization we'll pop all
   // interpreter frames for this compiled frame and that won't play
@@ -1064,6 +1092,11 @@ bool PhaseMacroExpand::eliminate_allocate_node(AllocateNode *alloc) {
 
   process_users_of_allocation(alloc);
 
+  if (boxing_alloc && alloc->jvms() != NULL &&
+      alloc->jvms()->method() != NULL && alloc->jvms()->method()->is_boxing_method()) {
+    post_box_elimination_event(C, alloc, true);
+  }
+
 #ifndef PRODUCT
   if (PrintEliminateAllocations) {
     if (alloc->is_AllocateArray())
@@ -1105,6 +1138,8 @@ bool PhaseMacroExpand::eliminate_boxing_node(CallStaticJavaNode *boxing) {
 
   process_users_of_allocation(boxing);
 
+  post_box_elimination_event(C, boxing, true);
+
 #ifndef PRODUCT
   if (PrintEliminateAllocations) {
     tty->print("++++ Eliminated: %d ", boxing->_idx);
@@ -2406,6 +2441,10 @@ bool PhaseMacroExpand::expand_macro_nodes() {
         _igvn._worklist.push(n);
         success = true;
       } else if (n->Opcode() == Op_CallStaticJava) {
+        if (n->as_CallStaticJava()->is_boxing_method()) {
+          // The boxing call survived escape analysis: its result escapes.
+          post_box_elimination_event(C, n->as_CallStaticJava(), false);
+        }
         // Remove it from macro list and put on IGVN worklist to optimize.
         C->remove_macro_node(n);
         _igvn._worklist.push(n);
@@ -2549,6 +2588,13 @@ bool PhaseMacroExpand::expand_macro_nodes() {
     }
     switch (n->class_id()) {
     case Node::Class_Allocate:
+      if (n->as_Allocate()->jvms() != NULL &&
+          n->as_Allocate()->jvms()->method() != NULL &&
+          n->as_Allocate()->jvms()->method()->is_boxing_method()) {
+        // A box allocation from an inlined valueOf() that could not be
+        // scalar replaced is expanded as a regular allocation.
+        post_box_elimination_event(C, n->as_Allocate(), false);
+      }
       expand_allocate(n->as_Allocate());
       break;
     case Node::Class_AllocateArray:
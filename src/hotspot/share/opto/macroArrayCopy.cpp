@@ -633,7 +633,31 @@ Node* PhaseMacroExpand::generate_arraycopy(ArrayCopyNode *ac, AllocateArrayNode*
       // Test S[] against D[], not S against D, because (probably)
       // the secondary supertype cache is less busy for S[] than S.
       // This usually only matters when D is an interface.
-      Node* not_subtype_ctrl = Phase::gen_subtype_check(src_klass, dest_klass, ctrl, mem, _igvn);
+      Node* not_subtype_ctrl = C->top();
+      if (src_klass != dest_klass && !_igvn.type(dest_klass)->singleton()) {
+        // Neither klass is known statically. The common case by far is a
+        // copy between arrays of the same type (S[] to S[]), for which the
+        // subtype check trivially passes. Both klasses were just loaded
+        // from the array headers (a narrow id each with compact headers),
+        // so guard the full check with a plain equality compare and only
+        // run the display walk (and the per-element checking stub behind
+        // it) when the klasses actually differ.
+        Node* cmp_klass = transform_later(new CmpPNode(src_klass, dest_klass));
+        Node* bol_klass = transform_later(new BoolNode(cmp_klass, BoolTest::ne));
+        Node* diff_klass = generate_guard(ctrl, bol_klass, NULL, PROB_UNLIKELY_MAG(2));
+        // *ctrl is now the same-klass fast path
+        if (diff_klass != NULL) {
+          Node* subtype_ctrl = diff_klass;
+          not_subtype_ctrl = Phase::gen_subtype_check(src_klass, dest_klass, &subtype_ctrl, mem, _igvn);
+          RegionNode* subtype_ok = new RegionNode(3);
+          subtype_ok->init_req(1, *ctrl);
+          subtype_ok->init_req(2, subtype_ctrl);
+          transform_later(subtype_ok);
+          *ctrl = subtype_ok;
+        }
+      } else {
+        not_subtype_ctrl = Phase::gen_subtype_check(src_klass, dest_klass, ctrl, mem, _igvn);
+      }
       // Plug failing path into checked_oop_disjoint_arraycopy
       if (not_subtype_ctrl != top()) {
         Node* local_ctrl = not_subtype_ctrl;
@@ -211,8 +211,10 @@ public:
   static const char *regName[];
   // Machine register encodings
   static const unsigned char _regEncode[];
+#ifndef PRODUCT
   // Machine Node names
   const char **_ruleName;
+#endif
   // Rules that are cheaper to rematerialize than to spill
   static const uint _begin_rematerialize;
   static const uint _end_rematerialize;
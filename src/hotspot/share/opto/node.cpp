@@ -2497,6 +2497,19 @@ void Unique_Node_List::remove(Node* n) {
   }
 }
 
+//-----------------------remove_non_members-------------------------------------
+// Remove all entries whose membership bit has been cleared by lazy_remove()
+void Unique_Node_List::remove_non_members() {
+  for (uint i = 0; i < size(); i++) {
+    Node* n = at(i);
+    if (!_in_worklist.test(n->_idx)) {
+      map(i, Node_List::pop());
+      --i;  // Visit popped node
+      // If it was last entry, loop terminates since size() was also reduced
+    }
+  }
+}
+
 //-----------------------remove_useless_nodes----------------------------------
 // Remove useless nodes from worklist
 void Unique_Node_List::remove_useless_nodes(VectorSet &useful) {
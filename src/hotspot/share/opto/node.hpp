@@ -1605,6 +1605,20 @@ public:
   bool member( Node *n ) { return _in_worklist.test(n->_idx) != 0; }
   VectorSet& member_set(){ return _in_worklist; }
 
+  // Lazy removal: only clear the membership bit, the list entry stays in
+  // place until the next call to remove_non_members(). Several removals can
+  // then share a single compaction pass instead of paying for one linear
+  // search each. The node must not be re-pushed before the compaction pass.
+  // Returns true if n was on the list.
+  bool lazy_remove(Node* n) {
+    if (!member(n)) {
+      return false;
+    }
+    _in_worklist.remove(n->_idx);
+    return true;
+  }
+  void remove_non_members();
+
   void push(Node* b) {
     if( !_in_worklist.test_set(b->_idx) )
       Node_List::push(b);
@@ -1357,6 +1357,7 @@ void PhaseIterGVN::remove_globally_dead_node( Node *dead ) {
   };
   assert(_stack.is_empty(), "not empty");
   _stack.push(dead, PROCESS_INPUTS);
+  bool dead_on_worklist = false;
 
   while (_stack.is_nonempty()) {
     dead = _stack.node();
@@ -1432,11 +1433,20 @@ void PhaseIterGVN::remove_globally_dead_node( Node *dead ) {
     } else {
       // Finished disconnecting all input and output edges.
       _stack.pop();
-      // Remove dead node from iterative worklist
-      _worklist.remove(dead);
+      // Remove dead node from iterative worklist. Removal is deferred: only
+      // the membership bit is cleared here, and the list is compacted in a
+      // single pass once the whole dead subgraph has been disconnected.
+      // Removing each node with its own linear search made the disconnection
+      // of large dead subgraphs quadratic in the worklist size.
+      // At this point the node is fully disconnected, so it cannot be found
+      // through edges and re-pushed before the compaction pass below.
+      dead_on_worklist |= _worklist.lazy_remove(dead);
       C->remove_useless_node(dead);
     }
   } // while (_stack.is_nonempty())
+  if (dead_on_worklist) {
+    _worklist.remove_non_members();
+  }
 }
 
 //------------------------------subsume_node-----------------------------------
@@ -272,6 +272,7 @@ private:
 
   static const TypeFunc* bigIntegerShift_Type();
 
+  static const TypeFunc* arraysHashCode_Type();
   static const TypeFunc* vectorizedMismatch_Type();
 
   static const TypeFunc* ghash_processBlocks_Type();
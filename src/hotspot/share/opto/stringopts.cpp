@@ -593,8 +593,17 @@ StringConcat* PhaseStringOpts::build_candidate(CallStaticJavaNode* call) {
       } else {
         if (arg->is_Proj() && arg->in(0)->is_CallStaticJava()) {
           CallStaticJavaNode* csj = arg->in(0)->as_CallStaticJava();
-          if (csj->method() != NULL &&
-              csj->method()->intrinsic_id() == vmIntrinsics::_Integer_toString &&
+          // String.valueOf(int) simply delegates to Integer.toString(int),
+          // so treat both the same way. This is how a concat chain commonly
+          // passes through one small helper method that was not inlined.
+          bool is_int_to_string = false;
+          if (csj->method() != NULL) {
+            is_int_to_string = csj->method()->intrinsic_id() == vmIntrinsics::_Integer_toString ||
+                               (csj->method()->holder() == C->env()->String_klass() &&
+                                csj->method()->name() == ciSymbols::valueOf_name() &&
+                                csj->method()->signature()->as_symbol() == ciSymbols::int_String_signature());
+          }
+          if (is_int_to_string &&
               arg->outcnt() == 1) {
             // _control is the list of StringBuilder calls nodes which
             // will be replaced by new String code after this optimization.
@@ -62,6 +62,8 @@ SuperWord::SuperWord(PhaseIdealLoop* phase) :
   _cmovev_kit(_arena, this),              // map to facilitate CMoveV creation
   _align_to_ref(NULL),                    // memory reference to align vectors to
   _disjoint_ptrs(arena(), 8,  0, OrderedPair::initial), // runtime disambiguated pointer pairs
+  _gather_loads(arena()),                 // gather candidate load set
+  _gather_adr_chain(arena()),             // gather address chain node set
   _dg(_arena),                            // dependence graph
   _visited(arena()),                      // visited node set
   _post_visited(arena()),                 // post visited node set
@@ -504,6 +506,10 @@ bool SuperWord::SLP_extract() {
       return false; // Did not find memory reference to align vectors
     }
 
+    if (SuperWordGatherLoads) {
+      find_gather_pairs();
+    }
+
     extend_packlist();
 
     if (_do_vector_loop_experimental) {
@@ -886,6 +892,169 @@ MemNode* SuperWord::find_align_to_ref(Node_List &memops, int &idx) {
   return NULL;
 }
 
+//------------------------------gather_index---------------------------
+// Match the address of an indirectly indexed load: a chain of AddP nodes off a
+// loop-invariant array base whose offsets are all constant except one scaled
+// index expression. Returns the node producing the element index, or NULL if
+// the address has some other shape. The base and the accumulated constant
+// offset are returned in gather_base and gather_offset. When mark_chain is set,
+// the traversed address nodes are recorded in _gather_adr_chain.
+Node* SuperWord::gather_index(LoadNode* ld, Node** gather_base, jlong* gather_offset, bool mark_chain) {
+  Node* adr = ld->in(MemNode::Address);
+  if (!adr->is_AddP()) {
+    return NULL;
+  }
+  Node* base = adr->in(AddPNode::Base);
+  if (base == NULL || in_bb(base) || base->bottom_type()->isa_aryptr() == NULL) {
+    return NULL;
+  }
+  jlong offset = 0;
+  Node* expr   = NULL;
+  Node* cur    = adr;
+  while (cur->is_AddP()) {
+    if (cur->in(AddPNode::Base) != base) {
+      return NULL;
+    }
+    if (mark_chain) {
+      _gather_adr_chain.set(cur->_idx);
+    }
+    Node* off = cur->in(AddPNode::Offset);
+    const TypeX* t_off = _igvn.type(off)->isa_intptr_t();
+    if (t_off != NULL && t_off->is_con()) {
+      offset += t_off->get_con();
+    } else if (expr == NULL) {
+      expr = off;
+    } else {
+      return NULL; // More than one non-constant offset
+    }
+    cur = cur->in(AddPNode::Address);
+  }
+  if (cur != base || expr == NULL) {
+    return NULL;
+  }
+  // The index must be scaled by exactly the element size, as a vector gather
+  // scales its indices by the element size in hardware.
+  if (expr->Opcode() != Op_LShiftX || !expr->in(2)->is_Con() ||
+      expr->in(2)->get_int() != exact_log2(type2aelembytes(ld->memory_type()))) {
+    return NULL;
+  }
+  if (mark_chain) {
+    _gather_adr_chain.set(expr->_idx);
+  }
+  expr = expr->in(1);
+  if (expr->Opcode() == Op_ConvI2L) {
+    if (mark_chain) {
+      _gather_adr_chain.set(expr->_idx);
+    }
+    expr = expr->in(1);
+  }
+  if (expr->Opcode() == Op_CastII) {
+    if (mark_chain) {
+      _gather_adr_chain.set(expr->_idx);
+    }
+    expr = expr->in(1);
+  }
+  *gather_base   = base;
+  *gather_offset = offset;
+  return expr;
+}
+
+//------------------------------find_gather_pairs---------------------------
+// Create initial pack pairs for loads that are indexed through another array
+// (b[idx[i]]). Such loads have no linear address function of the iv, so
+// find_adjacent_refs cannot pack them. But if their index loads were packed,
+// they can be implemented as a vector gather taking the index vector as
+// operand, provided the platform supports gathers for the element type.
+void SuperWord::find_gather_pairs() {
+  if (vectors_should_be_aligned()) {
+    return; // The pre-loop cannot align an indirectly indexed reference.
+  }
+  for (int i = 0; i < _block.length(); i++) {
+    Node* n1 = _block.at(i);
+    if (!n1->is_Load()) continue;
+    LoadNode* s1 = n1->as_Load();
+    BasicType bt = velt_basic_type(s1);
+    // Gathers exist only for the wider element types.
+    if (bt != T_INT && bt != T_LONG && bt != T_FLOAT && bt != T_DOUBLE) continue;
+    if (Matcher::max_vector_size(bt) < 2) continue;
+    if (!Matcher::match_rule_supported(Op_LoadVectorGather)) continue;
+    if (memory_alignment(s1, 0) != bottom_align) continue; // regular, packable reference
+    if (in_bb(s1->in(MemNode::Memory))) continue;          // slice must be read-only in this loop
+    Node* base1 = NULL;
+    jlong off1  = 0;
+    Node* t1 = gather_index(s1, &base1, &off1);
+    if (t1 == NULL || !in_bb(t1) || velt_basic_type(t1) != T_INT) continue;
+
+    for (int j = 0; j < _block.length(); j++) {
+      Node* n2 = _block.at(j);
+      if (n2 == n1 || !n2->is_Load()) continue;
+      LoadNode* s2 = n2->as_Load();
+      if (!isomorphic(s1, s2) || !independent(s1, s2)) continue;
+      if (exists_at(s1, 0) || exists_at(s2, 1)) continue;
+      if (memory_alignment(s2, 0) != bottom_align) continue;
+      if (s2->in(MemNode::Memory) != s1->in(MemNode::Memory)) continue;
+      Node* base2 = NULL;
+      jlong off2  = 0;
+      Node* t2 = gather_index(s2, &base2, &off2);
+      if (t2 == NULL || base2 != base1 || off2 != off1) continue;
+      // The index loads must already be adjacent lanes, in this order.
+      if (!in_packset(t1, t2)) continue;
+
+      // Lane positions follow the index pack.
+      int align = alignment(t1) / data_size(t1) * data_size(s1);
+      int s1_align = alignment(s1);
+      int s2_align = alignment(s2);
+      if ((s1_align != top_align && s1_align != align) ||
+          (s2_align != top_align && s2_align != align + data_size(s1))) {
+        continue;
+      }
+      Node_List* pair = new Node_List();
+      pair->push(s1);
+      pair->push(s2);
+      _packset.append(pair);
+      set_alignment(s1, s2, align);
+      _gather_loads.set(s1->_idx);
+      _gather_loads.set(s2->_idx);
+      // Mark the address chains: they are replaced by the index vector and
+      // must not be packed or demanded as scalars.
+      gather_index(s1, &base1, &off1, true);
+      gather_index(s2, &base2, &off2, true);
+      break;
+    }
+  }
+
+  if (TraceSuperWord) {
+    tty->print_cr("\nAfter find_gather_pairs");
+    print_packset();
+  }
+}
+
+//------------------------------gather_indices_are_packed-------------------
+// Do the members of gather pack p take their indices from matching lanes of a
+// single index pack? The emitted gather reuses the index pack's vector, so
+// member k of p must be indexed by member k of the index pack.
+bool SuperWord::gather_indices_are_packed(Node_List* p) {
+  Node* base0 = NULL;
+  jlong off0  = 0;
+  Node* idx0 = gather_index(p->at(0)->as_Load(), &base0, &off0);
+  if (idx0 == NULL || !in_bb(idx0)) {
+    return false;
+  }
+  Node_List* ipk = my_pack(idx0);
+  if (ipk == NULL || ipk->size() != p->size() || ipk->at(0) != idx0) {
+    return false;
+  }
+  for (uint k = 1; k < p->size(); k++) {
+    Node* base_k = NULL;
+    jlong off_k  = 0;
+    Node* idx_k = gather_index(p->at(k)->as_Load(), &base_k, &off_k);
+    if (idx_k == NULL || idx_k != ipk->at(k) || base_k != base0 || off_k != off0) {
+      return false;
+    }
+  }
+  return true;
+}
+
 //------------------span_works_for_memory_size-----------------------------
 static bool span_works_for_memory_size(MemNode* mem, int span, int mem_size, int offset) {
   bool span_matches_memory = false;
@@ -1187,6 +1356,12 @@ bool SuperWord::stmts_can_pack(Node* s1, Node* s2, int align) {
     return false; // No vectors for this type
   }
 
+  // Address computations feeding a gather load are replaced by the index
+  // vector operand; do not pack them as scalar operations.
+  if (_gather_adr_chain.test(s1->_idx) || _gather_adr_chain.test(s2->_idx)) {
+    return false;
+  }
+
   if (isomorphic(s1, s2)) {
     if ((independent(s1, s2) && have_similar_inputs(s1, s2)) || reduction(s1, s2)) {
       if (!exists_at(s1, 0) && !exists_at(s2, 1)) {
@@ -2003,6 +2178,8 @@ bool SuperWord::implemented(Node_List* p) {
       } else {
         retValue = ReductionNode::implemented(opc, size, arith_type->basic_type());
       }
+    } else if (is_gather_pack(p)) {
+      retValue = Matcher::match_rule_supported_vector(Op_LoadVectorGather, size, velt_basic_type(p0));
     } else {
       retValue = VectorNode::implemented(opc, size, velt_basic_type(p0));
     }
@@ -2052,6 +2229,11 @@ bool SuperWord::profitable(Node_List* p) {
       return false;
     }
   }
+  // A gather pack is only good if its indices come from matching lanes of a
+  // surviving index pack, whose vector becomes the gather's index operand.
+  if (is_gather_pack(p) && !gather_indices_are_packed(p)) {
+    return false;
+  }
   // Check if reductions are connected
   if (p0->is_reduction()) {
     Node* second_in = p0->in(2);
@@ -2096,6 +2278,11 @@ bool SuperWord::profitable(Node_List* p) {
                  (!_lpt->is_member(_phase->get_loop(_phase->ctrl_or_self(use))) && i == p->size()-1))) {
               continue;
             }
+            // Uses on a gather address chain are replaced by the index vector
+            // operand and need no scalar value.
+            if (_gather_adr_chain.test(use->_idx)) {
+              continue;
+            }
             if (!is_vector_use(use, k)) {
               return false;
             }
@@ -2445,7 +2632,31 @@ bool SuperWord::output() {
       }
       NOT_PRODUCT(if(is_trace_cmov()) {tty->print_cr("SWPointer::output: %d executed first, %d executed last in pack", first->_idx, n->_idx); print_pack(p);})
       int   opc = n->Opcode();
-      if (n->is_Load()) {
+      if (n->is_Load() && is_gather_pack(p)) {
+        // The index pack is emitted before the gather pack (index loads
+        // precede the dependent gather loads in RPO), so the extract inserted
+        // on the address chain now takes the index vector as its input.
+        Node* ctl = n->in(MemNode::Control);
+        Node* mem = first->in(MemNode::Memory);
+        Node* gather_base = NULL;
+        jlong gather_off  = 0;
+        Node* idx = gather_index(n->as_Load(), &gather_base, &gather_off);
+        if (idx == NULL || idx->Opcode() != Op_ExtractI || _igvn.type(idx->in(1))->isa_vect() == NULL) {
+          if (do_reserve_copy()) {
+            NOT_PRODUCT(if(is_trace_loop_reverse() || TraceLoopOpts) {tty->print_cr("SWPointer::output: cannot find index vector for gather, exiting SuperWord");})
+            return false; //and reverse to backup IG
+          }
+          ShouldNotReachHere();
+        }
+        Node* indices = idx->in(1);
+        Node* adr = new AddPNode(gather_base, gather_base, _igvn.MakeConX((intptr_t)gather_off));
+        _igvn.register_new_node_with_optimizer(adr);
+        _phase->set_ctrl(adr, _phase->get_ctrl(gather_base));
+        const TypePtr* atyp = n->adr_type();
+        const TypeVect* vt = TypeVect::make(velt_basic_type(n), vlen);
+        vn = new LoadVectorGatherNode(ctl, mem, adr, atyp, vt, indices);
+        vlen_in_bytes = vn->as_LoadVector()->memory_size();
+      } else if (n->is_Load()) {
         Node* ctl = n->in(MemNode::Control);
         Node* mem = first->in(MemNode::Memory);
         SWPointer p1(n->as_Mem(), this, NULL, false);
@@ -3735,6 +3946,8 @@ void SuperWord::init() {
   _dg.init();
   _packset.clear();
   _disjoint_ptrs.clear();
+  _gather_loads.clear();
+  _gather_adr_chain.clear();
   _block.clear();
   _post_block.clear();
   _data_entry.clear();
@@ -3759,6 +3972,8 @@ void SuperWord::restart() {
   _dg.init();
   _packset.clear();
   _disjoint_ptrs.clear();
+  _gather_loads.clear();
+  _gather_adr_chain.clear();
   _block.clear();
   _post_block.clear();
   _data_entry.clear();
@@ -313,6 +313,9 @@ class SuperWord : public ResourceObj {
 
   GrowableArray<OrderedPair> _disjoint_ptrs; // runtime disambiguated pointer pairs
 
+  VectorSet _gather_loads;     // Loads (by node idx) that are gather candidates
+  VectorSet _gather_adr_chain; // Address nodes (by node idx) between an index load and its gather load
+
   DepGraph _dg; // Dependence graph
 
   // Scratch pads
@@ -451,6 +454,8 @@ class SuperWord : public ResourceObj {
   void set_my_pack(Node* n, Node_List* p)     { int i = bb_idx(n); grow_node_info(i); _node_info.adr_at(i)->_my_pack = p; }
   // is pack good for converting into one vector node replacing 12 nodes of Cmp, Bool, CMov
   bool is_cmov_pack(Node_List* p);
+  // is pack a pack of indirectly indexed (gather) loads?
+  bool is_gather_pack(Node_List* p) { return p->at(0)->is_Load() && _gather_loads.test(p->at(0)->_idx); }
   bool is_cmov_pack_internal_node(Node_List* p, Node* nd) { return is_cmov_pack(p) && !nd->is_CMove(); }
   // For pack p, are all idx operands the same?
   bool same_inputs(Node_List* p, int idx);
@@ -469,6 +474,12 @@ class SuperWord : public ResourceObj {
   void find_adjacent_refs_trace_1(Node* best_align_to_mem_ref, int best_iv_adjustment);
   void print_loop(bool whole);
   #endif
+  // Create initial pack pairs for indirectly indexed (gather) loads.
+  void find_gather_pairs();
+  // Match the address of an indirectly indexed load and return the node producing the element index.
+  Node* gather_index(LoadNode* ld, Node** gather_base, jlong* gather_offset, bool mark_chain = false);
+  // Do the members of gather pack p take their indices from matching lanes of a single index pack?
+  bool gather_indices_are_packed(Node_List* p);
   // Find a memory reference to align the loop induction variable to.
   MemNode* find_align_to_ref(Node_List &memops, int &idx);
   // Calculate loop's iv adjustment for this memory ops.
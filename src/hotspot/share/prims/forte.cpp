@@ -87,6 +87,56 @@ static bool is_decipherable_interpreted_frame(JavaThread* thread,
                                               Method** method_p,
                                               int* bci_p);
 
+// Hard bound on the number of frames examined per capture. It keeps the
+// cost of a single sample bounded even when MaxJavaStackTraceDepth is 0
+// (which means unlimited for the walk loops below); stacks deeper than
+// this produce a truncated or failed sample instead of an unbounded walk.
+static const int forte_max_walk = 1024;
+
+static int forte_walk_limit() {
+  int limit = MaxJavaStackTraceDepth * 2;
+  return (limit == 0 || limit > forte_max_walk) ? forte_max_walk : limit;
+}
+
+// Per-thread cache of successful compiled-frame resolutions (interrupted
+// pc -> pc adjusted to the covering PcDesc). A 1 kHz profiler keeps
+// interrupting the same hot code, so this avoids repeating the PcDesc
+// search and avoids dirtying the nmethod's shared PcDescCache from
+// signal context. Entries are validated against the frame's CompiledMethod
+// on every hit; a stale entry for a reclaimed nmethod cannot match a live
+// frame unless the code cache reused the exact same address for code
+// covering the exact same pc, in which case the adjusted pc is still
+// bounds-checked against the live method before use.
+struct FortePcCacheEntry {
+  CompiledMethod* _nm;
+  address         _pc;
+  address         _real_pc;
+};
+
+static const int forte_pc_cache_size = 8;
+static THREAD_LOCAL FortePcCacheEntry forte_pc_cache[forte_pc_cache_size];
+static THREAD_LOCAL int forte_pc_cache_next = 0;
+
+static bool forte_pc_cache_lookup(CompiledMethod* nm, address pc, address* real_pc) {
+  for (int i = 0; i < forte_pc_cache_size; i++) {
+    const FortePcCacheEntry& e = forte_pc_cache[i];
+    if (e._nm == nm && e._pc == pc &&
+        e._real_pc >= nm->code_begin() && e._real_pc < nm->code_end()) {
+      *real_pc = e._real_pc;
+      return true;
+    }
+  }
+  return false;
+}
+
+static void forte_pc_cache_add(CompiledMethod* nm, address pc, address real_pc) {
+  FortePcCacheEntry& e = forte_pc_cache[forte_pc_cache_next];
+  forte_pc_cache_next = (forte_pc_cache_next + 1) % forte_pc_cache_size;
+  e._nm = nm;
+  e._pc = pc;
+  e._real_pc = real_pc;
+}
+
 
 
 
@@ -124,7 +174,7 @@ void vframeStreamForte::forte_next() {
   // handle general case
 
   int loop_count = 0;
-  int loop_max = MaxJavaStackTraceDepth * 2;
+  int loop_max = forte_walk_limit();
 
 
   do {
@@ -134,7 +184,7 @@ void vframeStreamForte::forte_next() {
     // By the time we get here we should never see unsafe but better
     // safe then segv'd
 
-    if ((loop_max != 0 && loop_count > loop_max) || !_frame.safe_for_sender(_thread)) {
+    if (loop_count > loop_max || !_frame.safe_for_sender(_thread)) {
       _mode = at_end_mode;
       return;
     }
@@ -162,11 +212,19 @@ static bool is_decipherable_compiled_frame(JavaThread* thread, frame* fr, Compil
     }
   }
 
-  // We're at some random pc in the compiled method so search for the PcDesc
-  // whose pc is greater than the current PC.  It's done this way
-  // because the extra PcDescs that are recorded for improved debug
-  // info record the end of the region covered by the ScopeDesc
-  // instead of the beginning.
+  // We're at some random pc in the compiled method. A sampling profiler
+  // keeps hitting the same pcs in hot code, so first check whether this
+  // thread has already resolved this pc.
+  address cached_real_pc;
+  if (forte_pc_cache_lookup(nm, fr->pc(), &cached_real_pc)) {
+    fr->set_pc(cached_real_pc);
+    return true;
+  }
+
+  // Not cached, so search for the PcDesc whose pc is greater than the
+  // current PC.  It's done this way because the extra PcDescs that are
+  // recorded for improved debug info record the end of the region
+  // covered by the ScopeDesc instead of the beginning.
   PcDesc* pc_desc = nm->pc_desc_near(fr->pc() + 1);
 
   // Now do we have a useful PcDesc?
@@ -198,6 +256,7 @@ static bool is_decipherable_compiled_frame(JavaThread* thread, frame* fr, Compil
 
   // This PcDesc is useful however we must adjust the frame's pc
   // so that the vframeStream lookups will use this same pc
+  forte_pc_cache_add(nm, fr->pc(), pc_desc->real_pc(nm));
   fr->set_pc(pc_desc->real_pc(nm));
   return true;
 }
@@ -362,10 +421,10 @@ static bool find_initial_Java_frame(JavaThread* thread,
 
     // See if we can find a useful frame
     int loop_count;
-    int loop_max = MaxJavaStackTraceDepth * 2;
+    int loop_max = forte_walk_limit();
     RegisterMap map(thread, false, false);
 
-    for (loop_count = 0; loop_max == 0 || loop_count < loop_max; loop_count++) {
+    for (loop_count = 0; loop_count < loop_max; loop_count++) {
       if (!candidate.safe_for_sender(thread)) return false;
       candidate = candidate.sender(&map);
       if (candidate.cb() != NULL) break;
@@ -376,10 +435,10 @@ static bool find_initial_Java_frame(JavaThread* thread,
   // We have a frame known to be in the codeCache
   // We will hopefully be able to figure out something to do with it.
   int loop_count;
-  int loop_max = MaxJavaStackTraceDepth * 2;
+  int loop_max = forte_walk_limit();
   RegisterMap map(thread, false, false);
 
-  for (loop_count = 0; loop_max == 0 || loop_count < loop_max; loop_count++) {
+  for (loop_count = 0; loop_count < loop_max; loop_count++) {
 
     if (candidate.is_entry_frame()) {
       // jcw is NULL if the java call wrapper couldn't be found
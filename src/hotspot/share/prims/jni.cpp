@@ -41,6 +41,7 @@
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "compiler/compilationWarmup.hpp"
 #include "compiler/compiler_globals.hpp"
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/gcLocker.inline.hpp"
@@ -2524,6 +2525,53 @@ static void check_bounds(jsize start, jsize copy_len, jsize array_len, TRAPS) {
   }
 }
 
+// A large array region would keep this thread from reaching a safepoint for
+// the duration of the whole copy, so regions past a chunk's worth of bytes
+// are copied in chunks with a safepoint poll in between. The array is
+// re-read from the handle after each poll because a GC at the safepoint may
+// have moved it.
+static const size_t array_region_chunk_size = 1*M;
+
+template <typename ElementType>
+static void copy_array_region_to_native(JavaThread* thread, typeArrayOop src, jsize start, jsize len, ElementType* buf) {
+  const jsize chunk = (jsize)(array_region_chunk_size / sizeof(ElementType));
+  if (len <= chunk) {
+    ArrayAccess<>::arraycopy_to_native(src, typeArrayOopDesc::element_offset<ElementType>(start), buf, len);
+    return;
+  }
+  typeArrayHandle src_h(thread, src);
+  while (len > 0) {
+    jsize n = MIN2(len, chunk);
+    ArrayAccess<>::arraycopy_to_native(src_h(), typeArrayOopDesc::element_offset<ElementType>(start), buf, n);
+    start += n;
+    buf += n;
+    len -= n;
+    if (len > 0) {
+      ThreadBlockInVM tbivm(thread);  // Be safepoint-polite between chunks.
+    }
+  }
+}
+
+template <typename ElementType>
+static void copy_array_region_from_native(JavaThread* thread, const ElementType* buf, typeArrayOop dst, jsize start, jsize len) {
+  const jsize chunk = (jsize)(array_region_chunk_size / sizeof(ElementType));
+  if (len <= chunk) {
+    ArrayAccess<>::arraycopy_from_native(buf, dst, typeArrayOopDesc::element_offset<ElementType>(start), len);
+    return;
+  }
+  typeArrayHandle dst_h(thread, dst);
+  while (len > 0) {
+    jsize n = MIN2(len, chunk);
+    ArrayAccess<>::arraycopy_from_native(buf, dst_h(), typeArrayOopDesc::element_offset<ElementType>(start), n);
+    start += n;
+    buf += n;
+    len -= n;
+    if (len > 0) {
+      ThreadBlockInVM tbivm(thread);  // Be safepoint-polite between chunks.
+    }
+  }
+}
+
 #define DEFINE_GETSCALARARRAYREGION(ElementTag,ElementType,Result, Tag \
                                     , EntryProbe, ReturnProbe); \
   DT_VOID_RETURN_MARK_DECL(Get##Result##ArrayRegion \
@@ -2537,7 +2585,7 @@ jni_Get##Result##ArrayRegion(JNIEnv *env, ElementType##Array array, jsize start,
   typeArrayOop src = typeArrayOop(JNIHandles::resolve_non_null(array)); \
   check_bounds(start, len, src->length(), CHECK); \
   if (len > 0) {    \
-    ArrayAccess<>::arraycopy_to_native(src, typeArrayOopDesc::element_offset<ElementType>(start), buf, len); \
+    copy_array_region_to_native(thread, src, start, len, buf); \
   } \
 JNI_END
 
@@ -2566,6 +2614,12 @@ DEFINE_GETSCALARARRAYREGION(T_DOUBLE,  jdouble, Double,  double
                             , HOTSPOT_JNI_GETDOUBLEARRAYREGION_ENTRY(env, array, start, len, (double *) buf),
                             HOTSPOT_JNI_GETDOUBLEARRAYREGION_RETURN());
 
+address jni_GetIntArrayRegion_addr() {
+  return (address)jni_GetIntArrayRegion;
+}
+address jni_GetLongArrayRegion_addr() {
+  return (address)jni_GetLongArrayRegion;
+}
 
 #define DEFINE_SETSCALARARRAYREGION(ElementTag,ElementType,Result, Tag \
                                     , EntryProbe, ReturnProbe); \
@@ -2580,7 +2634,7 @@ jni_Set##Result##ArrayRegion(JNIEnv *env, ElementType##Array array, jsize start,
   typeArrayOop dst = typeArrayOop(JNIHandles::resolve_non_null(array)); \
   check_bounds(start, len, dst->length(), CHECK); \
   if (len > 0) { \
-    ArrayAccess<>::arraycopy_from_native(buf, dst, typeArrayOopDesc::element_offset<ElementType>(start), len); \
+    copy_array_region_from_native(thread, buf, dst, start, len); \
   } \
 JNI_END
 
@@ -2927,9 +2981,24 @@ JNI_ENTRY(void, jni_DeleteWeakGlobalRef(JNIEnv *env, jweak ref))
 JNI_END
 
 
-JNI_ENTRY_NO_PRESERVE(jboolean, jni_ExceptionCheck(JNIEnv *env))
+// ExceptionCheck is typically called after every downcall in exception-aware
+// native code, so it is worth avoiding the native-to-VM transition. Testing
+// the thread-local pending exception field for null is safe from native state:
+// only the thread itself installs an exception there, and a concurrent GC can
+// at most replace one non-null oop with another. We only transition when an
+// async exception condition must be converted into a pending exception first.
+// Note that this reasoning does not extend to ExceptionOccurred, which reads
+// the exception oop itself and therefore must be in VM state.
+JNI_LEAF(jboolean, jni_ExceptionCheck(JNIEnv *env))
  HOTSPOT_JNI_EXCEPTIONCHECK_ENTRY(env);
-  jni_check_async_exceptions(thread);
+  if (thread->has_async_exception_condition()) {
+    // The leaf wrapper installed a NoHandleMark, but the transition can
+    // process safepoints and handshakes whose closures allocate handles.
+    ResetNoHandleMark rnhm;
+    HandleMark hm(thread);
+    ThreadInVMfromNative __tiv(thread);
+    jni_check_async_exceptions(thread);
+  }
   jboolean ret = (thread->has_pending_exception()) ? JNI_TRUE : JNI_FALSE;
  HOTSPOT_JNI_EXCEPTIONCHECK_RETURN(ret);
   return ret;
@@ -3474,6 +3543,15 @@ void quicken_jni_functions() {
     if (func != (address)-1) {
       jni_NativeInterface.GetDoubleField = (GetDoubleField_t)func;
     }
+    // Replace Get<PrimitiveType>ArrayRegion with fast versions for small copies
+    func = JNI_FastGetField::generate_fast_get_int_array_region();
+    if (func != (address)-1) {
+      jni_NativeInterface.GetIntArrayRegion = (GetIntArrayRegion_t)func;
+    }
+    func = JNI_FastGetField::generate_fast_get_long_array_region();
+    if (func != (address)-1) {
+      jni_NativeInterface.GetLongArrayRegion = (GetLongArrayRegion_t)func;
+    }
   }
 }
 
@@ -3648,6 +3726,10 @@ static jint JNI_CreateJavaVM_inner(JavaVM **vm, void **penv, void *args) {
     if (ReplayCompiles) ciReplay::replay(thread);
 #endif
 
+    if (WarmupReplayFile != NULL) {
+      CompilationWarmup::initialize_replay(thread);
+    }
+
 #ifdef ASSERT
     // Some platforms (like Win*) need a wrapper around these test
     // functions in order to properly handle error conditions.
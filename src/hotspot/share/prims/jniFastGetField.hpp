@@ -64,6 +64,7 @@ class JNI_FastGetField : AllStatic {
 
   static address generate_fast_get_int_field0(BasicType type);
   static address generate_fast_get_float_field0(BasicType type);
+  static address generate_fast_get_array_region0(BasicType type);
 
 #ifdef AARCH64
   template<int BType>
@@ -91,6 +92,14 @@ class JNI_FastGetField : AllStatic {
   static address generate_fast_get_float_field();
   static address generate_fast_get_double_field();
 
+  // Fast versions of jni_Get<Primitive>ArrayRegion for small copies,
+  // using the same speculative protocol as the field accessors with a
+  // bounds check against the speculatively loaded array length.
+  // Platforms without an implementation return (address)-1 so the slow
+  // path is kept.
+  static address generate_fast_get_int_array_region();
+  static address generate_fast_get_long_array_region();
+
   // If pc is in speculative_load_pclist, return the corresponding
   // slow case entry pc. Otherwise, return -1.
   // This is used by signal/exception handler to handle such case:
@@ -66,6 +66,10 @@ extern "C" {
       (JNIEnv *env, jobject obj, jfieldID fieldID);
   typedef jdouble (JNICALL *GetDoubleField_t)
     (JNIEnv *env, jobject obj, jfieldID fieldID);
+  typedef void (JNICALL *GetIntArrayRegion_t)
+      (JNIEnv *env, jintArray array, jsize start, jsize len, jint *buf);
+  typedef void (JNICALL *GetLongArrayRegion_t)
+      (JNIEnv *env, jlongArray array, jsize start, jsize len, jlong *buf);
 }
 
 void    quicken_jni_functions();
@@ -77,5 +81,7 @@ address jni_GetIntField_addr();
 address jni_GetLongField_addr();
 address jni_GetFloatField_addr();
 address jni_GetDoubleField_addr();
+address jni_GetIntArrayRegion_addr();
+address jni_GetLongArrayRegion_addr();
 
 #endif // SHARE_PRIMS_JVM_MISC_HPP
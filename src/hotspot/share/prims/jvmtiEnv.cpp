@@ -67,8 +67,10 @@
 #include "runtime/jfieldIDWorkaround.hpp"
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/objectMonitor.inline.hpp"
+#include "runtime/os.hpp"
 #include "runtime/osThread.hpp"
 #include "runtime/reflectionUtils.hpp"
+#include "runtime/safepointVerifiers.hpp"
 #include "runtime/signature.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadHeapSampler.hpp"
@@ -426,6 +428,20 @@ JvmtiEnv::RetransformClasses(jint class_count, const jclass* classes) {
 
     InstanceKlass* ik = InstanceKlass::cast(klass);
     if (ik->get_cached_class_file_bytes() == NULL) {
+      JvmtiCachedClassFileData* reconstituted = ik->get_reconstituted_class_file();
+      if (reconstituted != NULL) {
+        // Bytes reconstituted by an earlier retransformation are still
+        // valid: they are only freed when the class is redefined, which
+        // happens in a safepoint. Copy them out without passing one.
+        NoSafepointVerifier nsv;
+        const jint len = VM_RedefineClasses::get_cached_class_file_len(reconstituted);
+        unsigned char* copy = NEW_RESOURCE_ARRAY(unsigned char, len);
+        memcpy(copy, VM_RedefineClasses::get_cached_class_file_bytes(reconstituted), len);
+        class_definitions[index].class_byte_count = len;
+        class_definitions[index].class_bytes      = copy;
+        class_definitions[index].klass            = jcls;
+        continue;
+      }
       // Not cached, we need to reconstitute the class file from the
       // VM representation. We don't attach the reconstituted class
       // bytes to the InstanceKlass here because they have not been
@@ -438,6 +454,23 @@ JvmtiEnv::RetransformClasses(jint class_count, const jclass* classes) {
       class_definitions[index].class_byte_count = (jint)reconstituter.class_file_size();
       class_definitions[index].class_bytes      = (unsigned char*)
                                                        reconstituter.class_file_bytes();
+
+      // Keep a copy for the next retransformation of this class. No
+      // safepoint has passed since the reconstitution started, so the copy
+      // is consistent with the current class version; it is freed when the
+      // class is redefined.
+      const size_t cache_size = offset_of(JvmtiCachedClassFileData, data) +
+                                reconstituter.class_file_size();
+      JvmtiCachedClassFileData* cache =
+          (JvmtiCachedClassFileData*)os::malloc(cache_size, mtInternal);
+      if (cache != NULL) {
+        cache->length = (jint)reconstituter.class_file_size();
+        memcpy(cache->data, reconstituter.class_file_bytes(), reconstituter.class_file_size());
+        if (!ik->try_set_reconstituted_class_file(cache)) {
+          // Another thread won the race to cache its reconstitution
+          os::free(cache);
+        }
+      }
     } else {
       // it is cached, get it from the cache
       class_definitions[index].class_byte_count = ik->get_cached_class_file_len();
@@ -1567,11 +1600,17 @@ JvmtiEnv::GetThreadListStackTraces(jint thread_count, const jthread* thread_list
       *stack_info_ptr = op.stack_info();
     }
   } else {
-    // JVMTI get stack traces at safepoint.
-    VM_GetThreadListStackTraces op(this, thread_count, thread_list, max_frame_count);
-    VMThread::execute(&op);
-    err = op.result();
+    // Bulk collection: one handshake of all threads, with each listed
+    // thread capturing its own stack directly into the preallocated
+    // result buffer.
+    JavaThread *current_thread = JavaThread::current();
+    ResourceMark rm(current_thread);
+    ThreadsListHandle tlh(current_thread);
+
+    GetThreadListStackTracesClosure op(this, thread_count, thread_list, max_frame_count);
+    err = op.prepare(&tlh);
     if (err == JVMTI_ERROR_NONE) {
+      Handshake::execute(&op);
       *stack_info_ptr = op.stack_info();
     }
   }
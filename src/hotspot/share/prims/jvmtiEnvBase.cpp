@@ -977,7 +977,13 @@ JvmtiEnvBase::get_object_monitor_usage(JavaThread* calling_thread, jobject objec
         // this object has a lightweight monitor
 
         if (mark.has_locker()) {
-          owner = (address)mark.locker(); // save the address of the Lock word
+          if (UseFastLocking) {
+            // Fast-locked: the owning thread is the one whose lock stack
+            // contains the object.
+            owning_thread = Threads::owning_thread_from_object(tlh.list(), hobj());
+          } else {
+            owner = (address)mark.locker(); // save the address of the Lock word
+          }
         }
         // implied else: no owner
       } else {
@@ -990,7 +996,13 @@ JvmtiEnvBase::get_object_monitor_usage(JavaThread* calling_thread, jobject objec
         // by a non-owning JavaThread, but only the owning JavaThread
         // can change the owner field from the Lock word to the
         // JavaThread * and it may not have done that yet.
-        owner = (address)mon->owner();
+        if (UseFastLocking && mon->is_owner_anonymous()) {
+          // The monitor was inflated over a fast-lock whose owner has not
+          // claimed it yet; find the owner via the lock stacks instead.
+          owning_thread = Threads::owning_thread_from_object(tlh.list(), hobj());
+        } else {
+          owner = (address)mon->owner();
+        }
       }
     }
 
@@ -998,6 +1010,9 @@ JvmtiEnvBase::get_object_monitor_usage(JavaThread* calling_thread, jobject objec
       // This monitor is owned so we have to find the owning JavaThread.
       owning_thread = Threads::owning_thread_from_monitor_owner(tlh.list(), owner);
       assert(owning_thread != NULL, "owning JavaThread must not be NULL");
+    }
+
+    if (owning_thread != NULL) {
       Handle     th(current_thread, owning_thread->threadObj());
       ret.owner = (jthread)jni_reference(calling_thread, th);
     }
@@ -1237,30 +1252,103 @@ MultipleStackTracesCollector::allocate_and_fill_stacks(jint thread_count) {
 }
 
 
+// Fill in the jvmtiStackInfo for one slot of the result buffer.
+// Note that either or both of thr and thread_oop may be null if the
+// thread is new or has exited. Frames are only captured when the caller
+// is handshake safe for thr, i.e. from do_thread(); prepare() records
+// the thread state alone.
 void
-VM_GetThreadListStackTraces::doit() {
-  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+GetThreadListStackTracesClosure::fill_slot(jint i, JavaThread* thr, oop thread_oop, bool capture_frames) {
+  jvmtiStackInfo *infop = &_stack_info[i];
+  jint state = 0;
 
-  ResourceMark rm;
-  ThreadsListHandle tlh;
-  for (int i = 0; i < _thread_count; ++i) {
+  if (thread_oop != NULL) {
+    // get most state bits
+    state = (jint)java_lang_Thread::get_thread_status(thread_oop);
+  }
+
+  if (thr != NULL) {    // add more state bits if there is a JavaThead to query
+    if (thr->is_suspended()) {
+      state |= JVMTI_THREAD_STATE_SUSPENDED;
+    }
+    JavaThreadState jts = thr->thread_state();
+    if (jts == _thread_in_native) {
+      state |= JVMTI_THREAD_STATE_IN_NATIVE;
+    }
+    if (thr->is_interrupted(false)) {
+      state |= JVMTI_THREAD_STATE_INTERRUPTED;
+    }
+  }
+  infop->state = state;
+  infop->frame_count = 0;
+  infop->frame_buffer = NULL;
+
+  if (capture_frames && thr != NULL && (state & JVMTI_THREAD_STATE_ALIVE) != 0 &&
+      _max_frame_count > 0) {
+    jvmtiFrameInfo *frame_buffer = frame_buffer_at(i);
+    ((JvmtiEnvBase*)_env)->get_stack_trace(thr, 0, _max_frame_count,
+                                           frame_buffer, &(infop->frame_count));
+    if (infop->frame_count > 0) {
+      infop->frame_buffer = frame_buffer;
+    }
+  }
+}
+
+// Resolve the thread list and allocate the result buffer before the
+// handshake. The buffer is one block: thread_count jvmtiStackInfo records
+// followed by a frame buffer of max_frame_count entries per thread, so the
+// handshaked threads can fill their slots concurrently with no copying
+// afterwards. The caller's ThreadsListHandle must remain in scope until
+// the handshake has completed.
+jvmtiError
+GetThreadListStackTracesClosure::prepare(ThreadsListHandle* tlh) {
+  jlong alloc_size = _thread_count * (jlong)sizeof(jvmtiStackInfo)
+                   + _thread_count * (jlong)_max_frame_count * sizeof(jvmtiFrameInfo);
+  jvmtiError err = ((JvmtiEnvBase*)_env)->allocate(alloc_size, (unsigned char **)&_stack_info);
+  if (err != JVMTI_ERROR_NONE) {
+    return err;
+  }
+  _thread_targets = NEW_RESOURCE_ARRAY(JavaThread*, _thread_count);
+
+  for (jint i = 0; i < _thread_count; ++i) {
     jthread jt = _thread_list[i];
     JavaThread* java_thread = NULL;
     oop thread_oop = NULL;
-    jvmtiError err = JvmtiExport::cv_external_thread_to_JavaThread(tlh.list(), jt, &java_thread, &thread_oop);
+    err = JvmtiExport::cv_external_thread_to_JavaThread(tlh->list(), jt, &java_thread, &thread_oop);
     if (err != JVMTI_ERROR_NONE) {
       // We got an error code so we don't have a JavaThread *, but
       // only return an error from here if we didn't get a valid
       // thread_oop.
       if (thread_oop == NULL) {
-        _collector.set_result(err);
-        return;
+        ((JvmtiEnvBase*)_env)->deallocate((unsigned char *)_stack_info);
+        _stack_info = NULL;
+        return err;
       }
       // We have a valid thread_oop.
     }
-    _collector.fill_frames(jt, java_thread, thread_oop);
+    _thread_targets[i] = java_thread;
+    _stack_info[i].thread = jt;
+    fill_slot(i, java_thread, thread_oop, false /* capture_frames */);
+  }
+  return JVMTI_ERROR_NONE;
+}
+
+void
+GetThreadListStackTracesClosure::do_thread(Thread *target) {
+  JavaThread *jt = JavaThread::cast(target);
+  oop thread_oop = jt->threadObj();
+
+  if (jt->is_exiting() || thread_oop == NULL) {
+    return;  // the slots keep the state recorded by prepare()
+  }
+  // The thread list may name this thread more than once; each matching
+  // slot is ours alone, so concurrently handshaked threads never write
+  // to the same slot.
+  for (jint i = 0; i < _thread_count; ++i) {
+    if (_thread_targets[i] == jt) {
+      fill_slot(i, jt, thread_oop, true /* capture_frames */);
+    }
   }
-  _collector.allocate_and_fill_stacks(_thread_count);
 }
 
 void
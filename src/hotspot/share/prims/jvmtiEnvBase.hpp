@@ -46,6 +46,7 @@ class JvmtiThreadState;
 class JvmtiRawMonitor; // for jvmtiEnv.hpp
 class JvmtiEventControllerPrivate;
 class JvmtiTagMap;
+class ThreadsListHandle;
 
 
 
@@ -531,23 +532,41 @@ public:
   jvmtiError result()             { return _collector.result(); }
 };
 
-// VM operation to get stack trace at safepoint.
-class VM_GetThreadListStackTraces : public VM_Operation {
+// HandshakeClosure to get stack traces for a list of threads with a single
+// bulk handshake of all threads. prepare() resolves the thread list and
+// allocates one block holding every jvmtiStackInfo record plus a frame
+// buffer of max_frame_count entries per thread; each listed thread then
+// captures its own stack directly into its slot, so no intermediate copies
+// are made. Threads in the list with no JavaThread (not yet started or
+// already exited) keep the state recorded by prepare().
+class GetThreadListStackTracesClosure : public HandshakeClosure {
 private:
+  JvmtiEnv* _env;
   jint _thread_count;
   const jthread* _thread_list;
-  MultipleStackTracesCollector _collector;
+  jint _max_frame_count;
+  JavaThread** _thread_targets;   // resolved JavaThread per slot, or NULL; resource allocated
+  jvmtiStackInfo* _stack_info;
+
+  jvmtiFrameInfo* frame_buffer_at(jint i) {
+    return (jvmtiFrameInfo*)(_stack_info + _thread_count) + (size_t)i * _max_frame_count;
+  }
+  void fill_slot(jint i, JavaThread* thr, oop thread_oop, bool capture_frames);
 
 public:
-  VM_GetThreadListStackTraces(JvmtiEnv *env, jint thread_count, const jthread* thread_list, jint max_frame_count)
-      : _thread_count(thread_count),
-        _thread_list(thread_list),
-        _collector(env, max_frame_count) {
+  GetThreadListStackTracesClosure(JvmtiEnv* env, jint thread_count,
+                                  const jthread* thread_list, jint max_frame_count)
+    : HandshakeClosure("GetThreadListStackTraces"),
+      _env(env),
+      _thread_count(thread_count),
+      _thread_list(thread_list),
+      _max_frame_count(max_frame_count),
+      _thread_targets(NULL),
+      _stack_info(NULL) {
   }
-  VMOp_Type type() const { return VMOp_GetThreadListStackTraces; }
-  void doit();
-  jvmtiStackInfo *stack_info()    { return _collector.stack_info(); }
-  jvmtiError result()             { return _collector.result(); }
+  jvmtiError prepare(ThreadsListHandle* tlh);
+  void do_thread(Thread *target);
+  jvmtiStackInfo *stack_info()    { return _stack_info; }
 };
 
 // HandshakeClosure to get single stack trace.
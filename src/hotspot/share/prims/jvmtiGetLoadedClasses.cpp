@@ -23,74 +23,60 @@
  */
 
 #include "precompiled.hpp"
-#include "classfile/classLoaderDataGraph.hpp"
+#include "classfile/classLoaderDataGraph.inline.hpp"
 #include "classfile/dictionary.hpp"
 #include "classfile/javaClasses.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "oops/klass.inline.hpp"
 #include "prims/jvmtiGetLoadedClasses.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/thread.hpp"
-#include "utilities/stack.inline.hpp"
+#include "utilities/growableArray.hpp"
 
 // The closure for GetLoadedClasses
 class LoadedClassesClosure : public KlassClosure {
 private:
-  Stack<jclass, mtInternal> _classStack;
-  JvmtiEnv* _env;
+  GrowableArray<Handle> _mirrors;
   Thread*   _cur_thread;
   bool      _dictionary_walk;
 
-  int extract(jclass* result_list) {
-    // The size of the Stack will be 0 after extract, so get it here
-    int count = (int)_classStack.size();
-    int i = count;
-
-    // Pop all jclasses, fill backwards
-    while (!_classStack.is_empty()) {
-      result_list[--i] = _classStack.pop();
-    }
-
-    // Return the number of elements written
-    return count;
-  }
-
-  // Return current size of the Stack
-  int get_count() {
-    return (int)_classStack.size();
-  }
-
 public:
-  LoadedClassesClosure(JvmtiEnv* env, bool dictionary_walk) :
-      _env(env),
-      _cur_thread(Thread::current()),
+  LoadedClassesClosure(Thread* thread, bool dictionary_walk, int initial_capacity = 2) :
+      _mirrors(initial_capacity),
+      _cur_thread(thread),
       _dictionary_walk(dictionary_walk) {
+    assert(_cur_thread == Thread::current(), "must be current thread");
   }
 
   void do_klass(Klass* k) {
-    // Collect all jclasses
-    _classStack.push((jclass) _env->jni_reference(Handle(_cur_thread, k->java_mirror())));
+    // Collect mirrors in handles; the JNI references are created after
+    // the collection locks have been released.
+    _mirrors.append(Handle(_cur_thread, k->java_mirror()));
     if (_dictionary_walk) {
       // Collect array classes this way when walking the dictionary (because array classes are
       // not in the dictionary).
       for (Klass* l = k->array_klass_or_null(); l != NULL; l = l->array_klass_or_null()) {
-        _classStack.push((jclass) _env->jni_reference(Handle(_cur_thread, l->java_mirror())));
+        _mirrors.append(Handle(_cur_thread, l->java_mirror()));
       }
     }
   }
 
   jvmtiError get_result(JvmtiEnv *env, jint* classCountPtr, jclass** classesPtr) {
-    // Return results by extracting the collected contents into a list
-    // allocated via JvmtiEnv
+    // Return results by converting the collected mirrors into a list of
+    // JNI references allocated via JvmtiEnv. The handles keep the classes
+    // alive, so this is safe to run without the collection locks.
     jclass* result_list;
-    jvmtiError error = env->Allocate(get_count() * sizeof(jclass),
-                               (unsigned char**)&result_list);
+    jvmtiError error = env->Allocate(_mirrors.length() * sizeof(jclass),
+                                     (unsigned char**)&result_list);
 
     if (error == JVMTI_ERROR_NONE) {
-      int count = extract(result_list);
-      *classCountPtr = count;
+      for (int i = 0; i < _mirrors.length(); i++) {
+        result_list[i] = (jclass)env->jni_reference(_mirrors.at(i));
+      }
+      *classCountPtr = _mirrors.length();
       *classesPtr = result_list;
     }
     return error;
@@ -100,7 +86,14 @@ public:
 jvmtiError
 JvmtiGetLoadedClasses::getLoadedClasses(JvmtiEnv *env, jint* classCountPtr, jclass** classesPtr) {
 
-  LoadedClassesClosure closure(env, false);
+  ResourceMark rm;
+  // Pre-size the collection from the incrementally maintained class
+  // counters, so no reallocation happens while the locks are held. The
+  // counters are an upper bound; classes that have not yet entered the
+  // loaded state are filtered out by the walk.
+  const int estimated_count = (int)(ClassLoaderDataGraph::num_instance_classes() +
+                                    ClassLoaderDataGraph::num_array_classes());
+  LoadedClassesClosure closure(Thread::current(), false, MAX2(estimated_count, 2));
   {
     // To get a consistent list of classes we need MultiArray_lock to ensure
     // array classes aren't created.
@@ -119,7 +112,8 @@ jvmtiError
 JvmtiGetLoadedClasses::getClassLoaderClasses(JvmtiEnv *env, jobject initiatingLoader,
                                              jint* classCountPtr, jclass** classesPtr) {
 
-  LoadedClassesClosure closure(env, true);
+  ResourceMark rm;
+  LoadedClassesClosure closure(Thread::current(), true);
   {
     // To get a consistent list of classes we need MultiArray_lock to ensure
     // array classes aren't created during this walk.
@@ -30,16 +30,20 @@
 #include "classfile/javaClasses.inline.hpp"
 #include "classfile/metadataOnStackMark.hpp"
 #include "classfile/symbolTable.hpp"
+#include "classfile/systemDictionary.hpp"
 #include "classfile/klassFactory.hpp"
 #include "classfile/verifier.hpp"
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "code/codeCache.hpp"
 #include "compiler/compileBroker.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "interpreter/methodLookupCache.hpp"
 #include "interpreter/oopMapCache.hpp"
 #include "interpreter/rewriter.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "logging/logStream.hpp"
+#include "memory/iterator.hpp"
 #include "memory/metadataFactory.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
@@ -84,6 +88,7 @@ VM_RedefineClasses::VM_RedefineClasses(jint class_count,
   _class_count = class_count;
   _class_defs = class_defs;
   _class_load_kind = class_load_kind;
+  _skipped_count = 0;
   _any_class_has_resolved_methods = false;
   _res = JVMTI_ERROR_NONE;
   _the_class = NULL;
@@ -230,10 +235,29 @@ bool VM_RedefineClasses::doit_prologue() {
     return false;
   }
 
+  if (_skipped_count == _class_count) {
+    // Every retransformation was a no-op; skip the safepoint entirely.
+    // All the scratch class entries are NULL, so there is nothing else to
+    // free here besides the array itself.
+    os::free(_scratch_classes);
+    _timer_vm_op_prologue.stop();
+    unlock_classes();
+    return false;
+  }
+
   _timer_vm_op_prologue.stop();
   return true;
 }
 
+// Collects the loaded ClassLoaderData into an array so that the metadata
+// adjustment task can hand them out to the safepoint workers.
+class CollectClassLoaderDataClosure : public CLDClosure {
+  GrowableArray<ClassLoaderData*>* _clds;
+ public:
+  CollectClassLoaderDataClosure(GrowableArray<ClassLoaderData*>* clds) : _clds(clds) {}
+  void do_cld(ClassLoaderData* cld) { _clds->push(cld); }
+};
+
 void VM_RedefineClasses::doit() {
   Thread* current = Thread::current();
 
@@ -258,18 +282,37 @@ void VM_RedefineClasses::doit() {
                             // before the stack walk again.
 
   for (int i = 0; i < _class_count; i++) {
+    if (_scratch_classes[i] == NULL) {
+      // An unmodified retransformation, skipped in load_new_class_versions()
+      continue;
+    }
     redefine_single_class(current, _class_defs[i].klass, _scratch_classes[i]);
   }
 
   // Flush all compiled code that depends on the classes redefined.
   flush_dependent_code();
 
+  // Cached method lookup results may refer to old methods
+  MethodLookupCache::clear();
+
   // Adjust constantpool caches and vtables for all classes
   // that reference methods of the evolved classes.
   // Have to do this after all classes are redefined and all methods that
   // are redefined are marked as old.
-  AdjustAndCleanMetadata adjust_and_clean_metadata(current);
-  ClassLoaderDataGraph::classes_do(&adjust_and_clean_metadata);
+  // If the GC provides safepoint workers the walk is spread across them,
+  // one class loader at a time; otherwise it runs in the VM thread.
+  WorkerThreads* workers = Universe::heap()->safepoint_workers();
+  if (workers != NULL) {
+    ResourceMark rm(current);
+    GrowableArray<ClassLoaderData*>* clds = new GrowableArray<ClassLoaderData*>();
+    CollectClassLoaderDataClosure collect_clds(clds);
+    ClassLoaderDataGraph::loaded_cld_do(&collect_clds);
+    AdjustAndCleanMetadataTask task(clds);
+    workers->run_task(&task);
+  } else {
+    AdjustAndCleanMetadata adjust_and_clean_metadata(current);
+    ClassLoaderDataGraph::classes_do(&adjust_and_clean_metadata);
+  }
 
   // JSR-292 support
   if (_any_class_has_resolved_methods) {
@@ -1395,8 +1438,6 @@ jvmtiError VM_RedefineClasses::load_new_class_versions() {
     // Clear class_being_redefined just to be sure.
     state->clear_class_being_redefined();
 
-    // TODO: if this is retransform, and nothing changed we can skip it
-
     // Need to clean up allocated InstanceKlass if there's an error so assign
     // the result here. Caller deallocates all the scratch classes in case of
     // an error.
@@ -1423,6 +1464,31 @@ jvmtiError VM_RedefineClasses::load_new_class_versions() {
       }
     }
 
+    if (_class_load_kind == jvmti_class_load_kind_retransform &&
+        the_class->get_cached_class_file() == NULL &&
+        !state->class_being_redefined_modified()) {
+      // No ClassFileLoadHook returned new class file bytes and the hook
+      // input was reconstituted from the currently installed version, so
+      // this retransformation leaves the class unchanged: skip installing a
+      // new version and the verification, constant pool merging and method
+      // comparison that entails. A NULL scratch class entry marks the skip
+      // for doit().
+      // When original class file bytes are cached, the hook input is those
+      // original bytes; an unmodified result then means "revert to the
+      // original version" and must still be installed.
+      log_debug(redefine, class, load)
+        ("skipping unmodified class name=%s", the_class->external_name());
+      ClassLoaderData* cld = scratch_class->class_loader_data();
+      if (the_class->get_cached_class_file() == scratch_class->get_cached_class_file()) {
+        // Don't free cached_class_file shared with the original class.
+        scratch_class->set_cached_class_file(NULL);
+      }
+      cld->add_to_deallocate_list(scratch_class);
+      _scratch_classes[i] = NULL;
+      _skipped_count++;
+      continue;
+    }
+
     // Ensure class is linked before redefine
     if (!the_class->is_linked()) {
       the_class->link_class(THREAD);
@@ -3785,6 +3851,17 @@ void VM_RedefineClasses::AdjustAndCleanMetadata::do_klass(Klass* k) {
   }
 }
 
+void VM_RedefineClasses::AdjustAndCleanMetadataTask::work(uint worker_id) {
+  AdjustAndCleanMetadata adjust_and_clean_metadata(Thread::current());
+  for (;;) {
+    int index = Atomic::fetch_and_add(&_claim_index, 1);
+    if (index >= _clds->length()) {
+      return;
+    }
+    _clds->at(index)->classes_do(&adjust_and_clean_metadata);
+  }
+}
+
 void VM_RedefineClasses::update_jmethod_ids() {
   for (int j = 0; j < _matching_methods_length; ++j) {
     Method* old_method = _matching_old_methods[j];
@@ -4107,6 +4184,9 @@ void VM_RedefineClasses::flush_dependent_code() {
 
   // From now on we know that the dependency information is complete
   JvmtiExport::set_all_dependencies_are_recorded(true);
+
+  // Redefinition invalidates hierarchy-based facts as well.
+  SystemDictionary::notice_modification();
 }
 
 void VM_RedefineClasses::compute_added_deleted_matching_methods() {
@@ -4343,6 +4423,10 @@ void VM_RedefineClasses::redefine_single_class(Thread* current, jclass the_jclas
   // always owns these bytes.
   scratch_class->set_cached_class_file(NULL);
 
+  // Class file bytes reconstituted for an earlier RetransformClasses call
+  // were built from the old class version and are now stale.
+  the_class->clear_reconstituted_class_file();
+
   // Replace inner_classes
   Array<u2>* old_inner_classes = the_class->inner_classes();
   the_class->set_inner_classes(scratch_class->inner_classes());
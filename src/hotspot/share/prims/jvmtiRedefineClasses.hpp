@@ -25,12 +25,16 @@
 #ifndef SHARE_PRIMS_JVMTIREDEFINECLASSES_HPP
 #define SHARE_PRIMS_JVMTIREDEFINECLASSES_HPP
 
+#include "gc/shared/workerThread.hpp"
 #include "jvmtifiles/jvmtiEnv.hpp"
 #include "memory/oopFactory.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/objArrayKlass.hpp"
 #include "oops/objArrayOop.hpp"
 #include "runtime/vmOperation.hpp"
+#include "utilities/growableArray.hpp"
+
+class ClassLoaderData;
 
 // Introduction:
 //
@@ -358,6 +362,10 @@ class VM_RedefineClasses: public VM_Operation {
   // RetransformClasses.  Indicate which.
   JvmtiClassLoadKind          _class_load_kind;
 
+  // Number of classes skipped because a retransformation left their class
+  // file bytes unchanged; their _scratch_classes entries are NULL.
+  jint                        _skipped_count;
+
   // _index_map_count is just an optimization for knowing if
   // _index_map_p contains any entries.
   int                         _index_map_count;
@@ -521,6 +529,21 @@ class VM_RedefineClasses: public VM_Operation {
     void do_klass(Klass* k);
   };
 
+  // Parallel driver for AdjustAndCleanMetadata using the GC-provided
+  // safepoint workers. Workers claim whole class loaders, so a klass and
+  // the previous versions hanging off it are always processed by the
+  // same worker and the adjustments never race.
+  class AdjustAndCleanMetadataTask : public WorkerTask {
+    GrowableArray<ClassLoaderData*>* _clds;
+    volatile int _claim_index;
+   public:
+    AdjustAndCleanMetadataTask(GrowableArray<ClassLoaderData*>* clds) :
+      WorkerTask("RedefineClasses metadata adjustment"),
+      _clds(clds),
+      _claim_index(0) {}
+    void work(uint worker_id);
+  };
+
  public:
   VM_RedefineClasses(jint class_count,
                      const jvmtiClassDefinition *class_defs,
@@ -354,6 +354,14 @@ class TwoOopCallbackWrapper : public CallbackWrapper {
 // around the same time then it's possible that the Mutex associated with the
 // tag map will be a hot lock.
 void JvmtiTagMap::set_tag(jobject object, jlong tag) {
+  // Fast path: untagging is a no-op on an empty tag map. The unlocked
+  // emptiness check is racy, but two unsynchronized calls racing on the
+  // same object have no defined order anyway, so linearizing the untag
+  // before a concurrent first SetTag is a valid outcome.
+  if (tag == 0 && hashmap()->is_empty()) {
+    return;
+  }
+
   MutexLocker ml(lock(), Mutex::_no_safepoint_check_flag);
 
   // SetTag should not post events because the JavaThread has to
@@ -389,6 +397,15 @@ void JvmtiTagMap::set_tag(jobject object, jlong tag) {
 
 // get the tag for an object
 jlong JvmtiTagMap::get_tag(jobject object) {
+  // Fast path: an environment that has tagged nothing (or untagged
+  // everything again) answers 0 without touching the tag map lock. The
+  // unlocked emptiness check is racy: a lookup racing with the very first
+  // SetTag may validly linearize before it, and a stale non-zero count
+  // merely sends us down the locked slow path.
+  if (hashmap()->is_empty()) {
+    return 0;
+  }
+
   MutexLocker ml(lock(), Mutex::_no_safepoint_check_flag);
 
   // GetTag should not post events because the JavaThread has to
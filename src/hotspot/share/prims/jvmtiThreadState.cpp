@@ -57,6 +57,7 @@ JvmtiThreadState::JvmtiThreadState(JavaThread* thread)
   _pending_step_for_popframe = false;
   _class_being_redefined = NULL;
   _class_load_kind = jvmti_class_load_kind_load;
+  _class_being_redefined_modified = false;
   _classes_being_redefined = NULL;
   _head_env_thread_state = NULL;
   _dynamic_code_event_collector = NULL;
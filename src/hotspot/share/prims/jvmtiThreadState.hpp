@@ -100,6 +100,7 @@ class JvmtiThreadState : public CHeapObj<mtInternal> {
   // info to the class file load hook event handler.
   Klass*                _class_being_redefined;
   JvmtiClassLoadKind    _class_load_kind;
+  bool                  _class_being_redefined_modified;
   GrowableArray<Klass*>* _classes_being_redefined;
 
   // This is only valid when is_interp_only_mode() returns true
@@ -231,6 +232,7 @@ class JvmtiThreadState : public CHeapObj<mtInternal> {
   inline void set_class_being_redefined(Klass* k, JvmtiClassLoadKind kind) {
     _class_being_redefined = k;
     _class_load_kind = kind;
+    _class_being_redefined_modified = false;
   }
 
   inline void clear_class_being_redefined() {
@@ -246,6 +248,17 @@ class JvmtiThreadState : public CHeapObj<mtInternal> {
     return _class_load_kind;
   }
 
+  // Records whether a ClassFileLoadHook agent returned new class file bytes
+  // while _class_being_redefined was set. VM_RedefineClasses uses this to
+  // recognize retransformations that did not change the class.
+  inline void set_class_being_redefined_modified() {
+    _class_being_redefined_modified = true;
+  }
+
+  inline bool class_being_redefined_modified() {
+    return _class_being_redefined_modified;
+  }
+
   // Get the classes that are currently being redefined by this thread.
   inline GrowableArray<Klass*>* get_classes_being_redefined() {
     return _classes_being_redefined;
@@ -1081,10 +1081,13 @@ void MethodHandles::flush_dependent_nmethods(Handle call_site, Handle target) {
     oop context = java_lang_invoke_CallSite::context_no_keepalive(call_site());
     DependencyContext deps = java_lang_invoke_MethodHandleNatives_CallSiteContext::vmdependencies(context);
     marked = deps.mark_dependent_nmethods(changes);
+    // Make the marked nmethods not entrant while still holding the
+    // CodeCache_lock, saving the code cache walk in deoptimize_all_marked().
+    changes.make_marked_nmethods_not_entrant();
   }
   if (marked > 0) {
     // At least one nmethod has been marked for deoptimization.
-    Deoptimization::deoptimize_all_marked();
+    Deoptimization::deoptimize_marked_frames();
   }
 }
 
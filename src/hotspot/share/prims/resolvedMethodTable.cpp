@@ -51,7 +51,6 @@ static const size_t END_SIZE = 24;
 // If a chain gets to 32 something might be wrong
 static const size_t GROW_HINT = 32;
 
-static const size_t ResolvedMethodTableSizeLog = 10;
 
 unsigned int method_hash(const Method* method) {
   unsigned int hash = method->method_holder()->class_loader_data()->identity_hash();
@@ -93,17 +92,25 @@ class ResolvedMethodTableConfig : public AllStatic {
 };
 
 static ResolvedMethodTableHash* _local_table           = NULL;
-static size_t                   _current_size          = (size_t)1 << ResolvedMethodTableSizeLog;
+static size_t                   _current_size          = 0;
 
 volatile bool            ResolvedMethodTable::_has_work              = false;
 OopStorage*              ResolvedMethodTable::_oop_storage;
 
 volatile size_t          _items_count           = 0;
 
+static size_t ceil_log2(size_t val) {
+  size_t ret;
+  for (ret = 1; ((size_t)1 << ret) < val; ++ret);
+  return ret;
+}
+
 void ResolvedMethodTable::create_table() {
-  _local_table  = new ResolvedMethodTableHash(ResolvedMethodTableSizeLog, END_SIZE, GROW_HINT);
+  size_t start_size_log_2 = ceil_log2(ResolvedMethodTableSize);
+  _current_size = (size_t)1 << start_size_log_2;
+  _local_table  = new ResolvedMethodTableHash(start_size_log_2, END_SIZE, GROW_HINT);
   log_trace(membername, table)("Start size: " SIZE_FORMAT " (" SIZE_FORMAT ")",
-                               _current_size, ResolvedMethodTableSizeLog);
+                               _current_size, start_size_log_2);
   _oop_storage = OopStorageSet::create_weak("ResolvedMethodTable Weak", mtClass);
   _oop_storage->register_num_dead_callback(&gc_notification);
 }
@@ -272,24 +279,31 @@ void ResolvedMethodTable::do_concurrent_work(JavaThread* jt) {
 }
 
 void ResolvedMethodTable::grow(JavaThread* jt) {
-  ResolvedMethodTableHash::GrowTask gt(_local_table);
-  if (!gt.prepare(jt)) {
-    return;
-  }
-  log_trace(membername, table)("Started to grow");
-  {
-    TraceTime timer("Grow", TRACETIME_LOG(Debug, membername, table, perf));
-    while (gt.do_task(jt)) {
-      gt.pause(jt);
-      {
-        ThreadBlockInVM tbivm(jt);
+  // One GrowTask doubles the bucket count once. MethodHandle-heavy startup
+  // can push the load factor several times over the preferred value before
+  // the service thread gets here, so keep doubling until the table has
+  // caught up, instead of going through a new trigger round for every
+  // doubling.
+  do {
+    ResolvedMethodTableHash::GrowTask gt(_local_table);
+    if (!gt.prepare(jt)) {
+      return;
+    }
+    log_trace(membername, table)("Started to grow");
+    {
+      TraceTime timer("Grow", TRACETIME_LOG(Debug, membername, table, perf));
+      while (gt.do_task(jt)) {
+        gt.pause(jt);
+        {
+          ThreadBlockInVM tbivm(jt);
+        }
+        gt.cont(jt);
       }
-      gt.cont(jt);
     }
-  }
-  gt.done(jt);
-  _current_size = table_size();
-  log_info(membername, table)("Grown to size:" SIZE_FORMAT, _current_size);
+    gt.done(jt);
+    _current_size = table_size();
+    log_info(membername, table)("Grown to size:" SIZE_FORMAT, _current_size);
+  } while (get_load_factor() > PREF_AVG_LIST_LEN && !_local_table->is_max_size_reached());
 }
 
 struct ResolvedMethodTableDoDelete : StackObj {
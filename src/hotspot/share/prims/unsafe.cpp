@@ -371,6 +371,22 @@ UNSAFE_ENTRY(void, Unsafe_SetMemory0(JNIEnv *env, jobject unsafe, jobject obj, j
   Copy::fill_to_memory_atomic(p, sz, value);
 } UNSAFE_END
 
+// Copy one chunk, guarded against SIGBUS from truncated mapped files.
+static void unsafe_copy_memory(JavaThread* thread, void* src, void* dst, size_t sz) {
+  GuardUnsafeAccess guard(thread);
+  if (StubRoutines::unsafe_arraycopy() != NULL) {
+    MACOS_AARCH64_ONLY(ThreadWXEnable wx(WXExec, thread));
+    StubRoutines::UnsafeArrayCopy_stub()(src, dst, sz);
+  } else {
+    Copy::conjoint_memory_atomic(src, dst, sz);
+  }
+}
+
+// Maximum amount copied between safepoint polls. Large enough that the poll
+// is negligible against the copy itself, small enough that time-to-safepoint
+// stays bounded even when a thread copies gigabytes between direct buffers.
+static const size_t unsafe_copy_chunk_size = 1*M;
+
 UNSAFE_ENTRY(void, Unsafe_CopyMemory0(JNIEnv *env, jobject unsafe, jobject srcObj, jlong srcOffset, jobject dstObj, jlong dstOffset, jlong size)) {
   size_t sz = (size_t)size;
 
@@ -379,14 +395,29 @@ UNSAFE_ENTRY(void, Unsafe_CopyMemory0(JNIEnv *env, jobject unsafe, jobject srcOb
 
   void* src = index_oop_from_field_offset_long(srcp, srcOffset);
   void* dst = index_oop_from_field_offset_long(dstp, dstOffset);
-  {
-    GuardUnsafeAccess guard(thread);
-    if (StubRoutines::unsafe_arraycopy() != NULL) {
-      MACOS_AARCH64_ONLY(ThreadWXEnable wx(WXExec, thread));
-      StubRoutines::UnsafeArrayCopy_stub()(src, dst, sz);
-    } else {
-      Copy::conjoint_memory_atomic(src, dst, sz);
+
+  // An off-heap to off-heap copy may be very large (direct buffers are only
+  // limited by the address space) and the raw addresses stay valid across a
+  // safepoint, so copy it in chunks and poll in between instead of keeping
+  // every other thread waiting at a safepoint until the whole copy is done.
+  // Copies with an end on the heap stay monolithic because a safepoint could
+  // move the object under the raw pointer, as do overlapping copies, which
+  // rely on Copy::conjoint_memory_atomic picking the copy direction for the
+  // whole region at once.
+  bool disjoint = (address)src + sz <= (address)dst || (address)dst + sz <= (address)src;
+  if (srcp == NULL && dstp == NULL && disjoint && sz > unsafe_copy_chunk_size) {
+    address src_c = (address)src;
+    address dst_c = (address)dst;
+    while (sz > unsafe_copy_chunk_size) {
+      unsafe_copy_memory(thread, src_c, dst_c, unsafe_copy_chunk_size);
+      src_c += unsafe_copy_chunk_size;
+      dst_c += unsafe_copy_chunk_size;
+      sz -= unsafe_copy_chunk_size;
+      ThreadBlockInVM tbivm(thread);  // Be safepoint-polite between chunks.
     }
+    unsafe_copy_memory(thread, src_c, dst_c, sz);
+  } else {
+    unsafe_copy_memory(thread, src, dst, sz);
   }
 } UNSAFE_END
 
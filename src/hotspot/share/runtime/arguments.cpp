@@ -2050,6 +2050,30 @@ bool Arguments::check_vm_args_consistency() {
   }
 #endif
 
+  if (UseFastLocking) {
+#if defined(_LP64) && (defined(X86) || defined(AARCH64) || defined(PPC64) || defined(RISCV64))
+    if (VerifyHeavyMonitors) {
+      jio_fprintf(defaultStream::error_stream(),
+                  "-XX:+UseFastLocking and -XX:+VerifyHeavyMonitors are mutually exclusive");
+      return false;
+    }
+    if (UseZGC || UseShenandoahGC) {
+      // The lock stacks hold raw oops that are only fixed up at safepoints;
+      // collectors that relocate objects concurrently are not supported yet.
+      warning("UseFastLocking is not supported with this garbage collector; ignoring");
+      FLAG_SET_DEFAULT(UseFastLocking, false);
+    } else if (!UseHeavyMonitors) {
+      // The interpreter and compiler lock fast paths do not know about the
+      // lock stack yet: route them into the runtime via the heavy-monitor
+      // gates. The runtime then fast-locks instead of inflating.
+      FLAG_SET_ERGO(UseHeavyMonitors, true);
+    }
+#else
+    warning("UseFastLocking is not supported on this platform; ignoring");
+    FLAG_SET_DEFAULT(UseFastLocking, false);
+#endif
+  }
+
 #if !defined(X86) && !defined(AARCH64) && !defined(PPC64) && !defined(RISCV64)
   if (UseHeavyMonitors) {
     jio_fprintf(defaultStream::error_stream(),
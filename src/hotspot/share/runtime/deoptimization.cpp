@@ -902,10 +902,19 @@ class DeoptimizeMarkedClosure : public HandshakeClosure {
   }
 };
 
-void Deoptimization::deoptimize_all_marked(nmethod* nmethod_only) {
+void Deoptimization::deoptimize_marked_frames() {
   ResourceMark rm;
   DeoptimizationMarker dm;
 
+  DeoptimizeMarkedClosure deopt;
+  if (SafepointSynchronize::is_at_safepoint()) {
+    Threads::java_threads_do(&deopt);
+  } else {
+    Handshake::execute(&deopt);
+  }
+}
+
+void Deoptimization::deoptimize_all_marked(nmethod* nmethod_only) {
   // Make the dependent methods not entrant
   if (nmethod_only != NULL) {
     nmethod_only->mark_for_deoptimization();
@@ -915,12 +924,7 @@ void Deoptimization::deoptimize_all_marked(nmethod* nmethod_only) {
     CodeCache::make_marked_nmethods_not_entrant();
   }
 
-  DeoptimizeMarkedClosure deopt;
-  if (SafepointSynchronize::is_at_safepoint()) {
-    Threads::java_threads_do(&deopt);
-  } else {
-    Handshake::execute(&deopt);
-  }
+  deoptimize_marked_frames();
 }
 
 Deoptimization::DeoptAction Deoptimization::_unloaded_action
@@ -1483,7 +1487,11 @@ bool Deoptimization::relock_objects(JavaThread* thread, GrowableArray<MonitorInf
         Handle obj(thread, mon_info->owner());
         markWord mark = obj->mark();
         if (exec_mode == Unpack_none) {
-          if (mark.has_locker() && fr.sp() > (intptr_t*)mark.locker()) {
+          // With fast-locking there is no displaced header to restore:
+          // an object fast-locked in a callee frame is simply re-entered
+          // below, which inflates and counts the extra recursion in the
+          // monitor.
+          if (!UseFastLocking && mark.has_locker() && fr.sp() > (intptr_t*)mark.locker()) {
             // With exec_mode == Unpack_none obj may be thread local and locked in
             // a callee frame. Make the lock in the callee a recursive lock and restore the displaced header.
             markWord dmw = mark.displaced_mark_helper();
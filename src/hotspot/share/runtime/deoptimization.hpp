@@ -154,6 +154,12 @@ class Deoptimization : AllStatic {
   // find all marked nmethods and they are made not_entrant.
   static void deoptimize_all_marked(nmethod* nmethod_only = NULL);
 
+  // Deoptimize any live activations of nmethods that are marked_for_deoptimization,
+  // assuming the caller has already made the marked nmethods not_entrant. Avoids
+  // the code cache scan of deoptimize_all_marked() when the caller tracked the
+  // exact set of nmethods it marked.
+  static void deoptimize_marked_frames();
+
  public:
   // Deoptimizes a frame lazily. Deopt happens on return to the frame.
   static void deoptimize(JavaThread* thread, frame fr, DeoptReason reason = Reason_constraint);
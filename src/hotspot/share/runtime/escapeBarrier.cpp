@@ -25,6 +25,8 @@
 
 #include "precompiled.hpp"
 #include "code/scopeDesc.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "memory/allocation.hpp"
 #include "prims/jvmtiDeferredUpdates.hpp"
 #include "runtime/deoptimization.hpp"
@@ -349,6 +351,7 @@ bool EscapeBarrier::deoptimize_objects_internal(JavaThread* deoptee, intptr_t* f
     vfs->push(cvf);
 
     // reallocate and relock optimized objects
+    EventObjectReallocation event;
     bool deoptimized_objects = Deoptimization::deoptimize_objects_internal(ct, vfs, realloc_failures);
     if (!realloc_failures && deoptimized_objects) {
       // now do the updates
@@ -357,6 +360,12 @@ bool EscapeBarrier::deoptimize_objects_internal(JavaThread* deoptee, intptr_t* f
         cvf->create_deferred_updates_after_object_deoptimization();
       }
       set_objs_are_deoptimized(deoptee, fr_id);
+      if (event.should_commit()) {
+        GrowableArray<ScopeValue*>* objects = vfs->at(0)->scope()->objects();
+        event.set_deoptimizedThread(JFR_THREAD_ID(deoptee));
+        event.set_reallocatedObjects(objects != NULL ? objects->length() : 0);
+        event.commit();
+      }
     }
   }
   return !realloc_failures;
@@ -291,6 +291,17 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, UseInlineCaches, true,                                      \
           "Use Inline Caches for virtual calls ")                           \
                                                                             \
+  product(bool, UseMethodLookupCache, true, DIAGNOSTIC,                     \
+          "Share method lookup results between call sites and class "       \
+          "loaders during link resolution")                                 \
+                                                                            \
+  product(intx, VtableStubDedicatedIndexLimit, 16, DIAGNOSTIC,              \
+          "Generate a dedicated megamorphic dispatch stub per vtable or "   \
+          "itable index below this limit. On supported platforms, higher "  \
+          "indexes share one parameterized dispatch body reached through "  \
+          "a short per-index trampoline stub.")                             \
+          range(0, 32000)                                                   \
+                                                                            \
   product(bool, InlineArrayCopy, true, DIAGNOSTIC,                          \
           "Inline arraycopy native that is known to be part of "            \
           "base library DLL")                                               \
@@ -351,6 +362,10 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, UseVectorizedMismatchIntrinsic, false, DIAGNOSTIC,          \
           "Enables intrinsification of ArraysSupport.vectorizedMismatch()") \
                                                                             \
+  product(bool, UseArraysHashCodeIntrinsic, false, DIAGNOSTIC,              \
+          "Enables intrinsification of the polynomial hash codes in "       \
+          "Arrays.hashCode() and String.hashCode()")                        \
+                                                                            \
   product(bool, UseCopySignIntrinsic, false, DIAGNOSTIC,                    \
           "Enables intrinsification of Math.copySign")                      \
                                                                             \
@@ -434,6 +449,11 @@ const intx ObjectAlignmentInBytes = 8;
           "Number of ring buffer event logs")                               \
           range(1, NOT_LP64(1*K) LP64_ONLY(1*M))                            \
                                                                             \
+  product(ccstr, LogEventsBufferEntriesPerLog, NULL, DIAGNOSTIC,            \
+          "Per-log override of LogEventsBufferEntries, as a comma-"         \
+          "separated list of handle=entries pairs using the log handles "   \
+          "of the VM.events command (e.g. deopt=500,exc=100)")              \
+                                                                            \
   product(bool, BytecodeVerificationRemote, true, DIAGNOSTIC,               \
           "Enable the Java bytecode verifier for remote classes")           \
                                                                             \
@@ -705,6 +725,12 @@ const intx ObjectAlignmentInBytes = 8;
           "at one time (minimum is 1024).")                      \
           range(1024, max_jint)                                             \
                                                                             \
+  product(size_t, MonitorPoolMaxCached, 65536, DIAGNOSTIC,                  \
+          "Maximum number of free ObjectMonitor blocks retained by the "    \
+          "monitor block pool (0 disables pooling). Blocks beyond the "     \
+          "limit are returned to the C heap on deflation.")                 \
+          range(0, max_uintx)                                               \
+                                                                            \
   product(intx, MonitorUsedDeflationThreshold, 90, DIAGNOSTIC,              \
           "Percentage of used monitors before triggering deflation (0 is "  \
           "off). The check is performed on GuaranteedSafepointInterval "    \
@@ -773,6 +799,12 @@ const intx ObjectAlignmentInBytes = 8;
   notproduct(bool, PrintFieldLayout, false,                                 \
           "Print field layout for each class")                              \
                                                                             \
+  product(ccstr, FieldLayoutProfileFile, NULL, EXPERIMENTAL,                \
+          "File containing a field access profile from a training run, "    \
+          "one \"<classname> <fieldname>\" pair per line. Fields listed "   \
+          "in the profile are allocated first in instance layouts, so "     \
+          "they cluster in the first cache line after the object header")   \
+                                                                            \
   /* Need to limit the extent of the padding to reasonable size.          */\
   /* 8K is well beyond the reasonable HW cache line size, even with       */\
   /* aggressive prefetching, while still leaving the room for segregating */\
@@ -860,6 +892,14 @@ const intx ObjectAlignmentInBytes = 8;
   develop(bool, TraceICBuffer, false,                                       \
           "Trace usage of IC buffer")                                       \
                                                                             \
+  product(size_t, InlineCacheBufferSize, 10*K, DIAGNOSTIC,                  \
+          "Size of the buffer holding inline cache transition stubs. "     \
+          "The buffer drains at every safepoint; when it fills up "         \
+          "between safepoints, an extra ICBufferFull safepoint is "         \
+          "forced. Larger values trade code cache footprint for fewer "     \
+          "forced safepoints under heavy inline cache churn.")              \
+          range(1*K, 512*K)                                                 \
+                                                                            \
   develop(bool, TraceCompiledIC, false,                                     \
           "Trace changes of compiled IC")                                   \
                                                                             \
@@ -941,6 +981,14 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, EnableThreadSMRStatistics, trueInDebug, DIAGNOSTIC,         \
              "Enable Thread SMR Statistics")                                \
                                                                             \
+  product(uintx, ThreadsListReclaimThreshold, 1, DIAGNOSTIC,                \
+             "Number of pending freeable ThreadsLists that triggers a "     \
+             "hazard pointer scan and reclaim pass in "                     \
+             "ThreadsSMRSupport::free_list(). A value of 1 scans on "       \
+             "every call; larger values amortize the O(live threads) "      \
+             "scan over that many thread list changes")                     \
+             range(1, max_uintx)                                            \
+                                                                            \
   product(bool, UseNotificationThread, true,                                \
           "Use Notification Thread")                                        \
                                                                             \
@@ -974,6 +1022,15 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, PrintTouchedMethodsAtExit, false, DIAGNOSTIC,               \
           "Print all methods that have been ever touched in runtime")       \
                                                                             \
+  product(uintx, MethodCountersDeferThreshold, 0, DIAGNOSTIC,               \
+          "Number of interpreted invocations a method must accumulate "     \
+          "before its MethodCounters are allocated. Deferring keeps "       \
+          "once-executed methods from consuming metaspace, at the cost "    \
+          "of a runtime call per counter update until the threshold is "    \
+          "reached, and delays compilation triggers by up to that many "    \
+          "invocations. 0 allocates counters on first use.")                \
+          range(0, 65534)                                                   \
+                                                                            \
   develop(bool, TraceMethodReplacement, false,                              \
           "Print when methods are replaced do to recompilation")            \
                                                                             \
@@ -1069,6 +1126,13 @@ const intx ObjectAlignmentInBytes = 8;
           "Checks that no stack locking happens when using "                \
           "+UseHeavyMonitors")                                              \
                                                                             \
+  product(bool, UseFastLocking, false, EXPERIMENTAL,                        \
+          "Record uncontended lock ownership in per-thread lock stacks "    \
+          "instead of displacing the object header to the stack. The "      \
+          "generated lock fast paths do not know about lock stacks yet, "   \
+          "so this implies +UseHeavyMonitors to route them into the "       \
+          "runtime")                                                        \
+                                                                            \
   product(bool, PrintStringTableStatistics, false,                          \
           "print statistics about the StringTable and SymbolTable")         \
                                                                             \
@@ -1307,11 +1371,32 @@ const intx ObjectAlignmentInBytes = 8;
           "Delay in milliseconds for option SafepointTimeout")              \
           range(0, max_intx LP64_ONLY(/MICROUNITS))                         \
                                                                             \
+  product(uintx, SafepointCleanupBudget, 0, DIAGNOSTIC,                     \
+          "Time budget in milliseconds for the deferrable safepoint "       \
+          "cleanup subtasks (symbol/string table rehashing, dictionary "    \
+          "resizing). Subtasks not started within the budget carry over "   \
+          "to a later safepoint cleanup. 0 means no budget.")               \
+          range(0, max_jint)                                                \
+                                                                            \
+  product(uintx, TTSPProfilingThreshold, 0, DIAGNOSTIC,                     \
+          "Attribute time-to-safepoint stalls to the code the straggler "   \
+          "threads were executing once safepoint synchronization has "      \
+          "taken longer than this many milliseconds. Results are "          \
+          "reported as JFR events and by the VM.ttsp diagnostic "           \
+          "command. 0 means disabled")                                      \
+          range(0, max_jint)                                                \
+                                                                            \
   product(intx, NmethodSweepActivity, 10,                                   \
           "Removes cold nmethods from code cache if > 0. Higher values "    \
           "result in more aggressive sweeping")                             \
           range(0, 2000)                                                    \
                                                                             \
+  product(intx, NmethodSweepBatchSize, 0, DIAGNOSTIC,                       \
+          "Maximum number of nmethods processed per sweeper invocation. "   \
+          "A traversal that hits the bound is continued on the next "       \
+          "invocation. 0 sweeps the whole code cache in one invocation")    \
+          range(0, max_jint)                                                \
+                                                                            \
   notproduct(bool, LogSweeper, false,                                       \
           "Keep a ring buffer of sweeper activity")                         \
                                                                             \
@@ -1796,6 +1881,11 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, VerifySharedSpaces, false,                                  \
           "Verify integrity of shared spaces")                              \
                                                                             \
+  product(bool, PrefetchSharedHeapRegions, false, DIAGNOSTIC,               \
+          "Fault in the mapped archive heap regions right after mapping "   \
+          "them, instead of taking demand faults on first use of the "      \
+          "archived objects")                                               \
+                                                                            \
   product(bool, RecordDynamicDumpInfo, false,                               \
           "Record class info for jcmd VM.cds dynamic_dump")                 \
                                                                             \
@@ -1884,6 +1974,13 @@ const intx ObjectAlignmentInBytes = 8;
           "Number of buckets in the JVM internal Symbol table")             \
           range(minimumSymbolTableSize, 16777216ul /* 2^24 */)              \
                                                                             \
+  product(uintx, ResolvedMethodTableSize, 1024, DIAGNOSTIC,                 \
+          "Number of buckets the resolved method table starts with "        \
+          "(will be rounded to nearest higher power of 2). Pre-sizing "     \
+          "the table avoids growing it while MethodHandle-heavy "           \
+          "applications are running.")                                      \
+          range(128, 16777216ul /* 2^24 */)                                 \
+                                                                            \
   product(bool, UseStringDeduplication, false,                              \
           "Use string deduplication")                                       \
                                                                             \
@@ -75,6 +75,13 @@ inline void HandleMark::push() {
   debug_only(_area->_handle_mark_nesting++);
 }
 
+// In the common case, where the scope stayed within the chunk that was
+// current when the mark was set, this is a plain O(1) rollback of the three
+// top-of-arena markers - no chunk walking, no freeing. Only scopes that
+// overflowed into additional chunks pay for chopping them, and those chunks
+// go back to the size-classed ChunkPool free lists rather than to malloc,
+// so a JNI upcall that repeatedly overflows at the same depth recycles the
+// same pooled chunk instead of churning the C heap.
 inline void HandleMark::pop_and_restore() {
   // Delete later chunks
   if(_chunk->next() != NULL) {
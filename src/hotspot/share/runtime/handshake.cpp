@@ -625,27 +625,37 @@ HandshakeState::ProcessResult HandshakeState::try_process(HandshakeOperation* ma
 
   assert(op != NULL, "Must have an op");
   assert(SafepointMechanism::local_poll_armed(_handshakee), "Must be");
-  assert(op->_target == NULL || _handshakee == op->_target, "Wrong thread");
-
-  log_trace(handshake)("Processing handshake " INTPTR_FORMAT " by %s(%s)", p2i(op),
-                       op == match_op ? "handshaker" : "cooperative",
-                       current_thread->is_VM_thread() ? "VM Thread" : "JavaThread");
-
-  op->prepare(_handshakee, current_thread);
 
+  // While we own the mutex the handshakee cannot leave its safe state (see
+  // can_process_handshake()), so fuse all currently pending operations into
+  // this single visit instead of re-claiming the thread once per operation.
+  int executed = 0;
+  bool executed_match_op = false;
   set_active_handshaker(current_thread);
-  op->do_handshake(_handshakee); // acquire, op removed after
+  do {
+    assert(op->_target == NULL || _handshakee == op->_target, "Wrong thread");
+
+    log_trace(handshake)("Processing handshake " INTPTR_FORMAT " by %s(%s)", p2i(op),
+                         op == match_op ? "handshaker" : "cooperative",
+                         current_thread->is_VM_thread() ? "VM Thread" : "JavaThread");
+
+    op->prepare(_handshakee, current_thread);
+    op->do_handshake(_handshakee); // acquire, op removed after
+    executed_match_op |= (op == match_op);
+    executed++;
+    remove_op(op);
+    op = get_op();
+  } while (op != NULL);
   set_active_handshaker(NULL);
-  remove_op(op);
 
   _lock.unlock();
 
-  log_trace(handshake)("%s(" INTPTR_FORMAT ") executed an op for JavaThread: " INTPTR_FORMAT " %s target op: " INTPTR_FORMAT,
+  log_trace(handshake)("%s(" INTPTR_FORMAT ") executed %d op(s) in one visit for JavaThread: " INTPTR_FORMAT " %s target op: " INTPTR_FORMAT,
                        current_thread->is_VM_thread() ? "VM Thread" : "JavaThread",
-                       p2i(current_thread), p2i(_handshakee),
-                       op == match_op ? "including" : "excluding", p2i(match_op));
+                       p2i(current_thread), executed, p2i(_handshakee),
+                       executed_match_op ? "including" : "excluding", p2i(match_op));
 
-  return op == match_op ? HandshakeState::_succeeded : HandshakeState::_processed;
+  return executed_match_op ? HandshakeState::_succeeded : HandshakeState::_processed;
 }
 
 void HandshakeState::do_self_suspend() {
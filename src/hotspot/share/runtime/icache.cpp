@@ -31,6 +31,8 @@
 // The flush stub function address
 AbstractICache::flush_icache_stub_t AbstractICache::_flush_icache_stub = NULL;
 
+THREAD_LOCAL int AbstractICache::_flush_suppress_count = 0;
+
 void AbstractICache::initialize() {
   // Making this stub must be FIRST use of assembler
   ResourceMark rm;
@@ -75,6 +77,10 @@ void AbstractICache::invalidate_word(address addr) {
   // if the word to be flushed started in the last 4 bytes of the line.
   // Doing that would segv if the next line weren't mapped.
 
+  if (flush_suppressed()) {
+    return;
+  }
+
   const int word_size_in_bytes = 4; // Always, regardless of platform
 
   intptr_t start_line = ((intptr_t)addr + 0) & ~(ICache::line_size - 1);
@@ -91,7 +97,7 @@ void AbstractICache::invalidate_range(address start, int nbytes) {
     firstTime = false;
     return;
   }
-  if (nbytes == 0) {
+  if (nbytes == 0 || flush_suppressed()) {
     return;
   }
   // Align start address to an icache line boundary and transform
@@ -42,6 +42,8 @@
 // architecture-specific files, i.e., icache_<arch>.hpp/.cpp
 
 class AbstractICache : AllStatic {
+  friend class ICacheFlushSuppressor;
+
  public:
   // The flush stub signature
   typedef int (*flush_icache_stub_t)(address addr, int lines, int magic);
@@ -50,6 +52,10 @@ class AbstractICache : AllStatic {
   // The flush stub function address
   static flush_icache_stub_t _flush_icache_stub;
 
+  // Incremented by ICacheFlushSuppressor; flushes by the current thread are
+  // skipped while this is non-zero.
+  static THREAD_LOCAL int _flush_suppress_count;
+
   // Call the flush stub
   static void call_flush_stub(address start, int lines);
 
@@ -60,11 +66,26 @@ class AbstractICache : AllStatic {
     log2_line_size = 0  // log2(line_size)
   };
 
+  static bool flush_suppressed() { return _flush_suppress_count > 0; }
+
   static void initialize();
   static void invalidate_word(address addr);
   static void invalidate_range(address start, int nbytes);
 };
 
+// Suppresses icache flushing by the current thread for the duration of a
+// scope. For code that patches many sites in a blob that is not yet
+// executable and issues one invalidate_range covering the whole blob
+// afterwards, the per-site flushes issued deep in the patching code (e.g. by
+// Relocation::pd_set_data_value) are redundant; suppressing them coalesces
+// the icache maintenance into the single covering flush. The covering flush
+// must be issued after this scope has been exited.
+class ICacheFlushSuppressor : public StackObj {
+ public:
+  ICacheFlushSuppressor()  { AbstractICache::_flush_suppress_count++; }
+  ~ICacheFlushSuppressor() { AbstractICache::_flush_suppress_count--; }
+};
+
 
 // Must be included before the definition of ICacheStubGenerator
 // because ICacheStubGenerator uses ICache definitions.
@@ -74,6 +74,7 @@ void interpreter_init_stub();  // before any methods loaded
 void interpreter_init_code();  // after methods loaded, but before they are linked
 void accessFlags_init();
 void InterfaceSupport_init();
+void fieldLayoutProfile_init();  // must be before universe2_init, consulted when class layouts are computed
 void universe2_init();  // dependent on codeCache_init and stubRoutines_init, loads primordial classes
 void referenceProcessor_init();
 void jni_handles_init();
@@ -129,6 +130,7 @@ jint init_globals() {
   InterfaceSupport_init();
   VMRegImpl::set_regName(); // need this before generate_stubs (for printing oop maps).
   SharedRuntime::generate_stubs();
+  fieldLayoutProfile_init(); // before any class layout is computed
   universe2_init();  // dependent on codeCache_init and stubRoutines_init1
   javaClasses_init();// must happen after vtable initialization, before referenceProcessor_init
   interpreter_init_code();  // after javaClasses_init and before any method gets linked
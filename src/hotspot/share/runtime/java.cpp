@@ -31,6 +31,7 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "code/codeCache.hpp"
+#include "compiler/compilationWarmup.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerOracle.hpp"
 #include "gc/shared/collectedHeap.hpp"
@@ -489,6 +490,10 @@ void before_exit(JavaThread* thread) {
   }
 #endif
 
+  if (WarmupRecordFile != NULL && WarmupRecordAtExit) {
+    CompilationWarmup::record_at_exit(thread);
+  }
+
   if (JvmtiExport::should_post_thread_life()) {
     JvmtiExport::post_thread_end(thread);
   }
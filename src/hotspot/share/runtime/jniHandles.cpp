@@ -88,7 +88,16 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    // Prefer an entry from the thread local cache, where destroy_global
+    // parks released entries, over taking the storage allocation mutex.
+    oop* ptr = NULL;
+    Thread* current = Thread::current();
+    if (current->is_Java_thread()) {
+      ptr = JavaThread::cast(current)->jni_global_handle_cache_pop();
+    }
+    if (ptr == NULL) {
+      ptr = global_handles()->allocate();
+    }
     // Return NULL on allocation failure.
     if (ptr != NULL) {
       assert(*ptr == NULL, "invariant");
@@ -148,10 +157,25 @@ void JNIHandles::destroy_global(jobject handle) {
     assert(!is_jweak(handle), "wrong method for destroying jweak");
     oop* oop_ptr = jobject_ptr(handle);
     NativeAccess<>::oop_store(oop_ptr, (oop)NULL);
+    // Park the cleared entry in the thread local cache for reuse by
+    // make_global, unless the cache is full.
+    Thread* current = Thread::current();
+    if (current->is_Java_thread() &&
+        JavaThread::cast(current)->jni_global_handle_cache_push(oop_ptr)) {
+      return;
+    }
     global_handles()->release(oop_ptr);
   }
 }
 
+void JNIHandles::release_global_handle_cache(JavaThread* thread) {
+  oop* buf[JavaThread::jni_global_handle_cache_capacity];
+  int count = thread->jni_global_handle_cache_drain(buf);
+  if (count > 0) {
+    global_handles()->release(buf, count);
+  }
+}
+
 
 void JNIHandles::destroy_weak_global(jobject handle) {
   if (handle != NULL) {
@@ -92,6 +92,9 @@ class JNIHandles : AllStatic {
   static jobject make_global(Handle  obj,
                              AllocFailType alloc_failmode = AllocFailStrategy::EXIT_OOM);
   static void destroy_global(jobject handle);
+  // Releases the thread local cache of unused global handle entries.
+  // Called when the thread exits or a failed attach is cleaned up.
+  static void release_global_handle_cache(JavaThread* thread);
 
   // Weak global handles
   static jobject make_weak_global(Handle obj,
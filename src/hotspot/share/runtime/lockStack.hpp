@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_RUNTIME_LOCKSTACK_HPP
+#define SHARE_RUNTIME_LOCKSTACK_HPP
+
+#include "oops/oopsHierarchy.hpp"
+#include "utilities/debug.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class OopClosure;
+
+// Per-thread record of the objects fast-locked by the thread (see
+// -XX:+UseFastLocking). Ownership of a fast-locked object is expressed
+// solely by the object being present in the owning thread's lock stack;
+// the object's mark word only has its lock bits flipped and otherwise
+// stays in place. The stack is bounded: recursive locking and overflow
+// are handled by inflating an ObjectMonitor instead. Only the owning
+// thread pushes and removes entries; other threads may scan a lock
+// stack for diagnostic purposes, see Threads::owning_thread_from_object().
+// All entries are strong roots and are processed by JavaThread::oops_do().
+class LockStack {
+  friend class VMStructs;
+ private:
+  static const int CAPACITY = 8;
+  oop _base[CAPACITY];
+  int _top;               // index of the next free slot
+
+ public:
+  LockStack();
+
+  bool can_push() const { return _top < CAPACITY; }
+  bool is_empty() const { return _top == 0; }
+
+  void push(oop o) {
+    assert(can_push(), "lock stack overflow");
+    assert(!contains(o), "recursive fast-locking must inflate");
+    _base[_top++] = o;
+  }
+
+  bool contains(oop o) const {
+    for (int i = 0; i < _top; i++) {
+      if (_base[i] == o) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Remove the (single) entry for o, if any; entries pushed above it keep
+  // their order. Returns true if an entry was removed. Entries are not
+  // necessarily removed in LIFO order: inflation of a fast-lock in the
+  // middle of the stack (e.g. for wait()) removes that entry in place.
+  bool remove(oop o) {
+    for (int i = 0; i < _top; i++) {
+      if (_base[i] == o) {
+        for (int j = i; j < _top - 1; j++) {
+          _base[j] = _base[j + 1];
+        }
+        _top--;
+        DEBUG_ONLY(_base[_top] = NULL;)
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // GC support
+  void oops_do(OopClosure* cl);
+};
+
+#endif // SHARE_RUNTIME_LOCKSTACK_HPP
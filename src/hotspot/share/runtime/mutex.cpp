@@ -23,6 +23,8 @@
  */
 
 #include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
@@ -85,6 +87,18 @@ void Mutex::check_no_safepoint_state(Thread* thread) {
 
 void Mutex::lock_contended(Thread* self) {
   DEBUG_ONLY(int retry_cnt = 0;)
+  // The event's duration is the time this thread spent blocked; commit()
+  // writes to the thread-local JFR buffer, so the only cost when the event
+  // is disabled (the default) is the is_enabled()/should_commit() branch.
+  EventVMMutexBlocked event;
+  uintx previous_owner_tid = 0;
+  if (EventVMMutexBlocked::is_enabled()) {
+    // Racy read; the owner may be releasing the lock right now.
+    Thread* prev_owner = owner();
+    if (prev_owner != NULL) {
+      previous_owner_tid = (uintx)JFR_THREAD_ID(prev_owner);
+    }
+  }
   bool is_active_Java_thread = self->is_active_Java_thread();
   do {
     #ifdef ASSERT
@@ -110,6 +124,12 @@ void Mutex::lock_contended(Thread* self) {
       break;
     }
   } while (!_lock.try_lock());
+
+  if (event.should_commit()) {
+    event.set_name(name());
+    event.set_previousOwner(previous_owner_tid);
+    event.commit();
+  }
 }
 
 void Mutex::lock(Thread* self) {
@@ -256,6 +256,52 @@ static void check_object_context() {
 #endif // ASSERT
 }
 
+// Block pool for ObjectMonitor storage. Deflation returns monitors in
+// large batches and inflation storms consume them in bursts; recycling
+// the blocks through a spin-locked free list keeps both off the C heap
+// allocator. The link is stored in the first word of the free block
+// itself; a block is never handed out while it is on the list, so the
+// storage is not otherwise in use.
+struct ObjectMonitorFreeBlock {
+  ObjectMonitorFreeBlock* _next;
+};
+
+static ObjectMonitorFreeBlock* g_om_free_list = NULL;
+static volatile size_t g_om_free_count = 0;
+static volatile int g_om_pool_lock = 0;
+
+void* ObjectMonitor::operator new(size_t size) throw() {
+  assert(size == sizeof(ObjectMonitor), "no subclassing");
+  if (MonitorPoolMaxCached > 0) {
+    Thread::SpinAcquire(&g_om_pool_lock, "ObjectMonitorPool");
+    ObjectMonitorFreeBlock* block = g_om_free_list;
+    if (block != NULL) {
+      g_om_free_list = block->_next;
+      g_om_free_count--;
+      Thread::SpinRelease(&g_om_pool_lock);
+      return block;
+    }
+    Thread::SpinRelease(&g_om_pool_lock);
+  }
+  return AllocateHeap(size, mtObjectMonitor);
+}
+
+void ObjectMonitor::operator delete(void* p) {
+  if (MonitorPoolMaxCached > 0) {
+    Thread::SpinAcquire(&g_om_pool_lock, "ObjectMonitorPool");
+    if (g_om_free_count < MonitorPoolMaxCached) {
+      ObjectMonitorFreeBlock* block = (ObjectMonitorFreeBlock*)p;
+      block->_next = g_om_free_list;
+      g_om_free_list = block;
+      g_om_free_count++;
+      Thread::SpinRelease(&g_om_pool_lock);
+      return;
+    }
+    Thread::SpinRelease(&g_om_pool_lock);
+  }
+  FreeHeap(p);
+}
+
 ObjectMonitor::ObjectMonitor(oop object) :
   _header(markWord::zero()),
   _object(_oop_storage, object),
@@ -1861,6 +1907,7 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
         if (x < Knob_Poverty) x = Knob_Poverty;
         _SpinDuration = x + Knob_BonusB;
       }
+      OM_PERFDATA_OP(SpinAcquires, inc());
       return 1;
     }
     SpinPause();
@@ -1954,6 +2001,7 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
           if (x < Knob_Poverty) x = Knob_Poverty;
           _SpinDuration = x + Knob_Bonus;
         }
+        OM_PERFDATA_OP(SpinAcquires, inc());
         return 1;
       }
 
@@ -1984,19 +2032,21 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
     }
   }
 
-  // Spin failed with prejudice -- reduce _SpinDuration.
-  // TODO: Use an AIMD-like policy to adjust _SpinDuration.
-  // AIMD is globally stable.
+  // Spin failed with prejudice -- reduce _SpinDuration with an AIMD-like
+  // policy: additive increase on success, multiplicative decrease on
+  // failure. AIMD is globally stable, and the multiplicative term makes
+  // monitors protecting consistently long critical sections converge to
+  // no spinning in a few failed attempts instead of burning a full spin
+  // budget per attempt while the additive penalty slowly catches up.
   {
     int x = _SpinDuration;
     if (x > 0) {
-      // Consider an AIMD scheme like: x -= (x >> 3) + 100
-      // This is globally sample and tends to damp the response.
-      x -= Knob_Penalty;
+      x -= (x >> 3) + Knob_Penalty;
       if (x < 0) x = 0;
       _SpinDuration = x;
     }
   }
+  OM_PERFDATA_OP(FailedSpins, inc());
 
  Abort:
   if (_succ == current) {
@@ -2151,6 +2201,8 @@ PerfCounter * ObjectMonitor::_sync_ContendedLockAttempts       = NULL;
 PerfCounter * ObjectMonitor::_sync_FutileWakeups               = NULL;
 PerfCounter * ObjectMonitor::_sync_Parks                       = NULL;
 PerfCounter * ObjectMonitor::_sync_Notifications               = NULL;
+PerfCounter * ObjectMonitor::_sync_SpinAcquires                = NULL;
+PerfCounter * ObjectMonitor::_sync_FailedSpins                 = NULL;
 PerfCounter * ObjectMonitor::_sync_Inflations                  = NULL;
 PerfCounter * ObjectMonitor::_sync_Deflations                  = NULL;
 PerfLongVariable * ObjectMonitor::_sync_MonExtant              = NULL;
@@ -2188,6 +2240,8 @@ void ObjectMonitor::Initialize() {
     NEWPERFCOUNTER(_sync_FutileWakeups);
     NEWPERFCOUNTER(_sync_Parks);
     NEWPERFCOUNTER(_sync_Notifications);
+    NEWPERFCOUNTER(_sync_SpinAcquires);
+    NEWPERFCOUNTER(_sync_FailedSpins);
     NEWPERFVARIABLE(_sync_MonExtant);
 #undef NEWPERFCOUNTER
 #undef NEWPERFVARIABLE
@@ -147,6 +147,12 @@ class ObjectMonitor : public CHeapObj<mtObjectMonitor> {
                         sizeof(WeakHandle));
   // Used by async deflation as a marker in the _owner field:
   #define DEFLATER_MARKER reinterpret_cast<void*>(-1)
+  // With -XX:+UseFastLocking, marks the _owner field of a monitor that was
+  // inflated over a fast-lock held by a thread other than the inflating one.
+  // The owner is known only to itself (via its lock stack) and claims the
+  // monitor when it next takes the monitor slow path, see
+  // ObjectSynchronizer::inflate().
+  #define ANONYMOUS_OWNER reinterpret_cast<void*>(1)
   void* volatile _owner;            // pointer to owning thread OR BasicLock
   volatile uint64_t _previous_owner_tid;  // thread id of the previous owner of the monitor
   // Separate _owner and _next_om on different cache lines since
@@ -197,6 +203,8 @@ class ObjectMonitor : public CHeapObj<mtObjectMonitor> {
   static PerfCounter * _sync_FutileWakeups;
   static PerfCounter * _sync_Parks;
   static PerfCounter * _sync_Notifications;
+  static PerfCounter * _sync_SpinAcquires;
+  static PerfCounter * _sync_FailedSpins;
   static PerfCounter * _sync_Inflations;
   static PerfCounter * _sync_Deflations;
   static PerfLongVariable * _sync_MonExtant;
@@ -251,6 +259,10 @@ class ObjectMonitor : public CHeapObj<mtObjectMonitor> {
   void*     owner_raw() const;
   // Returns true if owner field == DEFLATER_MARKER and false otherwise.
   bool      owner_is_DEFLATER_MARKER() const;
+  // Returns true if owner field == ANONYMOUS_OWNER and false otherwise.
+  bool      is_owner_anonymous() const;
+  // Set _owner field to owner; current value must be ANONYMOUS_OWNER.
+  void      set_owner_from_anonymous(JavaThread* owner);
   // Returns true if 'this' is being async deflated and false otherwise.
   bool      is_being_async_deflated();
   // Clear _owner field; current value must match old_value.
@@ -291,6 +303,13 @@ class ObjectMonitor : public CHeapObj<mtObjectMonitor> {
   ObjectMonitor(oop object);
   ~ObjectMonitor();
 
+  // ObjectMonitors are allocated and freed in batches during inflation
+  // storms and deflation cycles. Back them with a block pool that
+  // recycles monitor-sized blocks instead of going to the C heap for
+  // each inflation.
+  void* operator new(size_t size) throw();
+  void operator delete(void* p);
+
   oop       object() const;
   oop       object_peek() const;
 
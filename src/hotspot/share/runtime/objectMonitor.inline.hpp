@@ -73,6 +73,19 @@ inline bool ObjectMonitor::owner_is_DEFLATER_MARKER() const {
   return owner_raw() == DEFLATER_MARKER;
 }
 
+// Returns true if owner field == ANONYMOUS_OWNER and false otherwise.
+inline bool ObjectMonitor::is_owner_anonymous() const {
+  return owner_raw() == ANONYMOUS_OWNER;
+}
+
+// Set _owner field to owner; current value must be ANONYMOUS_OWNER.
+// Only the anonymous owner itself can tell that it is the owner (by
+// finding the object in its lock stack), so there is no race with other
+// claimants and no cmpxchg() is needed.
+inline void ObjectMonitor::set_owner_from_anonymous(JavaThread* owner) {
+  set_owner_from(ANONYMOUS_OWNER, owner);
+}
+
 // Returns true if 'this' is being async deflated and false otherwise.
 inline bool ObjectMonitor::is_being_async_deflated() {
   return contentions() < 0;
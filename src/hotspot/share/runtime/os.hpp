@@ -549,6 +549,13 @@ class os: AllStatic {
   // the input pointer.
   static char* native_path(char *path);
   static int ftruncate(int fd, jlong length);
+  // Best-effort preallocation of backing store for [0, length) of an open
+  // file, without changing the visible file size. Returns false when the
+  // platform or the underlying file system does not support it.
+  static bool preallocate(int fd, jlong length);
+  // Release backing store preallocated beyond the visible file size with
+  // os::preallocate().
+  static void release_preallocation(int fd, jlong offset, jlong length);
   static int get_fileno(FILE* fp);
   static void flockfile(FILE* fp);
   static void funlockfile(FILE* fp);
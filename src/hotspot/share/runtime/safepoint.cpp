@@ -23,11 +23,13 @@
  */
 
 #include "precompiled.hpp"
+#include "jvm_io.h"
 #include "classfile/classLoaderDataGraph.hpp"
 #include "classfile/dictionary.hpp"
 #include "classfile/stringTable.hpp"
 #include "classfile/symbolTable.hpp"
 #include "code/codeCache.hpp"
+#include "code/debugInfoRec.hpp"
 #include "code/icBuffer.hpp"
 #include "code/nmethod.hpp"
 #include "code/pcDesc.hpp"
@@ -54,6 +56,7 @@
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "runtime/osThread.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointMechanism.inline.hpp"
@@ -141,6 +144,7 @@ const uint64_t SafepointSynchronize::InactiveSafepointCounter = 0;
 int SafepointSynchronize::_current_jni_active_count = 0;
 
 WaitBarrier* SafepointSynchronize::_wait_barrier;
+WaitBarrier* SafepointSynchronize::_priority_wait_barrier;
 
 static bool timeout_error_printed = false;
 
@@ -152,6 +156,7 @@ void SafepointSynchronize::init(Thread* vmthread) {
   // WaitBarrier should never be destroyed since we will have
   // threads waiting on it while exiting.
   _wait_barrier = new WaitBarrier(vmthread);
+  _priority_wait_barrier = new WaitBarrier(vmthread);
   SafepointTracing::init();
 }
 
@@ -324,6 +329,7 @@ void SafepointSynchronize::arm_safepoint() {
   // the wait barrier for the next safepoint id/counter.
   // Arming must be done after resetting _current_jni_active_count, _waiting_to_block.
   _wait_barrier->arm(static_cast<int>(_safepoint_counter + 1));
+  _priority_wait_barrier->arm(static_cast<int>(_safepoint_counter + 1));
 
   assert((_safepoint_counter & 0x1) == 0, "must be even");
   // The store to _safepoint_counter must happen after any stores in arming.
@@ -487,7 +493,9 @@ void SafepointSynchronize::disarm_safepoint() {
   // Release threads lock, so threads can be created/destroyed again.
   Threads_lock->unlock();
 
-  // Wake threads after local state is correctly set.
+  // Wake threads after local state is correctly set. Latency-sensitive
+  // threads resume first, before the bulk of the wakeups.
+  _priority_wait_barrier->disarm();
   _wait_barrier->disarm();
 }
 
@@ -524,73 +532,81 @@ public:
   }
 };
 
+class CleanupTracer {
+private:
+  const char*               _name;
+  EventSafepointCleanupTask _event;
+  TraceTime                 _timer;
+
+public:
+  CleanupTracer(const char* name) :
+      _name(name),
+      _event(),
+      _timer(name, TRACETIME_LOG(Info, safepoint, cleanup)) {}
+  ~CleanupTracer() {
+    post_safepoint_cleanup_task_event(_event, SafepointSynchronize::safepoint_id(), _name);
+  }
+};
+
+static jlong cleanup_deadline_counter() {
+  return SafepointCleanupBudget == 0 ? max_jlong :
+         os::elapsed_counter() +
+         (jlong)(SafepointCleanupBudget * (os::elapsed_frequency() / 1000.0));
+}
+
+// Deferrable cleanup work is skipped once the budget is spent. The trigger
+// conditions are sticky, so skipped work carries over to a later cleanup.
+static bool past_deadline(jlong deadline_counter) {
+  return os::elapsed_counter() > deadline_counter;
+}
+
 class ParallelSPCleanupTask : public WorkerTask {
 private:
   SubTasksDone _subtasks;
   uint _num_workers;
   bool _do_lazy_roots;
-
-  class Tracer {
-  private:
-    const char*               _name;
-    EventSafepointCleanupTask _event;
-    TraceTime                 _timer;
-
-  public:
-    Tracer(const char* name) :
-        _name(name),
-        _event(),
-        _timer(name, TRACETIME_LOG(Info, safepoint, cleanup)) {}
-    ~Tracer() {
-      post_safepoint_cleanup_task_event(_event, SafepointSynchronize::safepoint_id(), _name);
-    }
-  };
+  jlong _deadline_counter;
 
 public:
-  ParallelSPCleanupTask(uint num_workers) :
+  ParallelSPCleanupTask(uint num_workers, jlong deadline_counter) :
     WorkerTask("Parallel Safepoint Cleanup"),
     _subtasks(SafepointSynchronize::SAFEPOINT_CLEANUP_NUM_TASKS),
     _num_workers(num_workers),
     _do_lazy_roots(!VMThread::vm_operation()->skip_thread_oop_barriers() &&
-                   Universe::heap()->uses_stack_watermark_barrier()) {}
+                   Universe::heap()->uses_stack_watermark_barrier()),
+    _deadline_counter(deadline_counter) {}
+
+  bool past_deadline() const {
+    return ::past_deadline(_deadline_counter);
+  }
 
   void work(uint worker_id) {
     if (_subtasks.try_claim_task(SafepointSynchronize::SAFEPOINT_CLEANUP_LAZY_ROOT_PROCESSING)) {
       if (_do_lazy_roots) {
-        Tracer t("lazy partial thread root processing");
+        CleanupTracer t("lazy partial thread root processing");
         ParallelSPCleanupThreadClosure cl;
         Threads::threads_do(&cl);
       }
     }
 
     if (_subtasks.try_claim_task(SafepointSynchronize::SAFEPOINT_CLEANUP_UPDATE_INLINE_CACHES)) {
-      Tracer t("updating inline caches");
+      CleanupTracer t("updating inline caches");
       InlineCacheBuffer::update_inline_caches();
     }
 
     if (_subtasks.try_claim_task(SafepointSynchronize::SAFEPOINT_CLEANUP_COMPILATION_POLICY)) {
-      Tracer t("compilation policy safepoint handler");
+      CleanupTracer t("compilation policy safepoint handler");
       CompilationPolicy::do_safepoint_work();
     }
 
-    if (_subtasks.try_claim_task(SafepointSynchronize::SAFEPOINT_CLEANUP_SYMBOL_TABLE_REHASH)) {
-      if (SymbolTable::needs_rehashing()) {
-        Tracer t("rehashing symbol table");
-        SymbolTable::rehash_table();
-      }
-    }
-
-    if (_subtasks.try_claim_task(SafepointSynchronize::SAFEPOINT_CLEANUP_STRING_TABLE_REHASH)) {
-      if (StringTable::needs_rehashing()) {
-        Tracer t("rehashing string table");
-        StringTable::rehash_table();
-      }
-    }
-
     if (_subtasks.try_claim_task(SafepointSynchronize::SAFEPOINT_CLEANUP_SYSTEM_DICTIONARY_RESIZE)) {
       if (Dictionary::does_any_dictionary_needs_resizing()) {
-        Tracer t("resizing system dictionaries");
-        ClassLoaderDataGraph::resize_dictionaries();
+        if (past_deadline()) {
+          log_debug(safepoint, cleanup)("deferring system dictionary resize, over cleanup budget");
+        } else {
+          CleanupTracer t("resizing system dictionaries");
+          ClassLoaderDataGraph::resize_dictionaries();
+        }
       }
     }
 
@@ -612,17 +628,39 @@ void SafepointSynchronize::do_cleanup_tasks() {
   CollectedHeap* heap = Universe::heap();
   assert(heap != NULL, "heap not initialized yet?");
   WorkerThreads* cleanup_workers = heap->safepoint_workers();
+  const jlong deadline_counter = cleanup_deadline_counter();
   if (cleanup_workers != NULL) {
     // Parallel cleanup using GC provided thread pool.
     uint num_cleanup_workers = cleanup_workers->active_workers();
-    ParallelSPCleanupTask cleanup(num_cleanup_workers);
+    ParallelSPCleanupTask cleanup(num_cleanup_workers, deadline_counter);
     cleanup_workers->run_task(&cleanup);
   } else {
     // Serial cleanup using VMThread.
-    ParallelSPCleanupTask cleanup(1);
+    ParallelSPCleanupTask cleanup(1, deadline_counter);
     cleanup.work(0);
   }
 
+  // Rehashing moves every node of a table, so it is run as a task of its own
+  // striped over the cleanup workers rather than claimed by a single worker
+  // like the subtasks above.
+  if (SymbolTable::needs_rehashing()) {
+    if (past_deadline(deadline_counter)) {
+      log_debug(safepoint, cleanup)("deferring symbol table rehash, over cleanup budget");
+    } else {
+      CleanupTracer t("rehashing symbol table");
+      SymbolTable::rehash_table(cleanup_workers);
+    }
+  }
+
+  if (StringTable::needs_rehashing()) {
+    if (past_deadline(deadline_counter)) {
+      log_debug(safepoint, cleanup)("deferring string table rehash, over cleanup budget");
+    } else {
+      CleanupTracer t("rehashing string table");
+      StringTable::rehash_table(cleanup_workers);
+    }
+  }
+
   assert(InlineCacheBuffer::is_empty(), "should have cleaned up ICBuffer");
 
   if (log_is_enabled(Debug, monitorinflation)) {
@@ -716,6 +754,17 @@ void SafepointSynchronize::block(JavaThread *thread) {
   JavaThreadState state = thread->thread_state();
   thread->frame_anchor()->make_walkable(thread);
 
+  if (TTSPProfiler::is_enabled() && thread->has_last_Java_frame()) {
+    // Threads arriving through a compiled-code poll were already sampled
+    // with a precise pc in handle_polling_page_exception(); their top
+    // frame here is the safepoint stub.
+    address pc = thread->last_frame().pc();
+    CodeBlob* cb = CodeCache::find_blob(pc);
+    if (cb == NULL || !cb->is_safepoint_stub()) {
+      TTSPProfiler::sample(pc);
+    }
+  }
+
   uint64_t safepoint_id = SafepointSynchronize::safepoint_counter();
 
   // We have no idea where the VMThread is, it might even be at next safepoint.
@@ -729,7 +778,11 @@ void SafepointSynchronize::block(JavaThread *thread) {
   // Load in wait barrier should not float up
   thread->set_thread_state_fence(_thread_blocked);
 
-  _wait_barrier->wait(static_cast<int>(safepoint_id));
+  if (thread->latency_sensitive_wakeup()) {
+    _priority_wait_barrier->wait(static_cast<int>(safepoint_id));
+  } else {
+    _wait_barrier->wait(static_cast<int>(safepoint_id));
+  }
   assert(_state != _synchronized, "Can't be");
 
   // If barrier is disarmed stop store from floating above loads in barrier.
@@ -910,6 +963,10 @@ void ThreadSafepointState::handle_polling_page_exception() {
   assert(cb != NULL && cb->is_compiled(), "return address should be in nmethod");
   CompiledMethod* nm = (CompiledMethod*)cb;
 
+  if (TTSPProfiler::is_enabled()) {
+    TTSPProfiler::sample(real_return_addr);
+  }
+
   // Find frame of caller
   frame stub_fr = self->last_frame();
   CodeBlob* stub_cb = stub_fr.cb();
@@ -1140,3 +1197,144 @@ void SafepointTracing::end() {
 
   RuntimeService::record_safepoint_end(_last_safepoint_end_time_ns - _last_safepoint_cleanup_time_ns);
 }
+
+// -------------------------------------------------------------------------------------------------------
+// Implementation of TTSPProfiler
+
+TTSPProfiler::Entry TTSPProfiler::_table[TTSPProfiler::_table_size];
+volatile uint64_t   TTSPProfiler::_stragglers = 0;
+volatile uint64_t   TTSPProfiler::_dropped = 0;
+
+static unsigned int location_hash(const char* s) {
+  unsigned int h = 0;
+  for (; *s != '\0'; s++) {
+    h = 31 * h + (unsigned char)*s;
+  }
+  // 0 is indistinguishable from an unset hash.
+  return (h == 0) ? 1 : h;
+}
+
+void TTSPProfiler::describe_location(address pc, char* buf, size_t buflen) {
+  if (pc == NULL) {
+    jio_snprintf(buf, buflen, "<unknown>");
+    return;
+  }
+  if (Interpreter::contains(pc)) {
+    // Interpreted code polls on every branch and return, so the interpreter
+    // itself is rarely the culprit; a coarse bucket is enough.
+    jio_snprintf(buf, buflen, "Interpreter");
+    return;
+  }
+  CodeBlob* cb = CodeCache::find_blob(pc);
+  if (cb == NULL) {
+    jio_snprintf(buf, buflen, "<unknown code> (" PTR_FORMAT ")", p2i(pc));
+  } else if (cb->is_compiled()) {
+    CompiledMethod* cm = (CompiledMethod*)cb;
+    Method* m = cm->method();
+    int bci = -1;
+    PcDesc* pcd = cm->pc_desc_at(pc);
+    if (pcd != NULL && pcd->scope_decode_offset() != DebugInformationRecorder::serialized_null) {
+      // Attribute to the innermost inlined scope at the poll.
+      SimpleScopeDesc ssd(cm, pc);
+      m = ssd.method();
+      bci = ssd.bci();
+    }
+    char name[256];
+    if (m != NULL) {
+      m->name_and_sig_as_C_string(name, sizeof(name));
+    } else {
+      jio_snprintf(name, sizeof(name), "<unknown method>");
+    }
+    jio_snprintf(buf, buflen, "%s @ bci %d (compile id %d)", name, bci, cm->compile_id());
+  } else {
+    jio_snprintf(buf, buflen, "%s", cb->name());
+  }
+}
+
+void TTSPProfiler::aggregate(const char* location, jlong ttsp_ns) {
+  const unsigned int hash = location_hash(location);
+  int index = (int)(hash & (_table_size - 1));
+  for (int probes = 0; probes < _table_size; probes++) {
+    Entry* e = &_table[index];
+    int state = Atomic::load_acquire(&e->_state);
+    if (state == 0 && Atomic::cmpxchg(&e->_state, 0, 1) == 0) {
+      e->_hash = hash;
+      jio_snprintf(e->_location, sizeof(e->_location), "%s", location);
+      Atomic::release_store(&e->_state, 2);
+      state = 2;
+    }
+    while (Atomic::load_acquire(&e->_state) == 1) {
+      // Another straggler is publishing this slot; the window is one
+      // string copy.
+      SpinPause();
+    }
+    if (e->_hash == hash && strcmp(e->_location, location) == 0) {
+      Atomic::inc(&e->_count);
+      Atomic::add(&e->_total_ns, ttsp_ns);
+      jlong prev = Atomic::load(&e->_max_ns);
+      while (ttsp_ns > prev) {
+        jlong witnessed = Atomic::cmpxchg(&e->_max_ns, prev, ttsp_ns);
+        if (witnessed == prev) {
+          break;
+        }
+        prev = witnessed;
+      }
+      return;
+    }
+    index = (index + 1) & (_table_size - 1);
+  }
+  // Table is full of other locations.
+  Atomic::inc(&_dropped);
+}
+
+void TTSPProfiler::sample(address pc) {
+  assert(is_enabled(), "checked by caller");
+  if (!SafepointSynchronize::is_synchronizing()) {
+    // The poll was armed for a handshake, or synchronization already
+    // completed; this thread did not delay the safepoint.
+    return;
+  }
+  jlong ttsp_ns = os::javaTimeNanos() - SafepointTracing::start_of_safepoint();
+  if (ttsp_ns < (jlong)TTSPProfilingThreshold * NANOSECS_PER_MILLISEC) {
+    return;
+  }
+  Atomic::inc(&_stragglers);
+  char location[256];
+  describe_location(pc, location, sizeof(location));
+  aggregate(location, ttsp_ns);
+  EventTimeToSafepointStraggler event;
+  if (event.should_commit()) {
+    event.set_timeToSafepoint(ttsp_ns);
+    event.set_codeLocation(location);
+    event.commit();
+  }
+}
+
+void TTSPProfiler::print_on(outputStream* st) {
+  if (!is_enabled()) {
+    st->print_cr("TTSP profiling is disabled (-XX:TTSPProfilingThreshold=0).");
+    return;
+  }
+  st->print_cr("Time-to-safepoint stragglers (threshold: " UINTX_FORMAT " ms):", TTSPProfilingThreshold);
+  st->print_cr("%10s %12s %12s  %s", "count", "avg (ms)", "max (ms)", "location");
+  for (int i = 0; i < _table_size; i++) {
+    Entry* e = &_table[i];
+    if (Atomic::load_acquire(&e->_state) != 2) {
+      continue;
+    }
+    uint64_t count = Atomic::load(&e->_count);
+    if (count == 0) {
+      // Published but not counted yet.
+      continue;
+    }
+    jlong total_ns = Atomic::load(&e->_total_ns);
+    jlong max_ns = Atomic::load(&e->_max_ns);
+    st->print_cr(UINT64_FORMAT_W(10) " %12.3f %12.3f  %s",
+                 count,
+                 (double)total_ns / count / NANOSECS_PER_MILLISEC,
+                 (double)max_ns / NANOSECS_PER_MILLISEC,
+                 e->_location);
+  }
+  st->print_cr("Total stragglers: " UINT64_FORMAT ", dropped (table full): " UINT64_FORMAT,
+               Atomic::load(&_stragglers), Atomic::load(&_dropped));
+}
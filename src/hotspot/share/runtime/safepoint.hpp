@@ -73,8 +73,6 @@ class SafepointSynchronize : AllStatic {
     SAFEPOINT_CLEANUP_LAZY_ROOT_PROCESSING,
     SAFEPOINT_CLEANUP_UPDATE_INLINE_CACHES,
     SAFEPOINT_CLEANUP_COMPILATION_POLICY,
-    SAFEPOINT_CLEANUP_SYMBOL_TABLE_REHASH,
-    SAFEPOINT_CLEANUP_STRING_TABLE_REHASH,
     SAFEPOINT_CLEANUP_SYSTEM_DICTIONARY_RESIZE,
     SAFEPOINT_CLEANUP_REQUEST_OOPSTORAGE_CLEANUP,
     // Leave this one last.
@@ -106,8 +104,11 @@ class SafepointSynchronize : AllStatic {
   static uint64_t _safepoint_id;
 
   // JavaThreads that need to block for the safepoint will stop on the
-  // _wait_barrier, where they can quickly be started again.
+  // _wait_barrier, where they can quickly be started again. Threads with a
+  // latency-sensitive wakeup stop on the _priority_wait_barrier instead,
+  // which is disarmed first, so they resume ahead of the wakeup herd.
   static WaitBarrier* _wait_barrier;
+  static WaitBarrier* _priority_wait_barrier;
   static julong       _coalesced_vmop_count;     // coalesced vmop count
 
   // For debug long safepoint
@@ -289,4 +290,44 @@ public:
   }
 };
 
+// Attributes long time-to-safepoint (TTSP) stalls to the code the straggler
+// threads were executing. Once safepoint synchronization has been in progress
+// for more than TTSPProfilingThreshold milliseconds, every thread that reaches
+// its safepoint poll after that point records the code location it arrived
+// from and posts a JFR event. The locations are aggregated in a small table
+// which the VM.ttsp diagnostic command prints, so poll-starved compiled code
+// can be identified in production without a debugger.
+class TTSPProfiler : public AllStatic {
+private:
+  struct Entry {
+    // 0: empty, 1: location being published, 2: published
+    volatile int      _state;
+    volatile uint64_t _count;
+    volatile jlong    _total_ns;
+    volatile jlong    _max_ns;
+    unsigned int      _hash;
+    char              _location[256];
+  };
+
+  // Must be a power of two; the table is probed linearly.
+  static const int _table_size = 64;
+
+  static Entry             _table[_table_size];
+  static volatile uint64_t _stragglers;
+  static volatile uint64_t _dropped;
+
+  static void describe_location(address pc, char* buf, size_t buflen);
+  static void aggregate(const char* location, jlong ttsp_ns);
+
+public:
+  static bool is_enabled() { return TTSPProfilingThreshold > 0; }
+
+  // Called by a JavaThread on its way to block for a safepoint. Records the
+  // thread as a straggler if synchronization has exceeded the threshold.
+  // pc is the code location the thread came from, or NULL if unknown.
+  static void sample(address pc);
+
+  static void print_on(outputStream* st);
+};
+
 #endif // SHARE_RUNTIME_SAFEPOINT_HPP
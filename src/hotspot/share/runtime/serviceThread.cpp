@@ -30,10 +30,13 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmClasses.hpp"
+#include "code/dependencyContext.hpp"
 #include "gc/shared/oopStorage.hpp"
 #include "gc/shared/oopStorageSet.hpp"
+#include "memory/metaspace.hpp"
 #include "memory/universe.hpp"
 #include "oops/oopHandle.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/java.hpp"
@@ -69,19 +72,20 @@ class OopHandleList : public CHeapObj<mtInternal> {
      _handle.release(JavaThread::thread_oop_storage());
    }
    OopHandleList* next() const { return _next; }
+   void set_next(OopHandleList* next) { _next = next; }
 };
 
-static OopHandleList* _oop_handle_list = NULL;
+// Lock-free stack of deferred OopHandle releases; pushed to by exiting
+// threads (see add_oop_handle_release) and drained in one exchange by the
+// service thread, so bursts of thread exits do not serialize on Service_lock.
+static OopHandleList* volatile _oop_handle_list = NULL;
 
 static void release_oop_handles() {
-  OopHandleList* list;
-  {
-    MutexLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
-    list = _oop_handle_list;
-    _oop_handle_list = NULL;
-  }
   assert(!SafepointSynchronize::is_at_safepoint(), "cannot be called at a safepoint");
 
+  // Claim the whole list in a single exchange; pushes are lock-free, so no
+  // lock is needed and pushes racing with the drain stay for the next round.
+  OopHandleList* list = Atomic::xchg(&_oop_handle_list, (OopHandleList*)NULL);
   while (list != NULL) {
     OopHandleList* l = list;
     list = l->next();
@@ -124,6 +128,8 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
     JvmtiDeferredEvent jvmti_event;
     bool oop_handles_to_release = false;
     bool cldg_cleanup_work = false;
+    bool metaspace_purge_work = false;
+    bool deps_purge_work = false;
     bool jvmti_tagmap_work = false;
     {
       // Need state transition ThreadBlockInVM so that this thread
@@ -152,8 +158,10 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
               (thread_id_table_work = ThreadIdTable::has_work()) |
               (protection_domain_table_work = SystemDictionary::pd_cache_table()->has_work()) |
               (oopstorage_work = OopStorage::has_cleanup_work_and_reset()) |
-              (oop_handles_to_release = (_oop_handle_list != NULL)) |
+              (oop_handles_to_release = (Atomic::load(&_oop_handle_list) != NULL)) |
               (cldg_cleanup_work = ClassLoaderDataGraph::should_clean_metaspaces_and_reset()) |
+              (metaspace_purge_work = ClassLoaderDataGraph::should_purge_metaspace_and_reset()) |
+              (deps_purge_work = DependencyContext::has_stale_entries()) |
               (jvmti_tagmap_work = JvmtiTagMap::has_object_free_events_and_reset())
              ) == 0) {
         // Wait until notified that there is some work to do.
@@ -222,6 +230,18 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
       ClassLoaderDataGraph::safepoint_and_clean_metaspaces();
     }
 
+    if (metaspace_purge_work) {
+      // Deferred from the class unloading safepoint, see
+      // ClassLoaderDataGraph::purge().
+      Metaspace::purge();
+    }
+
+    if (deps_purge_work) {
+      // Reclaim nmethodBuckets released while a dependency context
+      // cleaning epoch was open, see DependencyContext::cleaning_end().
+      DependencyContext::purge_stale_entries();
+    }
+
     if (jvmti_tagmap_work) {
       JvmtiTagMap::flush_all_object_free_events();
     }
@@ -263,8 +283,16 @@ void ServiceThread::nmethods_do(CodeBlobClosure* cf) {
 }
 
 void ServiceThread::add_oop_handle_release(OopHandle handle) {
-  MutexLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
-  OopHandleList* new_head = new OopHandleList(handle, _oop_handle_list);
-  _oop_handle_list = new_head;
-  Service_lock->notify_all();
+  OopHandleList* new_head = new OopHandleList(handle, NULL);
+  OopHandleList* first;
+  do {
+    first = Atomic::load(&_oop_handle_list);
+    new_head->set_next(first);
+  } while (Atomic::cmpxchg(&_oop_handle_list, first, new_head) != first);
+  if (first == NULL) {
+    // The list went from empty to non-empty; wake the service thread. Later
+    // pushes ride along with the pending wakeup and skip the lock entirely.
+    MutexLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
+    Service_lock->notify_all();
+  }
 }
@@ -157,6 +157,12 @@ address StubRoutines::_bigIntegerLeftShiftWorker = NULL;
 
 address StubRoutines::_vectorizedMismatch = NULL;
 
+address StubRoutines::_arrays_hashcode_boolean = NULL;
+address StubRoutines::_arrays_hashcode_byte = NULL;
+address StubRoutines::_arrays_hashcode_char = NULL;
+address StubRoutines::_arrays_hashcode_short = NULL;
+address StubRoutines::_arrays_hashcode_int = NULL;
+
 address StubRoutines::_dexp = NULL;
 address StubRoutines::_dlog = NULL;
 address StubRoutines::_dlog10 = NULL;
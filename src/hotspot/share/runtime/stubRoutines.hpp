@@ -239,6 +239,14 @@ class StubRoutines: AllStatic {
 
   static address _vectorizedMismatch;
 
+  // 31-polynomial hash kernels, one per element kind (the T_BOOLEAN kernel
+  // hashes unsigned bytes, as needed for Latin-1 strings).
+  static address _arrays_hashcode_boolean;
+  static address _arrays_hashcode_byte;
+  static address _arrays_hashcode_char;
+  static address _arrays_hashcode_short;
+  static address _arrays_hashcode_int;
+
   static address _dexp;
   static address _dlog;
   static address _dlog10;
@@ -409,6 +417,19 @@ public:
 
   static address vectorizedMismatch()  { return _vectorizedMismatch; }
 
+  static address arrays_hashcode(BasicType eltype) {
+    switch (eltype) {
+    case T_BOOLEAN: return _arrays_hashcode_boolean;
+    case T_BYTE:    return _arrays_hashcode_byte;
+    case T_CHAR:    return _arrays_hashcode_char;
+    case T_SHORT:   return _arrays_hashcode_short;
+    case T_INT:     return _arrays_hashcode_int;
+    default:
+      ShouldNotReachHere();
+      return NULL;
+    }
+  }
+
   static address dexp()                { return _dexp; }
   static address dlog()                { return _dlog; }
   static address dlog10()              { return _dlog10; }
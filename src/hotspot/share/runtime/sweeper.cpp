@@ -237,6 +237,19 @@ void NMethodSweeper::report_allocation() {
   }
 }
 
+/**
+  * Wakes up the sweeper thread after a code cache allocation failed although
+  * the code heap still had free space. The free space is fragmented into
+  * blocks smaller than the request; flushing cold nmethods lets the freed
+  * blocks coalesce with neighboring free blocks and restores contiguous
+  * space, so sweep even if the free ratio alone would not start one.
+  */
+void NMethodSweeper::report_allocation_failure() {
+  MonitorLocker waiter(CodeSweeper_lock, Mutex::_no_safepoint_check_flag);
+  _should_sweep = true;
+  CodeSweeper_lock->notify();
+}
+
 bool NMethodSweeper::should_start_aggressive_sweep() {
   // Makes sure that we do not invoke the sweeper too often during startup.
   double start_threshold = 100.0 / (double)StartAggressiveSweepingAt;
@@ -290,8 +303,16 @@ void NMethodSweeper::sweep() {
   init_sweeper_log();
   sweep_code_cache();
 
-  // We are done with sweeping the code cache once.
-  _total_nof_code_cache_sweeps++;
+  if (_current.end()) {
+    // We are done with sweeping the code cache once.
+    _total_nof_code_cache_sweeps++;
+  } else {
+    // A bounded sweep stopped mid-traversal. Re-arm and wake the sweeper,
+    // so the remainder is processed by the next iteration of sweeper_loop().
+    MutexLocker mu(CodeSweeper_lock, Mutex::_no_safepoint_check_flag);
+    _should_sweep = true;
+    CodeSweeper_lock->notify();
+  }
 
   if (_force_sweep) {
     // Notify requester that forced sweep finished
@@ -388,10 +409,17 @@ void NMethodSweeper::sweep_code_cache() {
 
       _seen++;
       handle_safepoint_request();
+
+      if (NmethodSweepBatchSize > 0 && !_force_sweep && swept_count >= NmethodSweepBatchSize) {
+        // Bound the work done in this invocation; the remainder of the
+        // traversal is picked up by the next one. Forced sweeps always
+        // complete the traversal because the requester waits for it.
+        break;
+      }
     }
   }
 
-  assert(_current.end(), "must have scanned the whole cache");
+  assert(_current.end() || NmethodSweepBatchSize > 0, "must have scanned the whole cache");
 
   const Ticks sweep_end_counter = Ticks::now();
   const Tickspan sweep_time = sweep_end_counter - sweep_start_counter;
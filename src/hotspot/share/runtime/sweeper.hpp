@@ -118,6 +118,7 @@ class NMethodSweeper : public AllStatic {
   static int hotness_counter_reset_val();
   static void report_state_change(nmethod* nm);
   static void report_allocation();  // Possibly start the sweeper thread.
+  static void report_allocation_failure();  // Unconditionally start the sweeper thread.
   static void possibly_flush(nmethod* nm);
   static void print(outputStream* out);   // Printing/debugging
   static void print() { print(tty); }
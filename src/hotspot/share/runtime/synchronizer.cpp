@@ -92,12 +92,19 @@ bool ObjectMonitorsHashtable::has_entry(void* key, ObjectMonitor* om) {
   return true;
 }
 
+int MonitorList::stripe_for(Thread* thread) {
+  // 2654435761 = 2^32 * Phi (golden ratio)
+  uint32_t hash = (uint32_t)((uintptr_t)thread >> 3) * 2654435761u;
+  return (int)(hash % NUM_STRIPES);
+}
+
 void MonitorList::add(ObjectMonitor* m) {
+  ObjectMonitor* volatile* head_addr = &_stripes[stripe_for(Thread::current())]._head;
   ObjectMonitor* head;
   do {
-    head = Atomic::load(&_head);
+    head = Atomic::load(head_addr);
     m->set_next_om(head);
-  } while (Atomic::cmpxchg(&_head, head, m) != head);
+  } while (Atomic::cmpxchg(head_addr, head, m) != head);
 
   size_t count = Atomic::add(&_count, 1u);
   if (count > max()) {
@@ -113,57 +120,60 @@ size_t MonitorList::max() const {
   return Atomic::load(&_max);
 }
 
-// Walk the in-use list and unlink (at most MonitorDeflationMax) deflated
-// ObjectMonitors. Returns the number of unlinked ObjectMonitors.
+// Walk the in-use list stripes and unlink (at most MonitorDeflationMax)
+// deflated ObjectMonitors. Returns the number of unlinked ObjectMonitors.
 size_t MonitorList::unlink_deflated(Thread* current, LogStream* ls,
                                     elapsedTimer* timer_p,
                                     GrowableArray<ObjectMonitor*>* unlinked_list) {
   size_t unlinked_count = 0;
-  ObjectMonitor* prev = NULL;
-  ObjectMonitor* head = Atomic::load_acquire(&_head);
-  ObjectMonitor* m = head;
-  // The in-use list head can be NULL during the final audit.
-  while (m != NULL) {
-    if (m->is_being_async_deflated()) {
-      // Find next live ObjectMonitor.
-      ObjectMonitor* next = m;
-      do {
-        ObjectMonitor* next_next = next->next_om();
-        unlinked_count++;
-        unlinked_list->append(next);
-        next = next_next;
-        if (unlinked_count >= (size_t)MonitorDeflationMax) {
-          // Reached the max so bail out on the gathering loop.
-          break;
-        }
-      } while (next != NULL && next->is_being_async_deflated());
-      if (prev == NULL) {
-        ObjectMonitor* prev_head = Atomic::cmpxchg(&_head, head, next);
-        if (prev_head != head) {
-          // Find new prev ObjectMonitor that just got inserted.
-          for (ObjectMonitor* n = prev_head; n != m; n = n->next_om()) {
-            prev = n;
+  for (int s = 0; s < NUM_STRIPES && unlinked_count < (size_t)MonitorDeflationMax; s++) {
+    ObjectMonitor* volatile* head_addr = &_stripes[s]._head;
+    ObjectMonitor* prev = NULL;
+    ObjectMonitor* head = Atomic::load_acquire(head_addr);
+    ObjectMonitor* m = head;
+    // A stripe head can be NULL, e.g. during the final audit.
+    while (m != NULL) {
+      if (m->is_being_async_deflated()) {
+        // Find next live ObjectMonitor.
+        ObjectMonitor* next = m;
+        do {
+          ObjectMonitor* next_next = next->next_om();
+          unlinked_count++;
+          unlinked_list->append(next);
+          next = next_next;
+          if (unlinked_count >= (size_t)MonitorDeflationMax) {
+            // Reached the max so bail out on the gathering loop.
+            break;
+          }
+        } while (next != NULL && next->is_being_async_deflated());
+        if (prev == NULL) {
+          ObjectMonitor* prev_head = Atomic::cmpxchg(head_addr, head, next);
+          if (prev_head != head) {
+            // Find new prev ObjectMonitor that just got inserted.
+            for (ObjectMonitor* n = prev_head; n != m; n = n->next_om()) {
+              prev = n;
+            }
+            prev->set_next_om(next);
           }
+        } else {
           prev->set_next_om(next);
         }
+        if (unlinked_count >= (size_t)MonitorDeflationMax) {
+          // Reached the max so bail out on the searching loop.
+          break;
+        }
+        m = next;
       } else {
-        prev->set_next_om(next);
+        prev = m;
+        m = m->next_om();
       }
-      if (unlinked_count >= (size_t)MonitorDeflationMax) {
-        // Reached the max so bail out on the searching loop.
-        break;
-      }
-      m = next;
-    } else {
-      prev = m;
-      m = m->next_om();
-    }
 
-    if (current->is_Java_thread()) {
-      // A JavaThread must check for a safepoint/handshake and honor it.
-      ObjectSynchronizer::chk_for_block_req(JavaThread::cast(current), "unlinking",
-                                            "unlinked_count", unlinked_count,
-                                            ls, timer_p);
+      if (current->is_Java_thread()) {
+        // A JavaThread must check for a safepoint/handshake and honor it.
+        ObjectSynchronizer::chk_for_block_req(JavaThread::cast(current), "unlinking",
+                                              "unlinked_count", unlinked_count,
+                                              ls, timer_p);
+      }
     }
   }
   Atomic::sub(&_count, unlinked_count);
@@ -171,12 +181,26 @@ size_t MonitorList::unlink_deflated(Thread* current, LogStream* ls,
 }
 
 MonitorList::Iterator MonitorList::iterator() const {
-  return Iterator(Atomic::load_acquire(&_head));
+  return Iterator(this);
+}
+
+MonitorList::Iterator::Iterator(const MonitorList* list) :
+  _list(list), _stripe(0), _current(Atomic::load_acquire(&list->_stripes[0]._head)) {
+  advance_stripe();
+}
+
+// If the current stripe is exhausted, move on to the head of the next
+// non-empty stripe, if any.
+void MonitorList::Iterator::advance_stripe() {
+  while (_current == NULL && ++_stripe < NUM_STRIPES) {
+    _current = Atomic::load_acquire(&_list->_stripes[_stripe]._head);
+  }
 }
 
 ObjectMonitor* MonitorList::Iterator::next() {
   ObjectMonitor* current = _current;
   _current = current->next_om();
+  advance_stripe();
   return current;
 }
 
@@ -298,13 +322,25 @@ static uintx _no_progress_cnt = 0;
 // the monitorexit operation.  In that case the JIT could fuse the operations
 // into a single notifyAndExit() runtime primitive.
 
+// Returns true if the given mark denotes a lock that the current thread
+// holds without an inflated monitor: stack-locked, or, with
+// -XX:+UseFastLocking, fast-locked with the object on the current
+// thread's lock stack.
+static bool is_lock_owned_by(JavaThread* current, oop obj, markWord mark) {
+  if (!mark.has_locker()) {
+    return false;
+  }
+  return UseFastLocking ? current->lock_stack().contains(obj)
+                        : current->is_lock_owned((address)mark.locker());
+}
+
 bool ObjectSynchronizer::quick_notify(oopDesc* obj, JavaThread* current, bool all) {
   assert(current->thread_state() == _thread_in_Java, "invariant");
   NoSafepointVerifier nsv;
   if (obj == NULL) return false;  // slow-path for invalid obj
   const markWord mark = obj->mark();
 
-  if (mark.has_locker() && current->is_lock_owned((address)mark.locker())) {
+  if (is_lock_owned_by(current, oop(obj), mark)) {
     // Degenerate notify
     // stack-locked by caller so by definition the implied waitset is empty.
     return true;
@@ -471,7 +507,21 @@ void ObjectSynchronizer::enter(Handle obj, BasicLock* lock, JavaThread* current)
     handle_sync_on_value_based_class(obj, current);
   }
 
-  if (!useHeavyMonitors()) {
+  if (UseFastLocking) {
+    // Fast-lock by flipping the lock bits in place and recording ownership
+    // in the current thread's lock stack. Recursion, a full lock stack and
+    // any form of contention all fall through to inflation. Note that the
+    // BasicLock is not used at all in this mode.
+    LockStack& lock_stack = current->lock_stack();
+    markWord mark = obj->mark();
+    if (mark.is_neutral() && lock_stack.can_push()) {
+      markWord locked_mark = mark.set_fast_locked();
+      if (obj()->cas_set_mark(locked_mark, mark) == mark) {
+        lock_stack.push(obj());
+        return;
+      }
+    }
+  } else if (!useHeavyMonitors()) {
     markWord mark = obj->mark();
     if (mark.is_neutral()) {
       // Anticipate successful CAS -- the ST of the displaced mark must
@@ -510,6 +560,26 @@ void ObjectSynchronizer::enter(Handle obj, BasicLock* lock, JavaThread* current)
 }
 
 void ObjectSynchronizer::exit(oop object, BasicLock* lock, JavaThread* current) {
+  if (UseFastLocking) {
+    markWord mark = object->mark();
+    if (mark.is_fast_locked() && current->lock_stack().contains(object)) {
+      // Fast-locked by the current thread: restore the unlocked lock bits.
+      // If the CAS fails, a contender has inflated the lock or a hasher has
+      // installed an identity hash concurrently; fall through to the monitor
+      // path, where inflate() transfers ownership from the lock stack to
+      // the monitor before monitor->exit() releases it.
+      markWord unlocked_mark = mark.set_unlocked();
+      if (object->cas_set_mark(unlocked_mark, mark) == mark) {
+        bool removed = current->lock_stack().remove(object);
+        assert(removed, "fast-locked object must have been on the lock stack");
+        return;
+      }
+    }
+    ObjectMonitor* monitor = inflate(current, object, inflate_cause_vm_internal);
+    monitor->exit(current);
+    return;
+  }
+
   if (!useHeavyMonitors()) {
     markWord mark = object->mark();
 
@@ -691,7 +761,7 @@ void ObjectSynchronizer::notify(Handle obj, TRAPS) {
   JavaThread* current = THREAD;
 
   markWord mark = obj->mark();
-  if (mark.has_locker() && current->is_lock_owned((address)mark.locker())) {
+  if (is_lock_owned_by(current, obj(), mark)) {
     // Not inflated so there can't be any waiters to notify.
     return;
   }
@@ -706,7 +776,7 @@ void ObjectSynchronizer::notifyall(Handle obj, TRAPS) {
   JavaThread* current = THREAD;
 
   markWord mark = obj->mark();
-  if (mark.has_locker() && current->is_lock_owned((address)mark.locker())) {
+  if (is_lock_owned_by(current, obj(), mark)) {
     // Not inflated so there can't be any waiters to notify.
     return;
   }
@@ -819,6 +889,10 @@ markWord ObjectSynchronizer::stable_mark(oop object) {
     // CASE: stack-locked
     // Could be stack-locked either by this thread or by some other thread.
     if (mark.has_locker()) {
+      if (UseFastLocking) {
+        // Fast-locked: the header is in place, only the lock bits differ.
+        return mark.set_unlocked();
+      }
       BasicLock* lock = mark.locker();
       if (Thread::current()->is_lock_owned((address)lock)) {
         // If locked by this thread, it is safe to access the displaced header.
@@ -934,11 +1008,18 @@ intptr_t ObjectSynchronizer::FastHashCode(Thread* current, oop obj) {
       }
       hash = get_next_hash(current, obj);  // get a new hash
       temp = mark.copy_set_hash(hash);     // merge the hash into header
-                                           // try to install the hash
+      // try to install the hash
       test = obj->cas_set_mark(temp, mark);
       if (test == mark) {                  // if the hash was installed, return it
         return hash;
       }
+      if (test.is_neutral() && test.hash() != 0) {
+        // Lost the race to another hashing thread that already installed
+        // a hash. Use its value rather than inflating a monitor just to
+        // arbitrate, which would otherwise turn a hashCode() storm on a
+        // freshly allocated object into a monitor inflation storm.
+        return test.hash();
+      }
       // Failed to install the hash. It could be that another thread
       // installed the hash just before our attempt or inflation has
       // occurred or... so we fall thru to inflate the monitor for
@@ -970,6 +1051,22 @@ intptr_t ObjectSynchronizer::FastHashCode(Thread* current, oop obj) {
       }
       // Fall thru so we only have one place that installs the hash in
       // the ObjectMonitor.
+    } else if (UseFastLocking && mark.has_locker()) {
+      // Fast-locked (by any thread): the header, including any hash, is
+      // in place with only the lock bits flipped.
+      hash = mark.hash();
+      if (hash != 0) {
+        return hash;
+      }
+      hash = get_next_hash(current, obj);
+      temp = mark.copy_set_hash(hash);
+      test = obj->cas_set_mark(temp, mark);
+      if (test == mark) {
+        return hash;
+      }
+      // Interference: a racing hasher, an unlock, or inflation changed the
+      // mark. Just retry from the start.
+      continue;
     } else if (current->is_lock_owned((address)mark.locker())) {
       // This is a stack lock owned by the calling thread so fetch the
       // displaced markWord from the BasicLock on the stack.
@@ -1042,15 +1139,21 @@ bool ObjectSynchronizer::current_thread_holds_lock(JavaThread* current,
 
   markWord mark = read_stable_mark(obj);
 
-  // Uncontended case, header points to stack
+  // Uncontended case, header points to stack (or, with -XX:+UseFastLocking,
+  // the object is fast-locked and ownership is in some thread's lock stack)
   if (mark.has_locker()) {
-    return current->is_lock_owned((address)mark.locker());
+    return is_lock_owned_by(current, obj, mark);
   }
   // Contended case, header points to ObjectMonitor (tagged pointer)
   if (mark.has_monitor()) {
     // The first stage of async deflation does not affect any field
     // used by this comparison so the ObjectMonitor* is usable here.
     ObjectMonitor* monitor = mark.monitor();
+    if (UseFastLocking && monitor->is_owner_anonymous()) {
+      // Inflated over a fast-lock whose owner has not claimed the monitor
+      // yet; the owner is whoever still has the object on its lock stack.
+      return current->lock_stack().contains(obj);
+    }
     return monitor->is_entered(current) != 0;
   }
   // Unlocked case, header in place
@@ -1067,6 +1170,11 @@ JavaThread* ObjectSynchronizer::get_lock_owner(ThreadsList * t_list, Handle h_ob
 
   // Uncontended case, header points to stack
   if (mark.has_locker()) {
+    if (UseFastLocking) {
+      // Fast-locked: the owning thread is the one whose lock stack
+      // contains the object.
+      return Threads::owning_thread_from_object(t_list, obj);
+    }
     owner = (address) mark.locker();
   }
 
@@ -1076,6 +1184,10 @@ JavaThread* ObjectSynchronizer::get_lock_owner(ThreadsList * t_list, Handle h_ob
     // used by this comparison so the ObjectMonitor* is usable here.
     ObjectMonitor* monitor = mark.monitor();
     assert(monitor != NULL, "monitor should be non-null");
+    if (UseFastLocking && monitor->is_owner_anonymous()) {
+      // The fast-lock owner has not claimed the inflated monitor yet.
+      return Threads::owning_thread_from_object(t_list, obj);
+    }
     owner = (address) monitor->owner();
   }
 
@@ -1279,6 +1391,7 @@ ObjectMonitor* ObjectSynchronizer::inflate(Thread* current, oop object,
     // The mark can be in one of the following states:
     // *  Inflated     - just return
     // *  Stack-locked - coerce it to inflated
+    // *  Fast-locked  - coerce it to inflated (only with -XX:+UseFastLocking)
     // *  INFLATING    - busy wait for conversion to complete
     // *  Neutral      - aggressively inflate the object.
 
@@ -1287,6 +1400,15 @@ ObjectMonitor* ObjectSynchronizer::inflate(Thread* current, oop object,
       ObjectMonitor* inf = mark.monitor();
       markWord dmw = inf->header();
       assert(dmw.is_neutral(), "invariant: header=" INTPTR_FORMAT, dmw.value());
+      if (UseFastLocking && inf->is_owner_anonymous() &&
+          current->is_Java_thread() &&
+          JavaThread::cast(current)->lock_stack().contains(object)) {
+        // A contender inflated over a fast-lock held by the current thread.
+        // Transfer ownership from the lock stack to the monitor; from here
+        // on the hold is counted by the monitor like any other base hold.
+        inf->set_owner_from_anonymous(JavaThread::cast(current));
+        JavaThread::cast(current)->lock_stack().remove(object);
+      }
       return inf;
     }
 
@@ -1313,6 +1435,47 @@ ObjectMonitor* ObjectSynchronizer::inflate(Thread* current, oop object,
 
     LogStreamHandle(Trace, monitorinflation) lsh;
 
+    // CASE: fast-locked
+    // The header is in place with only the lock bits flipped, so it can be
+    // copied into the monitor directly and no INFLATING protocol is needed.
+    // Ownership is recorded only in the owning thread's lock stack, which
+    // cannot be examined from another thread: unless the current thread is
+    // the owner, install an anonymous owner. The real owner claims the
+    // monitor when it next takes the monitor slow path, see CASE: inflated
+    // above.
+    if (UseFastLocking && mark.has_locker()) {
+      ObjectMonitor* m = new ObjectMonitor(object);
+      m->set_header(mark.set_unlocked());
+      JavaThread* owner = (current->is_Java_thread() &&
+                           JavaThread::cast(current)->lock_stack().contains(object))
+                          ? JavaThread::cast(current) : NULL;
+      m->set_owner_from(NULL, owner != NULL ? (void*)owner : ANONYMOUS_OWNER);
+
+      if (object->cas_set_mark(markWord::encode(m), mark) != mark) {
+        delete m;
+        continue;       // Interference -- just retry
+      }
+      if (owner != NULL) {
+        owner->lock_stack().remove(object);
+      }
+
+      // Once the ObjectMonitor is configured and object is associated
+      // with the ObjectMonitor, it is safe to allow async deflation:
+      _in_use_list.add(m);
+
+      OM_PERFDATA_OP(Inflations, inc());
+      if (log_is_enabled(Trace, monitorinflation)) {
+        ResourceMark rm(current);
+        lsh.print_cr("inflate(fast_locked): object=" INTPTR_FORMAT ", mark="
+                     INTPTR_FORMAT ", type='%s'", p2i(object),
+                     object->mark().value(), object->klass()->external_name());
+      }
+      if (event.should_commit()) {
+        post_monitor_inflate_event(&event, object, cause);
+      }
+      return m;
+    }
+
     if (mark.has_locker()) {
       ObjectMonitor* m = new ObjectMonitor(object);
       // Optimistically prepare the ObjectMonitor - anticipate successful CAS
@@ -93,14 +93,28 @@ class ObjectMonitorsHashtable {
   size_t om_count() { return _om_count; }
 };
 
+// The in-use list is striped to spread the head CAS in add() and to let
+// deflation unlink each stripe independently. A thread always pushes to
+// the same stripe, selected from its Thread*, so the per-stripe lists
+// stay roughly balanced with the inflating threads.
 class MonitorList {
   friend class VMStructs;
 
+public:
+  static const int NUM_STRIPES = 8;
+
 private:
-  ObjectMonitor* volatile _head;
+  struct Stripe {
+    ObjectMonitor* volatile _head;
+    DEFINE_PAD_MINUS_SIZE(0, DEFAULT_CACHE_LINE_SIZE, sizeof(ObjectMonitor*));
+  };
+
+  Stripe _stripes[NUM_STRIPES];
   volatile size_t _count;
   volatile size_t _max;
 
+  static int stripe_for(Thread* thread);
+
 public:
   void add(ObjectMonitor* monitor);
   size_t unlink_deflated(Thread* current, LogStream* ls, elapsedTimer* timer_p,
@@ -113,10 +127,14 @@ public:
 };
 
 class MonitorList::Iterator {
+  const MonitorList* _list;
+  int _stripe;
   ObjectMonitor* _current;
 
+  void advance_stripe();
+
 public:
-  Iterator(ObjectMonitor* head) : _current(head) {}
+  Iterator(const MonitorList* list);
   bool has_next() const { return _current != NULL; }
   ObjectMonitor* next();
 };
@@ -30,6 +30,7 @@
 #include "classfile/classLoader.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/javaThreadStatus.hpp"
+#include "classfile/protectionDomainCache.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
@@ -217,6 +218,7 @@ Thread::Thread() {
 
   // allocated data structures
   set_osthread(NULL);
+  _cached_chunk = NULL;
   set_resource_area(new (mtThread)ResourceArea());
   DEBUG_ONLY(_current_resource_mark = NULL;)
   set_handle_area(new (mtThread) HandleArea(NULL));
@@ -406,6 +408,10 @@ Thread::~Thread() {
   delete handle_area();
   delete metadata_handles();
 
+  // Deleting the arenas above may have stashed one of their chunks in this
+  // thread's chunk cache; return it to the shared pool.
+  Chunk::flush_thread_cache(this);
+
   // osthread() can be NULL, if creation of thread failed.
   if (osthread() != NULL) os::free_thread(osthread());
 
@@ -511,6 +517,11 @@ ThreadPriority Thread::get_priority(const Thread* const thread) {
 
 void Thread::set_priority(Thread* thread, ThreadPriority priority) {
   debug_only(check_for_dangling_thread_pointer(thread);)
+  if (thread->is_Java_thread()) {
+    // Near-maximum priority is the only latency intent the application can
+    // express; such threads are woken first when a safepoint ends.
+    thread->as_Java_thread()->set_latency_sensitive_wakeup(priority >= NearMaxPriority);
+  }
   // Can return an error!
   (void)os::set_priority(thread, priority);
 }
@@ -1010,6 +1021,7 @@ JavaThread::JavaThread() :
   _current_waiting_monitor(NULL),
   _active_handles(NULL),
   _free_handle_block(NULL),
+  _jni_global_handle_cache_count(0),
   _Stalled(0),
 
   _monitor_chunks(nullptr),
@@ -1027,6 +1039,7 @@ JavaThread::JavaThread() :
   _in_deopt_handler(0),
   _doing_unsafe_access(false),
   _do_not_unlock_if_synchronized(false),
+  _latency_sensitive_wakeup(false),
   _jni_attach_state(_not_attaching_via_jni),
 #if INCLUDE_JVMCI
   _pending_deoptimization(-1),
@@ -1064,6 +1077,7 @@ JavaThread::JavaThread() :
   _interp_only_mode(0),
   _should_post_on_exceptions_flag(JNI_FALSE),
   _thread_stat(new ThreadStatistics()),
+  _pd_memo(nullptr),
 
   _parker(),
 
@@ -1222,6 +1236,7 @@ JavaThread::~JavaThread() {
   // All Java related clean up happens in exit
   ThreadSafepointState::destroy(this);
   if (_thread_stat != NULL) delete _thread_stat;
+  if (_pd_memo != NULL) delete _pd_memo;
 
 #if INCLUDE_JVMCI
   if (JVMCICounterSize > 0) {
@@ -1467,6 +1482,10 @@ void JavaThread::exit(bool destroy_vm, ExitType exit_type) {
     JvmtiExport::cleanup_thread(this);
   }
 
+  // After the JVMTI cleanup no more global handles can be destroyed on
+  // this thread, so the cached entries can be given back to the storage.
+  JNIHandles::release_global_handle_cache(this);
+
   // We need to cache the thread name for logging purposes below as once
   // we have called on_thread_detach this thread must not access any oops.
   char* thread_name = NULL;
@@ -1526,6 +1545,8 @@ void JavaThread::cleanup_failed_attach_current_thread(bool is_daemon) {
     JNIHandleBlock::release_block(block);
   }
 
+  JNIHandles::release_global_handle_cache(this);
+
   // These have to be removed while this is still a valid thread.
   _stack_overflow_state.remove_stack_guard_pages();
 
@@ -1888,6 +1909,9 @@ void JavaThread::oops_do_no_frames(OopClosure* f, CodeBlobClosure* cf) {
     active_handles()->oops_do(f);
   }
 
+  // Traverse the objects fast-locked by this thread.
+  _lock_stack.oops_do(f);
+
   DEBUG_ONLY(verify_frame_info();)
 
   if (has_last_Java_frame()) {
@@ -2183,6 +2207,14 @@ oop JavaThread::current_park_blocker() {
   return NULL;
 }
 
+ProtectionDomainMemo* JavaThread::pd_memo() {
+  assert(this == JavaThread::current(), "only the owning thread uses the memo");
+  if (_pd_memo == nullptr) {
+    _pd_memo = new ProtectionDomainMemo();
+  }
+  return _pd_memo;
+}
+
 
 void JavaThread::print_stack_on(outputStream* st) {
   if (!has_last_Java_frame()) return;
@@ -3620,6 +3652,19 @@ JavaThread *Threads::owning_thread_from_monitor_owner(ThreadsList * t_list,
   return the_owner;
 }
 
+JavaThread* Threads::owning_thread_from_object(ThreadsList* t_list, oop obj) {
+  assert(UseFastLocking, "only with fast-locking");
+  for (JavaThread* q : *t_list) {
+    // Scans of a foreign lock stack are inherently racy: like the stack
+    // address search above, this is best-effort information for problem
+    // reporting such as deadlock detection.
+    if (q->lock_stack().contains(obj)) {
+      return q;
+    }
+  }
+  return NULL;
+}
+
 class PrintOnClosure : public ThreadClosure {
 private:
   outputStream* _st;
@@ -36,6 +36,7 @@
 #include "runtime/globals.hpp"
 #include "runtime/handshake.hpp"
 #include "runtime/javaFrameAnchor.hpp"
+#include "runtime/lockStack.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/park.hpp"
@@ -65,6 +66,7 @@ class JvmtiSampledObjectAllocEventCollector;
 class JvmtiThreadState;
 class JvmtiVMObjectAllocEventCollector;
 class OSThread;
+class ProtectionDomainMemo;
 class ThreadStatistics;
 class ConcurrentLocksDump;
 class MonitorInfo;
@@ -82,6 +84,7 @@ class ICRefillVerifier;
 
 class JVMCIRuntime;
 
+class Chunk;
 class Metadata;
 class ResourceArea;
 
@@ -411,6 +414,10 @@ class Thread: public ThreadShadow {
   ResourceArea* resource_area() const            { return _resource_area; }
   void set_resource_area(ResourceArea* area)     { _resource_area = area; }
 
+  // Per-thread arena chunk cache
+  Chunk* cached_chunk() const                    { return _cached_chunk; }
+  void set_cached_chunk(Chunk* chunk)            { _cached_chunk = chunk; }
+
   OSThread* osthread() const                     { return _osthread;   }
   void set_osthread(OSThread* thread)            { _osthread = thread; }
 
@@ -534,6 +541,10 @@ protected:
   // Thread local resource area for temporary allocation within the VM
   ResourceArea* _resource_area;
 
+  // One arena chunk retained by this thread for lock-free refill,
+  // see Chunk::operator new
+  Chunk* _cached_chunk;
+
   DEBUG_ONLY(ResourceMark* _current_resource_mark;)
 
   // Thread local handle area for allocation of handles within the VM
@@ -738,12 +749,24 @@ class JavaThread: public Thread {
   bool           _current_pending_monitor_is_from_java; // locking is from Java code
   ObjectMonitor* volatile _current_waiting_monitor;     // ObjectMonitor on which this thread called Object.wait()
 
+  // Objects fast-locked by this thread, see -XX:+UseFastLocking
+  LockStack _lock_stack;
+
   // Active_handles points to a block of handles
   JNIHandleBlock* _active_handles;
 
   // One-element thread local free list
   JNIHandleBlock* _free_handle_block;
 
+ public:
+  // Thread local cache of unused JNI global handle storage entries.
+  // Entries are allocated in the global handles OopStorage and hold NULL.
+  // See JNIHandles::make_global/destroy_global.
+  enum { jni_global_handle_cache_capacity = 16 };
+ private:
+  oop* _jni_global_handle_cache[jni_global_handle_cache_capacity];
+  int  _jni_global_handle_cache_count;
+
  public:
   volatile intptr_t _Stalled;
 
@@ -771,6 +794,8 @@ class JavaThread: public Thread {
     Atomic::store(&_current_waiting_monitor, monitor);
   }
 
+  LockStack& lock_stack() { return _lock_stack; }
+
   // JNI handle support
   JNIHandleBlock* active_handles() const         { return _active_handles; }
   void set_active_handles(JNIHandleBlock* block) { _active_handles = block; }
@@ -780,6 +805,35 @@ class JavaThread: public Thread {
   void push_jni_handle_block();
   void pop_jni_handle_block();
 
+  // Pops an unused JNI global handle entry, or NULL if the cache is empty.
+  oop* jni_global_handle_cache_pop() {
+    if (_jni_global_handle_cache_count > 0) {
+      return _jni_global_handle_cache[--_jni_global_handle_cache_count];
+    }
+    return NULL;
+  }
+
+  // Caches an unused JNI global handle entry. Returns false if the cache
+  // is full, in which case the caller must release the entry itself.
+  bool jni_global_handle_cache_push(oop* ptr) {
+    if (_jni_global_handle_cache_count < jni_global_handle_cache_capacity) {
+      _jni_global_handle_cache[_jni_global_handle_cache_count++] = ptr;
+      return true;
+    }
+    return false;
+  }
+
+  // Moves all cached entries into buf (which must have room for
+  // jni_global_handle_cache_capacity entries) and returns their number.
+  int jni_global_handle_cache_drain(oop** buf) {
+    int count = _jni_global_handle_cache_count;
+    for (int i = 0; i < count; i++) {
+      buf[i] = _jni_global_handle_cache[i];
+    }
+    _jni_global_handle_cache_count = 0;
+    return count;
+  }
+
  private:
   MonitorChunk* _monitor_chunks;              // Contains the off stack monitors
                                               // allocated during deoptimization
@@ -895,6 +949,8 @@ class JavaThread: public Thread {
   volatile bool         _doing_unsafe_access;    // Thread may fault due to unsafe access
   bool                  _do_not_unlock_if_synchronized;  // Do not unlock the receiver of a synchronized method (since it was
                                                          // never locked) when throwing an exception. Used by interpreter only.
+  bool                  _latency_sensitive_wakeup;       // Wake this thread before the bulk wakeup when a safepoint ends.
+                                                         // Set for threads running at near-maximum Java priority.
 
   // JNI attach states:
   enum JNIAttachStates {
@@ -1136,6 +1192,9 @@ class JavaThread: public Thread {
   bool do_not_unlock_if_synchronized()             { return _do_not_unlock_if_synchronized; }
   void set_do_not_unlock_if_synchronized(bool val) { _do_not_unlock_if_synchronized = val; }
 
+  bool latency_sensitive_wakeup() const            { return _latency_sensitive_wakeup; }
+  void set_latency_sensitive_wakeup(bool val)      { _latency_sensitive_wakeup = val; }
+
   SafepointMechanism::ThreadData* poll_data() { return &_poll_data; }
 
   void set_requires_cross_modify_fence(bool val) PRODUCT_RETURN NOT_PRODUCT({ _requires_cross_modify_fence = val; })
@@ -1577,9 +1636,16 @@ class JavaThread: public Thread {
  private:
   ThreadStatistics *_thread_stat;
 
+  // Lazily created; only used when a security manager is enabled.
+  ProtectionDomainMemo* _pd_memo;
+
  public:
   ThreadStatistics* get_thread_stat() const    { return _thread_stat; }
 
+  // Memo of recently approved protection domains, see
+  // DictionaryEntry::is_valid_protection_domain().
+  ProtectionDomainMemo* pd_memo();
+
   // Return a blocker object for which this thread is blocked parking.
   oop current_park_blocker();
 
@@ -1746,6 +1812,11 @@ class Threads: AllStatic {
   static JavaThread *owning_thread_from_monitor_owner(ThreadsList * t_list,
                                                       address owner);
 
+  // Get the Java thread whose lock stack contains the given object, if any.
+  // Only used with -XX:+UseFastLocking, where neither a fast-locked mark
+  // word nor an anonymously owned monitor identifies the owning thread.
+  static JavaThread *owning_thread_from_object(ThreadsList* t_list, oop obj);
+
   // Number of threads on the active threads list
   static int number_of_threads()                 { return _number_of_threads; }
   // Number of non-daemon threads on the active threads list
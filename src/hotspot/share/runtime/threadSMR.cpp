@@ -34,6 +34,7 @@
 #include "runtime/vmOperations.hpp"
 #include "services/threadIdTable.hpp"
 #include "services/threadService.hpp"
+#include "utilities/align.hpp"
 #include "utilities/copy.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -620,16 +621,28 @@ void SafeThreadsListPtr::verify_hazard_ptr_scanned() {
 // No real entries, just the final NULL terminator.
 static JavaThread* const empty_threads_list_data[1] = {};
 
-// Result has 'entries + 1' elements, with the last being the NULL terminator.
-static JavaThread* const* make_threads_list_data(int entries) {
-  if (entries == 0) {
+// Capacity to allocate for a list of 'entries' threads. Rounding up lets a
+// retired list be reused for nearby snapshot lengths; thread churn moves
+// the length by one per create or exit.
+static uint round_threads_list_capacity(uint entries) {
+  return align_up(entries, (uint)8);
+}
+
+// Result has 'capacity + 1' elements, leaving room for the NULL terminator
+// that follows the last entry (set by the caller).
+static JavaThread* const* make_threads_list_data(uint capacity) {
+  if (capacity == 0) {
     return empty_threads_list_data;
   }
-  JavaThread** data = NEW_C_HEAP_ARRAY(JavaThread*, entries + 1, mtThread);
-  data[entries] = NULL;         // Make sure the final entry is NULL.
-  return data;
+  return NEW_C_HEAP_ARRAY(JavaThread*, capacity + 1, mtThread);
 }
 
+// Single-slot cache of a retired ThreadsList, guarded by the Threads_lock
+// like all ThreadsList allocation and reclamation. At steady state every
+// thread create or exit reuses the list retired by the previous one
+// instead of hitting the C-heap.
+static ThreadsList* _recycled_threads_list = NULL;
+
 #ifdef ASSERT
 
 ThreadsList::Iterator::Iterator() : _thread_ptr(nullptr), _list(nullptr) {}
@@ -656,10 +669,17 @@ void ThreadsList::Iterator::assert_same_list(Iterator i) const {
 ThreadsList::ThreadsList(int entries) :
   _magic(THREADS_LIST_MAGIC),
   _length(entries),
+  _capacity(round_threads_list_capacity(entries)),
   _next_list(NULL),
-  _threads(make_threads_list_data(entries)),
+  _threads(make_threads_list_data(_capacity)),
   _nested_handle_cnt(0)
-{}
+{
+  if (_capacity != 0) {
+    // Make sure the entry following the last one is the NULL terminator.
+    // The empty shared data already ends with one.
+    *(JavaThread**)(_threads + entries) = NULL;
+  }
+}
 
 ThreadsList::~ThreadsList() {
   if (_threads != empty_threads_list_data) {
@@ -668,6 +688,44 @@ ThreadsList::~ThreadsList() {
   _magic = 0xDEADBEEF;
 }
 
+void ThreadsList::reuse(uint entries) {
+  assert(entries <= _capacity, "invariant");
+  assert(_nested_handle_cnt == 0, "should not reuse a referenced list");
+  _length = entries;
+  _next_list = NULL;
+  if (_capacity != 0) {
+    *(JavaThread**)(_threads + entries) = NULL;
+  }
+}
+
+ThreadsList* ThreadsList::acquire(uint entries) {
+  assert_locked_or_safepoint(Threads_lock);
+  ThreadsList* list = _recycled_threads_list;
+  if (list != NULL && entries <= list->capacity()) {
+    _recycled_threads_list = NULL;
+    list->reuse(entries);
+    return list;
+  }
+  return new ThreadsList(entries);
+}
+
+void ThreadsList::recycle(ThreadsList* list) {
+  assert_locked_or_safepoint(Threads_lock);
+  assert(list != _recycled_threads_list, "invariant");
+  if (_recycled_threads_list == NULL) {
+    _recycled_threads_list = list;
+    return;
+  }
+  // Keep the cached list with the larger capacity, so a growing thread
+  // count does not keep missing the cache.
+  if (_recycled_threads_list->capacity() < list->capacity()) {
+    delete _recycled_threads_list;
+    _recycled_threads_list = list;
+  } else {
+    delete list;
+  }
+}
+
 // Add a JavaThread to a ThreadsList. The returned ThreadsList is a
 // new copy of the specified ThreadsList with the specified JavaThread
 // appended to the end.
@@ -675,7 +733,7 @@ ThreadsList *ThreadsList::add_thread(ThreadsList *list, JavaThread *java_thread)
   const uint index = list->_length;
   const uint new_length = index + 1;
   const uint head_length = index;
-  ThreadsList *const new_list = new ThreadsList(new_length);
+  ThreadsList *const new_list = ThreadsList::acquire(new_length);
 
   if (head_length > 0) {
     Copy::disjoint_words((HeapWord*)list->_threads, (HeapWord*)new_list->_threads, head_length);
@@ -756,7 +814,7 @@ ThreadsList *ThreadsList::remove_thread(ThreadsList* list, JavaThread* java_thre
   const uint new_length = list->_length - 1;
   const uint head_length = index;
   const uint tail_length = (new_length >= index) ? (new_length - index) : 0;
-  ThreadsList *const new_list = new ThreadsList(new_length);
+  ThreadsList *const new_list = ThreadsList::acquire(new_length);
 
   if (head_length > 0) {
     Copy::disjoint_words((HeapWord*)list->_threads, (HeapWord*)new_list->_threads, head_length);
@@ -890,6 +948,23 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
     }
   }
 
+  if (ThreadsListReclaimThreshold > 1) {
+    // Batch mode: defer the hazard ptr scan until enough freeable
+    // ThreadsLists have accumulated. The scan below visits every live
+    // thread, so scanning on every Threads::add()/remove() makes bulk
+    // thread start/exit quadratic in the number of live threads. The
+    // deferred lists are only pinned a little longer; they are still
+    // reclaimed by a later call once the threshold is crossed.
+    uintx pending = 0;
+    for (ThreadsList* t = _to_delete_list; t != NULL && pending < ThreadsListReclaimThreshold; t = t->next_list()) {
+      pending++;
+    }
+    if (pending < ThreadsListReclaimThreshold) {
+      log_debug(thread, smr)("tid=" UINTX_FORMAT ": ThreadsSMRSupport::free_list: threads=" INTPTR_FORMAT " is deferred (" UINTX_FORMAT " pending).", os::current_thread_id(), p2i(threads), pending);
+      return;
+    }
+  }
+
   // Gather a hash table of the current hazard ptrs:
   ThreadScanHashtable *scan_table = new ThreadScanHashtable();
   ScanHazardPtrGatherThreadsListClosure scan_cl(scan_table);
@@ -916,7 +991,7 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
 
       log_debug(thread, smr)("tid=" UINTX_FORMAT ": ThreadsSMRSupport::free_list: threads=" INTPTR_FORMAT " is freed.", os::current_thread_id(), p2i(current));
       if (current == threads) threads_is_freed = true;
-      delete current;
+      ThreadsList::recycle(current);
       if (EnableThreadSMRStatistics) {
         _java_thread_list_free_cnt++;
         _to_delete_list_cnt--;
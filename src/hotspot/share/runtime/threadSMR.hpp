@@ -170,7 +170,10 @@ class ThreadsList : public CHeapObj<mtThread> {
   friend class ThreadsListHandleTest;  // for _nested_handle_cnt access
 
   uint _magic;
-  const uint _length;
+  uint _length;
+  // Allocated entry capacity of _threads; at least _length. Retired lists
+  // are recycled for later snapshots that fit, see ThreadsList::acquire().
+  const uint _capacity;
   ThreadsList* _next_list;
   JavaThread *const *const _threads;
   volatile intx _nested_handle_cnt;
@@ -189,6 +192,18 @@ class ThreadsList : public CHeapObj<mtThread> {
   static ThreadsList* add_thread(ThreadsList* list, JavaThread* java_thread);
   static ThreadsList* remove_thread(ThreadsList* list, JavaThread* java_thread);
 
+  uint capacity() const                 { return _capacity; }
+  // Reinitialize a retired list so it can serve a new snapshot of
+  // 'entries' threads. Requires entries <= capacity().
+  void reuse(uint entries);
+
+  // Get a list with room for 'entries' threads, preferring a recycled
+  // retired list over a fresh allocation. Callers hold the Threads_lock,
+  // which also guards the recycling cache.
+  static ThreadsList* acquire(uint entries);
+  // Dispose of a list that is no longer referenced, caching it for reuse.
+  static void recycle(ThreadsList* list);
+
 public:
   explicit ThreadsList(int entries);
   ~ThreadsList();
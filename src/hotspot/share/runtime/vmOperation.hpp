@@ -63,19 +63,20 @@
   template(ZMarkEnd)                              \
   template(ZRelocateStart)                        \
   template(ZVerify)                               \
+  template(EpsilonHeapReset)                      \
   template(HandshakeAllThreads)                   \
   template(PopulateDumpSharedSpace)               \
   template(JNIFunctionTableCopier)                \
   template(RedefineClasses)                       \
   template(GetObjectMonitorUsage)                 \
   template(GetAllStackTraces)                     \
-  template(GetThreadListStackTraces)              \
   template(ChangeBreakpoints)                     \
   template(GetOrSetLocal)                         \
   template(ChangeSingleStep)                      \
   template(HeapWalkOperation)                     \
   template(HeapIterateOperation)                  \
   template(HeapObjectStatistics)                  \
+  template(HeaderHistogram)                       \
   template(ReportJavaOutOfMemory)                 \
   template(JFRCheckpoint)                         \
   template(ShenandoahFullGC)                      \
@@ -154,6 +155,14 @@ class VM_Operation : public StackObj {
   // or concurrently with Java threads running.
   virtual bool evaluate_at_safepoint() const { return true; }
 
+  // A safepoint operation may override this to return true if it is safe to
+  // evaluate in the same stop-the-world window as other, unrelated operations.
+  // Only operations that do not modify VM state (e.g. monitoring and
+  // diagnostic operations) should allow this. Asynchronously submitted
+  // operations that allow coalescing are evaluated in an already open
+  // safepoint instead of getting a stop-the-world window of their own.
+  virtual bool allow_coalescing() const { return false; }
+
   // Debugging
   virtual void print_on_error(outputStream* st) const;
   virtual const char* name() const  { return _names[type()]; }
@@ -149,6 +149,7 @@ class VM_PrintThreads: public VM_Operation {
   VMOp_Type type() const {
     return VMOp_PrintThreads;
   }
+  bool allow_coalescing() const                  { return true; }
   void doit();
   bool doit_prologue();
   void doit_epilogue();
@@ -185,6 +186,7 @@ class VM_FindDeadlocks: public VM_Operation {
 
   DeadlockCycle* result()      { return _deadlocks; };
   VMOp_Type type() const       { return VMOp_FindDeadlocks; }
+  bool allow_coalescing() const { return true; }
   void doit();
 };
 
@@ -218,6 +220,7 @@ class VM_ThreadDump : public VM_Operation {
                 bool with_locked_synchronizers);
 
   VMOp_Type type() const { return VMOp_ThreadDump; }
+  bool allow_coalescing() const { return true; }
   void doit();
   bool doit_prologue();
   void doit_epilogue();
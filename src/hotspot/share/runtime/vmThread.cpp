@@ -107,6 +107,8 @@ VM_Operation*     VMThread::_cur_vm_operation   = NULL;
 VM_Operation*     VMThread::_next_vm_operation  = &cleanup_op; // Prevent any thread from setting an operation until VM thread is ready.
 PerfCounter*      VMThread::_perf_accumulated_vm_operation_time = NULL;
 VMOperationTimeoutTask* VMThread::_timeout_task = NULL;
+VMOperationFuture* VMThread::_async_head        = NULL;
+VMOperationFuture* VMThread::_async_tail        = NULL;
 
 
 void VMThread::create() {
@@ -351,6 +353,70 @@ bool VMThread::set_next_operation(VM_Operation *op) {
   return true;
 }
 
+void VMThread::enqueue_async(VMOperationFuture* future) {
+  assert(VMOperation_lock->owned_by_self(), "must hold VMOperation_lock");
+  VM_Operation* op = future->op();
+  log_debug(vmthread)("Adding async VM operation: %s", op->name());
+
+  future->_next = NULL;
+  if (_async_tail == NULL) {
+    _async_head = future;
+  } else {
+    _async_tail->_next = future;
+  }
+  _async_tail = future;
+
+  HOTSPOT_VMOPS_REQUEST(
+                   (char *) op->name(), strlen(op->name()),
+                   op->evaluate_at_safepoint() ? 0 : 1);
+}
+
+VMOperationFuture* VMThread::dequeue_async(bool coalescible_only) {
+  assert(Thread::current()->is_VM_thread(), "Must be the VM thread");
+  MonitorLocker ml(VMOperation_lock, Mutex::_no_safepoint_check_flag);
+  VMOperationFuture* prev = NULL;
+  for (VMOperationFuture* cur = _async_head; cur != NULL; prev = cur, cur = cur->_next) {
+    VM_Operation* op = cur->op();
+    if (coalescible_only && !(op->evaluate_at_safepoint() && op->allow_coalescing())) {
+      continue;
+    }
+    if (prev == NULL) {
+      _async_head = cur->_next;
+    } else {
+      prev->_next = cur->_next;
+    }
+    if (_async_tail == cur) {
+      _async_tail = prev;
+    }
+    cur->_next = NULL;
+    return cur;
+  }
+  return NULL;
+}
+
+void VMThread::complete_async(VMOperationFuture* future) {
+  assert(Thread::current()->is_VM_thread(), "Must be the VM thread");
+  MonitorLocker ml(VMOperation_lock, Mutex::_no_safepoint_check_flag);
+  Atomic::release_store(&future->_done, true);
+  ml.notify_all();
+}
+
+void VMOperationFuture::wait_for_completion() {
+  Thread* t = Thread::current();
+  assert(!t->is_VM_thread(), "VM thread cannot wait for an async VM operation");
+  {
+    // Wait until the operation has been processed
+    TraceTime timer("Waiting for async VM operation to be completed", TRACETIME_LOG(Trace, vmthread));
+    MonitorLocker ml(VMOperation_lock,
+                     t->is_Java_thread() ? Mutex::_safepoint_check_flag
+                                         : Mutex::_no_safepoint_check_flag);
+    while (!is_done()) {
+      ml.wait();
+    }
+  }
+  _op->doit_epilogue();
+}
+
 void VMThread::wait_until_executed(VM_Operation* op) {
   MonitorLocker ml(VMOperation_lock,
                    Thread::current()->is_Java_thread() ?
@@ -429,6 +495,20 @@ void VMThread::inner_execute(VM_Operation* op) {
   evaluate_operation(_cur_vm_operation);
 
   if (end_safepoint) {
+    // Coalesce pending asynchronous safepoint operations into this
+    // stop-the-world window instead of giving each one its own safepoint.
+    // They were queued before the safepoint began, so their requesters are
+    // already blocked and cannot observe the reordering.
+    VMOperationFuture* future;
+    while ((future = dequeue_async(true /* coalescible_only */)) != NULL) {
+      VM_Operation* async_op = future->op();
+      EventMarkVMOperation em_async("Executing coalesced VM operation: %s", async_op->name());
+      log_debug(vmthread)("Evaluating coalesced safepoint VM operation: %s", async_op->name());
+      _cur_vm_operation = async_op;
+      evaluate_operation(async_op);
+      complete_async(future);
+    }
+    _cur_vm_operation = op;
     if (has_timeout_task) {
       _timeout_task->disarm();
     }
@@ -450,7 +530,7 @@ void VMThread::wait_for_operation() {
 
   while (!should_terminate()) {
     self_destruct_if_needed();
-    if (_next_vm_operation != NULL) {
+    if (_next_vm_operation != NULL || _async_head != NULL) {
       return;
     }
     if (handshake_alot()) {
@@ -460,7 +540,7 @@ void VMThread::wait_for_operation() {
         Handshake::execute(&hal_cl);
       }
       // When we unlocked above someone might have setup a new op.
-      if (_next_vm_operation != NULL) {
+      if (_next_vm_operation != NULL || _async_head != NULL) {
         return;
       }
     }
@@ -492,8 +572,17 @@ void VMThread::loop() {
     if (should_terminate()) break;
     wait_for_operation();
     if (should_terminate()) break;
-    assert(_next_vm_operation != NULL, "Must have one");
-    inner_execute(_next_vm_operation);
+    assert(_next_vm_operation != NULL || _async_head != NULL, "Must have one");
+    if (_next_vm_operation != NULL) {
+      inner_execute(_next_vm_operation);
+    }
+    // Execute any asynchronous operations that were not coalesced into the
+    // safepoint window above; each gets a stop-the-world window of its own.
+    VMOperationFuture* future;
+    while ((future = dequeue_async(false /* coalescible_only */)) != NULL) {
+      inner_execute(future->op());
+      complete_async(future);
+    }
   }
 }
 
@@ -551,6 +640,34 @@ void VMThread::execute(VM_Operation* op) {
   op->doit_epilogue();
 }
 
+bool VMThread::execute_async(VMOperationFuture* future) {
+  Thread* t = Thread::current();
+  assert(!t->is_VM_thread(), "use execute() from the VM thread");
+  VM_Operation* op = future->op();
+
+  // Avoid re-entrant attempts to gc-a-lot
+  SkipGCALot sgcalot(t);
+
+  // JavaThread or WatcherThread
+  if (t->is_Java_thread()) {
+    JavaThread::cast(t)->check_for_valid_safepoint_state();
+  }
+
+  // New request from Java thread, evaluate prologue
+  if (!op->doit_prologue()) {
+    return false;   // op was cancelled
+  }
+
+  op->set_calling_thread(t);
+
+  MonitorLocker ml(VMOperation_lock,
+                   t->is_Java_thread() ? Mutex::_safepoint_check_flag
+                                       : Mutex::_no_safepoint_check_flag);
+  enqueue_async(future);
+  ml.notify_all();
+  return true;
+}
+
 void VMThread::verify() {
   oops_do(&VerifyOopClosure::verify_oop, NULL);
 }
@@ -52,6 +52,25 @@ public:
   void disarm();
 };
 
+// Completion handle for a VM operation submitted with VMThread::execute_async().
+// The submitting thread must keep the operation and the future alive until
+// wait_for_completion() returns; wait_for_completion() also runs the
+// operation's doit_epilogue() on the submitting thread, mirroring the
+// synchronous VMThread::execute() protocol.
+class VMOperationFuture : public StackObj {
+  friend class VMThread;
+  VM_Operation* const _op;
+  VMOperationFuture* _next;      // queue link, guarded by VMOperation_lock
+  volatile bool _done;
+
+ public:
+  VMOperationFuture(VM_Operation* op) : _op(op), _next(NULL), _done(false) {}
+
+  VM_Operation* op() const { return _op; }
+  bool is_done() const { return Atomic::load_acquire(&_done); }
+  void wait_for_completion();
+};
+
 //
 // A single VMThread is used by other threads to offload heavy vm operations
 // like scavenge, garbage_collect etc.
@@ -102,6 +121,13 @@ class VMThread: public NamedThread {
   // Execution of vm operation
   static void execute(VM_Operation* op);
 
+  // Asynchronous submission of a vm operation. Returns false if the
+  // operation was cancelled by its prologue. On success the caller must
+  // eventually call future->wait_for_completion(). Queued operations that
+  // allow_coalescing() are evaluated in the next stop-the-world window
+  // instead of requesting a safepoint of their own.
+  static bool execute_async(VMOperationFuture* future);
+
   // Returns the current vm operation if any.
   static VM_Operation* vm_operation()             {
     assert(Thread::current()->is_VM_thread(), "Must be");
@@ -141,8 +167,16 @@ class VMThread: public NamedThread {
   static VM_Operation*     _cur_vm_operation;   // Current VM operation
   static VM_Operation*     _next_vm_operation;  // Next VM operation
 
+  // FIFO of asynchronously submitted operations, guarded by VMOperation_lock.
+  static VMOperationFuture* _async_head;
+  static VMOperationFuture* _async_tail;
+
   bool set_next_operation(VM_Operation *op);    // Set the _next_vm_operation if possible.
 
+  static void enqueue_async(VMOperationFuture* future);
+  static VMOperationFuture* dequeue_async(bool coalescible_only);
+  static void complete_async(VMOperationFuture* future);
+
   // Pointer to single-instance of VM thread
   static VMThread*     _vm_thread;
 };
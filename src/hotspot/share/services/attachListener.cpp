@@ -183,12 +183,20 @@ static jint thread_dump(AttachOperation* op, outputStream* out) {
     }
   }
 
+  // Spill the dump to temporary storage when the transport supports it,
+  // so that dumps of processes with very many threads are not buffered
+  // whole in memory.
+  outputStream* os = op->open_spill_stream();
+  if (os == NULL) {
+    os = out;
+  }
+
   // thread stacks and JNI global handles
-  VM_PrintThreads op1(out, print_concurrent_locks, print_extended_info, true /* print JNI handle info */);
+  VM_PrintThreads op1(os, print_concurrent_locks, print_extended_info, true /* print JNI handle info */);
   VMThread::execute(&op1);
 
   // Deadlock detection
-  VM_FindDeadlocks op2(out);
+  VM_FindDeadlocks op2(os);
   VMThread::execute(&op2);
 
   return JNI_OK;
@@ -298,9 +306,20 @@ static jint heap_inspection(AttachOperation* op, outputStream* out) {
     parallel_thread_num = num == 0 ? parallel_thread_num : (uint)num;
   }
 
+  if (fs == NULL) {
+    // No dump file was given, so the histogram goes back over the attach
+    // socket. Spill it to temporary storage when the transport supports
+    // it, so that histograms of large heaps are not buffered whole in
+    // memory.
+    outputStream* spill = op->open_spill_stream();
+    if (spill != NULL) {
+      os = spill;
+    }
+  }
+
   VM_GC_HeapInspection heapop(os, live_objects_only /* request full gc */, parallel_thread_num);
   VMThread::execute(&heapop);
-  if (os != NULL && os != out) {
+  if (fs != NULL) {
     out->print_cr("Heap inspection file created: %s", path);
     delete fs;
   }
@@ -188,6 +188,14 @@ class AttachOperation: public CHeapObj<mtInternal> {
 
   // complete operation by sending result code and any result data to the client
   virtual void complete(jint result, bufferedStream* result_stream) = 0;
+
+  // Redirect bulky result data to temporary storage on transports that
+  // support it. Returns a stream backed by a temporary file; the file
+  // contents are forwarded to the client in bounded chunks by complete(),
+  // so large output (heap histograms, thread dumps) is never held whole
+  // in memory. Returns NULL when the transport does not support spilling,
+  // in which case the caller keeps writing to the in-memory result buffer.
+  virtual outputStream* open_spill_stream() { return NULL; }
 };
 #endif // INCLUDE_SERVICES
 
@@ -219,10 +219,15 @@ void ClassLoadingService::notify_class_unloaded(InstanceKlass* k) {
     // Compute method size & subtract from running total.
     // We are called during phase 1 of mark sweep, so it's
     // still ok to iterate through Method*s here.
+    // Sum locally and update the counter once: the counter lives in the
+    // shared perf memory segment, so this avoids a read-modify-write of
+    // shared memory per method of the unloaded class.
     Array<Method*>* methods = k->methods();
+    jlong methods_size = 0;
     for (int i = 0; i < methods->length(); i++) {
-      _class_methods_size->inc(-methods->at(i)->size());
+      methods_size += methods->at(i)->size();
     }
+    _class_methods_size->dec(methods_size);
   }
 }
 
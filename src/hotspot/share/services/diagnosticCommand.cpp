@@ -48,12 +48,16 @@
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
 #include "runtime/os.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/vmOperations.hpp"
+#include "runtime/vmThread.hpp"
 #include "runtime/vm_version.hpp"
 #include "services/diagnosticArgument.hpp"
 #include "services/diagnosticCommand.hpp"
 #include "services/diagnosticFramework.hpp"
+#include "services/finalizerService.hpp"
 #include "services/heapDumper.hpp"
+#include "services/heapObjectStatistics.hpp"
 #include "services/management.hpp"
 #include "services/writeableFlags.hpp"
 #include "utilities/debug.hpp"
@@ -98,9 +102,11 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<RunFinalizationDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeapInfoDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<FinalizerInfoDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<FinalizerBacklogDCmd>(full_export, true, false));
 #if INCLUDE_SERVICES
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeapDumpDCmd>(DCmd_Source_Internal | DCmd_Source_AttachAPI, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassHistogramDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeaderHistogramDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SystemDictionaryDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassHierarchyDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassesDCmd>(full_export, true, false));
@@ -126,6 +132,7 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<TrimCLibcHeapDCmd>(full_export, true, false));
 #endif // LINUX
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<TouchedMethodsDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<TTSPProfilerDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CodeHeapAnalyticsDCmd>(full_export, true, false));
 
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDirectivesPrintDCmd>(full_export, true, false));
@@ -471,6 +478,49 @@ void FinalizerInfoDCmd::execute(DCmdSource source, TRAPS) {
   }
 }
 
+class FinalizerBacklogClosure : public FinalizerEntryClosure {
+ private:
+  outputStream* _out;
+  int _count;
+ public:
+  FinalizerBacklogClosure(outputStream* out) : _out(out), _count(0) {}
+  int count() const { return _count; }
+  virtual bool do_entry(FinalizerEntry* fe) {
+    uintptr_t registered_delta;
+    uintptr_t run_delta;
+    jlong interval_millis;
+    fe->sample_backlog(&registered_delta, &run_delta, &interval_millis);
+    _out->print(SIZE_FORMAT_W(10) "  +" SIZE_FORMAT "/-" SIZE_FORMAT,
+                (size_t)fe->objects_on_heap(), (size_t)registered_delta, (size_t)run_delta);
+    if (interval_millis > 0) {
+      const double growth_per_sec =
+        ((double)registered_delta - (double)run_delta) * 1000.0 / (double)interval_millis;
+      _out->print("  %+.1f/s", growth_per_sec);
+    }
+    _out->print_cr("  %s", fe->klass()->external_name());
+    _count++;
+    return true;
+  }
+};
+
+void FinalizerBacklogDCmd::execute(DCmdSource source, TRAPS) {
+  if (!InstanceKlass::is_finalization_enabled()) {
+    output()->print_cr("Finalization is disabled");
+    return;
+  }
+  ResourceMark rm(THREAD);
+  output()->print_cr("Finalization backlog (registered/run deltas and growth "
+                     "are relative to the previous invocation)");
+  output()->print_cr("   backlog  registered/run  class name");
+  output()->print_cr("---------------------------------------");
+  FinalizerBacklogClosure closure(output());
+  MutexLocker lock(THREAD, ClassLoaderDataGraph_lock); // Keep class unloading from removing entries.
+  FinalizerService::do_entries(&closure, THREAD);
+  if (closure.count() == 0) {
+    output()->print_cr("No finalizable classes registered");
+  }
+}
+
 #if INCLUDE_SERVICES // Heap dumping/inspection supported
 HeapDumpDCmd::HeapDumpDCmd(outputStream* output, bool heap) :
                            DCmdWithParser(output, heap),
@@ -537,6 +587,10 @@ void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
   VMThread::execute(&heapop);
 }
 
+void HeaderHistogramDCmd::execute(DCmdSource source, TRAPS) {
+  HeaderHistogram::print_on(output());
+}
+
 #endif // INCLUDE_SERVICES
 
 ThreadDumpDCmd::ThreadDumpDCmd(outputStream* output, bool heap) :
@@ -548,13 +602,23 @@ ThreadDumpDCmd::ThreadDumpDCmd(outputStream* output, bool heap) :
 }
 
 void ThreadDumpDCmd::execute(DCmdSource source, TRAPS) {
+  // Submit both operations asynchronously so the VM thread can evaluate
+  // them in a single stop-the-world window; the queue preserves submission
+  // order, so the output order is unchanged.
   // thread stacks and JNI global handles
   VM_PrintThreads op1(output(), _locks.value(), _extended.value(), true /* print JNI handle info */);
-  VMThread::execute(&op1);
-
+  VMOperationFuture future1(&op1);
   // Deadlock detection
   VM_FindDeadlocks op2(output());
-  VMThread::execute(&op2);
+  VMOperationFuture future2(&op2);
+  bool queued1 = VMThread::execute_async(&future1);
+  bool queued2 = VMThread::execute_async(&future2);
+  if (queued1) {
+    future1.wait_for_completion();
+  }
+  if (queued2) {
+    future2.wait_for_completion();
+  }
 }
 
 // Enhanced JMX Agent support
@@ -956,6 +1020,10 @@ void TouchedMethodsDCmd::execute(DCmdSource source, TRAPS) {
   VMThread::execute(&dumper);
 }
 
+void TTSPProfilerDCmd::execute(DCmdSource source, TRAPS) {
+  TTSPProfiler::print_on(output());
+}
+
 ClassesDCmd::ClassesDCmd(outputStream* output, bool heap) :
                                      DCmdWithParser(output, heap),
   _verbose("-verbose",
@@ -307,6 +307,26 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class FinalizerBacklogDCmd : public DCmd {
+public:
+  FinalizerBacklogDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "GC.finalizer_backlog"; }
+  static const char* description() {
+    return "Print the per-class finalization backlog and its growth since "
+           "the previous invocation of this command.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+      "monitor", NULL};
+      return p;
+  }
+
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 #if INCLUDE_SERVICES   // Heap dumping supported
 // See also: dump_heap in attachListener.cpp
 class HeapDumpDCmd : public DCmdWithParser {
@@ -360,6 +380,27 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class HeaderHistogramDCmd : public DCmd {
+public:
+  HeaderHistogramDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() {
+    return "VM.header_histogram";
+  }
+  static const char* description() {
+    return "Show a per-class histogram of object header states "
+           "(locking and identity hash).";
+  }
+  static const char* impact() {
+    return "High: Depends on Java heap size and content.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class ClassHierarchyDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _print_interfaces; // true if inherited interfaces should be printed.
@@ -401,6 +442,27 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class TTSPProfilerDCmd : public DCmd {
+public:
+  TTSPProfilerDCmd(outputStream* output, bool heap) : DCmd(output, heap) {}
+  static const char* name() {
+    return "VM.ttsp";
+  }
+  static const char* description() {
+    return "Print the time-to-safepoint straggler report "
+           "(requires -XX:TTSPProfilingThreshold to be set).";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 #if INCLUDE_CDS
 class DumpSharedArchiveDCmd: public DCmdWithParser {
 protected:
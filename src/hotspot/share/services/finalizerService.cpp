@@ -35,6 +35,7 @@
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
 #include "runtime/synchronizer.hpp"
 #include "runtime/thread.inline.hpp"
 #include "services/finalizerService.hpp"
@@ -91,7 +92,11 @@ FinalizerEntry::FinalizerEntry(const InstanceKlass* ik) :
     _ik(ik),
     _codesource(get_codesource(ik)),
     _objects_on_heap(0),
-    _total_finalizers_run(0) {}
+    _total_finalizers_run(0),
+    _total_registered(0),
+    _last_sample_registered(0),
+    _last_sample_run(0),
+    _last_sample_nanos(0) {}
 
 FinalizerEntry::~FinalizerEntry() {
   FREE_C_HEAP_ARRAY(char, _codesource);
@@ -113,8 +118,28 @@ uintptr_t FinalizerEntry::total_finalizers_run() const {
   return Atomic::load(&_total_finalizers_run);
 }
 
+uintptr_t FinalizerEntry::total_registered() const {
+  return Atomic::load(&_total_registered);
+}
+
 void FinalizerEntry::on_register() {
   Atomic::inc(&_objects_on_heap, memory_order_relaxed);
+  Atomic::inc(&_total_registered, memory_order_relaxed);
+}
+
+void FinalizerEntry::sample_backlog(uintptr_t* registered_delta, uintptr_t* run_delta, jlong* interval_millis) {
+  assert(registered_delta != nullptr, "invariant");
+  assert(run_delta != nullptr, "invariant");
+  assert(interval_millis != nullptr, "invariant");
+  const uintptr_t registered = Atomic::load(&_total_registered);
+  const uintptr_t run = Atomic::load(&_total_finalizers_run);
+  const jlong now = os::javaTimeNanos();
+  *registered_delta = registered - _last_sample_registered;
+  *run_delta = run - _last_sample_run;
+  *interval_millis = _last_sample_nanos != 0 ? (now - _last_sample_nanos) / (jlong)NANOSECS_PER_MILLISEC : -1;
+  _last_sample_registered = registered;
+  _last_sample_run = run;
+  _last_sample_nanos = now;
 }
 
 void FinalizerEntry::on_complete() {
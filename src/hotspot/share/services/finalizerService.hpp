@@ -38,6 +38,11 @@ class FinalizerEntry : public CHeapObj<mtServiceability> {
   const char* _codesource;
   uintptr_t _objects_on_heap;
   uintptr_t _total_finalizers_run;
+  uintptr_t _total_registered;
+  // Snapshot taken by the last backlog sample, see sample_backlog().
+  uintptr_t _last_sample_registered;
+  uintptr_t _last_sample_run;
+  jlong _last_sample_nanos;
  public:
   FinalizerEntry(const InstanceKlass* ik);
   ~FinalizerEntry();
@@ -45,13 +50,19 @@ class FinalizerEntry : public CHeapObj<mtServiceability> {
   const char* codesource() const NOT_MANAGEMENT_RETURN_(nullptr);
   uintptr_t objects_on_heap() const NOT_MANAGEMENT_RETURN_(0L);
   uintptr_t total_finalizers_run() const NOT_MANAGEMENT_RETURN_(0L);
+  uintptr_t total_registered() const NOT_MANAGEMENT_RETURN_(0L);
   void on_register() NOT_MANAGEMENT_RETURN;
   void on_complete() NOT_MANAGEMENT_RETURN;
+  // Returns the number of objects registered and finalizers run since the
+  // previous sample and the length of that interval, then stores the new
+  // sample. A negative interval means there is no previous sample. Samplers
+  // are expected to be serialized (a diagnostic command).
+  void sample_backlog(uintptr_t* registered_delta, uintptr_t* run_delta, jlong* interval_millis) NOT_MANAGEMENT_RETURN;
 };
 
 class FinalizerEntryClosure : public StackObj {
  public:
-  virtual bool do_entry(const FinalizerEntry* fe) = 0;
+  virtual bool do_entry(FinalizerEntry* fe) = 0;
 };
 
 class FinalizerService : AllStatic {
@@ -26,8 +26,11 @@
 #include "classfile/javaClasses.hpp"
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "logging/log.hpp"
+#include "memory/allocation.inline.hpp"
 #include "oops/objArrayOop.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/javaCalls.hpp"
@@ -40,43 +43,87 @@
 #include "memory/oopFactory.hpp"
 #include "memory/resourceArea.hpp"
 
-GCNotificationRequest *GCNotifier::first_request = NULL;
-GCNotificationRequest *GCNotifier::last_request = NULL;
+GCNotificationRequest *GCNotifier::_ring = NULL;
+volatile uint GCNotifier::_head = 0;
+volatile uint GCNotifier::_tail = 0;
+volatile size_t GCNotifier::_dropped = 0;
 
-void GCNotifier::pushNotification(GCMemoryManager *mgr, const char *action, const char *cause) {
-  // Make a copy of the last GC statistics
-  // GC may occur between now and the creation of the notification
-  int num_pools = MemoryService::num_memory_pools();
-  // stat is deallocated inside GCNotificationRequest
-  GCStatInfo* stat = new(ResourceObj::C_HEAP, mtGC) GCStatInfo(num_pools);
-  mgr->get_last_gc_stat(stat);
-  // timestamp is current time in ms
-  GCNotificationRequest *request = new GCNotificationRequest(os::javaTimeMillis(),mgr,action,cause,stat);
-  addRequest(request);
- }
-
-void GCNotifier::addRequest(GCNotificationRequest *request) {
+void GCNotifier::initialize() {
   MutexLocker ml(Notification_lock, Mutex::_no_safepoint_check_flag);
-  if(first_request == NULL) {
-    first_request = request;
-  } else {
-    last_request->next = request;
+  if (_ring != NULL) {
+    return;
   }
-  last_request = request;
+  // All memory pools are registered during VM initialization, so the usage
+  // arrays can be sized once, before the first notification is pushed.
+  int num_pools = MemoryService::num_memory_pools();
+  GCNotificationRequest *ring = NEW_C_HEAP_ARRAY(GCNotificationRequest, ring_capacity, mtGC);
+  for (uint i = 0; i < ring_capacity; i++) {
+    ring[i].ready = false;
+    ring[i].gcStatInfo = new(ResourceObj::C_HEAP, mtGC) GCStatInfo(num_pools);
+  }
+  _ring = ring;
+}
+
+void GCNotifier::pushNotification(GCMemoryManager *mgr, const char *action, const char *cause) {
+  assert(_ring != NULL, "ring is preallocated when notifications are enabled");
+  GCNotificationRequest *request = claimRequest();
+  if (request == NULL) {
+    // The listener is ring_capacity notifications behind; drop this one
+    // rather than queueing without bound.
+    Atomic::inc(&_dropped);
+    log_debug(gc)("GC notification dropped, listener is %u notifications behind", ring_capacity);
+    return;
+  }
+  request->timestamp = os::javaTimeMillis();
+  request->gcManager = mgr;
+  request->gcAction = action;
+  request->gcCause = cause;
+  // Copy the last GC statistics into the preallocated record; another GC
+  // may complete between now and the composition of the notification.
+  mgr->get_last_gc_stat(request->gcStatInfo);
+  Atomic::release_store(&request->ready, true);
+  // Wake up the service thread; the record itself has already been
+  // published by the tail bump in claimRequest().
+  MutexLocker ml(Notification_lock, Mutex::_no_safepoint_check_flag);
   Notification_lock->notify_all();
 }
 
+GCNotificationRequest *GCNotifier::claimRequest() {
+  uint t = Atomic::load(&_tail);
+  while (true) {
+    if (t - Atomic::load(&_head) >= ring_capacity) {
+      return NULL;  // ring is full
+    }
+    uint prev = Atomic::cmpxchg(&_tail, t, t + 1);
+    if (prev == t) {
+      return &_ring[t & (ring_capacity - 1)];
+    }
+    t = prev;
+  }
+}
+
 GCNotificationRequest *GCNotifier::getRequest() {
-  MutexLocker ml(Notification_lock, Mutex::_no_safepoint_check_flag);
-  GCNotificationRequest *request = first_request;
-  if(first_request != NULL) {
-    first_request = first_request->next;
+  uint h = Atomic::load(&_head);
+  if (h == Atomic::load(&_tail)) {
+    return NULL;
+  }
+  GCNotificationRequest *request = &_ring[h & (ring_capacity - 1)];
+  if (!Atomic::load_acquire(&request->ready)) {
+    // Claimed but not yet filled; the producer is still in the GC pause
+    // epilogue and will wake us again once the record is complete.
+    return NULL;
   }
   return request;
 }
 
+void GCNotifier::releaseRequest(GCNotificationRequest *request) {
+  assert(request == &_ring[Atomic::load(&_head) & (ring_capacity - 1)], "must release in order");
+  request->ready = false;
+  Atomic::release_store(&_head, Atomic::load(&_head) + 1);
+}
+
 bool GCNotifier::has_event() {
-  return first_request != NULL;
+  return getRequest() != NULL;
 }
 
 static Handle getGcInfoBuilder(GCMemoryManager *gcManager,TRAPS) {
@@ -175,8 +222,8 @@ void GCNotifier::sendNotification(TRAPS) {
 
 class NotificationMark : public StackObj {
   // This class is used in GCNotifier::sendNotificationInternal to ensure that
-  // the GCNotificationRequest object is properly cleaned up, whatever path
-  // is used to exit the method.
+  // the ring slot is released back to the producers, whatever path is used
+  // to exit the method.
   GCNotificationRequest* _request;
 public:
   NotificationMark(GCNotificationRequest* r) {
@@ -184,7 +231,7 @@ public:
   }
   ~NotificationMark() {
     assert(_request != NULL, "Sanity check");
-    delete _request;
+    GCNotifier::releaseRequest(_request);
   }
 };
 
@@ -30,38 +30,42 @@
 #include "services/memoryService.hpp"
 #include "services/memoryManager.hpp"
 
-class GCNotificationRequest : public CHeapObj<mtInternal> {
+// A preallocated record in GCNotifier's notification ring. The GC pause
+// side fills one of these and publishes it by advancing the ring's tail;
+// the Java-visible notification object is composed later on the service
+// thread.
+class GCNotificationRequest {
   friend class GCNotifier;
-  GCNotificationRequest *next;
+  volatile bool ready;    // set once the producer has filled the record
   jlong timestamp;
   GCMemoryManager *gcManager;
   const char *gcAction;
   const char *gcCause;
-  GCStatInfo *gcStatInfo;
-public:
-  GCNotificationRequest(jlong ts, GCMemoryManager *manager, const char*action, const char *cause,GCStatInfo *info) {
-    next = NULL;
-    timestamp = ts;
-    gcManager = manager;
-    gcAction = action;
-    gcCause = cause;
-    gcStatInfo = info;
-  }
-
-  ~GCNotificationRequest() {
-    delete gcStatInfo;
-  }
+  GCStatInfo *gcStatInfo; // preallocated, sized to the number of memory pools
 };
 
 class GCNotifier : public AllStatic {
   friend class ServiceThread;
+  friend class NotificationMark;
 private:
-  static GCNotificationRequest *first_request;
-  static GCNotificationRequest *last_request;
-  static void addRequest(GCNotificationRequest *request);
+  // Bounded ring of preallocated notification records, claimed by the GC
+  // pause side with an atomic tail bump and consumed in order by the
+  // service thread. If the listener falls more than ring_capacity
+  // notifications behind, new notifications are dropped instead of queued
+  // without bound.
+  static const uint ring_capacity = 32;  // must be a power of two
+  static GCNotificationRequest *_ring;
+  static volatile uint _head;            // next record to consume
+  static volatile uint _tail;            // next record to claim
+  static volatile size_t _dropped;       // notifications dropped on overflow
+  static GCNotificationRequest *claimRequest();
   static GCNotificationRequest *getRequest();
+  static void releaseRequest(GCNotificationRequest *request);
   static void sendNotificationInternal(TRAPS);
 public:
+  // Preallocates the ring; called when notifications are first enabled,
+  // after all memory pools have been registered.
+  static void initialize();
   static void pushNotification(GCMemoryManager *manager, const char *action, const char *cause);
   static bool has_event();
   static void sendNotification(TRAPS);
@@ -2568,8 +2568,12 @@ void HeapDumper::dump_heap(bool oome) {
   }
   dump_file_seq++;   // increment seq number for next time we dump
 
+  // Use the same parallelism heuristic as the attach listener: the
+  // event-triggered dumps (OOME, before/after full GC) otherwise walk
+  // large heaps with a single dumper thread.
+  uint parallel_thread_num = MAX2<uint>(1, (uint)os::initial_active_processor_count() * 3 / 8);
   HeapDumper dumper(false /* no GC before heap dump */,
                     oome  /* pass along out-of-memory-error flag */);
-  dumper.dump(my_path, tty, HeapDumpGzipLevel);
+  dumper.dump(my_path, tty, HeapDumpGzipLevel, false, parallel_thread_num);
   os::free(my_path);
 }
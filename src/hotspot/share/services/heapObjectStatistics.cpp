@@ -30,7 +30,9 @@
 #include "memory/iterator.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
+#include "oops/compressedKlass.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/os.hpp"
 #include "runtime/vmThread.hpp"
 #include "services/heapObjectStatistics.hpp"
 #include "utilities/copy.hpp"
@@ -39,13 +41,65 @@
 
 HeapObjectStatistics* HeapObjectStatistics::_instance = NULL;
 
+// Visits objects in batches. The mark words are gathered first and their
+// narrow klass fields extracted in a tight loop that the compiler can
+// vectorize. The expensive part - decoding the klass and computing the
+// object size - is then done with a one-entry decode cache, which turns
+// the scattered per-object decodes into a single decode per run of
+// same-klass objects, the common case for bulk-allocated instances.
 class HeapObjectStatsObjectClosure : public ObjectClosure {
 private:
+  static const int BATCH_SIZE = 256;
+
   HeapObjectStatistics* const _stats;
+  int      _num_buffered;
+  oop      _objs[BATCH_SIZE];
+  markWord _marks[BATCH_SIZE];
+#ifdef _LP64
+  narrowKlass _nklasses[BATCH_SIZE];
+#endif
+
+  void flush() {
+#ifdef _LP64
+    for (int i = 0; i < _num_buffered; i++) {
+      // With compact headers the narrow klass lives in the upper mark
+      // bits, unless the header is displaced by a monitor.
+      _nklasses[i] = _marks[i].has_displaced_mark_helper() ? 0 : _marks[i].narrow_klass();
+    }
+    narrowKlass last_nklass = 0;
+    Klass* last_klass = NULL;
+    for (int i = 0; i < _num_buffered; i++) {
+      Klass* klass;
+      if (_nklasses[i] != 0) {
+        if (_nklasses[i] != last_nklass) {
+          last_nklass = _nklasses[i];
+          last_klass = CompressedKlassPointers::decode_not_null(last_nklass);
+        }
+        klass = last_klass;
+      } else {
+        klass = _objs[i]->klass();
+      }
+      _stats->visit_object(_objs[i], _marks[i], _objs[i]->size_given_klass(klass));
+    }
+#else
+    for (int i = 0; i < _num_buffered; i++) {
+      _stats->visit_object(_objs[i], _marks[i], _objs[i]->size());
+    }
+#endif
+    _num_buffered = 0;
+  }
+
 public:
-  HeapObjectStatsObjectClosure() : _stats(HeapObjectStatistics::instance()) {}
+  HeapObjectStatsObjectClosure() : _stats(HeapObjectStatistics::instance()), _num_buffered(0) {}
+  ~HeapObjectStatsObjectClosure() {
+    flush();
+  }
   void do_object(oop obj) {
-    _stats->visit_object(obj);
+    _objs[_num_buffered] = obj;
+    _marks[_num_buffered] = obj->mark();
+    if (++_num_buffered == BATCH_SIZE) {
+      flush();
+    }
   }
 };
 
@@ -121,7 +175,38 @@ void HeapObjectStatistics::increase_counter(uint64_t& counter, uint64_t val) {
 }
 
 HeapObjectStatistics::HeapObjectStatistics() :
-  _task(), _num_samples(0), _num_objects(0), _num_ihashed(0), _num_locked(0), _lds(0) { }
+  _task(), _num_samples(0), _num_objects(0), _num_ihashed(0), _num_locked(0), _lds(0),
+  _klass_table(), _klass_overflow_count(0), _klass_overflow_words(0) { }
+
+HeapObjectStatistics::~HeapObjectStatistics() {
+  for (int i = 0; i < KLASS_TABLE_SIZE; i++) {
+    if (_klass_table[i]._name != NULL) {
+      os::free(_klass_table[i]._name);
+    }
+  }
+}
+
+void HeapObjectStatistics::record_klass(Klass* klass, size_t size) {
+  // Runs single-threaded inside the sampling VM operation.
+  uintptr_t h = (uintptr_t(klass) >> LogKlassAlignmentInBytes) * 2654435761u;
+  for (int probe = 0; probe < KLASS_TABLE_MAX_PROBES; probe++) {
+    KlassEntry* entry = &_klass_table[(h + probe) % KLASS_TABLE_SIZE];
+    if (entry->_klass == NULL) {
+      // The name is copied because the class may be unloaded before the
+      // statistics are printed at shutdown.
+      ResourceMark rm;
+      entry->_klass = klass;
+      entry->_name = os::strdup(klass->external_name(), mtGC);
+    }
+    if (entry->_klass == klass) {
+      increase_counter(entry->_count);
+      increase_counter(entry->_words, size);
+      return;
+    }
+  }
+  increase_counter(_klass_overflow_count);
+  increase_counter(_klass_overflow_words, size);
+}
 
 void HeapObjectStatistics::start() {
   _task.enroll();
@@ -136,8 +221,11 @@ void HeapObjectStatistics::begin_sample() {
 }
 
 void HeapObjectStatistics::visit_object(oop obj) {
+  visit_object(obj, obj->mark(), obj->size());
+}
+
+void HeapObjectStatistics::visit_object(oop obj, markWord mark, size_t size) {
   increase_counter(_num_objects);
-  markWord mark = obj->mark();
   if (!mark.has_no_hash()) {
     increase_counter(_num_ihashed);
     if (mark.age() > 0) {
@@ -154,7 +242,8 @@ void HeapObjectStatistics::visit_object(oop obj) {
   }
 #endif
 #endif
-  increase_counter(_lds, obj->size());
+  increase_counter(_lds, size);
+  record_klass(obj->klass(), size);
 }
 
 void HeapObjectStatistics::print(outputStream* out) const {
@@ -173,4 +262,203 @@ void HeapObjectStatistics::print(outputStream* out) const {
   out->print_cr("Average number of locked objects: " UINT64_FORMAT " (%.2f%%)", _num_locked / _num_samples, (float) (_num_locked * 100) / _num_objects);
   out->print_cr("Average LDS: " UINT64_FORMAT " bytes", _lds * HeapWordSize / _num_samples);
   out->print_cr("Avg LDS with (assumed) 64bit header: " UINT64_FORMAT " bytes (%.1f%%)", (_lds - _num_objects) * HeapWordSize / _num_samples, ((float) _lds - _num_objects) * 100.0 / _lds);
+
+  // Top classes by accumulated live data size. The per-object header saving
+  // is one word, so the count column directly gives the savings attributable
+  // to each class.
+  const int max_ranks = 20;
+  out->print_cr("Top classes by live data size (averaged over samples):");
+  out->print_cr("%-10s %-14s %-14s %s", "avg count", "avg bytes", "hdr savings", "class");
+  const KlassEntry* printed[max_ranks] = {};
+  for (int rank = 0; rank < max_ranks; rank++) {
+    const KlassEntry* best = NULL;
+    for (int i = 0; i < KLASS_TABLE_SIZE; i++) {
+      const KlassEntry* entry = &_klass_table[i];
+      if (entry->_klass == NULL || entry->_count == 0) {
+        continue;
+      }
+      bool seen = false;
+      for (int j = 0; j < rank; j++) {
+        seen |= (printed[j] == entry);
+      }
+      if (!seen && (best == NULL || entry->_words > best->_words)) {
+        best = entry;
+      }
+    }
+    if (best == NULL) {
+      break;
+    }
+    printed[rank] = best;
+    out->print_cr(UINT64_FORMAT_W(10) " " UINT64_FORMAT_W(14) " " UINT64_FORMAT_W(14) " %s",
+                  best->_count / _num_samples,
+                  best->_words * HeapWordSize / _num_samples,
+                  best->_count * HeapWordSize / _num_samples,
+                  best->_name);
+  }
+  if (_klass_overflow_count > 0) {
+    out->print_cr(UINT64_FORMAT_W(10) " " UINT64_FORMAT_W(14) " " UINT64_FORMAT_W(14) " %s",
+                  _klass_overflow_count / _num_samples,
+                  _klass_overflow_words * HeapWordSize / _num_samples,
+                  _klass_overflow_count * HeapWordSize / _num_samples,
+                  "<overflow>");
+  }
+}
+
+// Classifies the header of every live object and attributes the states to
+// the object's class. The table lives only for the duration of the VM
+// operation, so class names can be printed straight from the Klass and no
+// name copies are needed.
+class HeaderHistogramClosure : public ObjectClosure {
+private:
+  static const int TABLE_SIZE = 1024;
+  static const int MAX_PROBES = 32;
+
+  struct Entry {
+    Klass*   _klass;
+    uint64_t _count;
+    uint64_t _fast_locked;
+    uint64_t _inflated;
+    uint64_t _hashed;
+  };
+
+  Entry*   _table;
+  Entry    _overflow;
+  uint64_t _total;
+  uint64_t _total_fast_locked;
+  uint64_t _total_inflated;
+  uint64_t _total_hashed;
+
+  Entry* entry_for(Klass* klass) {
+    uintptr_t h = (uintptr_t(klass) >> LogKlassAlignmentInBytes) * 2654435761u;
+    for (int probe = 0; probe < MAX_PROBES; probe++) {
+      Entry* entry = &_table[(h + probe) % TABLE_SIZE];
+      if (entry->_klass == NULL) {
+        entry->_klass = klass;
+      }
+      if (entry->_klass == klass) {
+        return entry;
+      }
+    }
+    return &_overflow;
+  }
+
+  // An entry only carries signal if some of its objects are locked or hashed.
+  static bool has_signal(const Entry* entry) {
+    return entry->_fast_locked + entry->_inflated + entry->_hashed > 0;
+  }
+
+  // Rank by monitor pressure first, since finding the classes responsible
+  // for inflation is the main use of the histogram.
+  static bool ranks_higher(const Entry* a, const Entry* b) {
+    if (a->_inflated != b->_inflated)       return a->_inflated > b->_inflated;
+    if (a->_fast_locked != b->_fast_locked) return a->_fast_locked > b->_fast_locked;
+    if (a->_hashed != b->_hashed)           return a->_hashed > b->_hashed;
+    return a->_count > b->_count;
+  }
+
+  void print_entry(outputStream* out, const Entry* entry, const char* name) const {
+    out->print_cr(UINT64_FORMAT_W(12) " " UINT64_FORMAT_W(12) " " UINT64_FORMAT_W(12) " " UINT64_FORMAT_W(12) " %s",
+                  entry->_count, entry->_fast_locked, entry->_inflated, entry->_hashed, name);
+  }
+
+public:
+  HeaderHistogramClosure() :
+    _table(NEW_RESOURCE_ARRAY(Entry, TABLE_SIZE)),
+    _overflow(), _total(0), _total_fast_locked(0), _total_inflated(0), _total_hashed(0) {
+    memset(_table, 0, sizeof(Entry) * TABLE_SIZE);
+  }
+
+  void do_object(oop obj) {
+    const markWord mark = obj->mark();
+    const bool inflated = mark.has_monitor();
+    const bool fast_locked = !inflated && mark.is_locked();
+    // While the object is stack-locked or inflated the identity hash state
+    // lives in the displaced header.
+    const markWord hmark = mark.has_displaced_mark_helper() ? mark.displaced_mark_helper() : mark;
+    const bool hashed = !hmark.has_no_hash();
+
+    Entry* entry = entry_for(obj->klass());
+    entry->_count++;
+    _total++;
+    if (fast_locked) {
+      entry->_fast_locked++;
+      _total_fast_locked++;
+    }
+    if (inflated) {
+      entry->_inflated++;
+      _total_inflated++;
+    }
+    if (hashed) {
+      entry->_hashed++;
+      _total_hashed++;
+    }
+  }
+
+  void print_on(outputStream* out) const {
+    out->print_cr("Object header states (" UINT64_FORMAT " objects): "
+                  UINT64_FORMAT " fast-locked, " UINT64_FORMAT " inflated, " UINT64_FORMAT " hashed",
+                  _total, _total_fast_locked, _total_inflated, _total_hashed);
+    out->print_cr("%-12s %-12s %-12s %-12s %s", "count", "fast-locked", "inflated", "hashed", "class");
+    const int max_ranks = 40;
+    const Entry* printed[max_ranks] = {};
+    for (int rank = 0; rank < max_ranks; rank++) {
+      const Entry* best = NULL;
+      for (int i = 0; i < TABLE_SIZE; i++) {
+        const Entry* entry = &_table[i];
+        if (entry->_klass == NULL || !has_signal(entry)) {
+          continue;
+        }
+        bool seen = false;
+        for (int j = 0; j < rank; j++) {
+          seen |= (printed[j] == entry);
+        }
+        if (!seen && (best == NULL || ranks_higher(entry, best))) {
+          best = entry;
+        }
+      }
+      if (best == NULL) {
+        break;
+      }
+      printed[rank] = best;
+      print_entry(out, best, best->_klass->external_name());
+    }
+    if (_overflow._count > 0) {
+      print_entry(out, &_overflow, "<overflow>");
+    }
+  }
+};
+
+class VM_HeaderHistogram : public VM_Operation {
+private:
+  outputStream* const _out;
+
+public:
+  VM_HeaderHistogram(outputStream* out) : _out(out) {}
+  VMOp_Type type() const { return VMOp_HeaderHistogram; }
+  bool doit_prologue() {
+    Heap_lock->lock();
+    return true;
+  }
+
+  void doit_epilogue() {
+    Heap_lock->unlock();
+  }
+
+  void doit() {
+    assert(SafepointSynchronize::is_at_safepoint(), "all threads are stopped");
+    assert(Heap_lock->is_locked(), "should have the Heap_lock");
+
+    CollectedHeap* heap = Universe::heap();
+    heap->ensure_parsability(false);
+
+    ResourceMark rm;
+    HeaderHistogramClosure cl;
+    heap->object_iterate(&cl);
+    cl.print_on(_out);
+  }
+};
+
+void HeaderHistogram::print_on(outputStream* out) {
+  VM_HeaderHistogram vmop(out);
+  VMThread::execute(&vmop);
 }
@@ -26,6 +26,7 @@
 #define SHARE_SERVICES_HEAPOBJECTSTATISTICS_HPP
 
 #include "memory/allocation.hpp"
+#include "oops/markWord.hpp"
 #include "oops/oopsHierarchy.hpp"
 #include "runtime/task.hpp"
 #include "runtime/vmOperation.hpp"
@@ -50,8 +51,26 @@ private:
   uint64_t _num_locked;
   uint64_t _lds;
 
+  // Per-class footprint attribution. Fixed-size open-addressing table keyed
+  // by Klass*; the class name is copied on first insertion because classes
+  // can be unloaded before the statistics are printed at shutdown. Entries
+  // that do not find a slot are aggregated into the overflow counters.
+  static const int KLASS_TABLE_SIZE = 1024;
+  static const int KLASS_TABLE_MAX_PROBES = 32;
+  struct KlassEntry {
+    Klass*   _klass;
+    char*    _name;
+    uint64_t _count;
+    uint64_t _words;
+  };
+  KlassEntry _klass_table[KLASS_TABLE_SIZE];
+  uint64_t _klass_overflow_count;
+  uint64_t _klass_overflow_words;
+
   static void increase_counter(uint64_t& counter, uint64_t val = 1);
 
+  void record_klass(Klass* klass, size_t size);
+
   void print(outputStream* out) const;
 
 public:
@@ -61,11 +80,23 @@ public:
   static HeapObjectStatistics* instance();
 
   HeapObjectStatistics();
+  ~HeapObjectStatistics();
   void start();
   void stop();
 
   void begin_sample();
   void visit_object(oop object);
+  void visit_object(oop object, markWord mark, size_t size);
+};
+
+// One-shot per-class histogram of object header states (unlocked,
+// fast-locked, inflated, hashed), exposed as the VM.header_histogram
+// diagnostic command. Unlike the sampling statistics above it does not
+// depend on -XX:+HeapObjectStats; the heap is walked once inside a
+// safepoint VM operation and the result printed to the given stream.
+class HeaderHistogram : public AllStatic {
+public:
+  static void print_on(outputStream* out);
 };
 
 #endif // SHARE_SERVICES_HEAPOBJECTSTATISTICS_HPP
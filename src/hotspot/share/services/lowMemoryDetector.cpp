@@ -107,16 +107,33 @@ void LowMemoryDetector::detect_low_memory() {
 // and also VMThread.
 void LowMemoryDetector::detect_low_memory(MemoryPool* pool) {
   SensorInfo* sensor = pool->usage_sensor();
+  ThresholdSupport* threshold = pool->usage_threshold();
   if (sensor == NULL ||
-      !pool->usage_threshold()->is_high_threshold_supported() ||
-      pool->usage_threshold()->high_threshold() == 0) {
+      !threshold->is_high_threshold_supported() ||
+      threshold->high_threshold() == 0) {
+    return;
+  }
+
+  // Cheap lock-free edge filter: while the usage stays inside a threshold
+  // band, the gauge state machine would not change state, so only the
+  // check that crosses a band edge needs to take Notification_lock. This
+  // keeps repeated slow-path allocation checks during a sustained spike
+  // from hammering the lock.
+  MemoryUsage usage = pool->get_memory_usage();
+  if (threshold->is_high_threshold_crossed(usage)) {
+    if (!sensor->claim_high_edge()) {
+      return;
+    }
+  } else if (!threshold->is_low_threshold_crossed(usage) ||
+             !sensor->claim_low_edge()) {
     return;
   }
 
   {
     MutexLocker ml(Notification_lock, Mutex::_no_safepoint_check_flag);
 
-    MemoryUsage usage = pool->get_memory_usage();
+    // Apply the usage observed at claim time; it is the observation the
+    // claimed edge corresponds to.
     sensor->set_gauge_sensor_level(usage,
                                    pool->usage_threshold());
     if (sensor->has_pending_requests()) {
@@ -163,6 +180,7 @@ void LowMemoryDetector::recompute_enabled_for_collected_pools() {
 }
 
 SensorInfo::SensorInfo() {
+  _level_state = level_below_high;
   _sensor_on = false;
   _sensor_count = 0;
   _pending_trigger_count = 0;
@@ -219,6 +237,14 @@ void SensorInfo::set_gauge_sensor_level(MemoryUsage usage, ThresholdSupport* hig
 
   assert(!(is_over_high && is_below_low), "Can't be both true");
 
+  // Keep the lock-free band mirror in sync for callers that take the
+  // locked path directly (full-scan detection, threshold changes).
+  if (is_over_high) {
+    Atomic::store(&_level_state, (int)level_above_high);
+  } else if (is_below_low) {
+    Atomic::store(&_level_state, (int)level_below_high);
+  }
+
   if (is_over_high &&
         ((!_sensor_on && _pending_trigger_count == 0) ||
          _pending_clear_count > 0)) {
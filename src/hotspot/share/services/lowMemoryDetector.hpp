@@ -118,7 +118,18 @@ class ThresholdSupport : public CHeapObj<mtInternal> {
 
 class SensorInfo : public CHeapObj<mtInternal> {
 private:
+  // Threshold band the usage was last observed in, published lock-free.
+  // Allocation-path callers use it to detect band edges cheaply and only
+  // take Notification_lock for the check that crosses an edge; repeated
+  // checks while the usage stays inside a band would be no-ops for the
+  // gauge state machine and are filtered out without the lock.
+  enum LevelState {
+    level_below_high = 0,
+    level_above_high = 1
+  };
+
   OopHandle       _sensor_obj;
+  volatile int    _level_state;
   bool            _sensor_on;
   size_t          _sensor_count;
 
@@ -151,6 +162,18 @@ public:
   int pending_trigger_count()      { return _pending_trigger_count; }
   int pending_clear_count()        { return _pending_clear_count; }
 
+  // Lock-free edge filter. Claims the transition into the high (resp. low)
+  // band; returns false if the sensor is already in that band, in which
+  // case the caller can skip the locked update entirely.
+  bool claim_high_edge() {
+    return Atomic::load(&_level_state) == level_below_high &&
+           Atomic::cmpxchg(&_level_state, (int)level_below_high, (int)level_above_high) == level_below_high;
+  }
+  bool claim_low_edge() {
+    return Atomic::load(&_level_state) == level_above_high &&
+           Atomic::cmpxchg(&_level_state, (int)level_above_high, (int)level_below_high) == level_above_high;
+  }
+
   // When this method is used, the memory usage is monitored
   // as a gauge attribute.  High and low thresholds are designed
   // to provide a hysteresis mechanism to avoid repeated triggering
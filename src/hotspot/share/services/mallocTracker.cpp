@@ -35,7 +35,6 @@
 
 size_t MallocMemorySummary::_snapshot[CALC_OBJ_SIZE_IN_TYPE(MallocMemorySnapshot, size_t)];
 
-#ifdef ASSERT
 void MemoryCounter::update_peak_count(size_t count) {
   size_t peak_cnt = peak_count();
   while (peak_cnt < count) {
@@ -63,7 +62,6 @@ size_t MemoryCounter::peak_count() const {
 size_t MemoryCounter::peak_size() const {
   return Atomic::load(&_peak_size);
 }
-#endif
 
 // Total malloc invocation count
 size_t MallocMemorySnapshot::total_count() const {
@@ -80,10 +78,18 @@ size_t MallocMemorySnapshot::total() const {
   for (int index = 0; index < mt_number_of_types; index ++) {
     amount += _malloc[index].malloc_size();
   }
-  amount += _tracking_header.size() + total_arena();
+  amount += malloc_overhead() + total_arena();
   return amount;
 }
 
+// Total memory used by malloc tracking headers. Every live malloc carries
+// exactly one header, so this is derived from the live malloc count instead
+// of being maintained as a separate counter, which would cost two atomic
+// updates on a shared cache line for every malloc and free.
+size_t MallocMemorySnapshot::malloc_overhead() const {
+  return total_count() * sizeof(MallocHeader);
+}
+
 // Total malloc'd memory used by arenas
 size_t MallocMemorySnapshot::total_arena() const {
   size_t amount = 0;
@@ -241,7 +247,6 @@ void* MallocTracker::record_malloc(void* malloc_base, size_t size, MEMFLAGS flag
   assert(malloc_base != NULL, "precondition");
 
   MallocMemorySummary::record_malloc(size, flags);
-  MallocMemorySummary::record_new_malloc_header(sizeof(MallocHeader));
   uint32_t mst_marker = 0;
   if (MemTracker::tracking_level() == NMT_detail) {
     MallocSiteTable::allocation_at(stack, size, &mst_marker, flags);
@@ -276,7 +281,6 @@ void* MallocTracker::record_free(void* memblock) {
   header->assert_block_integrity();
 
   MallocMemorySummary::record_free(header->size(), header->flags());
-  MallocMemorySummary::record_free_malloc_header(sizeof(MallocHeader));
   if (MemTracker::tracking_level() == NMT_detail) {
     MallocSiteTable::deallocation_at(header->size(), header->mst_marker());
   }
@@ -43,22 +43,21 @@ class MemoryCounter {
   volatile size_t   _count;
   volatile size_t   _size;
 
-  DEBUG_ONLY(volatile size_t   _peak_count;)
-  DEBUG_ONLY(volatile size_t   _peak_size; )
+  // High-water marks; never reset, so they can be read after the
+  // corresponding allocations are gone (e.g. arena peak per category).
+  volatile size_t   _peak_count;
+  volatile size_t   _peak_size;
 
  public:
-  MemoryCounter() : _count(0), _size(0) {
-    DEBUG_ONLY(_peak_count = 0;)
-    DEBUG_ONLY(_peak_size  = 0;)
-  }
+  MemoryCounter() : _count(0), _size(0), _peak_count(0), _peak_size(0) {}
 
   inline void allocate(size_t sz) {
     size_t cnt = Atomic::add(&_count, size_t(1), memory_order_relaxed);
     if (sz > 0) {
       size_t sum = Atomic::add(&_size, sz, memory_order_relaxed);
-      DEBUG_ONLY(update_peak_size(sum);)
+      update_peak_size(sum);
     }
-    DEBUG_ONLY(update_peak_count(cnt);)
+    update_peak_count(cnt);
   }
 
   inline void deallocate(size_t sz) {
@@ -74,19 +73,17 @@ class MemoryCounter {
     if (sz != 0) {
       assert(sz >= 0 || size() >= size_t(-sz), "Must be");
       size_t sum = Atomic::add(&_size, size_t(sz), memory_order_relaxed);
-      DEBUG_ONLY(update_peak_size(sum);)
+      update_peak_size(sum);
     }
   }
 
   inline size_t count() const { return Atomic::load(&_count); }
   inline size_t size()  const { return Atomic::load(&_size);  }
 
-#ifdef ASSERT
   void update_peak_count(size_t cnt);
   void update_peak_size(size_t sz);
   size_t peak_count() const;
   size_t peak_size()  const;
-#endif // ASSERT
 };
 
 /*
@@ -127,8 +124,8 @@ class MallocMemory {
   inline size_t arena_size()   const { return _arena.size();  }
   inline size_t arena_count()  const { return _arena.count(); }
 
-  DEBUG_ONLY(inline const MemoryCounter& malloc_counter() const { return _malloc; })
-  DEBUG_ONLY(inline const MemoryCounter& arena_counter()  const { return _arena;  })
+  inline const MemoryCounter& malloc_counter() const { return _malloc; }
+  inline const MemoryCounter& arena_counter()  const { return _arena;  }
 };
 
 class MallocMemorySummary;
@@ -140,7 +137,6 @@ class MallocMemorySnapshot : public ResourceObj {
 
  private:
   MallocMemory      _malloc[mt_number_of_types];
-  MemoryCounter     _tracking_header;
 
 
  public:
@@ -149,9 +145,10 @@ class MallocMemorySnapshot : public ResourceObj {
     return &_malloc[index];
   }
 
-  inline MemoryCounter* malloc_overhead() {
-    return &_tracking_header;
-  }
+  // Memory used by the malloc tracking headers. Derived from the number of
+  // live mallocs, so it does not need its own counter updates on the
+  // allocation and deallocation paths.
+  size_t malloc_overhead() const;
 
   // Total malloc invocation count
   size_t total_count() const;
@@ -170,7 +167,6 @@ class MallocMemorySnapshot : public ResourceObj {
     // copy is going on, because their size is adjusted using this
     // buffer in make_adjustment().
     ThreadCritical tc;
-    s->_tracking_header = _tracking_header;
     for (int index = 0; index < mt_number_of_types; index ++) {
       s->_malloc[index] = _malloc[index];
     }
@@ -217,18 +213,9 @@ class MallocMemorySummary : AllStatic {
      s->make_adjustment();
    }
 
-   // Record memory used by malloc tracking header
-   static inline void record_new_malloc_header(size_t sz) {
-     as_snapshot()->malloc_overhead()->allocate(sz);
-   }
-
-   static inline void record_free_malloc_header(size_t sz) {
-     as_snapshot()->malloc_overhead()->deallocate(sz);
-   }
-
    // The memory used by malloc tracking headers
    static inline size_t tracking_overhead() {
-     return as_snapshot()->malloc_overhead()->size();
+     return as_snapshot()->malloc_overhead();
    }
 
   static MallocMemorySnapshot* as_snapshot() {
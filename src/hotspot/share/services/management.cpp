@@ -1922,6 +1922,11 @@ JVM_ENTRY(void, jmm_SetGCNotificationEnabled(JNIEnv *env, jobject obj, jboolean
   ResourceMark rm(THREAD);
   // Get the GCMemoryManager
   GCMemoryManager* mgr = get_gc_memory_manager_from_jobject(obj, CHECK);
+  if (enabled) {
+    // Preallocate the notification ring before the first notification can
+    // be pushed from a GC pause.
+    GCNotifier::initialize();
+  }
   mgr->set_notification_enabled(enabled?true:false);
 JVM_END
 
@@ -139,8 +139,7 @@ class MemBaseline {
 
   size_t malloc_tracking_overhead() const {
     assert(baseline_type() != Not_baselined, "Not yet baselined");
-    MemBaseline* bl = const_cast<MemBaseline*>(this);
-    return bl->_malloc_memory_snapshot.malloc_overhead()->size();
+    return _malloc_memory_snapshot.malloc_overhead();
   }
 
   MallocMemory* malloc_memory(MEMFLAGS flag) {
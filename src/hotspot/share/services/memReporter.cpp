@@ -83,10 +83,10 @@ void MemReporterBase::print_virtual_memory_line(size_t reserved, size_t committe
   output()->print_cr(" ");
 }
 
-void MemReporterBase::print_arena_line(size_t amount, size_t count) const {
+void MemReporterBase::print_arena_line(size_t amount, size_t count, size_t peak) const {
   const char* scale = current_scale();
-  output()->print_cr("%27s (arena=" SIZE_FORMAT "%s #" SIZE_FORMAT ")", " ",
-    amount_in_current_scale(amount), scale, count);
+  output()->print_cr("%27s (arena=" SIZE_FORMAT "%s #" SIZE_FORMAT ", peak=" SIZE_FORMAT "%s)", " ",
+    amount_in_current_scale(amount), scale, count, amount_in_current_scale(peak), scale);
 }
 
 void MemReporterBase::print_virtual_memory_region(const char* type, address base, size_t size) const {
@@ -157,8 +157,8 @@ void MemSummaryReporter::report_summary_of_type(MEMFLAGS flag,
     }
   } else if (flag == mtNMT) {
     // Count malloc headers in "NMT" category
-    reserved_amount  += _malloc_snapshot->malloc_overhead()->size();
-    committed_amount += _malloc_snapshot->malloc_overhead()->size();
+    reserved_amount  += _malloc_snapshot->malloc_overhead();
+    committed_amount += _malloc_snapshot->malloc_overhead();
   }
 
   if (amount_in_current_scale(reserved_amount) > 0) {
@@ -206,13 +206,14 @@ void MemSummaryReporter::report_summary_of_type(MEMFLAGS flag,
     }
 
     if (amount_in_current_scale(malloc_memory->arena_size()) > 0) {
-      print_arena_line(malloc_memory->arena_size(), malloc_memory->arena_count());
+      print_arena_line(malloc_memory->arena_size(), malloc_memory->arena_count(),
+        malloc_memory->arena_counter().peak_size());
     }
 
     if (flag == mtNMT &&
-      amount_in_current_scale(_malloc_snapshot->malloc_overhead()->size()) > 0) {
+      amount_in_current_scale(_malloc_snapshot->malloc_overhead()) > 0) {
       out->print_cr("%27s (tracking overhead=" SIZE_FORMAT "%s)", " ",
-        amount_in_current_scale(_malloc_snapshot->malloc_overhead()->size()), scale);
+        amount_in_current_scale(_malloc_snapshot->malloc_overhead()), scale);
     } else if (flag == mtClass) {
       // Metadata information
       report_metadata(Metaspace::NonClassType);
@@ -85,7 +85,7 @@ class MemReporterBase : public StackObj {
 
   void print_malloc_line(size_t amount, size_t count) const;
   void print_virtual_memory_line(size_t reserved, size_t committed) const;
-  void print_arena_line(size_t amount, size_t count) const;
+  void print_arena_line(size_t amount, size_t count, size_t peak) const;
 
   void print_virtual_memory_region(const char* type, address base, size_t size) const;
 };
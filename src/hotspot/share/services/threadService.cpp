@@ -43,6 +43,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/init.hpp"
 #include "runtime/objectMonitor.inline.hpp"
+#include "runtime/orderAccess.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.inline.hpp"
 #include "runtime/vframe.hpp"
@@ -862,9 +863,47 @@ ThreadStatistics::ThreadStatistics() {
   _sleep_count = 0;
   _count_pending_reset = false;
   _timer_pending_reset = false;
+  _version = 0;
+  _sampled_version = -2;  // no cached sample yet; -1 means a sampler is updating
   memset((void*) _perf_recursion_counts, 0, sizeof(_perf_recursion_counts));
 }
 
+void ThreadStatistics::sample(ThreadStatSample* dest) {
+  jlong v = Atomic::load_acquire(&_version);
+  jlong cached = Atomic::load_acquire(&_sampled_version);
+  if (cached == v) {
+    *dest = _cached_sample;
+    // The copy is consistent only if no other sampler replaced the cache
+    // while we read it; the copy's loads must not be reordered past the
+    // validating re-read.
+    OrderAccess::loadload();
+    if (Atomic::load(&_sampled_version) == v) {
+      return;
+    }
+  }
+  dest->contended_enter_count = contended_enter_count();
+  dest->contended_enter_ticks = contended_enter_ticks();
+  dest->monitor_wait_count = monitor_wait_count();
+  dest->monitor_wait_ticks = monitor_wait_ticks();
+  dest->sleep_count = sleep_count();
+  dest->sleep_ticks = sleep_ticks();
+  // The counter and timer reads above must not be reordered past the
+  // validating version re-read below.
+  OrderAccess::loadload();
+  // A running timer keeps growing without a version bump, so a sample taken
+  // while the thread is blocked, waiting or sleeping must not be cached.
+  if (!_contended_enter_timer.is_active() &&
+      !_monitor_wait_timer.is_active() &&
+      !_sleep_timer.is_active() &&
+      Atomic::load(&_version) == v) {
+    // Publish the fresh sample unless another sampler is mid-update
+    if (cached != -1 && Atomic::cmpxchg(&_sampled_version, cached, (jlong)-1) == cached) {
+      _cached_sample = *dest;
+      Atomic::release_store(&_sampled_version, v);
+    }
+  }
+}
+
 oop ThreadSnapshot::threadObj() const { return _threadObj.resolve(); }
 
 void ThreadSnapshot::initialize(ThreadsList * t_list, JavaThread* thread) {
@@ -873,12 +912,14 @@ void ThreadSnapshot::initialize(ThreadsList * t_list, JavaThread* thread) {
   _threadObj = OopHandle(_thread_service_storage, threadObj);
 
   ThreadStatistics* stat = thread->get_thread_stat();
-  _contended_enter_ticks = stat->contended_enter_ticks();
-  _contended_enter_count = stat->contended_enter_count();
-  _monitor_wait_ticks = stat->monitor_wait_ticks();
-  _monitor_wait_count = stat->monitor_wait_count();
-  _sleep_ticks = stat->sleep_ticks();
-  _sleep_count = stat->sleep_count();
+  ThreadStatSample sample;
+  stat->sample(&sample);
+  _contended_enter_ticks = sample.contended_enter_ticks;
+  _contended_enter_count = sample.contended_enter_count;
+  _monitor_wait_ticks = sample.monitor_wait_ticks;
+  _monitor_wait_count = sample.monitor_wait_count;
+  _sleep_ticks = sample.sleep_ticks;
+  _sleep_count = sample.sleep_count;
 
   // If thread is still attaching then threadObj will be NULL.
   _thread_status = threadObj == NULL ? JavaThreadStatus::NEW
@@ -28,6 +28,7 @@
 #include "classfile/classLoader.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/javaThreadStatus.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/handles.hpp"
 #include "runtime/init.hpp"
 #include "runtime/objectMonitor.hpp"
@@ -117,6 +118,17 @@ public:
   static void   metadata_do(void f(Metadata*));
 };
 
+// A consistent sample of the contention statistics of one thread, taken
+// for a bulk thread-info query.
+struct ThreadStatSample {
+  jlong contended_enter_count;
+  jlong contended_enter_ticks;
+  jlong monitor_wait_count;
+  jlong monitor_wait_ticks;
+  jlong sleep_count;
+  jlong sleep_ticks;
+};
+
 // Per-thread Statistics for synchronization
 class ThreadStatistics : public CHeapObj<mtInternal> {
 private:
@@ -142,6 +154,14 @@ private:
   int           _perf_recursion_counts[PerfClassTraceTime::EVENT_TYPE_COUNT];
   elapsedTimer  _perf_timers[PerfClassTraceTime::EVENT_TYPE_COUNT];
 
+  // Version of the statistics above, bumped by the owning thread on every
+  // transition that changes them (and on cross-thread resets). Together
+  // with the cached sample it makes a periodic all-threads info poll cheap
+  // for the threads that have not transitioned since the previous poll.
+  volatile jlong  _version;
+  volatile jlong  _sampled_version;  // -1 while a sampler is updating the cache
+  ThreadStatSample _cached_sample;
+
   // utility functions
   void  check_and_reset_count()            {
                                              if (!_count_pending_reset) return;
@@ -168,20 +188,27 @@ public:
   jlong sleep_count()                      { return (_count_pending_reset ? 0 : _sleep_count); }
   jlong sleep_ticks()                      { return (_timer_pending_reset ? 0 : _sleep_timer.active_ticks()); }
 
-  void monitor_wait()                      { check_and_reset_count(); _monitor_wait_count++; }
-  void monitor_wait_begin()                { check_and_reset_timer(); _monitor_wait_timer.start(); }
-  void monitor_wait_end()                  { _monitor_wait_timer.stop(); check_and_reset_timer(); }
+  void monitor_wait()                      { check_and_reset_count(); _monitor_wait_count++; publish(); }
+  void monitor_wait_begin()                { check_and_reset_timer(); _monitor_wait_timer.start(); publish(); }
+  void monitor_wait_end()                  { _monitor_wait_timer.stop(); check_and_reset_timer(); publish(); }
+
+  void thread_sleep()                      { check_and_reset_count(); _sleep_count++; publish(); }
+  void thread_sleep_begin()                { check_and_reset_timer(); _sleep_timer.start(); publish(); }
+  void thread_sleep_end()                  { _sleep_timer.stop(); check_and_reset_timer(); publish(); }
+
+  void contended_enter()                   { check_and_reset_count(); _contended_enter_count++; publish(); }
+  void contended_enter_begin()             { check_and_reset_timer(); _contended_enter_timer.start(); publish(); }
+  void contended_enter_end()               { _contended_enter_timer.stop(); check_and_reset_timer(); publish(); }
 
-  void thread_sleep()                      { check_and_reset_count(); _sleep_count++; }
-  void thread_sleep_begin()                { check_and_reset_timer(); _sleep_timer.start(); }
-  void thread_sleep_end()                  { _sleep_timer.stop(); check_and_reset_timer(); }
+  void reset_count_stat()                  { _count_pending_reset = true; publish(); }
+  void reset_time_stat()                   { _timer_pending_reset = true; publish(); }
 
-  void contended_enter()                   { check_and_reset_count(); _contended_enter_count++; }
-  void contended_enter_begin()             { check_and_reset_timer(); _contended_enter_timer.start(); }
-  void contended_enter_end()               { _contended_enter_timer.stop(); check_and_reset_timer(); }
+  // Record that the statistics have changed, invalidating the cached sample.
+  void publish()                           { Atomic::inc(&_version); }
 
-  void reset_count_stat()                  { _count_pending_reset = true; }
-  void reset_time_stat()                   { _timer_pending_reset = true; }
+  // Consistent sample for a bulk thread-info query; served from the cached
+  // sample when the thread has not transitioned since the previous query.
+  void sample(ThreadStatSample* dest);
 
   int* perf_recursion_counts_addr()        { return _perf_recursion_counts; }
   elapsedTimer* perf_timers_addr()         { return _perf_timers; }
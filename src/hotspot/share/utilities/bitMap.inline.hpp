@@ -212,7 +212,20 @@ inline BitMap::idx_t BitMap::get_next_bit_impl(idx_t l_index, idx_t r_index) con
       idx_t limit = aligned_right
         ? to_words_align_down(r_index) // Minuscule savings when aligned.
         : to_words_align_up(r_index);
-      while (++index < limit) {
+      ++index;
+      // For sparse bitmaps most words are uninteresting.  Testing the OR
+      // of a group of words costs one branch per group instead of one per
+      // word, and the independent loads can issue in parallel.  A group
+      // whose OR is interesting is rescanned by the word loop below.
+      while ((index + 4) <= limit) {
+        bm_word_t gword = ((map(index)     ^ flip) |
+                           (map(index + 1) ^ flip) |
+                           (map(index + 2) ^ flip) |
+                           (map(index + 3) ^ flip));
+        if (gword != 0) break;
+        index += 4;
+      }
+      for ( ; index < limit; ++index) {
         cword = map(index) ^ flip;
         if (cword != 0) {
           idx_t result = bit_index(index) + count_trailing_zeros(cword);
@@ -309,6 +309,12 @@ class ConcurrentHashTable : public CHeapObj<F> {
   void internal_grow_range(Thread* thread, size_t start, size_t stop);
   bool internal_grow(Thread* thread, size_t log2_size);
 
+  // Method for moving nodes to another table, used by rehashing. The caller
+  // holds the resize lock; with is_mt set other threads may concurrently move
+  // nodes into the same destination table.
+  void internal_move_range(ConcurrentHashTable<CONFIG, F>* to_cht,
+                           size_t start_idx, size_t stop_idx, bool is_mt = false);
+
   // Get a value.
   template <typename LOOKUP_FUNC>
   VALUE* internal_get(Thread* thread, LOOKUP_FUNC& lookup_f,
@@ -518,6 +524,7 @@ class ConcurrentHashTable : public CHeapObj<F> {
  public:
   class BulkDeleteTask;
   class GrowTask;
+  class MoveTask;
 };
 
 #endif // SHARE_UTILITIES_CONCURRENTHASHTABLE_HPP
@@ -1259,14 +1259,12 @@ inline void ConcurrentHashTable<CONFIG, F>::
 }
 
 template <typename CONFIG, MEMFLAGS F>
-inline bool ConcurrentHashTable<CONFIG, F>::
-  try_move_nodes_to(Thread* thread, ConcurrentHashTable<CONFIG, F>* to_cht)
+inline void ConcurrentHashTable<CONFIG, F>::
+  internal_move_range(ConcurrentHashTable<CONFIG, F>* to_cht,
+                      size_t start_idx, size_t stop_idx, bool is_mt)
 {
-  if (!try_resize_lock(thread)) {
-    return false;
-  }
-  assert(_new_table == NULL || _new_table == POISON_PTR, "Must be NULL");
-  for (size_t bucket_it = 0; bucket_it < _table->_size; bucket_it++) {
+  assert(stop_idx <= _table->_size, "Range must be within the table");
+  for (size_t bucket_it = start_idx; bucket_it < stop_idx; bucket_it++) {
     Bucket* bucket = _table->get_bucket(bucket_it);
     assert(!bucket->have_redirect() && !bucket->is_locked(), "Table must be uncontended");
     while (bucket->first() != NULL) {
@@ -1278,12 +1276,33 @@ inline bool ConcurrentHashTable<CONFIG, F>::
       if (!dead_hash) {
         Bucket* insert_bucket = to_cht->get_bucket(insert_hash);
         assert(!bucket->have_redirect() && !bucket->is_locked(), "Not bit should be present");
-        move_node->set_next(insert_bucket->first());
-        ok = insert_bucket->cas_first(move_node, insert_bucket->first());
-        assert(ok, "Uncontended cas must work");
+        if (is_mt) {
+          // Source buckets are claimed range-wise, but other threads may
+          // concurrently insert into the same destination bucket.
+          Node* first;
+          do {
+            first = insert_bucket->first();
+            move_node->set_next(first);
+          } while (!insert_bucket->cas_first(move_node, first));
+        } else {
+          move_node->set_next(insert_bucket->first());
+          ok = insert_bucket->cas_first(move_node, insert_bucket->first());
+          assert(ok, "Uncontended cas must work");
+        }
       }
     }
   }
+}
+
+template <typename CONFIG, MEMFLAGS F>
+inline bool ConcurrentHashTable<CONFIG, F>::
+  try_move_nodes_to(Thread* thread, ConcurrentHashTable<CONFIG, F>* to_cht)
+{
+  if (!try_resize_lock(thread)) {
+    return false;
+  }
+  assert(_new_table == NULL || _new_table == POISON_PTR, "Must be NULL");
+  internal_move_range(to_cht, 0, _table->_size);
   unlock_resize_lock(thread);
   return true;
 }
@@ -31,8 +31,8 @@
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/concurrentHashTable.inline.hpp"
 
-// This inline file contains BulkDeleteTask and GrowTasks which are both bucket
-// operations, which they are serialized with each other.
+// This inline file contains BulkDeleteTask, GrowTask and MoveTask which are
+// all bucket operations, which they are serialized with each other.
 
 // Base class for pause and/or parallel bulk operations.
 template <typename CONFIG, MEMFLAGS F>
@@ -202,4 +202,51 @@ class ConcurrentHashTable<CONFIG, F>::GrowTask :
   }
 };
 
+// For doing a pausable/parallel move of all nodes into another table, as done
+// when rehashing with a new hash function. The destination table must be
+// pre-sized; nodes are moved as-is without allocation.
+template <typename CONFIG, MEMFLAGS F>
+class ConcurrentHashTable<CONFIG, F>::MoveTask :
+  public BucketsOperation
+{
+  ConcurrentHashTable<CONFIG, F>* _to_cht;
+ public:
+  MoveTask(ConcurrentHashTable<CONFIG, F>* cht,
+           ConcurrentHashTable<CONFIG, F>* to_cht, bool is_mt = false)
+    : BucketsOperation(cht, is_mt), _to_cht(to_cht) {
+  }
+  // Before start prepare must be called.
+  bool prepare(Thread* thread) {
+    bool lock = BucketsOperation::_cht->try_resize_lock(thread);
+    if (!lock) {
+      return false;
+    }
+    this->setup(thread);
+    return true;
+  }
+
+  // Moves one range of nodes to the destination table. Returns true if there
+  // is more work. May be called by several threads when is_mt was set.
+  bool do_task(Thread* thread) {
+    size_t start, stop;
+    assert(BucketsOperation::_cht->_resize_lock_owner != NULL,
+           "Should be locked");
+    if (!this->claim(&start, &stop)) {
+      return false;
+    }
+    BucketsOperation::_cht->internal_move_range(_to_cht, start, stop,
+                                                BucketsOperation::_is_mt);
+    assert(BucketsOperation::_cht->_resize_lock_owner != NULL,
+           "Should be locked");
+    return true;
+  }
+
+  // Must be called after ranges are done.
+  void done(Thread* thread) {
+    this->thread_owns_resize_lock(thread);
+    BucketsOperation::_cht->unlock_resize_lock(thread);
+    this->thread_do_not_own_resize_lock(thread);
+  }
+};
+
 #endif // SHARE_UTILITIES_CONCURRENTHASHTABLETASKS_INLINE_HPP
@@ -90,15 +90,42 @@ void Events::print() {
   print_all(tty);
 }
 
+// Returns the ring buffer length for the log with the given handle: the
+// handle's entry in -XX:LogEventsBufferEntriesPerLog if one is given,
+// otherwise the LogEventsBufferEntries default. Malformed pairs are ignored.
+static int buffer_entries(const char* handle) {
+  int entries = (int)LogEventsBufferEntries;
+  const size_t handle_len = strlen(handle);
+  const char* cur = LogEventsBufferEntriesPerLog;
+  while (cur != NULL && *cur != '\0') {
+    const char* end = strchr(cur, ',');
+    if (end == NULL) {
+      end = cur + strlen(cur);
+    }
+    const char* eq = strchr(cur, '=');
+    if (eq != NULL && eq < end &&
+        (size_t)(eq - cur) == handle_len && strncmp(cur, handle, handle_len) == 0) {
+      long value = strtol(eq + 1, NULL, 10);
+      if (value >= 1 && value <= max_jint) {
+        entries = (int)value;
+      } else {
+        warning("Ignoring out of range LogEventsBufferEntriesPerLog entry for \"%s\"", handle);
+      }
+    }
+    cur = (*end == '\0') ? end : end + 1;
+  }
+  return entries;
+}
+
 void Events::init() {
   if (LogEvents) {
-    _messages = new StringEventLog("Events", "events");
-    _vm_operations = new StringEventLog("VM Operations", "vmops");
-    _exceptions = new ExceptionsEventLog("Internal exceptions", "exc");
-    _redefinitions = new StringEventLog("Classes redefined", "redef");
-    _class_unloading = new UnloadingEventLog("Classes unloaded", "unload");
-    _class_loading = new StringEventLog("Classes loaded", "load");
-    _deopt_messages = new StringEventLog("Deoptimization events", "deopt");
+    _messages = new StringEventLog("Events", "events", buffer_entries("events"));
+    _vm_operations = new StringEventLog("VM Operations", "vmops", buffer_entries("vmops"));
+    _exceptions = new ExceptionsEventLog("Internal exceptions", "exc", buffer_entries("exc"));
+    _redefinitions = new StringEventLog("Classes redefined", "redef", buffer_entries("redef"));
+    _class_unloading = new UnloadingEventLog("Classes unloaded", "unload", buffer_entries("unload"));
+    _class_loading = new StringEventLog("Classes loaded", "load", buffer_entries("load"));
+    _deopt_messages = new StringEventLog("Deoptimization events", "deopt", buffer_entries("deopt"));
   }
 }
 
@@ -173,11 +173,16 @@ class FormatStringEventLog : public EventLogBase< FormatStringLogMessage<bufsz>
     if (!this->should_log()) return;
 
     double timestamp = this->fetch_timestamp();
+    // Format into a stack buffer before taking the lock; vsnprintf is the
+    // expensive part of recording an event and would otherwise serialize
+    // concurrent loggers (and crash time printing) on the ring buffer mutex.
+    FormatStringLogMessage<bufsz> msg;
+    msg.printv(format, ap);
     MutexLocker ml(&this->_mutex, Mutex::_no_safepoint_check_flag);
     int index = this->compute_log_index();
     this->_records[index].thread = thread;
     this->_records[index].timestamp = timestamp;
-    this->_records[index].data.printv(format, ap);
+    memcpy(this->_records[index].data.buffer(), msg.buffer(), bufsz);
   }
 
   void log(Thread* thread, const char* format, ...) ATTRIBUTE_PRINTF(3, 4) {
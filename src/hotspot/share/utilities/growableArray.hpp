@@ -759,6 +759,54 @@ public:
   }
 };
 
+// GrowableArray with storage for the first N elements embedded in the
+// instance, so arrays that stay small cause no allocation traffic at all.
+// The data array moves to CHeap once the embedded capacity is exceeded.
+// Intended for stack-allocated worklists that are small in the common case.
+//
+// Instances must not be swap()ed: the embedded buffer cannot change owner.
+template <typename E, int N, MEMFLAGS F>
+class GrowableArrayWithInlineStorage : public GrowableArrayWithAllocator<E, GrowableArrayWithInlineStorage<E, N, F> > {
+  friend class GrowableArrayWithAllocator<E, GrowableArrayWithInlineStorage<E, N, F> >;
+
+  STATIC_ASSERT(N > 0);
+  STATIC_ASSERT(F != mtNone);
+
+  // Embedded storage for the first N elements. The union gives the buffer
+  // 64-bit alignment, which covers the element types stored by value in
+  // HotSpot arrays.
+  union {
+    char    _inline_storage[N * sizeof(E)];
+    int64_t _inline_storage_alignment;
+  };
+
+  NONCOPYABLE(GrowableArrayWithInlineStorage);
+
+  E* inline_data() {
+    return reinterpret_cast<E*>(_inline_storage);
+  }
+
+  E* allocate() {
+    assert(this->_max > N, "only grows beyond the embedded capacity");
+    return (E*)GrowableArrayCHeapAllocator::allocate(this->_max, sizeof(E), F);
+  }
+
+  void deallocate(E* mem) {
+    if (mem != inline_data()) {
+      GrowableArrayCHeapAllocator::deallocate(mem);
+    }
+  }
+
+public:
+  GrowableArrayWithInlineStorage() :
+      GrowableArrayWithAllocator<E, GrowableArrayWithInlineStorage<E, N, F> >(
+          reinterpret_cast<E*>(_inline_storage), N) {}
+
+  ~GrowableArrayWithInlineStorage() {
+    this->clear_and_deallocate();
+  }
+};
+
 // Custom STL-style iterator to iterate over GrowableArrays
 // It is constructed by invoking GrowableArray::begin() and GrowableArray::end()
 template <typename E>
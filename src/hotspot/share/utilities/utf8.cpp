@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "memory/allocation.hpp"
+#include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/utf8.hpp"
@@ -128,8 +129,33 @@ int UTF8::unicode_length(const char* str, bool& is_latin1, bool& has_multibyte)
   int num_chars = 0;
   has_multibyte = false;
   is_latin1 = true;
+  const char* p = str;
+
+  // ASCII fast path: scan a word at a time while every byte is plain ASCII
+  // (non-zero, high bit clear), counting one unicode char per byte. Align
+  // first so the word loads never read past the page holding the NUL.
+  while (!is_aligned(p, sizeof(uintptr_t)) && *p != '\0' && (*p & 0x80) == 0) {
+    p++;
+    num_chars++;
+  }
+  if (is_aligned(p, sizeof(uintptr_t))) {
+    const uintptr_t ones  = ~(uintptr_t)0 / 0xFF; // 0x0101...01
+    const uintptr_t highs = ones << 7;            // 0x8080...80
+    for (;;) {
+      uintptr_t w = *(const uintptr_t*)p;
+      // Stop at the first word holding a NUL byte or a byte with the high bit set.
+      if ((((w - ones) & ~w) | w) & highs) {
+        break;
+      }
+      p += sizeof(uintptr_t);
+      num_chars += (int)sizeof(uintptr_t);
+    }
+  }
+
+  // Any byte before p is ASCII, so a continuation byte at p cannot have had
+  // a prefix > 0xC3; starting with prev == 0 is correct for the remainder.
   unsigned char prev = 0;
-  for (const char* p = str; *p; p++) {
+  for (; *p; p++) {
     unsigned char c = (*p);
     if ((c & 0xC0) == 0x80) {
       // Multibyte, check if valid latin1 character.
@@ -88,7 +88,11 @@ void GenericWaitBarrier::wait(int barrier_tag) {
     _sem_barrier.wait();
     // We help out with posting, but we need to do so before we decrement the
     // _barrier_threads otherwise we might wake threads up in next wait.
-    GenericWaitBarrier::wake_if_needed();
+    // Posting two wakeups instead of one makes the wakeup propagate as a
+    // tree rather than a chain, which matters with many waiting threads.
+    if (GenericWaitBarrier::wake_if_needed() > 0) {
+      GenericWaitBarrier::wake_if_needed();
+    }
   }
   Atomic::add(&_barrier_threads, -1);
 }
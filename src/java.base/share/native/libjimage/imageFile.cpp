@@ -565,6 +565,23 @@ void ImageFileReader::get_resource(ImageLocation& location, u1* uncompressed_dat
     }
 }
 
+// Return the in-image address of an uncompressed resource in a memory
+// mapped image, NULL otherwise. This allows callers to consume stored
+// resources without copying them out of the mapping.
+const u1* ImageFileReader::get_resource_address(u4 offset) const {
+    if (!memory_map_image) {
+        return NULL;
+    }
+    u1* data = get_location_offset_data(offset);
+    ImageLocation location(data);
+    u8 compressed_size = location.get_attribute(ImageLocation::ATTRIBUTE_COMPRESSED);
+    if (compressed_size != 0) {
+        return NULL;
+    }
+    u8 resource_offset = location.get_attribute(ImageLocation::ATTRIBUTE_OFFSET);
+    return get_data_address() + resource_offset;
+}
+
 // Return the ImageModuleData for this image
 ImageModuleData * ImageFileReader::get_image_module_data() {
     return _module_data;
@@ -578,6 +578,11 @@ public:
     // Return the resource for the supplied path.
     void get_resource(ImageLocation& location, u1* uncompressed_data) const;
 
+    // Return the in-image address of the resource at the supplied location
+    // offset, or NULL if the resource is compressed or the image is not
+    // memory mapped. The returned data is valid as long as the image is open.
+    const u1* get_resource_address(u4 offset) const;
+
     // Return the ImageModuleData for this image
     ImageModuleData * get_image_module_data();
 
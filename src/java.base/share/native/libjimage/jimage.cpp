@@ -162,6 +162,27 @@ JIMAGE_GetResource(JImageFile* image, JImageLocationRef location,
     return size;
 }
 
+/*
+ * JImageGetResourceAddress - Given an open image file (see JImageOpen) and a
+ * location (see JImageFindResource), return the address of the resource data
+ * inside the memory mapped image, or NULL if the resource is compressed or
+ * the image is not memory mapped. The returned data must not be modified and
+ * remains valid until the image is closed (see JImageClose).
+ *
+ * Ex.
+ *  jlong size;
+ *  JImageLocationRef location = (*JImageFindResource)(image,
+ *                                 "java.base", "9.0", "java/lang/String.class", &size);
+ *  const char* data = (*JImageGetResourceAddress)(image, location);
+ *  if (data == NULL) {
+ *      // fall back to JImageGetResource
+ *  }
+ */
+extern "C" JNIEXPORT const char*
+JIMAGE_GetResourceAddress(JImageFile* image, JImageLocationRef location) {
+    return (const char*) ((ImageFileReader*) image)->get_resource_address((u4) location);
+}
+
 /*
  * JImageResourceIterator - Given an open image file (see JImageOpen), a visitor
  * function and a visitor argument, iterator through each of the image's resources.
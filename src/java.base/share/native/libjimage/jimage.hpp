@@ -157,6 +157,27 @@ JIMAGE_GetResource(JImageFile* jimage, JImageLocationRef location,
 typedef jlong(*JImageGetResource_t)(JImageFile* jimage, JImageLocationRef location,
         char* buffer, jlong size);
 
+/*
+ * JImageGetResourceAddress - Given an open image file (see JImageOpen) and a
+ * location (see JImageFindResource), return the address of the resource data
+ * inside the memory mapped image, or NULL if the resource is compressed or
+ * the image is not memory mapped. The returned data must not be modified and
+ * remains valid until the image is closed (see JImageClose).
+ *
+ * Ex.
+ *  jlong size;
+ *  JImageLocationRef location = (*JImageFindResource)(image,
+ *                                 "java.base", "9.0", "java/lang/String.class", &size);
+ *  const char* data = (*JImageGetResourceAddress)(image, location);
+ *  if (data == NULL) {
+ *      // fall back to JImageGetResource
+ *  }
+ */
+extern "C" JNIEXPORT const char*
+JIMAGE_GetResourceAddress(JImageFile* jimage, JImageLocationRef location);
+
+typedef const char* (*JImageGetResourceAddress_t)(JImageFile* jimage, JImageLocationRef location);
+
 
 /*
  * JImageResourceIterator - Given an open image file (see JImageOpen), a visitor
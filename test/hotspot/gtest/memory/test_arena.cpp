@@ -397,3 +397,18 @@ TEST_VM(Arena, different_chunk_sizes) {
     Arena ar7(mtTest, random_arena_chunk_size());
   }
 }
+
+TEST_VM(Arena, peak_size) {
+  Arena ar(mtTest, Chunk::init_size);
+  const size_t initial = ar.size_in_bytes();
+  ASSERT_EQ(ar.peak_size_in_bytes(), initial);
+  // Force the arena to grow; the peak must follow the size.
+  ar.Amalloc(Chunk::size * 2);
+  const size_t grown = ar.size_in_bytes();
+  ASSERT_GT(grown, initial);
+  ASSERT_EQ(ar.peak_size_in_bytes(), grown);
+  // Shrinking the arena again must not lower the peak.
+  ar.destruct_contents();
+  ASSERT_EQ(ar.size_in_bytes(), (size_t)0);
+  ASSERT_EQ(ar.peak_size_in_bytes(), grown);
+}
@@ -26,6 +26,7 @@
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "oops/instanceKlass.hpp"
+#include "oops/markWord.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
@@ -112,3 +113,85 @@ TEST_VM(markWord, printing) {
   }
 }
 #endif // PRODUCT
+
+// Bit-level tests for the hash/age/lock state machine. These guard the
+// header layout against regressions when rebasing: the identity hash, the
+// age bits and (on 64 bit) the narrow klass all live in the same word and
+// must not disturb each other.
+
+TEST(markWord, hash_and_age) {
+  markWord mark = markWord::prototype();
+  EXPECT_TRUE(mark.is_neutral());
+  EXPECT_TRUE(mark.has_no_hash());
+  EXPECT_EQ(mark.age(), 0u);
+
+  const intptr_t hash = (intptr_t)markWord::hash_mask; // largest possible hash
+  markWord hashed = mark.copy_set_hash(hash);
+  EXPECT_TRUE(hashed.is_neutral());
+  EXPECT_FALSE(hashed.has_no_hash());
+  EXPECT_EQ(hashed.hash(), hash);
+
+  // Aging must not disturb the hash, and installing a hash must not
+  // disturb the age.
+  markWord aged = hashed.set_age(markWord::max_age);
+  EXPECT_EQ(aged.age(), markWord::max_age);
+  EXPECT_EQ(aged.hash(), hash);
+  EXPECT_EQ(mark.set_age(markWord::max_age).copy_set_hash(hash).value(), aged.value());
+
+  // incr_age() saturates at max_age.
+  EXPECT_EQ(aged.incr_age().age(), markWord::max_age);
+}
+
+#ifdef _LP64
+TEST(markWord, narrow_klass_disjoint_from_hash) {
+  // With the klass in the header, hash installation and klass updates
+  // must leave each other's bits alone.
+  const narrowKlass nklass = (narrowKlass)0xcafebabe;
+  const intptr_t hash = (intptr_t)markWord::hash_mask;
+
+  markWord mark = markWord::prototype().set_narrow_klass(nklass);
+  EXPECT_TRUE(mark.is_neutral());
+  EXPECT_EQ(mark.narrow_klass(), nklass);
+
+  markWord hashed = mark.copy_set_hash(hash);
+  EXPECT_EQ(hashed.narrow_klass(), nklass);
+  EXPECT_EQ(hashed.hash(), hash);
+  EXPECT_EQ(hashed.set_narrow_klass(0).hash(), hash);
+}
+#endif // _LP64
+
+TEST(markWord, lock_transitions) {
+  markWord mark = markWord::prototype().copy_set_hash(0x51ab5);
+  EXPECT_TRUE(mark.is_unlocked());
+  EXPECT_FALSE(mark.is_locked());
+
+  // Stack lock: a pointer with the two low bits clear.
+  alignas(BytesPerWord) static char lock_storage[BytesPerWord];
+  BasicLock* lock = (BasicLock*)lock_storage;
+  markWord stack_locked = markWord::encode(lock);
+  EXPECT_TRUE(stack_locked.is_locked());
+  EXPECT_TRUE(stack_locked.has_locker());
+  EXPECT_EQ(stack_locked.locker(), lock);
+  EXPECT_FALSE(stack_locked.has_monitor());
+
+  // Inflated lock: monitor pointer tagged with monitor_value.
+  alignas(BytesPerWord) static char monitor_storage[BytesPerWord];
+  ObjectMonitor* monitor = (ObjectMonitor*)monitor_storage;
+  markWord inflated = markWord::encode(monitor);
+  EXPECT_TRUE(inflated.is_locked());
+  EXPECT_TRUE(inflated.has_monitor());
+  EXPECT_FALSE(inflated.has_locker());
+  EXPECT_EQ(inflated.monitor(), monitor);
+
+  // The transient inflation protocol value is all zeros.
+  EXPECT_TRUE(markWord::INFLATING().is_being_inflated());
+  EXPECT_FALSE(mark.is_being_inflated());
+
+  // GC marking round-trip preserves the non-lock bits.
+  markWord marked = mark.set_marked();
+  EXPECT_TRUE(marked.is_marked());
+  EXPECT_FALSE(marked.is_neutral());
+  markWord unmarked = marked.set_unmarked();
+  EXPECT_TRUE(unmarked.is_neutral());
+  EXPECT_EQ(unmarked.value(), mark.value());
+}
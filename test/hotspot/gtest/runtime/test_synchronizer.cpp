@@ -22,9 +22,18 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/vmClasses.hpp"
 #include "memory/allocation.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/oop.inline.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/objectMonitor.inline.hpp"
+#include "runtime/os.hpp"
+#include "runtime/semaphore.inline.hpp"
 #include "runtime/synchronizer.hpp"
 #include "runtime/vm_version.hpp"
+#include "threadHelper.inline.hpp"
 #include "unittest.hpp"
 
 class SynchronizerTest : public ::testing::Test {
@@ -33,6 +42,7 @@ class SynchronizerTest : public ::testing::Test {
     static u_char* get_gvars_hc_sequence_addr() { return ObjectSynchronizer::get_gvars_hc_sequence_addr(); }
     static size_t get_gvars_size() { return ObjectSynchronizer::get_gvars_size(); }
     static u_char* get_gvars_stw_random_addr() { return ObjectSynchronizer::get_gvars_stw_random_addr(); }
+    static size_t in_use_list_count() { return ObjectSynchronizer::_in_use_list.count(); }
 };
 
 TEST_VM(SynchronizerTest, sanity) {
@@ -67,3 +77,108 @@ TEST_VM(SynchronizerTest, sanity) {
             << "sharing.";
   }
 }
+
+// A thread that hammers FastHashCode on a shared object. The first call
+// races with the other hashers to install the hash; all later calls must
+// return the same stable value.
+class HasherThread : public JavaTestThread {
+  oop _obj;
+  intptr_t* _result;
+ public:
+  HasherThread(Semaphore* post, oop obj, intptr_t* result)
+    : JavaTestThread(post), _obj(obj), _result(result) {}
+  virtual ~HasherThread() {}
+
+  void main_run() {
+    JavaThread* THREAD = JavaThread::current();
+    HandleMark hm(THREAD);
+    Handle h_obj(THREAD, _obj);
+    intptr_t hash = ObjectSynchronizer::FastHashCode(THREAD, h_obj());
+    for (int i = 0; i < 10000; i++) {
+      ASSERT_EQ(ObjectSynchronizer::FastHashCode(THREAD, h_obj()), hash);
+    }
+    *_result = hash;
+  }
+};
+
+TEST_VM(SynchronizerTest, fast_hash_code_contended) {
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative invm(THREAD);
+  HandleMark hm(THREAD);
+  Handle h_obj(THREAD, vmClasses::Object_klass()->allocate_instance(THREAD));
+
+  const int num_threads = 4;
+  intptr_t results[num_threads];
+  Semaphore done(0);
+  HasherThread* threads[num_threads];
+  for (int i = 0; i < num_threads; i++) {
+    threads[i] = new HasherThread(&done, h_obj(), &results[i]);
+  }
+  for (int i = 0; i < num_threads; i++) {
+    threads[i]->doit();
+  }
+  for (int i = 0; i < num_threads; i++) {
+    done.wait_with_safepoint_check(THREAD);
+  }
+
+  // All threads must agree on the identity hash, and it must be the one
+  // installed in the header. A hashCode storm on an unlocked object must
+  // be resolved without inflating a monitor.
+  markWord mark = h_obj->mark();
+  ASSERT_TRUE(mark.is_neutral()) << "hashing must not inflate: " << mark.value();
+  ASSERT_NE(mark.hash(), (intptr_t)markWord::no_hash);
+  for (int i = 0; i < num_threads; i++) {
+    EXPECT_EQ(results[i], mark.hash());
+  }
+}
+
+TEST_VM(SynchronizerTest, inflate_deflate_preserves_hash) {
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative invm(THREAD);
+  HandleMark hm(THREAD);
+  Handle h_obj(THREAD, vmClasses::Object_klass()->allocate_instance(THREAD));
+
+  const intptr_t hash = ObjectSynchronizer::FastHashCode(THREAD, h_obj());
+  ASSERT_NE(hash, (intptr_t)markWord::no_hash);
+  const size_t monitors_before = SynchronizerTest::in_use_list_count();
+
+  // Inflation must move the hash into the monitor's displaced header.
+  ObjectMonitor* monitor = ObjectSynchronizer::inflate(THREAD, h_obj(),
+                                                       ObjectSynchronizer::inflate_cause_vm_internal);
+  ASSERT_TRUE(h_obj->mark().has_monitor());
+  EXPECT_EQ(h_obj->mark().monitor(), monitor);
+  EXPECT_EQ(monitor->header().hash(), hash);
+  EXPECT_EQ(ObjectSynchronizer::FastHashCode(THREAD, h_obj()), hash);
+  EXPECT_GE(SynchronizerTest::in_use_list_count(), monitors_before + 1);
+
+  // Deflation of the idle monitor must restore the hash to the header.
+  size_t deflated = ObjectSynchronizer::deflate_idle_monitors(NULL);
+  EXPECT_GE(deflated, (size_t)1);
+  markWord mark = h_obj->mark();
+  ASSERT_FALSE(mark.has_monitor());
+  ASSERT_TRUE(mark.is_neutral());
+  EXPECT_EQ(mark.hash(), hash);
+  EXPECT_EQ(ObjectSynchronizer::FastHashCode(THREAD, h_obj()), hash);
+}
+
+TEST_VM(SynchronizerTest, fast_hash_code_hot_lookup) {
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative invm(THREAD);
+  HandleMark hm(THREAD);
+  Handle h_obj(THREAD, vmClasses::Object_klass()->allocate_instance(THREAD));
+
+  // Microbenchmark for the hot path: looking up an already installed hash.
+  // The timing is informational only; asserting on wall-clock time here
+  // would make the test environment-dependent.
+  const intptr_t hash = ObjectSynchronizer::FastHashCode(THREAD, h_obj());
+  const int iterations = 1000000;
+  intptr_t sum = 0;
+  jlong start = os::javaTimeNanos();
+  for (int i = 0; i < iterations; i++) {
+    sum += ObjectSynchronizer::FastHashCode(THREAD, h_obj());
+  }
+  jlong elapsed = os::javaTimeNanos() - start;
+  EXPECT_EQ(sum, hash * iterations);
+  tty->print_cr("FastHashCode hot lookup: %d iterations in " JLONG_FORMAT " ns (" JLONG_FORMAT " ns/op)",
+                iterations, elapsed, elapsed / iterations);
+}
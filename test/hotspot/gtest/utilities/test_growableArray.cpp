@@ -555,3 +555,30 @@ TEST(GrowableArrayCHeap, sanity) {
     delete a;
   }
 }
+
+TEST(GrowableArrayWithInlineStorage, sanity) {
+  GrowableArrayWithInlineStorage<int, 4, mtTest> a;
+  ASSERT_TRUE(a.is_empty());
+  ASSERT_EQ(a.max_length(), 4);
+
+  // Fill the embedded storage; the data array must not move.
+  a.append(0);
+  int* embedded_data = a.adr_at(0);
+  for (int i = 1; i < 4; i++) {
+    a.append(i);
+  }
+  ASSERT_EQ(a.adr_at(0), embedded_data);
+
+  // Grow beyond the embedded capacity and check the contents survived.
+  for (int i = 4; i < 100; i++) {
+    a.append(i);
+  }
+  ASSERT_NE(a.adr_at(0), embedded_data);
+  ASSERT_EQ(a.length(), 100);
+  for (int i = 0; i < 100; i++) {
+    ASSERT_EQ(a.at(i), i);
+  }
+
+  a.clear();
+  ASSERT_TRUE(a.is_empty());
+}